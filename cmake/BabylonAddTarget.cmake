@@ -87,3 +87,28 @@ macro(babylon_add_test TARGET)
     get_target_property(sources ${TARGET} SOURCES)
     source_group_by_path_all(${CMAKE_CURRENT_SOURCE_DIR} ${sources})
 endmacro()
+
+macro(babylon_add_benchmark TARGET)
+    message("babylon_add_benchmark ${TARGET}")
+    add_executable(${TARGET} ${ARGN})
+    # Create namespaced alias
+    add_executable(${META_PROJECT_NAME}::${TARGET} ALIAS ${TARGET})
+
+    target_link_libraries(${TARGET} PRIVATE benchmark::benchmark benchmark::benchmark_main)
+    babylon_target_clang_tidy(${TARGET})
+
+    # Run the benchmarks and write the results as JSON, to track them between releases
+    add_custom_target(${TARGET}_json
+        COMMAND ${TARGET}
+                --benchmark_out=${CMAKE_BINARY_DIR}/${TARGET}.json
+                --benchmark_out_format=json
+        DEPENDS ${TARGET}
+        WORKING_DIRECTORY ${CMAKE_CURRENT_BINARY_DIR}
+        COMMENT "Running ${TARGET}, writing ${CMAKE_BINARY_DIR}/${TARGET}.json"
+        USES_TERMINAL
+    )
+
+    # group sources
+    get_target_property(sources ${TARGET} SOURCES)
+    source_group_by_path_all(${CMAKE_CURRENT_SOURCE_DIR} ${sources})
+endmacro()
@@ -0,0 +1,58 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "benchmark_utils.h"
+
+#include <babylon/animations/animation.h>
+#include <babylon/animations/ianimation_key.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+void AnimateTransformNodes(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  // Frame independent results
+  scene->useConstantAnimationDeltaTime = true;
+
+  // Position and rotation animations of 60 keys, shared by all the nodes
+  std::vector<IAnimationKey> positionKeys;
+  std::vector<IAnimationKey> rotationKeys;
+  for (unsigned int frame = 0; frame < 60; ++frame) {
+    const auto angle = static_cast<float>(frame) * 0.1f;
+    positionKeys.emplace_back(
+      IAnimationKey(static_cast<float>(frame),
+                    AnimationValue(Vector3(std::cos(angle), std::sin(angle), 0.f))));
+    rotationKeys.emplace_back(
+      IAnimationKey(static_cast<float>(frame),
+                    AnimationValue(Quaternion::RotationYawPitchRoll(angle, 0.f, 0.f))));
+  }
+  auto positionAnimation
+    = Animation::New("position", "position", 30, Animation::ANIMATIONTYPE_VECTOR3);
+  positionAnimation->setKeys(positionKeys);
+  auto rotationAnimation = Animation::New("rotation", "rotationQuaternion", 30,
+                                          Animation::ANIMATIONTYPE_QUATERNION);
+  rotationAnimation->setKeys(rotationKeys);
+
+  std::vector<TransformNodePtr> nodes;
+  for (int64_t index = 0; index < state.range(0); ++index) {
+    auto node = TransformNode::New("node", scene.get());
+    node->animations.emplace_back(positionAnimation);
+    node->animations.emplace_back(rotationAnimation);
+    scene->beginAnimation(node, 0.f, 59.f, true);
+    nodes.emplace_back(node);
+  }
+
+  for (auto _ : state) {
+    scene->animate();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * 2);
+}
+BENCHMARK(AnimateTransformNodes)->Arg(100)->Arg(1000);
+
+} // end of anonymous namespace
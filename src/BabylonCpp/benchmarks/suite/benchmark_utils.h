@@ -0,0 +1,24 @@
+#ifndef BABYLON_BENCHMARK_UTILS_H
+#define BABYLON_BENCHMARK_UTILS_H
+
+#include <babylon/engines/null_engine.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Creates the engine used by the benchmarks of a scene, without rendering context.
+ */
+inline std::unique_ptr<Engine> createBenchmarkEngine()
+{
+  NullEngineOptions options;
+  options.renderHeight          = 256;
+  options.renderWidth           = 256;
+  options.textureSize           = 256;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  return NullEngine::New(options);
+}
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_BENCHMARK_UTILS_H
@@ -0,0 +1,107 @@
+#include <benchmark/benchmark.h>
+
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/csg/node.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+std::unique_ptr<BABYLON::VertexData> CreateSphere(unsigned int segments, float offset)
+{
+  using namespace BABYLON;
+
+  SphereOptions options;
+  options.segments = segments;
+  options.diameter = 1.f;
+  auto vertexData  = VertexData::CreateSphere(options);
+  for (size_t i = 0; i < vertexData->positions.size(); i += 3) {
+    vertexData->positions[i] += offset;
+  }
+  return vertexData;
+}
+
+std::vector<BABYLON::CSG::Polygon> ToPolygons(const BABYLON::VertexData& vertexData)
+{
+  using namespace BABYLON;
+
+  std::vector<CSG::Polygon> polygons;
+  const auto& indices = vertexData.indices;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    std::vector<CSG::Vertex> vertices;
+    for (size_t j = 0; j < 3; ++j) {
+      vertices.emplace_back(Vector3::FromArray(vertexData.positions, indices[i + j] * 3),
+                            Vector3::FromArray(vertexData.normals, indices[i + j] * 3),
+                            Vector2::FromArray(vertexData.uvs, indices[i + j] * 2));
+    }
+    CSG::Polygon polygon(vertices, CSG::PolygonOptions{});
+    if (polygon.plane.first) {
+      polygons.emplace_back(std::move(polygon));
+    }
+  }
+  return polygons;
+}
+
+// Operation between two overlapping spheres of increasing resolution
+template <typename Operation>
+void CSGOperation(benchmark::State& state, const Operation& operation)
+{
+  using namespace BABYLON;
+
+  const auto segments = static_cast<unsigned int>(state.range(0));
+  const auto a        = CreateSphere(segments, 0.f);
+  const auto b        = CreateSphere(segments, 0.5f);
+  const auto csgA     = CSG::CSG::FromVertexData(*a);
+  const auto csgB     = CSG::CSG::FromVertexData(*b);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(operation(*csgA, csgB));
+  }
+  state.SetItemsProcessed(state.iterations()
+                          * static_cast<int64_t>((a->indices.size() + b->indices.size()) / 3));
+}
+
+void CSGUnion(benchmark::State& state)
+{
+  CSGOperation(state, [](auto& csgA, const auto& csgB) { return csgA._union(csgB); });
+}
+BENCHMARK(CSGUnion)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMicrosecond);
+
+void CSGSubtract(benchmark::State& state)
+{
+  CSGOperation(state, [](auto& csgA, const auto& csgB) { return csgA.subtract(csgB); });
+}
+BENCHMARK(CSGSubtract)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMicrosecond);
+
+void CSGIntersect(benchmark::State& state)
+{
+  CSGOperation(state, [](auto& csgA, const auto& csgB) { return csgA.intersect(csgB); });
+}
+BENCHMARK(CSGIntersect)->RangeMultiplier(2)->Range(8, 128)->Unit(benchmark::kMicrosecond);
+
+// Union through the recursive BSP tree clipping of csg.js, whose recursion overflows the stack on
+// larger inputs
+void CSGUnionBSPTree(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto segments  = static_cast<unsigned int>(state.range(0));
+  const auto a         = CreateSphere(segments, 0.f);
+  const auto b         = CreateSphere(segments, 0.5f);
+  const auto polygonsA = ToPolygons(*a);
+  const auto polygonsB = ToPolygons(*b);
+  for (auto _ : state) {
+    CSG::Node nodeA(polygonsA), nodeB(polygonsB);
+    nodeA.clipTo(nodeB);
+    nodeB.clipTo(nodeA);
+    nodeB.invert();
+    nodeB.clipTo(nodeA);
+    nodeB.invert();
+    nodeA.build(nodeB.allPolygons());
+    benchmark::DoNotOptimize(nodeA.allPolygons());
+  }
+  state.SetItemsProcessed(state.iterations()
+                          * static_cast<int64_t>((a->indices.size() + b->indices.size()) / 3));
+}
+BENCHMARK(CSGUnionBSPTree)->Arg(8)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
@@ -0,0 +1,106 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+
+#include <babylon/core/delegates/delegate.h>
+
+namespace {
+
+struct Sample {
+  double A(int)
+  {
+    return 0.1;
+  }
+}; // end of struct Sample
+
+// Delegates compared to std::function, created from an instance method or from a lambda, then
+// called
+void DelegateMethodCreation(benchmark::State& state)
+{
+  Sample sample;
+  SA::delegate<double(int)> delegate;
+  for (auto _ : state) {
+    delegate = SA::delegate<double(int)>::create<Sample, &Sample::A>(&sample);
+    benchmark::DoNotOptimize(delegate);
+  }
+}
+BENCHMARK(DelegateMethodCreation);
+
+void FunctionMethodCreation(benchmark::State& state)
+{
+  using namespace std::placeholders;
+
+  Sample sample;
+  std::function<double(int)> function;
+  for (auto _ : state) {
+    function = std::bind(&Sample::A, &sample, _1);
+    benchmark::DoNotOptimize(function);
+  }
+}
+BENCHMARK(FunctionMethodCreation);
+
+void DelegateLambdaCreation(benchmark::State& state)
+{
+  auto lambda = [](int) -> double { return 0.0; };
+  SA::delegate<double(int)> delegate;
+  for (auto _ : state) {
+    delegate = SA::delegate<double(int)>::create<decltype(lambda)>(lambda);
+    benchmark::DoNotOptimize(delegate);
+  }
+}
+BENCHMARK(DelegateLambdaCreation);
+
+void FunctionLambdaCreation(benchmark::State& state)
+{
+  auto lambda = [](int) -> double { return 0.0; };
+  std::function<double(int)> function;
+  for (auto _ : state) {
+    function = std::function<double(int)>(lambda);
+    benchmark::DoNotOptimize(function);
+  }
+}
+BENCHMARK(FunctionLambdaCreation);
+
+void DelegateMethodCall(benchmark::State& state)
+{
+  Sample sample;
+  const auto delegate = SA::delegate<double(int)>::create<Sample, &Sample::A>(&sample);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(delegate(11));
+  }
+}
+BENCHMARK(DelegateMethodCall);
+
+void FunctionMethodCall(benchmark::State& state)
+{
+  using namespace std::placeholders;
+
+  Sample sample;
+  const std::function<double(int)> function = std::bind(&Sample::A, &sample, _1);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(function(11));
+  }
+}
+BENCHMARK(FunctionMethodCall);
+
+void DelegateLambdaCall(benchmark::State& state)
+{
+  auto lambda         = [](int) -> double { return 0.0; };
+  const auto delegate = SA::delegate<double(int)>::create<decltype(lambda)>(lambda);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(delegate(11));
+  }
+}
+BENCHMARK(DelegateLambdaCall);
+
+void FunctionLambdaCall(benchmark::State& state)
+{
+  auto lambda = [](int) -> double { return 0.0; };
+  const std::function<double(int)> function(lambda);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(function(11));
+  }
+}
+BENCHMARK(FunctionLambdaCall);
+
+} // end of anonymous namespace
@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <array>
+#include <cmath>
+
+#include <babylon/rendering/edges_renderer.h>
+
+namespace {
+
+// Grid of size x size quads on a wavy surface, the rows sharing their vertices
+void CreateGrid(unsigned int subdivisions, BABYLON::Float32Array& positions,
+                BABYLON::IndicesArray& indices)
+{
+  for (unsigned int row = 0; row <= subdivisions; ++row) {
+    for (unsigned int col = 0; col <= subdivisions; ++col) {
+      const auto x = static_cast<float>(col), z = static_cast<float>(row);
+      positions.insert(positions.end(), {x, std::sin(x * 0.1f) * std::cos(z * 0.1f), z});
+    }
+  }
+  for (unsigned int row = 0; row < subdivisions; ++row) {
+    for (unsigned int col = 0; col < subdivisions; ++col) {
+      const auto a = row * (subdivisions + 1) + col, b = a + 1;
+      const auto c = a + subdivisions + 1, d = c + 1;
+      indices.insert(indices.end(), {a, b, d, a, d, c});
+    }
+  }
+}
+
+// Nested loop over the pairs of faces, which the renderer used before the hash map
+std::vector<std::array<int, 3>> PairwiseAdjacencies(const BABYLON::IndicesArray& indices)
+{
+  const auto faceCount = indices.size() / 3;
+  std::vector<std::array<int, 3>> adjacencies(faceCount, {{-1, -1, -1}});
+  for (size_t face = 0; face < faceCount; ++face) {
+    for (size_t edge = 0; edge < 3; ++edge) {
+      const auto a = indices[face * 3 + edge], b = indices[face * 3 + (edge + 1) % 3];
+      for (auto other = face + 1; other < faceCount && adjacencies[face][edge] == -1; ++other) {
+        for (size_t otherEdge = 0; otherEdge < 3; ++otherEdge) {
+          const auto c = indices[other * 3 + otherEdge];
+          const auto d = indices[other * 3 + (otherEdge + 1) % 3];
+          if ((a == c && b == d) || (a == d && b == c)) {
+            adjacencies[face][edge]       = static_cast<int>(other);
+            adjacencies[other][otherEdge] = static_cast<int>(face);
+          }
+        }
+      }
+    }
+  }
+  return adjacencies;
+}
+
+// Adjacency computation, linear in the face count, matching the edges by index (0) or by welded
+// vertex position (1)
+void EdgesRendererComputeFaceAdjacencies(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateGrid(static_cast<unsigned int>(state.range(0)), positions, indices);
+  const auto checkVertices = state.range(1) != 0;
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+      EdgesRenderer::ComputeFaceAdjacencies(positions, indices, checkVertices));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size() / 3));
+}
+BENCHMARK(EdgesRendererComputeFaceAdjacencies)
+  ->ArgsProduct({{32, 100, 316, 1000}, {0, 1}})
+  ->Unit(benchmark::kMillisecond);
+
+void EdgesRendererPairwiseAdjacencies(benchmark::State& state)
+{
+  BABYLON::Float32Array positions;
+  BABYLON::IndicesArray indices;
+  CreateGrid(static_cast<unsigned int>(state.range(0)), positions, indices);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(PairwiseAdjacencies(indices));
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size() / 3));
+}
+BENCHMARK(EdgesRendererPairwiseAdjacencies)->Arg(32)->Arg(100)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
@@ -0,0 +1,78 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.h"
+
+#include <babylon/culling/ray.h>
+#include <babylon/engines/scene.h>
+#include <babylon/maths/functions.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+// Reads the vertex data of a dense sphere, through copies (getVerticesData / getIndices) or views
+// (getVerticesDataView / getIndicesView)
+template <typename Function>
+void GeometryDataAccess(benchmark::State& state, const Function& function)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions options;
+  options.segments = 256;
+  auto sphere      = SphereBuilder::CreateSphere("sphere", options, scene.get());
+  for (auto _ : state) {
+    function(*sphere);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(sphere->getTotalIndices()));
+}
+
+void GeometryBoundsCopy(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GeometryDataAccess(state, [](Mesh& sphere) {
+    const auto positions = sphere.getVerticesData(VertexBuffer::PositionKind);
+    const auto indices   = sphere.getIndices();
+    benchmark::DoNotOptimize(
+      extractMinAndMaxIndexed(positions, indices, 0, sphere.getTotalIndices()));
+  });
+}
+BENCHMARK(GeometryBoundsCopy)->Unit(benchmark::kMicrosecond);
+
+void GeometryBoundsView(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GeometryDataAccess(state, [](Mesh& sphere) {
+    const auto positions = sphere.getVerticesDataView(VertexBuffer::PositionKind);
+    const auto indices   = sphere.getIndicesView();
+    benchmark::DoNotOptimize(
+      extractMinAndMaxIndexed(positions, indices, 0, sphere.getTotalIndices()));
+  });
+}
+BENCHMARK(GeometryBoundsView)->Unit(benchmark::kMicrosecond);
+
+void MeshRefreshBoundingInfo(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GeometryDataAccess(state, [](Mesh& sphere) { sphere.refreshBoundingInfo(false); });
+}
+BENCHMARK(MeshRefreshBoundingInfo)->Unit(benchmark::kMicrosecond);
+
+void MeshIntersectsRay(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Ray ray(Vector3(0.f, 0.f, -10.f), Vector3(0.f, 0.f, 1.f));
+  GeometryDataAccess(state, [&ray](Mesh& sphere) {
+    benchmark::DoNotOptimize(sphere.intersects(ray, false).distance);
+  });
+}
+BENCHMARK(MeshIntersectsRay)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
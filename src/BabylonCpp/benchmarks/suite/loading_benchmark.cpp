@@ -0,0 +1,84 @@
+#include <benchmark/benchmark.h>
+
+#include <functional>
+#include <sstream>
+
+#include "benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/loading/plugins/babylon/babylon_file_loader.h>
+
+namespace {
+
+/**
+ * @brief Returns a .babylon scene of "meshCount" grids of "size" x "size" vertices.
+ */
+std::string BabylonScene(unsigned int meshCount, unsigned int size)
+{
+  const auto writeArray = [](std::ostringstream& stream, const char* name, unsigned int count,
+                             const std::function<void(unsigned int index)>& write) {
+    stream << "\"" << name << "\":[";
+    for (unsigned int index = 0; index < count; ++index) {
+      if (index > 0) {
+        stream << ",";
+      }
+      write(index);
+    }
+    stream << "]";
+  };
+
+  std::ostringstream stream;
+  stream << "{\"meshes\":[";
+  for (unsigned int meshIndex = 0; meshIndex < meshCount; ++meshIndex) {
+    stream << (meshIndex > 0 ? "," : "") << "{\"name\":\"mesh" << meshIndex << "\",\"id\":\"mesh"
+           << meshIndex << "\",\"position\":[" << meshIndex << ",0,0],";
+    writeArray(stream, "positions", size * size * 3, [&](unsigned int index) {
+      const auto vertex = index / 3;
+      stream << (index % 3 == 0 ? vertex % size : index % 3 == 1 ? 0 : vertex / size);
+    });
+    stream << ",";
+    writeArray(stream, "normals", size * size * 3,
+               [&](unsigned int index) { stream << (index % 3 == 1 ? 1 : 0); });
+    stream << ",";
+    writeArray(stream, "uvs", size * size * 2, [&](unsigned int index) {
+      const auto vertex = index / 2;
+      stream << static_cast<float>(index % 2 == 0 ? vertex % size : vertex / size) / (size - 1);
+    });
+    stream << ",";
+    writeArray(stream, "indices", (size - 1) * (size - 1) * 6, [&](unsigned int index) {
+      const auto quad    = index / 6;
+      const auto topLeft = quad / (size - 1) * size + quad % (size - 1);
+      const unsigned int offsets[6]{size + 1, size, 0, 1, size + 1, 0};
+      stream << topLeft + offsets[index % 6];
+    });
+    stream << "}";
+  }
+  stream << "]}";
+  return stream.str();
+}
+
+void LoadBabylonFile(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto data = BabylonScene(static_cast<unsigned int>(state.range(0)), 64);
+  auto engine     = createBenchmarkEngine();
+  BabylonFileLoader loader;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto scene = Scene::New(engine.get());
+    state.ResumeTiming();
+
+    // Parsing of the json data and creation of the meshes
+    benchmark::DoNotOptimize(loader.load(scene.get(), data, ""));
+
+    state.PauseTiming();
+    scene->dispose();
+    scene.reset();
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(LoadBabylonFile)->Arg(10)->Arg(100)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
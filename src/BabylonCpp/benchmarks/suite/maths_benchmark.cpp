@@ -0,0 +1,112 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+#include <vector>
+
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/quaternion.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+std::vector<BABYLON::Matrix> RandomMatrices(size_t count)
+{
+  using namespace BABYLON;
+
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> distribution(-1.f, 1.f);
+  std::vector<Matrix> matrices(count);
+  for (auto& matrix : matrices) {
+    Matrix::ComposeToRef(Vector3(1.f + distribution(generator) * 0.5f, 1.f, 1.f),
+                         Quaternion::RotationYawPitchRoll(distribution(generator),
+                                                          distribution(generator),
+                                                          distribution(generator)),
+                         Vector3(distribution(generator), distribution(generator),
+                                 distribution(generator)),
+                         matrix);
+  }
+  return matrices;
+}
+
+void MatrixMultiply(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto matrices = RandomMatrices(1024);
+  Matrix result;
+  for (auto _ : state) {
+    for (size_t index = 0; index + 1 < matrices.size(); ++index) {
+      matrices[index].multiplyToRef(matrices[index + 1], result);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(matrices.size() - 1));
+}
+BENCHMARK(MatrixMultiply);
+
+void MatrixInvert(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto matrices = RandomMatrices(1024);
+  Matrix result;
+  for (auto _ : state) {
+    for (auto& matrix : matrices) {
+      matrix.invertToRef(result);
+      benchmark::DoNotOptimize(result);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(matrices.size()));
+}
+BENCHMARK(MatrixInvert);
+
+void MatrixCompose(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const Vector3 scaling(1.f, 2.f, 3.f);
+  const Vector3 translation(4.f, 5.f, 6.f);
+  auto rotation = Quaternion::RotationYawPitchRoll(0.1f, 0.2f, 0.3f);
+  Matrix result;
+  for (auto _ : state) {
+    Matrix::ComposeToRef(scaling, rotation, translation, result);
+    benchmark::DoNotOptimize(result);
+  }
+}
+BENCHMARK(MatrixCompose);
+
+void Vector3TransformCoordinates(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto count     = static_cast<size_t>(state.range(0));
+  const auto transform = RandomMatrices(1).front();
+  std::vector<Vector3> positions(count, Vector3(1.f, 2.f, 3.f));
+  std::vector<Vector3> results(count);
+  for (auto _ : state) {
+    for (size_t index = 0; index < count; ++index) {
+      Vector3::TransformCoordinatesToRef(positions[index], transform, results[index]);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(count));
+}
+BENCHMARK(Vector3TransformCoordinates)->Arg(1024)->Arg(65536);
+
+void QuaternionSlerp(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto left  = Quaternion::RotationYawPitchRoll(0.1f, 0.2f, 0.3f);
+  const auto right = Quaternion::RotationYawPitchRoll(1.1f, -0.7f, 2.3f);
+  Quaternion result;
+  auto amount = 0.f;
+  for (auto _ : state) {
+    Quaternion::SlerpToRef(left, right, amount, result);
+    benchmark::DoNotOptimize(result);
+    amount = amount < 1.f ? amount + 0.001f : 0.f;
+  }
+}
+BENCHMARK(QuaternionSlerp);
+
+} // end of anonymous namespace
@@ -0,0 +1,100 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/builders/sphere_builder.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_optimizer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+// Ground from a procedural height map
+std::unique_ptr<BABYLON::VertexData> CreateGroundVertexData()
+{
+  using namespace BABYLON;
+
+  constexpr unsigned int bufferSize = 512;
+  GroundFromHeightMapOptions groundOptions;
+  groundOptions.width        = 100.f;
+  groundOptions.height       = 100.f;
+  groundOptions.subdivisions = 256;
+  groundOptions.minHeight    = 0.f;
+  groundOptions.maxHeight    = 10.f;
+  groundOptions.bufferWidth  = bufferSize;
+  groundOptions.bufferHeight = bufferSize;
+  groundOptions.buffer.resize(bufferSize * bufferSize * 4);
+  for (unsigned int y = 0; y < bufferSize; ++y) {
+    for (unsigned int x = 0; x < bufferSize; ++x) {
+      const auto value = 0.5f + 0.25f * (std::sin(x * 0.05f) + std::cos(y * 0.07f));
+      auto* pixel      = &groundOptions.buffer[(y * bufferSize + x) * 4];
+      pixel[0] = pixel[1] = pixel[2] = static_cast<uint8_t>(value * 255.f);
+      pixel[3]                       = 255;
+    }
+  }
+  return VertexData::CreateGroundFromHeightMap(groundOptions);
+}
+
+void SetCounters(benchmark::State& state, const BABYLON::MeshOptimizerStatistics& statistics)
+{
+  state.counters["verticesBefore"] = static_cast<double>(statistics.verticesBefore);
+  state.counters["verticesAfter"]  = static_cast<double>(statistics.verticesAfter);
+  state.counters["acmrBefore"]     = statistics.acmrBefore;
+  state.counters["acmrAfter"]      = statistics.acmrAfter;
+  state.counters["atvrBefore"]     = statistics.atvrBefore;
+  state.counters["atvrAfter"]      = statistics.atvrAfter;
+}
+
+// Ground created from a height map, with the Forsyth (0) or Tipsify (1) vertex cache optimization
+void MeshOptimizerGround(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine                 = createBenchmarkEngine();
+  auto scene                  = Scene::New(engine.get());
+  const auto groundVertexData = CreateGroundVertexData();
+  auto ground                 = Mesh::New("ground", scene.get());
+  MeshOptimizerOptions options;
+  options.vertexCacheOptimizationType = state.range(0) == 0 ? VertexCacheOptimizationType::FORSYTH :
+                                                              VertexCacheOptimizationType::TIPSIFY;
+  MeshOptimizerStatistics statistics;
+  for (auto _ : state) {
+    state.PauseTiming();
+    groundVertexData->applyToMesh(*ground);
+    state.ResumeTiming();
+    statistics = MeshOptimizer::OptimizeMesh(ground.get(), options);
+  }
+  SetCounters(state, statistics);
+}
+BENCHMARK(MeshOptimizerGround)->Arg(0)->Arg(1)->Unit(benchmark::kMillisecond);
+
+// Unwelded sphere, every triangle having its own vertices, similar to what exporters commonly
+// produce for loaded files
+void MeshOptimizerUnweldedSphere(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions sphereOptions;
+  sphereOptions.segments = 128;
+  MeshOptimizerStatistics statistics;
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto sphere = SphereBuilder::CreateSphere("sphere", sphereOptions, scene.get());
+    sphere->convertToUnIndexedMesh();
+    state.ResumeTiming();
+    statistics = MeshOptimizer::OptimizeMesh(sphere.get());
+    state.PauseTiming();
+    sphere->dispose();
+    state.ResumeTiming();
+  }
+  SetCounters(state, statistics);
+}
+BENCHMARK(MeshOptimizerUnweldedSphere)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
@@ -0,0 +1,178 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include "benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/facet_parameters.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+// Wavy ground of size x size vertices
+void CreateWavyGround(unsigned int size, BABYLON::Float32Array& positions,
+                      BABYLON::IndicesArray& indices)
+{
+  positions.reserve(size * size * 3);
+  indices.reserve((size - 1) * (size - 1) * 6);
+  for (unsigned int row = 0; row < size; ++row) {
+    for (unsigned int col = 0; col < size; ++col) {
+      positions.insert(positions.end(), {static_cast<float>(col),
+                                         std::sin(col * 0.05f) * std::cos(row * 0.07f),
+                                         static_cast<float>(row)});
+    }
+  }
+  for (unsigned int row = 0; row + 1 < size; ++row) {
+    for (unsigned int col = 0; col + 1 < size; ++col) {
+      const auto topLeft    = row * size + col;
+      const auto bottomLeft = topLeft + size;
+      indices.insert(indices.end(), {bottomLeft + 1, bottomLeft, topLeft, //
+                                     topLeft + 1, bottomLeft + 1, topLeft});
+    }
+  }
+}
+
+// Reference single threaded accumulation of the facet normals
+void ComputeNormalsSequential(const BABYLON::Float32Array& positions,
+                              const BABYLON::IndicesArray& indices, BABYLON::Float32Array& normals)
+{
+  normals.assign(positions.size(), 0.f);
+  for (size_t index = 0; index < indices.size(); index += 3) {
+    const auto* p1 = &positions[indices[index] * 3];
+    const auto* p2 = &positions[indices[index + 1] * 3];
+    const auto* p3 = &positions[indices[index + 2] * 3];
+    const float p1p2x = p1[0] - p2[0], p1p2y = p1[1] - p2[1], p1p2z = p1[2] - p2[2];
+    const float p3p2x = p3[0] - p2[0], p3p2y = p3[1] - p2[1], p3p2z = p3[2] - p2[2];
+    auto x            = p1p2y * p3p2z - p1p2z * p3p2y;
+    auto y            = p1p2z * p3p2x - p1p2x * p3p2z;
+    auto z            = p1p2x * p3p2y - p1p2y * p3p2x;
+    auto length       = std::sqrt(x * x + y * y + z * z);
+    length            = (length == 0.f) ? 1.f : length;
+    for (size_t corner = 0; corner < 3; ++corner) {
+      auto* normal = &normals[indices[index + corner] * 3];
+      normal[0] += x / length;
+      normal[1] += y / length;
+      normal[2] += z / length;
+    }
+  }
+  for (size_t index = 0; index < normals.size(); index += 3) {
+    auto length = std::sqrt(normals[index] * normals[index]
+                            + normals[index + 1] * normals[index + 1]
+                            + normals[index + 2] * normals[index + 2]);
+    length      = (length == 0.f) ? 1.f : length;
+    normals[index] /= length;
+    normals[index + 1] /= length;
+    normals[index + 2] /= length;
+  }
+}
+
+void ComputeNormals(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateWavyGround(static_cast<unsigned int>(state.range(0)), positions, indices);
+  Float32Array normals;
+  for (auto _ : state) {
+    VertexData::ComputeNormals(positions, indices, normals);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size() / 3));
+}
+BENCHMARK(ComputeNormals)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void ComputeNormalsReference(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateWavyGround(static_cast<unsigned int>(state.range(0)), positions, indices);
+  Float32Array normals;
+  for (auto _ : state) {
+    ComputeNormalsSequential(positions, indices, normals);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(indices.size() / 3));
+}
+BENCHMARK(ComputeNormalsReference)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void ComputeNormalsWithFacetData(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateWavyGround(static_cast<unsigned int>(state.range(0)), positions, indices);
+  const auto faceCount = indices.size() / 3;
+  FacetParameters facetParameters;
+  facetParameters.facetNormals.resize(faceCount);
+  facetParameters.facetPositions.resize(faceCount);
+  facetParameters.depthSort = true;
+  Float32Array normals;
+  for (auto _ : state) {
+    VertexData::ComputeNormals(positions, indices, normals, &facetParameters);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(faceCount));
+}
+BENCHMARK(ComputeNormalsWithFacetData)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond);
+
+void CreateSphereVertexData(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  SphereOptions options;
+  options.segments = static_cast<unsigned int>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(VertexData::CreateSphere(options));
+  }
+}
+BENCHMARK(CreateSphereVertexData)->Arg(32)->Arg(256);
+
+void CreateTorusVertexData(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  TorusOptions options;
+  options.tessellation = static_cast<unsigned int>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(VertexData::CreateTorus(options));
+  }
+}
+BENCHMARK(CreateTorusVertexData)->Arg(32)->Arg(256);
+
+void CreateGroundVertexData(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GroundOptions options;
+  options.subdivisions = static_cast<unsigned int>(state.range(0));
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(VertexData::CreateGround(options));
+  }
+}
+BENCHMARK(CreateGroundVertexData)->Arg(32)->Arg(256);
+
+void MeshBuilderCreateSphere(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  // Includes the creation of the geometry, its vertex buffers and bounding info
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+  SphereOptions options;
+  options.segments = static_cast<unsigned int>(state.range(0));
+  for (auto _ : state) {
+    auto sphere = MeshBuilder::CreateSphere("sphere", options, scene.get());
+    sphere->dispose();
+  }
+}
+BENCHMARK(MeshBuilderCreateSphere)->Arg(32)->Arg(256);
+
+} // end of anonymous namespace
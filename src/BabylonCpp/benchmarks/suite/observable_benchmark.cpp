@@ -0,0 +1,72 @@
+#include <benchmark/benchmark.h>
+
+#include <babylon/misc/compact_observable.h>
+#include <babylon/misc/observable.h>
+
+namespace {
+
+void ObservableNotify(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Observable<int> observable;
+  int sum = 0;
+  for (int64_t index = 0; index < state.range(0); ++index) {
+    observable.add([&sum](int* value, EventState&) { sum += *value; });
+  }
+  int value = 1;
+  for (auto _ : state) {
+    observable.notifyObservers(&value);
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ObservableNotify)->Arg(0)->Arg(1)->Arg(16)->Arg(256);
+
+void CompactObservableNotify(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  int sum = 0;
+  for (int64_t index = 0; index < state.range(0); ++index) {
+    observable.add([&sum](int* value, EventState&) { sum += *value; });
+  }
+  int value = 1;
+  for (auto _ : state) {
+    observable.notifyObservers(&value);
+  }
+  benchmark::DoNotOptimize(sum);
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(CompactObservableNotify)->Arg(0)->Arg(1)->Arg(16)->Arg(256);
+
+void ObservableAddRemove(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  Observable<int> observable;
+  int sum = 0;
+  for (auto _ : state) {
+    auto observer = observable.add([&sum](int* value, EventState&) { sum += *value; });
+    observable.remove(observer);
+  }
+  benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(ObservableAddRemove);
+
+void CompactObservableAddRemove(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  int sum = 0;
+  for (auto _ : state) {
+    auto observer = observable.add([&sum](int* value, EventState&) { sum += *value; });
+    observable.remove(observer);
+  }
+  benchmark::DoNotOptimize(sum);
+}
+BENCHMARK(CompactObservableAddRemove);
+
+} // end of anonymous namespace
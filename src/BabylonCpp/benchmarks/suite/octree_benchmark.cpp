@@ -0,0 +1,131 @@
+#include <benchmark/benchmark.h>
+
+#include <random>
+
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/culling/octrees/octree_block.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/plane.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+/**
+ * @brief Octree of points, the entries being addresses in an array of positions.
+ */
+struct PointOctree {
+  using Entry = BABYLON::AbstractMesh*;
+
+  explicit PointOctree(size_t pointCount)
+      : positions(pointCount)
+      , octree{[](Entry& entry, BABYLON::OctreeBlock<Entry>& block) {
+                 const auto& position = *reinterpret_cast<const BABYLON::Vector3*>(entry);
+                 const auto &min = block.minPoint(), &max = block.maxPoint();
+                 if (position.x >= min.x && position.x <= max.x && position.y >= min.y
+                     && position.y <= max.y && position.z >= min.z && position.z <= max.z) {
+                   block.entries.emplace_back(entry);
+                 }
+               },
+               64, 5}
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-100.f, 100.f);
+    std::vector<Entry> entries;
+    for (auto& position : positions) {
+      position = BABYLON::Vector3(distribution(generator), distribution(generator),
+                                  distribution(generator));
+      entries.emplace_back(reinterpret_cast<Entry>(&position));
+    }
+    octree.update(BABYLON::Vector3(-100.f, -100.f, -100.f),
+                  BABYLON::Vector3(100.f, 100.f, 100.f), entries);
+  }
+
+  std::vector<BABYLON::Vector3> positions;
+  BABYLON::Octree<Entry> octree;
+}; // end of struct PointOctree
+
+// Frustum covering about an eighth of the points
+const std::array<BABYLON::Plane, 6> FrustumPlanes{
+  {BABYLON::Plane(1.f, 0.f, 0.f, 0.f), BABYLON::Plane(-1.f, 0.f, 0.f, 100.f),
+   BABYLON::Plane(0.f, 1.f, 0.f, 0.f), BABYLON::Plane(0.f, -1.f, 0.f, 100.f),
+   BABYLON::Plane(0.f, 0.f, 1.f, 0.f), BABYLON::Plane(0.f, 0.f, -1.f, 100.f)}};
+const BABYLON::Vector3 SphereCenter(10.f, -20.f, 30.f);
+constexpr float SphereRadius = 40.f;
+
+BABYLON::Ray CreateRay()
+{
+  return BABYLON::Ray(BABYLON::Vector3(-120.f, -110.f, -90.f),
+                      BABYLON::Vector3(1.f, 0.9f, 0.7f).normalize());
+}
+
+// Query of the flattened blocks of the octree
+template <typename Query>
+void OctreeQuery(benchmark::State& state, const Query& query)
+{
+  PointOctree points(static_cast<size_t>(state.range(0)));
+  query(points.octree);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(query(points.octree).data());
+  }
+}
+
+// Recursive traversal of the blocks, which the queries used before the blocks were flattened
+template <typename Query>
+void OctreeRecursiveQuery(benchmark::State& state, const Query& query)
+{
+  PointOctree points(static_cast<size_t>(state.range(0)));
+  std::vector<PointOctree::Entry> selection;
+  for (auto _ : state) {
+    selection.clear();
+    for (auto& block : points.octree.blocks) {
+      query(block, selection);
+    }
+    benchmark::DoNotOptimize(selection.data());
+  }
+}
+
+void OctreeSelect(benchmark::State& state)
+{
+  OctreeQuery(state, [](auto& octree) -> auto& { return octree.select(FrustumPlanes, true); });
+}
+BENCHMARK(OctreeSelect)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+void OctreeSelectRecursive(benchmark::State& state)
+{
+  OctreeRecursiveQuery(
+    state, [](auto& block, auto& selection) { block.select(FrustumPlanes, selection, true); });
+}
+BENCHMARK(OctreeSelectRecursive)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+void OctreeIntersects(benchmark::State& state)
+{
+  OctreeQuery(state, [](auto& octree) -> auto& {
+    return octree.intersects(SphereCenter, SphereRadius, true);
+  });
+}
+BENCHMARK(OctreeIntersects)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+void OctreeIntersectsRecursive(benchmark::State& state)
+{
+  OctreeRecursiveQuery(state, [](auto& block, auto& selection) {
+    block.intersects(SphereCenter, SphereRadius, selection, true);
+  });
+}
+BENCHMARK(OctreeIntersectsRecursive)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+void OctreeIntersectsRay(benchmark::State& state)
+{
+  const auto ray = CreateRay();
+  OctreeQuery(state, [&ray](auto& octree) -> auto& { return octree.intersectsRay(ray); });
+}
+BENCHMARK(OctreeIntersectsRay)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+void OctreeIntersectsRayRecursive(benchmark::State& state)
+{
+  const auto ray = CreateRay();
+  OctreeRecursiveQuery(
+    state, [&ray](auto& block, auto& selection) { block.intersectsRay(ray, selection); });
+}
+BENCHMARK(OctreeIntersectsRayRecursive)->Arg(10000)->Arg(100000)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
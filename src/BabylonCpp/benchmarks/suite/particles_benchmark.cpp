@@ -0,0 +1,74 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/particles/particle_system.h>
+#include <babylon/particles/solid_particle.h>
+#include <babylon/particles/solid_particle_system.h>
+
+namespace {
+
+void SolidParticleSystemSetParticles(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+
+  // Updatable SPS of boxes, spread on a grid
+  auto box = Mesh::CreateBox("box", 1.f, scene.get());
+  SolidParticleSystemOptions spsOptions;
+  spsOptions.updatable = true;
+  auto sps             = SolidParticleSystem::New("SPS", scene.get(), spsOptions);
+  SolidParticleSystemMeshBuilderOptions spsMeshBuilderOptions;
+  spsMeshBuilderOptions.positionFunction
+    = [](SolidParticle* particle, unsigned int i, unsigned int /*s*/) -> void {
+    particle->position.set(static_cast<float>(i % 100), static_cast<float>(i / 100 % 100),
+                           static_cast<float>(i / 10000));
+  };
+  sps->addShape(box, static_cast<size_t>(state.range(0)), spsMeshBuilderOptions);
+  sps->buildMesh();
+  box->dispose();
+
+  for (auto _ : state) {
+    for (auto& particle : sps->particles) {
+      particle->rotation.y += 0.01f;
+    }
+    sps->setParticles();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(SolidParticleSystemSetParticles)->Arg(1000)->Arg(10000)->Unit(benchmark::kMillisecond);
+
+void ParticleSystemAnimate(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+
+  // The particle system is owned by the scene. The particles live 100 steps, the emit rate keeps
+  // the system full once warmed up.
+  const auto capacity         = static_cast<size_t>(state.range(0));
+  auto particleSystem         = new ParticleSystem("particles", capacity, scene.get());
+  particleSystem->emitter     = Vector3::Zero();
+  particleSystem->emitRate    = static_cast<int>(capacity / 100);
+  particleSystem->minLifeTime = 100.f;
+  particleSystem->maxLifeTime = 100.f;
+  particleSystem->updateSpeed = 1.f;
+  particleSystem->start();
+
+  // Simulation steps as run by the pre-warming, without the upload of the vertex buffer
+  for (unsigned int step = 0; step < 100; ++step) {
+    particleSystem->animate(true);
+  }
+  for (auto _ : state) {
+    particleSystem->animate(true);
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(capacity));
+}
+BENCHMARK(ParticleSystemAnimate)->Arg(1000)->Arg(10000);
+
+} // end of anonymous namespace
@@ -0,0 +1,80 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/meshes/polygonmesh/polygon_mesh_batch_builder.h>
+#include <babylon/meshes/polygonmesh/polygon_mesh_builder.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+// Building footprint of 4 to 16 points laid out on a grid, every 8th one with a courtyard
+std::vector<BABYLON::Vector2> Footprint(size_t index, std::vector<BABYLON::Vector2>& courtyard)
+{
+  using namespace BABYLON;
+
+  const auto centerX    = static_cast<float>(index % 1000) * 30.f;
+  const auto centerY    = static_cast<float>(index / 1000) * 30.f;
+  const auto pointCount = 4 + index % 13;
+  std::vector<Vector2> contour;
+  for (size_t point = 0; point < pointCount; ++point) {
+    const auto angle  = Math::PI2 * static_cast<float>(point) / static_cast<float>(pointCount);
+    const auto radius = (point % 2 == 0) ? 10.f : 8.f;
+    contour.emplace_back(centerX + radius * std::cos(angle), centerY + radius * std::sin(angle));
+  }
+  courtyard.clear();
+  if (index % 8 == 0) {
+    courtyard = {Vector2(centerX - 2.f, centerY - 2.f), Vector2(centerX - 2.f, centerY + 2.f),
+                 Vector2(centerX + 2.f, centerY + 2.f), Vector2(centerX + 2.f, centerY - 2.f)};
+  }
+  return contour;
+}
+
+float Height(size_t index)
+{
+  return 5.f + static_cast<float>(index % 7) * 3.f;
+}
+
+void PolygonMeshBuilderPerPolygon(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto polygonCount = static_cast<size_t>(state.range(0));
+  std::vector<Vector2> courtyard;
+  for (auto _ : state) {
+    for (size_t index = 0; index < polygonCount; ++index) {
+      PolygonMeshBuilder builder("building", Footprint(index, courtyard), nullptr);
+      if (!courtyard.empty()) {
+        builder.addHole(courtyard);
+      }
+      benchmark::DoNotOptimize(builder.buildVertexData(Height(index)));
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(PolygonMeshBuilderPerPolygon)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+void PolygonMeshBatchBuilderBatch(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto polygonCount = static_cast<size_t>(state.range(0));
+  PolygonMeshBatchBuilder builder("buildings", nullptr);
+  std::vector<Vector2> courtyard;
+  for (auto _ : state) {
+    builder.clear();
+    for (size_t index = 0; index < polygonCount; ++index) {
+      const auto contour = Footprint(index, courtyard);
+      builder.addPolygon(contour, courtyard.empty() ? std::vector<std::vector<Vector2>>{} :
+                                                      std::vector<std::vector<Vector2>>{courtyard},
+                         Height(index));
+    }
+    benchmark::DoNotOptimize(builder.buildVertexData());
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(PolygonMeshBatchBuilderBatch)->Arg(1000)->Arg(100000)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
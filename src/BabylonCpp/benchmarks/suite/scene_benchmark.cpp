@@ -0,0 +1,125 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/collisions/picking_info.h>
+#include <babylon/culling/ray.h>
+#include <babylon/engines/scene.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/transform_node.h>
+
+namespace {
+
+/**
+ * @brief Grid of boxes seen by a free camera.
+ */
+struct GridScene {
+  explicit GridScene(int size)
+  {
+    using namespace BABYLON;
+
+    engine = createBenchmarkEngine();
+    scene  = Scene::New(engine.get());
+    camera = FreeCamera::New("camera", Vector3(0.f, 2.f * size, -2.f * size), scene.get());
+    camera->setTarget(Vector3::Zero());
+    for (int row = 0; row < size; ++row) {
+      for (int col = 0; col < size; ++col) {
+        auto box = Mesh::CreateBox("box", 1.f, scene.get());
+        box->position().set(2.f * (col - size / 2.f), 0.f, 2.f * (row - size / 2.f));
+        boxes.emplace_back(box);
+      }
+    }
+  }
+
+  std::unique_ptr<BABYLON::Engine> engine;
+  std::unique_ptr<BABYLON::Scene> scene;
+  BABYLON::FreeCameraPtr camera;
+  std::vector<BABYLON::MeshPtr> boxes;
+}; // end of struct GridScene
+
+void ComputeWorldMatrixDeepHierarchy(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine = createBenchmarkEngine();
+  auto scene  = Scene::New(engine.get());
+
+  // Chain of nodes, each one parented to the previous one
+  std::vector<TransformNodePtr> nodes;
+  for (int64_t depth = 0; depth < state.range(0); ++depth) {
+    auto node = TransformNode::New("node", scene.get());
+    node->position().set(0.f, 1.f, 0.f);
+    if (!nodes.empty()) {
+      node->parent = nodes.back().get();
+    }
+    nodes.emplace_back(node);
+  }
+
+  auto angle = 0.f;
+  for (auto _ : state) {
+    // Moving the root invalidates the whole hierarchy
+    angle += 0.01f;
+    nodes.front()->rotation().y = angle;
+    for (const auto& node : nodes) {
+      benchmark::DoNotOptimize(node->computeWorldMatrix());
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ComputeWorldMatrixDeepHierarchy)->Arg(16)->Arg(256);
+
+void EvaluateActiveMeshes(benchmark::State& state)
+{
+  // The active meshes are evaluated at the beginning of each frame of the scene
+  GridScene grid(static_cast<int>(state.range(0)));
+  auto angle = 0.f;
+  for (auto _ : state) {
+    angle += 0.01f;
+    grid.boxes.front()->rotation().y = angle;
+    grid.scene->render();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0));
+}
+BENCHMARK(EvaluateActiveMeshes)->Arg(10)->Arg(32);
+
+void PickWithRay(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GridScene grid(static_cast<int>(state.range(0)));
+  grid.scene->render();
+  const Ray ray(Vector3(-100.f, 0.5f, -100.f), Vector3(1.f, 0.f, 1.f).normalize(), 1000.f);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(grid.scene->pickWithRay(ray));
+  }
+}
+BENCHMARK(PickWithRay)->Arg(10)->Arg(32);
+
+void MoveWithCollisions(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  GridScene grid(static_cast<int>(state.range(0)));
+  grid.scene->collisionsEnabled = true;
+  for (const auto& box : grid.boxes) {
+    box->checkCollisions = true;
+  }
+  const auto size = static_cast<float>(state.range(0));
+  auto mover      = Mesh::CreateSphere("mover", 8, 1.f, grid.scene.get());
+  mover->ellipsoid.set(0.5f, 0.5f, 0.5f);
+  grid.scene->render();
+
+  for (auto _ : state) {
+    // Slides along the boxes of the middle row
+    mover->position().set(-2.f * size, 0.f, 0.5f);
+    for (unsigned int step = 0; step < 16; ++step) {
+      Vector3 displacement(size / 4.f, 0.f, 0.f);
+      mover->moveWithCollisions(displacement);
+    }
+  }
+  state.SetItemsProcessed(state.iterations() * 16);
+}
+BENCHMARK(MoveWithCollisions)->Arg(10)->Arg(32);
+
+} // end of anonymous namespace
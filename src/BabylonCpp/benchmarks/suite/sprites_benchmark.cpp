@@ -0,0 +1,47 @@
+#include <benchmark/benchmark.h>
+
+#include "benchmark_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/sprites/sprite.h>
+#include <babylon/sprites/sprite_manager.h>
+
+namespace {
+
+// Rendering of a large number of sprites, the given percentage of them moving every frame. The
+// sprites that did not change are not uploaded again.
+void SpriteManagerRender(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  auto engine              = createBenchmarkEngine();
+  auto scene               = Scene::New(engine.get());
+  const auto spriteCount   = static_cast<size_t>(state.range(0));
+  const auto movingPercent = static_cast<size_t>(state.range(1));
+  auto spriteManager       = SpriteManager::New(
+    "sprites", "sprites.png", static_cast<unsigned int>(spriteCount), ISize{64, 64}, scene.get());
+  std::vector<SpritePtr> sprites;
+  for (size_t i = 0; i < spriteCount; ++i) {
+    auto sprite = Sprite::New("sprite", spriteManager);
+    sprite->position.set(static_cast<float>(i % 1000), static_cast<float>(i / 1000), 0.f);
+    sprites.emplace_back(sprite);
+  }
+  const auto movingCount = spriteCount * movingPercent / 100;
+  spriteManager->render();
+
+  for (auto _ : state) {
+    // Moving sprites spread over the whole buffer
+    for (size_t i = 0; i < movingCount; ++i) {
+      sprites[i * spriteCount / movingCount]->position.z += 0.01f;
+    }
+    spriteManager->render();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(spriteCount));
+
+  spriteManager->dispose();
+}
+BENCHMARK(SpriteManagerRender)
+  ->ArgsProduct({{10000, 100000}, {0, 1, 100}})
+  ->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
@@ -141,6 +141,17 @@ enum class SimplificationType {
   QUADRATIC
 }; // end of enum class SimplificationType
 
+/**
+ * @brief The implemented algorithms used to reorder triangles for the post-transform vertex cache.
+ * @see MeshOptimizer
+ */
+enum class VertexCacheOptimizationType {
+  /** Tom Forsyth's "Linear-Speed Vertex Cache Optimisation" (LRU cache model) */
+  FORSYTH,
+  /** Sander et al. "Fast Triangle Reordering for Vertex Locality and Reduced Overdraw" */
+  TIPSIFY
+}; // end of enum class VertexCacheOptimizationType
+
 enum class Type : unsigned int {
   NODE  = 0,
   SCENE = 1,
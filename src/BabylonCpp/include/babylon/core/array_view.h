@@ -0,0 +1,126 @@
+#ifndef BABYLON_CORE_ARRAY_VIEW_H
+#define BABYLON_CORE_ARRAY_VIEW_H
+
+#include <cstddef>
+#include <cstdint>
+#include <type_traits>
+#include <vector>
+
+namespace BABYLON {
+
+/**
+ * @brief Non-owning view over a contiguous sequence of elements (similar to C++20 std::span).
+ *
+ * The view does not extend the lifetime of the viewed storage: it is invalidated as soon as the
+ * underlying array is resized, reassigned or destroyed.
+ */
+template <typename T>
+class ArrayView {
+
+public:
+  using element_type   = T;
+  using value_type     = std::remove_cv_t<T>;
+  using size_type      = std::size_t;
+  using pointer        = T*;
+  using reference      = T&;
+  using iterator       = T*;
+  using const_iterator = const T*;
+
+  constexpr ArrayView() noexcept : _data{nullptr}, _size{0}
+  {
+  }
+
+  constexpr ArrayView(T* data, size_type size) noexcept : _data{data}, _size{size}
+  {
+  }
+
+  /**
+   * @brief Creates a view over a whole vector.
+   */
+  template <typename U, typename = std::enable_if_t<std::is_same_v<std::remove_cv_t<U>, value_type>
+                                                    && std::is_convertible_v<U*, T*>>>
+  ArrayView(std::vector<U>& vector) noexcept : _data{vector.data()}, _size{vector.size()}
+  {
+  }
+
+  /**
+   * @brief Creates a read-only view over a whole vector.
+   */
+  template <typename U, typename = std::enable_if_t<std::is_same_v<U, value_type>
+                                                    && std::is_const_v<T>>>
+  ArrayView(const std::vector<U>& vector) noexcept : _data{vector.data()}, _size{vector.size()}
+  {
+  }
+
+  /**
+   * @brief Creates a read-only view from a mutable one.
+   */
+  template <typename U, typename = std::enable_if_t<std::is_same_v<const U, T>>>
+  constexpr ArrayView(const ArrayView<U>& other) noexcept
+      : _data{other.data()}, _size{other.size()}
+  {
+  }
+
+  constexpr ArrayView(const ArrayView& other) noexcept = default;
+  constexpr ArrayView& operator=(const ArrayView& other) noexcept = default;
+
+  [[nodiscard]] constexpr T* data() const noexcept
+  {
+    return _data;
+  }
+
+  [[nodiscard]] constexpr size_type size() const noexcept
+  {
+    return _size;
+  }
+
+  [[nodiscard]] constexpr bool empty() const noexcept
+  {
+    return _size == 0;
+  }
+
+  constexpr T& operator[](size_type index) const noexcept
+  {
+    return _data[index];
+  }
+
+  [[nodiscard]] constexpr T* begin() const noexcept
+  {
+    return _data;
+  }
+
+  [[nodiscard]] constexpr T* end() const noexcept
+  {
+    return _data + _size;
+  }
+
+  /**
+   * @brief Returns a view over count elements starting at offset.
+   */
+  [[nodiscard]] constexpr ArrayView subView(size_type offset, size_type count) const noexcept
+  {
+    return ArrayView(_data + offset, count);
+  }
+
+  /**
+   * @brief Copies the viewed elements into a new array.
+   */
+  [[nodiscard]] std::vector<value_type> toArray() const
+  {
+    return std::vector<value_type>(begin(), end());
+  }
+
+private:
+  T* _data;
+  size_type _size;
+
+}; // end of class ArrayView
+
+using Float32ArrayView      = ArrayView<float>;
+using ConstFloat32ArrayView = ArrayView<const float>;
+using IndicesArrayView      = ArrayView<uint32_t>;
+using ConstIndicesArrayView = ArrayView<const uint32_t>;
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_ARRAY_VIEW_H
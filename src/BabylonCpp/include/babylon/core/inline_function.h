@@ -0,0 +1,137 @@
+#ifndef BABYLON_CORE_INLINE_FUNCTION_H
+#define BABYLON_CORE_INLINE_FUNCTION_H
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace BABYLON {
+
+template <typename Signature, std::size_t Capacity = 4 * sizeof(void*)>
+class InlineFunction;
+
+/**
+ * @brief Move-only type-erased callable (similar to std::function) which never allocates: the
+ * callable is stored in an inline buffer of "Capacity" bytes, and callables which do not fit in
+ * the buffer are rejected at compile time.
+ */
+template <typename R, typename... Args, std::size_t Capacity>
+class InlineFunction<R(Args...), Capacity> {
+
+public:
+  InlineFunction() noexcept : _operations{nullptr}
+  {
+  }
+
+  InlineFunction(std::nullptr_t) noexcept : _operations{nullptr}
+  {
+  }
+
+  /**
+   * @brief Stores a copy of the callable in the inline buffer.
+   */
+  template <typename F, typename Callable = std::decay_t<F>,
+            typename = std::enable_if_t<!std::is_same_v<Callable, InlineFunction>
+                                        && std::is_invocable_r_v<R, Callable&, Args...>>>
+  InlineFunction(F&& callable) : _operations{&OperationsFor<Callable>}
+  {
+    static_assert(sizeof(Callable) <= Capacity, "Callable too large for the inline buffer");
+    static_assert(alignof(Callable) <= alignof(std::max_align_t), "Callable over-aligned");
+    static_assert(std::is_nothrow_move_constructible_v<Callable>,
+                  "Callable must be nothrow move constructible");
+    ::new (static_cast<void*>(&_storage)) Callable(std::forward<F>(callable));
+  }
+
+  InlineFunction(InlineFunction&& other) noexcept : _operations{other._operations}
+  {
+    if (_operations) {
+      _operations->move(&other._storage, &_storage);
+      other._operations = nullptr;
+    }
+  }
+
+  InlineFunction& operator=(InlineFunction&& other) noexcept
+  {
+    if (this != &other) {
+      reset();
+      if (other._operations) {
+        other._operations->move(&other._storage, &_storage);
+        _operations       = other._operations;
+        other._operations = nullptr;
+      }
+    }
+    return *this;
+  }
+
+  InlineFunction(const InlineFunction&) = delete;
+  InlineFunction& operator=(const InlineFunction&) = delete;
+
+  ~InlineFunction()
+  {
+    reset();
+  }
+
+  /**
+   * @brief Destroys the stored callable.
+   */
+  void reset() noexcept
+  {
+    if (_operations) {
+      _operations->destroy(&_storage);
+      _operations = nullptr;
+    }
+  }
+
+  explicit operator bool() const noexcept
+  {
+    return _operations != nullptr;
+  }
+
+  R operator()(Args... args) const
+  {
+    return _operations->invoke(const_cast<Storage*>(&_storage), std::forward<Args>(args)...);
+  }
+
+private:
+  using Storage = std::aligned_storage_t<Capacity, alignof(std::max_align_t)>;
+
+  struct Operations {
+    R (*invoke)(void* storage, Args&&... args);
+    void (*move)(void* from, void* to) noexcept;
+    void (*destroy)(void* storage) noexcept;
+  }; // end of struct Operations
+
+  template <typename Callable>
+  static R Invoke(void* storage, Args&&... args)
+  {
+    return (*static_cast<Callable*>(storage))(std::forward<Args>(args)...);
+  }
+
+  template <typename Callable>
+  static void Move(void* from, void* to) noexcept
+  {
+    auto source = static_cast<Callable*>(from);
+    ::new (to) Callable(std::move(*source));
+    source->~Callable();
+  }
+
+  template <typename Callable>
+  static void Destroy(void* storage) noexcept
+  {
+    static_cast<Callable*>(storage)->~Callable();
+  }
+
+  template <typename Callable>
+  static constexpr Operations OperationsFor{&Invoke<Callable>, &Move<Callable>,
+                                            &Destroy<Callable>};
+
+private:
+  const Operations* _operations;
+  Storage _storage;
+
+}; // end of class InlineFunction
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_INLINE_FUNCTION_H
@@ -0,0 +1,97 @@
+#ifndef BABYLON_CORE_THREAD_POOL_H
+#define BABYLON_CORE_THREAD_POOL_H
+
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <future>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Fixed size pool of worker threads shared by the CPU heavy algorithms of the engine
+ * (normals computation, mesh processing, simulation, ...).
+ *
+ * The thread calling parallelFor() always takes part in the work, so a pool without worker threads
+ * simply runs everything on the calling thread. This is the case for the default pool on single
+ * core machines and on platforms without thread support.
+ */
+class BABYLON_SHARED_EXPORT ThreadPool {
+
+public:
+  using Task = std::function<void()>;
+  /**
+   * Function processing the [begin, end) range of a parallelFor
+   */
+  using RangeTask = std::function<void(size_t begin, size_t end)>;
+
+public:
+  /**
+   * @brief Creates a thread pool.
+   * @param threadCount defines the number of worker threads (0 runs all the work on the calling
+   * thread)
+   */
+  explicit ThreadPool(size_t threadCount);
+  ThreadPool(const ThreadPool& other) = delete;
+  ThreadPool& operator=(const ThreadPool& other) = delete;
+  ~ThreadPool(); // Waits for the pending tasks
+
+  /**
+   * @brief Returns the pool shared by the engine, using one worker thread less than the number of
+   * hardware threads as the calling thread also takes part in the work.
+   */
+  static ThreadPool& Default();
+
+  /**
+   * @brief Returns the number of worker threads.
+   */
+  [[nodiscard]] size_t threadCount() const;
+
+  /**
+   * @brief Returns the maximum number of threads running a parallelFor, including the calling
+   * thread.
+   */
+  [[nodiscard]] size_t concurrency() const;
+
+  /**
+   * @brief Queues a task to be run by a worker thread (or runs it immediately when the pool has no
+   * worker thread).
+   * @param task defines the task to run
+   * @returns a future becoming ready once the task has run, rethrowing its exception if any
+   */
+  std::future<void> submit(Task task);
+
+  /**
+   * @brief Splits the [begin, end) range in chunks of grainSize elements and processes them in
+   * parallel, returning once all of them are processed.
+   * Chunk boundaries only depend on begin, end and grainSize, which allows algorithms to write per
+   * chunk results without synchronization. The first exception thrown by the body is rethrown on
+   * the calling thread.
+   * @param begin defines the start of the range
+   * @param end defines the end of the range (excluded)
+   * @param grainSize defines the number of elements per chunk
+   * @param body defines the function processing a chunk
+   */
+  void parallelFor(size_t begin, size_t end, size_t grainSize, const RangeTask& body);
+
+private:
+  void _workerLoop();
+  bool _runPendingTask();
+
+private:
+  std::vector<std::thread> _workers;
+  std::deque<Task> _tasks;
+  std::mutex _mutex;
+  std::condition_variable _condition;
+  bool _stopping;
+
+}; // end of class ThreadPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_CORE_THREAD_POOL_H
@@ -18,12 +18,9 @@ struct BABYLON_SHARED_EXPORT IOctreeContainer {
   /**
    * Blocks within the octree
    */
-  static std::vector<OctreeBlock<T>> blocks;
+  std::vector<OctreeBlock<T>> blocks;
 }; // end of struct IOctreeContainer<T>
 
-template <class T>
-std::vector<OctreeBlock<T>> IOctreeContainer<T>::blocks;
-
 } // end of namespace BABYLON
 
 #endif // end of BABYLON_CULLING_OCTREES_IOCTREE_CONTAINER_H
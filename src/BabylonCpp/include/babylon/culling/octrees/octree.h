@@ -1,6 +1,8 @@
 #ifndef BABYLON_CULLING_OCTREES_OCTREE_H
 #define BABYLON_CULLING_OCTREES_OCTREE_H
 
+#include <array>
+#include <cstdint>
 #include <functional>
 
 #include <babylon/babylon_api.h>
@@ -17,6 +19,9 @@ class Vector3;
 /**
  * @brief Octrees are a really powerful data structure that can quickly select
  * entities based on space coordinates.
+ *
+ * The queries run on a flattened copy of the blocks, rebuilt after update(), addMesh() and
+ * removeMesh(): blocks edited directly have to be followed by a call to markAsDirty().
  * @see https://doc.babylonjs.com/how_to/optimizing_your_scene_with_octrees
  */
 template <class T>
@@ -98,6 +103,12 @@ public:
    */
   std::vector<T>& intersectsRay(const Ray& ray);
 
+  /**
+   * @brief Flags the flattened blocks used by the queries to be rebuilt, to be called after
+   * editing the blocks or their entries directly.
+   */
+  void markAsDirty();
+
   /** Statics **/
 
   /**
@@ -125,11 +136,39 @@ public:
    */
   std::size_t maxDepth;
 
+private:
+  /**
+   * @brief Blocks of the octree stored in arrays, the bounds in separate arrays so that the
+   * children of a block, which are contiguous, are tested together.
+   */
+  struct FlatNodes {
+    std::vector<float> minX, minY, minZ;
+    std::vector<float> maxX, maxY, maxZ;
+    // Children of inner nodes, or entries of leaves
+    std::vector<uint32_t> first;
+    std::vector<uint32_t> count;
+    std::vector<uint8_t> isLeaf;
+    std::vector<T> entries;
+    std::size_t rootCount    = 0;
+    std::size_t maxGroupSize = 0;
+  }; // end of struct FlatNodes
+
+  void _flattenBlocks();
+
+  // Collects the entries of the leaves passing the test, which writes whether each of the count
+  // nodes starting at first passes into its result array, without duplicates if not allowed
+  template <typename GroupTest>
+  void _collect(const GroupTest& test, bool allowDuplicate);
+
+  void _appendDynamicContent(bool allowDuplicate);
+
 private:
   std::size_t _maxBlockCapacity;
 
   std::vector<T> _selectionContent;
   std::function<void(T&, OctreeBlock<T>&)> _creationFunc;
+  FlatNodes _flatNodes;
+  bool _flatNodesDirty;
 
 }; // end of class Octree
 
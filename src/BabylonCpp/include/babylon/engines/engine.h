@@ -18,6 +18,7 @@ class MultiviewExtension;
 class OcclusionQueryExtension;
 class PostProcess;
 class RawTextureExtension;
+class RenderTargetPool;
 class RenderTargetTexture;
 class TransformFeedbackExtension;
 using ArrayBufferViewArray      = std::vector<ArrayBufferView>;
@@ -688,6 +689,13 @@ public:
    */
   void setTextureFromPostProcessOutput(int channel, const PostProcessPtr& postProcess);
 
+  /**
+   * @brief Gets the pool of the render targets only used during a part of the frame, shared by the
+   * passes whose lifetimes do not overlap.
+   * @returns the render target pool of the engine
+   */
+  RenderTargetPool& getRenderTargetPool();
+
   /**
    * @brief Hidden
    */
@@ -1470,6 +1478,9 @@ private:
   float _deltaTime                                        = 0.f;
   std::unique_ptr<PerformanceMonitor> _performanceMonitor = nullptr;
 
+  // Transient render targets
+  std::unique_ptr<RenderTargetPool> _renderTargetPool;
+
   // Focus
   std::function<void()> _onFocus                            = nullptr;
   std::function<void()> _onBlur                             = nullptr;
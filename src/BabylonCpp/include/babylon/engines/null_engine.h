@@ -568,7 +568,7 @@ public:
 protected:
   NullEngine(const NullEngineOptions& options = NullEngineOptions{});
 
-  void _deleteBuffer(GL::IGLBuffer* buffer);
+  void _deleteBuffer(const WebGLDataBufferPtr& buffer) override;
 
 private:
   NullEngineOptions _options;
@@ -0,0 +1,137 @@
+#ifndef BABYLON_ENGINES_RENDER_TARGET_POOL_H
+#define BABYLON_ENGINES_RENDER_TARGET_POOL_H
+
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/materials/textures/irender_target_options.h>
+#include <babylon/maths/isize.h>
+
+namespace BABYLON {
+
+class InternalTexture;
+using InternalTexturePtr = std::shared_ptr<InternalTexture>;
+
+/**
+ * @brief Frame-scoped pool of render target textures.
+ *
+ * Passes only needing a render target for a part of the frame acquire it from the pool and release
+ * it as soon as it has been read, so that the passes whose lifetimes do not overlap within the
+ * frame share the same textures. The textures are matched on their size, type, format, sampling
+ * mode, mip maps, depth and stencil buffers and samples, and are disposed after staying unused for
+ * a few frames.
+ */
+class BABYLON_SHARED_EXPORT RenderTargetPool {
+
+public:
+  using CreateTextureFunction = std::function<InternalTexturePtr(
+    const ISize& size, const IRenderTargetOptions& options, unsigned int samples)>;
+  using ReleaseTextureFunction = std::function<void(const InternalTexturePtr& texture)>;
+
+public:
+  /**
+   * @brief Creates a new render target pool.
+   * @param createTexture defines the function creating a render target texture
+   * @param releaseTexture defines the function disposing a render target texture
+   */
+  RenderTargetPool(const CreateTextureFunction& createTexture,
+                   const ReleaseTextureFunction& releaseTexture);
+  ~RenderTargetPool(); // = default
+
+  /**
+   * @brief Gets a render target texture which is not used by another pass, creating it if needed.
+   * @param size defines the size of the texture
+   * @param options defines the options of the texture
+   * @param samples defines the number of samples of the texture
+   * @returns the render target texture, owned by the pool until it is released
+   */
+  InternalTexturePtr acquire(const ISize& size, const IRenderTargetOptions& options,
+                             unsigned int samples = 1);
+
+  /**
+   * @brief Gives a texture back to the pool, once its content has been read, so that it can be
+   * used by the following passes of the frame.
+   * @param texture defines the texture acquired from the pool
+   */
+  void release(const InternalTexturePtr& texture);
+
+  /**
+   * @brief Returns whether the texture has been acquired from this pool.
+   * @param texture defines the texture to check
+   * @returns true if the texture belongs to the pool
+   */
+  [[nodiscard]] bool owns(const InternalTexturePtr& texture) const;
+
+  /**
+   * @brief Ends the frame, disposing the textures which have not been used for more than
+   * "maxUnusedFrames" frames.
+   */
+  void endFrame();
+
+  /**
+   * @brief Disposes all the textures of the pool.
+   */
+  void clear();
+
+  /**
+   * @brief Gets the number of textures allocated by the pool.
+   */
+  [[nodiscard]] size_t textureCount() const;
+
+  /**
+   * @brief Gets the estimated memory of the textures allocated by the pool, in bytes.
+   */
+  [[nodiscard]] size_t memory() const;
+
+  /**
+   * @brief Gets the estimated memory allocated by the pool during the last frame, in bytes.
+   */
+  [[nodiscard]] size_t lastFrameMemory() const;
+
+  /**
+   * @brief Gets the highest estimated memory allocated by the pool, in bytes.
+   */
+  [[nodiscard]] size_t peakMemory() const;
+
+  /**
+   * @brief Estimates the video memory used by a render target texture.
+   * @param size defines the size of the texture
+   * @param options defines the options of the texture
+   * @param samples defines the number of samples of the texture
+   * @returns the estimated memory in bytes
+   */
+  static size_t EstimateMemory(const ISize& size, const IRenderTargetOptions& options,
+                               unsigned int samples);
+
+public:
+  /**
+   * Number of frames a texture can stay unused before being disposed (default: 2).
+   */
+  size_t maxUnusedFrames;
+
+private:
+  struct Entry {
+    ISize size;
+    IRenderTargetOptions options;
+    unsigned int samples;
+    InternalTexturePtr texture;
+    size_t memory;
+    size_t lastUsedFrame;
+    bool inUse;
+  }; // end of struct Entry
+
+  CreateTextureFunction _createTexture;
+  ReleaseTextureFunction _releaseTexture;
+  std::vector<Entry> _entries;
+  size_t _frameId;
+  size_t _memory;
+  size_t _lastFrameMemory;
+  size_t _peakMemory;
+
+}; // end of class RenderTargetPool
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_ENGINES_RENDER_TARGET_POOL_H
@@ -65,6 +65,21 @@ protected:
    */
   void set_captureShaderCompilationTime(bool value);
 
+  /**
+   * @brief Gets the perf counter used for the memory of the transient render targets.
+   */
+  PerfCounter& get_renderTargetPoolMemoryCounter();
+
+  /**
+   * @brief Gets the transient render targets memory capture status.
+   */
+  [[nodiscard]] bool get_captureRenderTargetPoolMemory() const;
+
+  /**
+   * @brief Enable or disable the transient render targets memory capture.
+   */
+  void set_captureRenderTargetPoolMemory(bool value);
+
 public:
   // Properties
   /**
@@ -87,6 +102,17 @@ public:
    */
   Property<EngineInstrumentation, bool> captureShaderCompilationTime;
 
+  /**
+   * Perf counter used for the memory allocated by the render target pool each frame, in bytes. Its
+   * max value is the peak memory of the transient render targets.
+   */
+  ReadOnlyProperty<EngineInstrumentation, PerfCounter> renderTargetPoolMemoryCounter;
+
+  /**
+   * Enable or disable the transient render targets memory capture.
+   */
+  Property<EngineInstrumentation, bool> captureRenderTargetPoolMemory;
+
 private:
   /**
    * Define the instrumented engine.
@@ -100,11 +126,15 @@ private:
   bool _captureShaderCompilationTime;
   PerfCounter _shaderCompilationTime;
 
+  bool _captureRenderTargetPoolMemory;
+  PerfCounter _renderTargetPoolMemory;
+
   // Observers
   Observer<Engine>::Ptr _onBeginFrameObserver;
   Observer<Engine>::Ptr _onEndFrameObserver;
   Observer<Engine>::Ptr _onBeforeShaderCompilationObserver;
   Observer<Engine>::Ptr _onAfterShaderCompilationObserver;
+  Observer<Engine>::Ptr _onEndFrameRenderTargetPoolObserver;
 
 }; // end of class EngineInstrumentation
 
@@ -108,6 +108,20 @@ public:
    */
   static void setCleanBoneMatrixWeights(bool value);
 
+  /**
+   * @brief Gets a boolean indicating if the loaded meshes must be optimized for the GPU (vertex
+   * welding, vertex cache, overdraw and vertex fetch optimizations).
+   * @see MeshOptimizer
+   */
+  static bool OptimizeMeshes();
+
+  /**
+   * @brief Sets a boolean indicating if the loaded meshes must be optimized for the GPU (vertex
+   * welding, vertex cache, overdraw and vertex fetch optimizations).
+   * @see MeshOptimizer
+   */
+  static void setOptimizeMeshes(bool value);
+
 private:
   // Functions
   static void RegisterPlugins();
@@ -116,6 +130,7 @@ private:
   static IRegisteredPlugin _getPluginForDirectLoad(const std::string& data);
   static IRegisteredPlugin _getPluginForFilename(std::string sceneFilename);
   static std::string _getDirectLoad(const std::string& sceneFilename);
+  static void _optimizeMeshes(const std::vector<AbstractMeshPtr>& meshes);
   static std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>
   _loadData(
     const IFileInfo& fileInfo, Scene* scene,
@@ -15,6 +15,7 @@ private:
   static bool _ForceFullSceneLoadingForIncremental;
   static bool _ShowLoadingScreen;
   static bool _CleanBoneMatrixWeights;
+  static bool _OptimizeMeshes;
   static unsigned int _loggingLevel;
 
 public:
@@ -64,6 +65,20 @@ public:
    */
   static void setCleanBoneMatrixWeights(bool value);
 
+  /**
+   * @brief Gets a boolean indicating if the loaded meshes must be optimized for the GPU (vertex
+   * welding, vertex cache, overdraw and vertex fetch optimizations).
+   * @see MeshOptimizer
+   */
+  static bool OptimizeMeshes();
+
+  /**
+   * @brief Sets a boolean indicating if the loaded meshes must be optimized for the GPU (vertex
+   * welding, vertex cache, overdraw and vertex fetch optimizations).
+   * @see MeshOptimizer
+   */
+  static void setOptimizeMeshes(bool value);
+
 }; // end of struct SceneLoaderFlags
 
 } // end of namespace BABYLON
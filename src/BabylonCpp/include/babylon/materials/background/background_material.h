@@ -53,6 +53,13 @@ public:
    */
   [[nodiscard]] bool needAlphaTesting() const override;
 
+  /**
+   * @brief Specifies if the shaders of this material decode octahedral encoded normals and
+   * tangents.
+   * @returns true
+   */
+  [[nodiscard]] bool supportsOctahedralVertexData() const override;
+
   /**
    * @brief The entire material has been created in order to prevent overdraw.
    * @returns true if blending is enable
@@ -147,6 +147,12 @@ public:
    */
   std::vector<std::string>& getSamplers();
 
+  /**
+   * @brief Returns an array of uniform variable names, including the samplers
+   * @returns The array of uniform variable names.
+   */
+  std::vector<std::string>& getUniformNames();
+
   /**
    * @brief The error from the last compilation.
    * @returns the error string.
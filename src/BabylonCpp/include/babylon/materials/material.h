@@ -240,6 +240,13 @@ public:
    */
   [[nodiscard]] virtual bool needAlphaTesting() const;
 
+  /**
+   * @brief Specifies if the shaders of this material decode the octahedral encoded normals and
+   * tangents of the meshes converted with Mesh::quantizeVertexData.
+   * @returns a boolean specifying if octahedral encoded normals and tangents are supported
+   */
+  [[nodiscard]] virtual bool supportsOctahedralVertexData() const;
+
   /**
    * @brief Gets the texture used for the alpha test.
    * @returns the texture to use for alpha testing
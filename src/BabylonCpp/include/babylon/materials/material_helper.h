@@ -131,11 +131,14 @@ struct BABYLON_SHARED_EXPORT MaterialHelper {
    * @param useBones Precise whether bones should be used or not (override mesh info)
    * @param useMorphTargets Precise whether morph targets should be used or not (override mesh info)
    * @param useVertexAlpha Precise whether vertex alpha should be used or not (override mesh info)
+   * @param useOctahedralVertexData Precise whether the shaders decode octahedral encoded normals
+   * and tangents (NORMAL_OCTAHEDRAL and TANGENT_OCTAHEDRAL defines)
    * @returns false if defines are considered not dirty and have not been checked
    */
   static bool PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDefines& defines,
                                           bool useVertexColor, bool useBones,
-                                          bool useMorphTargets = false, bool useVertexAlpha = true);
+                                          bool useMorphTargets = false, bool useVertexAlpha = true,
+                                          bool useOctahedralVertexData = false);
 
   /**
    * @brief Prepares the defines related to multiview.
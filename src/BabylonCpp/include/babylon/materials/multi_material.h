@@ -59,6 +59,13 @@ public:
    */
   [[nodiscard]] std::string getClassName() const override;
 
+  /**
+   * @brief Specifies if the shaders of all the sub materials decode octahedral encoded normals and
+   * tangents.
+   * @returns a boolean specifying if octahedral encoded normals and tangents are supported
+   */
+  [[nodiscard]] bool supportsOctahedralVertexData() const override;
+
   /**
    * @brief Checks if the material is ready to render the requested sub mesh.
    * @param mesh Define the mesh the submesh belongs to
@@ -360,6 +360,9 @@ protected:
 
 private:
   static size_t _BuildIdGenerator;
+  // Identifiers of the generated shaders, keyed by their full vertex and fragment source code so
+  // that different shaders never share an effect name
+  static std::unordered_map<std::string, size_t> _ShaderIds;
   INodeMaterialOptionsPtr _options;
   NodeMaterialBuildStatePtr _vertexCompilationState;
   NodeMaterialBuildStatePtr _fragmentCompilationState;
@@ -112,10 +112,11 @@ protected:
   /**
    * @brief Creates a new connection point
    * @param name defines the connection point name
-   * @param ownerBlock defines the block hosting this connection point
+   * @param ownerBlock defines the block hosting this connection point, which can still be under
+   * construction
    * @param direction defines the direction of the connection point
    */
-  NodeMaterialConnectionPoint(const std::string& name, const NodeMaterialBlockPtr& ownerBlock,
+  NodeMaterialConnectionPoint(const std::string& name, NodeMaterialBlock* ownerBlock,
                               const NodeMaterialConnectionPointDirection& direction);
 
   /**
@@ -174,7 +175,8 @@ protected:
   NodeMaterialConnectionPointPtr& get_connectedPoint();
 
   /**
-   * @brief Get the block that owns this connection point.
+   * @brief Get the block that owns this connection point, resolved on first access as the block
+   * registers its connection points before it is owned by a shared pointer.
    */
   NodeMaterialBlockPtr& get_ownerBlock();
 
@@ -346,6 +348,7 @@ private:
   NodeMaterialBlockPtr _sourceBlock;
   std::vector<NodeMaterialBlockPtr> _connectedBlocks;
   NodeMaterialBlockTargets _tmpTarget;
+  NodeMaterialBlock* _ownerBlockPtr;
 
 }; // end of enum class NodeMaterialConnectionPoint
 
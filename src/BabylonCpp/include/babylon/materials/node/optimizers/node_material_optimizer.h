@@ -13,11 +13,23 @@ using NodeMaterialBlockPtr = std::shared_ptr<NodeMaterialBlock>;
 
 /**
  * @brief Root class for all node material optimizers.
+ *
+ * The default implementation rewrites the graph before it is built:
+ * - math blocks whose inputs are all constants are replaced by a constant input,
+ * - identities (x + 0, x * 1, x / 1, lerp with a constant gradient of 0 or 1...) are bypassed and
+ *   products by 0 are replaced by a constant,
+ * - equivalent constant, attribute and system value inputs and identical math expressions are
+ *   merged into a single block,
+ * - blocks no longer reachable from the output nodes are disconnected from the graph, so they do
+ *   not produce varyings or uniforms anymore.
+ * The graph is modified in place, so the optimizer has to be explicitly registered on the node
+ * material.
  */
 struct BABYLON_SHARED_EXPORT NodeMaterialOptimizer {
   virtual ~NodeMaterialOptimizer() = default;
   /**
-   * @brief Function used to optimize a NodeMaterial graph.
+   * @brief Function used to optimize a NodeMaterial graph, called before its blocks are
+   * initialized.
    * @param vertexOutputNodes defines the list of output nodes for the vertex
    * shader
    * @param fragmentOutputNodes defines the list of output nodes for the
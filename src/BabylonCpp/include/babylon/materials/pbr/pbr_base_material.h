@@ -122,6 +122,13 @@ public:
    */
   [[nodiscard]] bool needAlphaTesting() const override;
 
+  /**
+   * @brief Specifies if the shaders of this material decode octahedral encoded normals and
+   * tangents.
+   * @returns true
+   */
+  [[nodiscard]] bool supportsOctahedralVertexData() const override;
+
   /**
    * @brief Gets the texture used for the alpha test.
    */
@@ -73,6 +73,13 @@ public:
    */
   [[nodiscard]] bool needAlphaTesting() const override;
 
+  /**
+   * @brief Specifies if the shaders of this material decode octahedral encoded normals and
+   * tangents.
+   * @returns true
+   */
+  [[nodiscard]] bool supportsOctahedralVertexData() const override;
+
   /**
    * @brief Get the texture used for alpha test purpose.
    * @returns the diffuse texture in case of the standard material.
@@ -14,6 +14,9 @@ using HDRCubeTexturePtr = std::shared_ptr<HDRCubeTexture>;
  *
  * The only supported format is currently panorama picture stored in RGBE format.
  * Example of such files can be found on HDRLib: http://hdrlib.com/
+ *
+ * Set HDRCubeTextureCache::CacheDirectory to keep the processed faces and harmonics on disk and
+ * skip the panorama conversion on the next loads of the same file.
  */
 class BABYLON_SHARED_EXPORT HDRCubeTexture : public BaseTexture {
 
@@ -4,6 +4,7 @@
 #include <functional>
 
 #include <babylon/babylon_common.h>
+#include <babylon/core/array_view.h>
 #include <babylon/core/structs.h>
 #include <babylon/maths/vector2.h>
 
@@ -19,7 +20,8 @@ namespace BABYLON {
  * @param bias defines bias value to add to the result
  * @return minimum and maximum values
  */
-inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint32Array& indices,
+inline MinMax extractMinAndMaxIndexed(const ConstFloat32ArrayView& positions,
+                                      const ConstIndicesArrayView& indices,
                                       size_t indexStart, size_t indexCount,
                                       const std::optional<Vector2>& bias = std::nullopt)
 {
@@ -60,7 +62,7 @@ inline MinMax extractMinAndMaxIndexed(const Float32Array& positions, const Uint3
  * positions in the positions array)
  * @return minimum and maximum values
  */
-inline MinMax extractMinAndMax(const Float32Array& positions, size_t start, size_t count,
+inline MinMax extractMinAndMax(const ConstFloat32ArrayView& positions, size_t start, size_t count,
                                const std::optional<Vector2>& bias = std::nullopt,
                                std::optional<unsigned int> stride = std::nullopt)
 {
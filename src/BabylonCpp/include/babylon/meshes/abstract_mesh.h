@@ -6,6 +6,7 @@
 #include <babylon/babylon_api.h>
 #include <babylon/collisions/_mesh_collision_data.h>
 #include <babylon/collisions/collider.h>
+#include <babylon/core/array_view.h>
 #include <babylon/culling/icullable.h>
 #include <babylon/culling/octrees/octree.h>
 #include <babylon/interfaces/idisposable.h>
@@ -322,6 +323,21 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view over the requested vertex data kind, without copying it.
+   * Implemented by child classes.
+   * @param kind defines the vertex data kind to use
+   * @returns an empty view
+   */
+  virtual ConstFloat32ArrayView getVerticesDataView(const std::string& kind);
+
+  /**
+   * @brief Returns a read-only view over the indices, without copying them. Implemented by child
+   * classes.
+   * @returns an empty view
+   */
+  virtual ConstIndicesArrayView getIndicesView();
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and
@@ -535,13 +551,20 @@ public:
   /**
    * @brief Hidden
    */
-  void _refreshBoundingInfo(const Float32Array& data, const std::optional<Vector2>& bias);
+  void _refreshBoundingInfo(const ConstFloat32ArrayView& data, const std::optional<Vector2>& bias);
 
   /**
    * @brief Hidden
    */
   Float32Array _getPositionData(bool applySkeleton);
 
+  /**
+   * @brief Hidden
+   * Returns a view over the geometry positions when no skinning has to be applied, otherwise
+   * stores the skinned positions in storage and returns a view over it.
+   */
+  ConstFloat32ArrayView _getPositionDataView(bool applySkeleton, Float32Array& storage);
+
   /**
    * @brief Hidden
    */
@@ -0,0 +1,98 @@
+#ifndef BABYLON_MESHES_COMPRESSION_MESHOPT_COMPRESSION_H
+#define BABYLON_MESHES_COMPRESSION_MESHOPT_COMPRESSION_H
+
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Decoder of the meshoptimizer vertex codec, index codecs and filters, as used by the
+ * EXT_meshopt_compression glTF extension.
+ *
+ * The decoding functions throw a std::runtime_error when the encoded data is malformed.
+ * @see https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+ */
+struct BABYLON_SHARED_EXPORT MeshoptCompression {
+
+  /**
+   * @brief Decodes vertex data encoded with the vertex codec (version 0).
+   * @param destination receives vertexCount * vertexSize bytes
+   * @param vertexCount the number of vertices
+   * @param vertexSize the size of a vertex in bytes, a multiple of 4 up to 256
+   * @param buffer the encoded data
+   * @param bufferSize the size of the encoded data in bytes
+   */
+  static void DecodeVertexBuffer(uint8_t* destination, size_t vertexCount, size_t vertexSize,
+                                 const uint8_t* buffer, size_t bufferSize);
+
+  /**
+   * @brief Decodes triangle indices encoded with the index codec (versions 0 and 1).
+   * @param destination receives indexCount indices of indexSize bytes
+   * @param indexCount the number of indices, a multiple of 3
+   * @param indexSize the size of an index in bytes, 2 or 4
+   * @param buffer the encoded data
+   * @param bufferSize the size of the encoded data in bytes
+   */
+  static void DecodeIndexBuffer(uint8_t* destination, size_t indexCount, size_t indexSize,
+                                const uint8_t* buffer, size_t bufferSize);
+
+  /**
+   * @brief Decodes an index sequence encoded with the index sequence codec.
+   * @param destination receives indexCount indices of indexSize bytes
+   * @param indexCount the number of indices
+   * @param indexSize the size of an index in bytes, 2 or 4
+   * @param buffer the encoded data
+   * @param bufferSize the size of the encoded data in bytes
+   */
+  static void DecodeIndexSequence(uint8_t* destination, size_t indexCount, size_t indexSize,
+                                  const uint8_t* buffer, size_t bufferSize);
+
+  /**
+   * @brief Decodes octahedral encoded unit vectors in place (4 signed normalized components per
+   * element, the fourth one being preserved).
+   * @param data the data to decode
+   * @param count the number of elements
+   * @param stride the size of an element in bytes, 4 (8-bit components) or 8 (16-bit components)
+   */
+  static void DecodeFilterOct(uint8_t* data, size_t count, size_t stride);
+
+  /**
+   * @brief Decodes quaternions encoded with 3 components and the index of the largest one in
+   * place (4 signed normalized 16-bit components per element).
+   * @param data the data to decode
+   * @param count the number of elements
+   * @param stride the size of an element in bytes, 8
+   */
+  static void DecodeFilterQuat(uint8_t* data, size_t count, size_t stride);
+
+  /**
+   * @brief Decodes floats encoded with a 24-bit mantissa and an 8-bit exponent in place.
+   * @param data the data to decode
+   * @param count the number of elements
+   * @param stride the size of an element in bytes, a multiple of 4
+   */
+  static void DecodeFilterExp(uint8_t* data, size_t count, size_t stride);
+
+  /**
+   * @brief Decodes the data of a compressed glTF buffer view.
+   * @param source the encoded data
+   * @param sourceSize the size of the encoded data in bytes
+   * @param count the number of elements
+   * @param stride the size of an element in bytes
+   * @param mode the compression mode ("ATTRIBUTES", "TRIANGLES" or "INDICES")
+   * @param filter the filter applied to the attributes ("NONE", "OCTAHEDRAL", "QUATERNION" or
+   * "EXPONENTIAL")
+   * @returns the decoded data, count * stride bytes
+   */
+  static ArrayBuffer DecodeGltfBuffer(const uint8_t* source, size_t sourceSize, size_t count,
+                                      size_t stride, const std::string& mode,
+                                      const std::string& filter = "NONE");
+
+}; // end of struct MeshoptCompression
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_COMPRESSION_MESHOPT_COMPRESSION_H
@@ -0,0 +1,84 @@
+#ifndef BABYLON_MESHES_CSG_BVH_H
+#define BABYLON_MESHES_CSG_BVH_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+class Vector3;
+
+namespace CSG {
+
+class Plane;
+class Vertex;
+struct PolygonArena;
+
+/**
+ * @brief Bounding volume hierarchy over the triangles of a set of polygons, used by the CSG
+ * operations to find the polygons crossing a polygon of the other solid and to classify points
+ * against a solid.
+ *
+ * The hierarchy is stored in a flat array and traversed without recursion. Queries do not modify
+ * it and can run from several threads.
+ */
+class BABYLON_SHARED_EXPORT BVH {
+
+public:
+  /**
+   * @brief Builds the hierarchy over the fan triangulation of the polygons.
+   * @param polygons the polygons, which are not referenced after the construction
+   */
+  BVH(const PolygonArena& polygons);
+  ~BVH(); // = default
+
+  /**
+   * @brief Collects the polygons intersecting a convex polygon, including the coplanar polygons
+   * overlapping its bounding box.
+   * @param vertices the vertices of the convex polygon
+   * @param count the number of vertices
+   * @param plane the plane of the convex polygon
+   * @param result receives the sorted indices of the intersecting polygons
+   */
+  void intersectingPolygons(const Vertex* vertices, size_t count, const Plane& plane,
+                            std::vector<size_t>& result) const;
+
+  /**
+   * @brief Returns whether a point is inside the solid bounded by the polygons, the face nearest
+   * to the point along a ray telling on which side of the surface the point lies.
+   * @param point the point to classify
+   * @returns true if the point is inside the solid
+   */
+  [[nodiscard]] bool isInside(const Vector3& point) const;
+
+private:
+  using Float3 = std::array<float, 3>;
+
+  struct Triangle {
+    Float3 a, b, c;
+    Float3 normal;
+    size_t polygon;
+  }; // end of struct Triangle
+
+  // Inner nodes have a count of 0 and their two children at first and first + 1, leaves reference
+  // the triangles [first, first + count)
+  struct Node {
+    Float3 min, max;
+    uint32_t first;
+    uint32_t count;
+  }; // end of struct Node
+
+private:
+  std::vector<Triangle> _triangles;
+  std::vector<Node> _nodes;
+
+}; // end of class BVH
+
+} // end of namespace CSG
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_CSG_BVH_H
@@ -5,13 +5,14 @@
 #include <babylon/maths/matrix.h>
 #include <babylon/maths/quaternion.h>
 #include <babylon/maths/vector3.h>
-#include <babylon/meshes/csg/polygon.h>
+#include <babylon/meshes/csg/polygon_arena.h>
 
 namespace BABYLON {
 
 class Material;
 class Mesh;
 class Scene;
+class VertexData;
 using MaterialPtr = std::shared_ptr<Material>;
 using MeshPtr     = std::shared_ptr<Mesh>;
 
@@ -37,6 +38,13 @@ public:
    */
   static CSGPtr FromMesh(const MeshPtr& mesh);
 
+  /**
+   * @brief Convert a VertexData to CSG.
+   * @param vertexData The VertexData to convert to CSG, missing normals and uvs being zero
+   * @returns A new CSG from the VertexData
+   */
+  static CSGPtr FromVertexData(const VertexData& vertexData);
+
   /**
    * @brief Clones, or makes a deep copy, of the CSG.
    * @returns A new CSG
@@ -114,6 +122,13 @@ public:
   MeshPtr buildMeshGeometry(const std::string& name, Scene* scene = nullptr,
                             bool keepSubMeshes = false);
 
+  /**
+   * @brief Build vertex data from CSG.
+   * Coordinates are transformed back to the space of the CSG matrix
+   * @returns A new VertexData
+   */
+  [[nodiscard]] std::unique_ptr<VertexData> toVertexData() const;
+
   /**
    * @brief Build Mesh from CSG taking material and transforms into account.
    * @param name The name of the Mesh
@@ -127,10 +142,10 @@ public:
 
 private:
   /**
-   * @brief Construct a CSG solid from a list of `CSG.Polygon` instances.
+   * @brief Construct a CSG solid from a set of polygons.
    * @param polygons Polygons used to construct a CSG solid
    */
-  static CSGPtr FromPolygons(const std::vector<Polygon>& polygons);
+  static CSGPtr FromPolygons(PolygonArena&& polygons);
 
 public:
   /**
@@ -160,7 +175,7 @@ public:
 
 private:
   static unsigned int currentCSGMeshId;
-  std::vector<Polygon> _polygons;
+  PolygonArena _polygons;
 
 }; // end of class CSG
 
@@ -0,0 +1,139 @@
+#ifndef BABYLON_MESHES_CSG_POLYGON_ARENA_H
+#define BABYLON_MESHES_CSG_POLYGON_ARENA_H
+
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/meshes/csg/plane.h>
+#include <babylon/meshes/csg/polygon.h>
+#include <babylon/meshes/csg/vertex.h>
+
+namespace BABYLON {
+namespace CSG {
+
+/**
+ * @brief Set of convex polygons stored in contiguous arrays: the vertices of all the polygons
+ * follow each other in a single array and each polygon references a range of it, so that adding
+ * polygons does not allocate once the arrays have grown.
+ */
+struct BABYLON_SHARED_EXPORT PolygonArena {
+
+  /**
+   * @brief Range of vertices of a polygon and its properties.
+   */
+  struct Entry {
+    /**
+     * Index of the first vertex of the polygon
+     */
+    size_t firstVertex;
+    /**
+     * Number of vertices of the polygon
+     */
+    size_t vertexCount;
+    /**
+     * Properties that are shared across all polygons split from the same polygon
+     */
+    PolygonOptions shared;
+    /**
+     * The plane of the polygon
+     */
+    Plane plane;
+  }; // end of struct Entry
+
+  /**
+   * @brief Returns the number of polygons.
+   */
+  [[nodiscard]] size_t size() const
+  {
+    return polygons.size();
+  }
+
+  /**
+   * @brief Returns whether the arena holds no polygon.
+   */
+  [[nodiscard]] bool empty() const
+  {
+    return polygons.empty();
+  }
+
+  /**
+   * @brief Removes all the polygons, keeping the allocated memory.
+   */
+  void clear();
+
+  /**
+   * @brief Returns the first vertex of a polygon.
+   * @param index the index of the polygon
+   */
+  [[nodiscard]] const Vertex* vertexData(size_t index) const
+  {
+    return vertices.data() + polygons[index].firstVertex;
+  }
+
+  /**
+   * @brief Adds a polygon whose plane is computed from its first three vertices.
+   * @param polygonVertices the vertices of the polygon, coplanar and forming a convex loop
+   * @param count the number of vertices
+   * @param shared the properties shared across all polygons
+   * @returns false if the polygon is degenerate, in which case it is not added
+   */
+  bool add(const Vertex* polygonVertices, size_t count, const PolygonOptions& shared);
+
+  /**
+   * @brief Adds a polygon with a known plane.
+   * @param polygonVertices the vertices of the polygon, coplanar and forming a convex loop
+   * @param count the number of vertices
+   * @param shared the properties shared across all polygons
+   * @param plane the plane of the polygon
+   */
+  void add(const Vertex* polygonVertices, size_t count, const PolygonOptions& shared,
+           const Plane& plane);
+
+  /**
+   * @brief Adds a polygon of another arena, flipping it if requested.
+   * @param other the arena holding the polygon
+   * @param index the index of the polygon in the other arena
+   * @param flip whether the polygon is flipped
+   */
+  void add(const PolygonArena& other, size_t index, bool flip = false);
+
+  /**
+   * @brief Appends all the polygons of another arena.
+   * @param other the arena to append
+   */
+  void append(const PolygonArena& other);
+
+  /**
+   * @brief Flips the faces of all the polygons.
+   */
+  void flip();
+
+  /**
+   * @brief Converts the arena to a list of polygons.
+   * @returns The polygons
+   */
+  [[nodiscard]] std::vector<Polygon> toPolygons() const;
+
+  /**
+   * @brief Creates an arena from a list of polygons, skipping the polygons without plane.
+   * @param polygonList the polygons
+   * @returns The arena
+   */
+  static PolygonArena FromPolygons(const std::vector<Polygon>& polygonList);
+
+  /**
+   * The vertices of all the polygons
+   */
+  std::vector<Vertex> vertices;
+
+  /**
+   * The polygons
+   */
+  std::vector<Entry> polygons;
+
+}; // end of struct PolygonArena
+
+} // end of namespace CSG
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_CSG_POLYGON_ARENA_H
@@ -6,6 +6,7 @@
 #include <nlohmann/json_fwd.hpp>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/array_view.h>
 #include <babylon/core/structs.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 
@@ -168,6 +169,32 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Gets a read-only view over a specific vertex data, without copying it.
+   * The view is only available when the vertex buffer stores tightly packed floats, use
+   * getVerticesData() as a fallback when it is empty. The view is invalidated by any update of
+   * the vertex buffer.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @returns a view over the vertex data or an empty view
+   */
+  ConstFloat32ArrayView getVerticesDataView(const std::string& kind);
+
+  /**
+   * @brief Gets a writable view over a specific updatable vertex data, without copying it.
+   * Call updateVerticesDataFromView() once the data was modified to upload it.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @returns a view over the vertex data or an empty view if the data is not updatable or not
+   * tightly packed
+   */
+  Float32ArrayView getWritableVerticesDataView(const std::string& kind);
+
+  /**
+   * @brief Uploads the vertex data modified through a writable view and notifies the meshes.
+   * @param kind defines the data kind (Position, normal, etc...)
+   * @param updateExtends defines if the geometry extends must be recomputed
+   */
+  void updateVerticesDataFromView(const std::string& kind, bool updateExtends = false);
+
   /**
    * @brief Returns a boolean defining if the vertex data for the requested `kind` is updatable.
    * @param kind defines the data kind (Position, normal, etc...)
@@ -236,6 +263,13 @@ public:
    */
   IndicesArray getIndices(bool copyWhenShared = false, bool forceCopy = false) override;
 
+  /**
+   * @brief Gets a read-only view over the index buffer array, without copying it.
+   * The view is invalidated by any update of the indices.
+   * @returns a view over the index buffer array
+   */
+  ConstIndicesArrayView getIndicesView() const;
+
   /**
    * @brief Gets the index buffer.
    * @return the index buffer
@@ -392,8 +426,8 @@ protected:
   [[nodiscard]] bool get_doNotSerialize() const;
 
 private:
-  void _updateBoundingInfo(bool updateExtends, const Float32Array& data);
-  void _updateExtend(Float32Array data);
+  void _updateBoundingInfo(bool updateExtends, const ConstFloat32ArrayView& data);
+  void _updateExtend(const ConstFloat32ArrayView& data = {});
   void _applyToMesh(Mesh* mesh);
   void notifyUpdate(const std::string& kind = "");
   void _queueLoad(Scene* scene, const std::function<void()>& onLoaded);
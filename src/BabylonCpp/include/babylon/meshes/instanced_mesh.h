@@ -77,6 +77,11 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view over the source mesh vertex data of the requested kind.
+   */
+  ConstFloat32ArrayView getVerticesDataView(const std::string& kind) override;
+
   /**
    * @brief Sets the vertex data of the mesh geometry for the requested `kind`.
    * If the mesh has no geometry, a new Geometry object is set to the mesh and
@@ -165,6 +170,11 @@ public:
    */
   IndicesArray getIndices(bool copyWhenShared = false, bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view over the source mesh indices.
+   */
+  ConstIndicesArrayView getIndicesView() override;
+
   /**
    * @brief Hidden
    */
@@ -7,6 +7,7 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/iget_set_vertices_data.h>
 #include <babylon/meshes/vertex_data_constants.h>
+#include <babylon/meshes/vertex_quantization.h>
 
 namespace BABYLON {
 
@@ -308,6 +309,14 @@ public:
   Float32Array getVerticesData(const std::string& kind, bool copyWhenShared = false,
                                bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view over the requested vertex data kind, without copying it.
+   * @param kind defines the vertex data kind to use
+   * @returns a view over the vertex data or an empty view if the mesh has no geometry or if the
+   * vertex buffer data is not tightly packed (use getVerticesData() in that case)
+   */
+  ConstFloat32ArrayView getVerticesDataView(const std::string& kind) override;
+
   /**
    * @brief Returns the mesh VertexBuffer object from the requested `kind`.
    * @param kind defines which buffer to read from (positions, indices, normals,
@@ -413,6 +422,12 @@ public:
    */
   IndicesArray getIndices(bool copyWhenShared = false, bool forceCopy = false) override;
 
+  /**
+   * @brief Returns a read-only view over the mesh indices, without copying them.
+   * @returns a view over the indices or an empty view if the mesh has no geometry
+   */
+  ConstIndicesArrayView getIndicesView() override;
+
   /**
    * @brief Determine if the current mesh is ready to be rendered
    * @param completeCheck defines if a complete check (including materials and
@@ -711,6 +726,12 @@ public:
       onBeforeDraw,
     Material* effectiveMaterial = nullptr);
 
+  /**
+   * @brief Hidden
+   * Returns the matrix to apply before the world matrix when the positions are quantized.
+   */
+  Matrix* _getPositionDequantizationMatrix() const;
+
   /**
    * @brief Hidden
    */
@@ -976,6 +997,19 @@ public:
    */
   void forceSharedVertices();
 
+  /**
+   * @brief Converts the vertex data to compact formats to reduce the memory and bandwidth usage.
+   * Positions are stored as 16-bit normalized integers, the dequantization matrix being applied on
+   * top of the world matrix when rendering. Normals and tangents are octahedral encoded when the
+   * meshes sharing the geometry are not morphed and use materials decoding them (see
+   * Material::supportsOctahedralVertexData), and texture coordinates are stored as half floats.
+   * Updatable vertex data is left untouched. Warning : the mesh is really modified and the compact
+   * vertex data can not be updated afterwards.
+   * @param options defines the vertex data to convert
+   * @returns current mesh
+   */
+  Mesh& quantizeVertexData(const VertexQuantizationOptions& options = VertexQuantizationOptions());
+
   /** Instances **/
 
   /**
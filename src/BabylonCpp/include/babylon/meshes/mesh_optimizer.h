@@ -0,0 +1,207 @@
+#ifndef BABYLON_MESHES_MESH_OPTIMIZER_H
+#define BABYLON_MESHES_MESH_OPTIMIZER_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/babylon_enums.h>
+
+namespace BABYLON {
+
+class Mesh;
+class VertexData;
+
+/**
+ * @brief Options used to optimize the vertex and index data of a mesh.
+ * @see MeshOptimizer
+ */
+struct BABYLON_SHARED_EXPORT MeshOptimizerOptions {
+  /**
+   * Merges the vertices having exactly the same attributes (positions, normals, uvs, ...)
+   */
+  bool weldVertices = true;
+  /**
+   * Reorders the triangles to maximize the post-transform vertex cache hits
+   */
+  bool optimizeVertexCache = true;
+  /**
+   * The algorithm used to reorder the triangles for the vertex cache
+   */
+  VertexCacheOptimizationType vertexCacheOptimizationType = VertexCacheOptimizationType::FORSYTH;
+  /**
+   * Reorders clusters of triangles so that the outward facing ones are drawn first, which reduces
+   * the overdraw
+   */
+  bool optimizeOverdraw = true;
+  /**
+   * Defines how much the ACMR can be degraded by the overdraw optimization (1.05 means 5% worse)
+   */
+  float overdrawThreshold = 1.05f;
+  /**
+   * Reorders the vertices in the order they are referenced by the index buffer, which also removes
+   * the unused vertices
+   */
+  bool optimizeVertexFetch = true;
+  /**
+   * Size of the simulated FIFO cache used by Tipsify, the overdraw clustering and the statistics
+   */
+  unsigned int cacheSize = 16;
+}; // end of struct MeshOptimizerOptions
+
+/**
+ * @brief Statistics reported by the mesh optimizer.
+ */
+struct BABYLON_SHARED_EXPORT MeshOptimizerStatistics {
+  /**
+   * Number of vertices before and after the optimization
+   */
+  size_t verticesBefore = 0;
+  size_t verticesAfter  = 0;
+  /**
+   * Average cache miss ratio (transformed vertices per triangle, 0.5 is optimal for a regular
+   * grid and 3 the worst case) before and after the optimization
+   */
+  float acmrBefore = 0.f;
+  float acmrAfter  = 0.f;
+  /**
+   * Average transformed vertex ratio (transformed vertices per vertex, 1 is optimal) before and
+   * after the optimization
+   */
+  float atvrBefore = 0.f;
+  float atvrAfter  = 0.f;
+}; // end of struct MeshOptimizerStatistics
+
+/**
+ * @brief Optimizes the vertex and index data of triangle meshes for the GPU: duplicate vertex
+ * welding, triangle reordering for the post-transform vertex cache and overdraw, and vertex
+ * reordering for fetch locality.
+ *
+ * The triangles are only reordered within the index range of each sub-mesh, so multi-material
+ * meshes keep their sub-meshes. The winding of each triangle is preserved.
+ */
+class BABYLON_SHARED_EXPORT MeshOptimizer {
+
+public:
+  /**
+   * @brief Optimizes the geometry of a mesh in place. The geometry is modified for all the meshes
+   * sharing it.
+   * Vertices are not welded nor reordered for meshes with morph targets (as the targets are
+   * indexed by vertex) or using compact vertex formats, only the triangles are reordered.
+   * @param mesh defines the mesh to optimize
+   * @param options defines the optimization options
+   * @returns the optimization statistics
+   */
+  static MeshOptimizerStatistics OptimizeMesh(Mesh* mesh,
+                                              const MeshOptimizerOptions& options
+                                              = MeshOptimizerOptions());
+
+  /**
+   * @brief Optimizes vertex data in place.
+   * @param vertexData defines the vertex data to optimize
+   * @param options defines the optimization options
+   * @returns the optimization statistics
+   */
+  static MeshOptimizerStatistics OptimizeVertexData(VertexData& vertexData,
+                                                    const MeshOptimizerOptions& options
+                                                    = MeshOptimizerOptions());
+
+  /**
+   * @brief Computes the average cache miss ratio of an index buffer using a FIFO cache model.
+   * @param indices defines the indices of the triangles
+   * @param vertexCount defines the number of vertices referenced by the indices
+   * @param cacheSize defines the size of the simulated cache
+   * @returns the number of cache misses per triangle
+   */
+  static float ComputeACMR(const IndicesArray& indices, size_t vertexCount,
+                           unsigned int cacheSize = 16);
+
+  /**
+   * @brief Computes the average transformed vertex ratio of an index buffer using a FIFO cache
+   * model.
+   * @param indices defines the indices of the triangles
+   * @param vertexCount defines the number of vertices referenced by the indices
+   * @param cacheSize defines the size of the simulated cache
+   * @returns the number of cache misses per vertex
+   */
+  static float ComputeATVR(const IndicesArray& indices, size_t vertexCount,
+                           unsigned int cacheSize = 16);
+
+  /**
+   * @brief Reorders triangles using Tom Forsyth's linear-speed vertex cache optimization.
+   * @param indices defines the indices of the triangles
+   * @param vertexCount defines the number of vertices referenced by the indices
+   * @returns the reordered indices
+   */
+  static IndicesArray OptimizeVertexCacheForsyth(const IndicesArray& indices, size_t vertexCount);
+
+  /**
+   * @brief Reorders triangles using the Tipsify algorithm.
+   * @param indices defines the indices of the triangles
+   * @param vertexCount defines the number of vertices referenced by the indices
+   * @param cacheSize defines the size of the targeted FIFO cache
+   * @returns the reordered indices
+   */
+  static IndicesArray OptimizeVertexCacheTipsify(const IndicesArray& indices, size_t vertexCount,
+                                                 unsigned int cacheSize = 16);
+
+  /**
+   * @brief Reorders clusters of triangles to reduce the overdraw, the triangles being expected to
+   * be optimized for the vertex cache first.
+   * @param indices defines the indices of the triangles
+   * @param positions defines the vertex positions (3 floats per vertex)
+   * @param threshold defines how much the ACMR can be degraded by the clustering
+   * @param cacheSize defines the size of the simulated FIFO cache
+   * @returns the reordered indices
+   */
+  static IndicesArray OptimizeOverdraw(const IndicesArray& indices, const Float32Array& positions,
+                                       float threshold = 1.05f, unsigned int cacheSize = 16);
+
+  /**
+   * @brief Generates the remap table merging the vertices having identical attributes.
+   * @param streams defines the vertex attributes, each stream containing componentCount floats
+   * per vertex
+   * @param vertexCount defines the number of vertices
+   * @param remap receives the new index of each vertex
+   * @returns the number of unique vertices
+   */
+  static size_t GenerateVertexRemap(const std::vector<const Float32Array*>& streams,
+                                    size_t vertexCount, Uint32Array& remap);
+
+  /**
+   * @brief Generates the remap table ordering the vertices by first use in the index buffer.
+   * Unused vertices are mapped to InvalidIndex.
+   * @param indices defines the indices of the triangles
+   * @param vertexCount defines the number of vertices
+   * @param remap receives the new index of each vertex
+   * @returns the number of used vertices
+   */
+  static size_t GenerateVertexFetchRemap(const IndicesArray& indices, size_t vertexCount,
+                                         Uint32Array& remap);
+
+  /**
+   * @brief Applies a remap table to an index buffer and vertex attributes streams.
+   * @param remap defines the new index of each vertex (InvalidIndex for removed vertices)
+   * @param newVertexCount defines the number of vertices after remapping
+   * @param indices defines the indices to update
+   * @param streams defines the vertex attributes to update
+   */
+  static void ApplyVertexRemap(const Uint32Array& remap, size_t newVertexCount,
+                               IndicesArray& indices, const std::vector<Float32Array*>& streams);
+
+public:
+  /**
+   * Value used in the remap tables for removed vertices
+   */
+  static constexpr uint32_t InvalidIndex = 0xffffffff;
+
+private:
+  static MeshOptimizerStatistics
+  _Optimize(const std::vector<Float32Array*>& streams, Float32Array* positions,
+            IndicesArray& indices, size_t& vertexCount,
+            const std::vector<std::pair<size_t, size_t>>& indexRanges, bool remapVertices,
+            const MeshOptimizerOptions& options);
+
+}; // end of class MeshOptimizer
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_MESH_OPTIMIZER_H
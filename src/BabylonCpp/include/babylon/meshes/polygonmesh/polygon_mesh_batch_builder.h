@@ -0,0 +1,150 @@
+#ifndef BABYLON_MESHES_POLYGONMESH_POLYGON_MESH_BATCH_BUILDER_H
+#define BABYLON_MESHES_POLYGONMESH_POLYGON_MESH_BATCH_BUILDER_H
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class Mesh;
+class Scene;
+class Vector2;
+class VertexData;
+using MeshPtr = std::shared_ptr<Mesh>;
+
+/**
+ * @brief Vertices and indices of a polygon in the buffers built by a PolygonMeshBatchBuilder.
+ */
+struct PolygonMeshBatchRange {
+  unsigned int verticesStart = 0;
+  size_t verticesCount       = 0;
+  unsigned int indexStart    = 0;
+  size_t indexCount          = 0;
+}; // end of struct PolygonMeshBatchRange
+
+/**
+ * @brief Builds many polygons (e.g. building footprints) into a single vertex and index buffer.
+ *
+ * Each polygon gets the geometry PolygonMeshBuilder builds for it, optionally extruded to its own
+ * depth. Compared with one PolygonMeshBuilder per polygon:
+ * - the points of all the polygons are stored in a single array of coordinates;
+ * - the polygons are triangulated in parallel, by chunks, and their vertices and indices are
+ *   written in parallel directly into the shared buffers, at offsets computed from the triangle
+ *   counts;
+ * - the result is a single mesh, the polygons being identified by their range in the buffers, a
+ *   submesh per polygon or a vertex attribute holding the polygon index.
+ */
+class BABYLON_SHARED_EXPORT PolygonMeshBatchBuilder {
+
+public:
+  /**
+   * Vertex attribute holding the index of the polygon of each vertex (as a float, exact below
+   * 2^24 polygons)
+   */
+  static constexpr const char* PolygonIdKind = "polygonId";
+
+public:
+  /**
+   * @brief Creates a PolygonMeshBatchBuilder.
+   * @param name name of the mesh to build
+   * @param scene scene to add to when creating the mesh
+   */
+  PolygonMeshBatchBuilder(const std::string& name, Scene* scene);
+  ~PolygonMeshBatchBuilder(); // = default
+
+  /**
+   * @brief Reserves the storage for the polygons to add.
+   * @param polygonCount number of polygons
+   * @param pointCount total number of points of the polygons, holes included
+   */
+  void reserve(size_t polygonCount, size_t pointCount);
+
+  /**
+   * @brief Adds a polygon.
+   * @param coordinates interleaved x, y coordinates of the contour followed by the holes. A last
+   * point of a ring equal to its first point is ignored
+   * @param holeIndices index of the first point of each hole in the coordinates
+   * @param depth extrusion depth, the polygon is flat if not positive
+   * @returns the index of the polygon
+   */
+  size_t addPolygon(const Float32Array& coordinates, const Uint32Array& holeIndices = {},
+                    float depth = 0.f);
+
+  /**
+   * @brief Adds a polygon.
+   * @param contour points of the contour
+   * @param holes points of each hole within the polygon
+   * @param depth extrusion depth, the polygon is flat if not positive
+   * @returns the index of the polygon
+   */
+  size_t addPolygon(const std::vector<Vector2>& contour,
+                    const std::vector<std::vector<Vector2>>& holes = {}, float depth = 0.f);
+
+  /**
+   * @brief Gets the number of polygons added.
+   */
+  [[nodiscard]] size_t polygonCount() const;
+
+  /**
+   * @brief Removes all the polygons.
+   */
+  void clear();
+
+  /**
+   * @brief Creates the mesh of all the polygons.
+   * @param updatable If the mesh should be updatable
+   * @param createSubMeshes If a submesh should be created for each polygon
+   * @param addPolygonIds If the index of the polygon of each vertex should be stored in the
+   * PolygonIdKind vertex attribute
+   * @returns the created mesh
+   */
+  MeshPtr build(bool updatable = false, bool createSubMeshes = false, bool addPolygonIds = false);
+
+  /**
+   * @brief Creates the vertex data of all the polygons and updates their ranges.
+   * @returns the vertex data
+   */
+  std::unique_ptr<VertexData> buildVertexData();
+
+  /**
+   * @brief Gets the range of each polygon in the buffers of the last built vertex data.
+   */
+  [[nodiscard]] const std::vector<PolygonMeshBatchRange>& ranges() const;
+
+private:
+  /**
+   * Points of a polygon, as indices in the coordinates and hole indices arrays
+   */
+  struct PolygonEntry {
+    size_t pointStart;
+    size_t pointCount;
+    size_t holeStart;
+    size_t holeCount;
+    float depth;
+  }; // end of struct PolygonEntry
+
+  /**
+   * @brief Ends the ring of the polygon whose coordinates start at the given offset, ignoring its
+   * last point if it closes the ring, and an empty hole.
+   */
+  void _endRing(PolygonEntry& entry, size_t ringStart, bool isHole);
+
+private:
+  std::string _name;
+  Scene* _scene;
+  // Interleaved x, y coordinates of the points of all the polygons
+  Float32Array _coordinates;
+  // Index of the first point of each hole in its polygon
+  Uint32Array _holeIndices;
+  std::vector<PolygonEntry> _polygons;
+  std::vector<PolygonMeshBatchRange> _ranges;
+
+}; // end of class PolygonMeshBatchBuilder
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_POLYGONMESH_POLYGON_MESH_BATCH_BUILDER_H
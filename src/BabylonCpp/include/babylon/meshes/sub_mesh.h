@@ -72,7 +72,7 @@ public:
    * @param data defines an optional position array to use to determine the bounding info
    * @returns the SubMesh
    */
-  SubMesh& refreshBoundingInfo(const Float32Array& data = {});
+  SubMesh& refreshBoundingInfo(const ConstFloat32ArrayView& data = {});
 
   /**
    * @brief Hidden
@@ -107,7 +107,7 @@ public:
    * @brief Returns a new Index Buffer.
    * @returns The WebGLBuffer.
    */
-  WebGLDataBufferPtr& _getLinesIndexBuffer(const IndicesArray& indices, Engine* engine);
+  WebGLDataBufferPtr& _getLinesIndexBuffer(const ConstIndicesArrayView& indices, Engine* engine);
 
   /**
    * @brief Returns if the passed Ray intersects the submesh bounding box.
@@ -125,7 +125,7 @@ public:
    * @returns intersection info or null if no intersection
    */
   std::optional<IntersectionInfo>
-  intersects(Ray& ray, const std::vector<Vector3>& positions, const IndicesArray& indices,
+  intersects(Ray& ray, const std::vector<Vector3>& positions, const ConstIndicesArrayView& indices,
              bool fastCheck = false, const TrianglePickingPredicate& trianglePredicate = nullptr);
 
   /**
@@ -181,24 +181,24 @@ protected:
 private:
   /** Hidden */
   std::optional<IntersectionInfo> _intersectLines(Ray& ray, const std::vector<Vector3>& positions,
-                                                  const IndicesArray& indices,
+                                                  const ConstIndicesArrayView& indices,
                                                   float intersectionThreshold,
                                                   bool fastCheck = false);
   /** Hidden */
   std::optional<IntersectionInfo> _intersectUnIndexedLines(Ray& ray,
                                                            const std::vector<Vector3>& positions,
-                                                           const IndicesArray& indices,
+                                                           const ConstIndicesArrayView& indices,
                                                            float intersectionThreshold,
                                                            bool fastCheck = false);
   /** Hidden */
   std::optional<IntersectionInfo>
-  _intersectTriangles(Ray& ray, const std::vector<Vector3>& positions, const IndicesArray& indices,
-                      bool fastCheck                                    = false,
+  _intersectTriangles(Ray& ray, const std::vector<Vector3>& positions,
+                      const ConstIndicesArrayView& indices, bool fastCheck = false,
                       const TrianglePickingPredicate& trianglePredicate = nullptr);
   /** Hidden */
   std::optional<IntersectionInfo>
   _intersectUnIndexedTriangles(Ray& ray, const std::vector<Vector3>& positions,
-                               const IndicesArray& indices, bool fastCheck = false,
+                               const ConstIndicesArrayView& indices, bool fastCheck = false,
                                const TrianglePickingPredicate& trianglePredicate = nullptr);
 
 public:
@@ -13,6 +13,7 @@ namespace BABYLON {
 class Buffer;
 class DataView;
 class Engine;
+class Matrix;
 class Scene;
 class WebGLDataBuffer;
 using WebGLDataBufferPtr = std::shared_ptr<WebGLDataBuffer>;
@@ -140,6 +141,11 @@ public:
    */
   static constexpr const unsigned int FLOAT = 5126;
 
+  /**
+   * The half float type.
+   */
+  static constexpr const unsigned int HALF_FLOAT = 5131;
+
 public:
   /**
    * @brief Constructor
@@ -228,6 +234,13 @@ public:
    */
   [[nodiscard]] size_t getSize() const;
 
+  /**
+   * @brief Returns the number of components per vertex once decoded (integer).
+   * This differs from getSize() for octahedral encoded vectors, which store one component less.
+   * @returns the size in float of the decoded data
+   */
+  [[nodiscard]] size_t getDecodedSize() const;
+
   /**
    * @brief Gets a boolean indicating is the internal buffer of the VertexBuffer is instanced.
    * @returns true if this buffer is instanced
@@ -283,6 +296,15 @@ public:
    */
   void forEach(size_t count, const std::function<void(float value, size_t index)>& callback);
 
+  /**
+   * @brief Gets the vertex data decoded as tightly packed floats.
+   * Normalized integers, half floats, octahedral encoded vectors and quantized positions are
+   * converted back to their floating point values.
+   * @param totalVertices the number of vertices to decode
+   * @returns the decoded data
+   */
+  Float32Array getFloatData(size_t totalVertices);
+
   /**
    * @brief Gets the byte length of the given type.
    * @param type the type
@@ -337,6 +359,7 @@ private:
 
   static float _GetFloatValue(const DataView& dataView, unsigned int type, size_t byteOffset,
                               bool normalized);
+  static float _GetFloatValue(const uint8_t* bytes, unsigned int type, bool normalized);
 
 public:
   /**
@@ -375,6 +398,18 @@ public:
    */
   unsigned int type;
 
+  /**
+   * Gets whether the data stores unit vectors using the octahedral encoding (2 components,
+   * followed by the bitangent sign for tangents).
+   */
+  bool octahedralEncoded;
+
+  /**
+   * Gets the matrix transforming the stored values to the actual data, used by quantized positions
+   * (null when the data is stored as is).
+   */
+  std::unique_ptr<Matrix> dequantizationMatrix;
+
 private:
   std::string _kind;
   size_t _size;
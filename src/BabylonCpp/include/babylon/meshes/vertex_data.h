@@ -589,10 +589,12 @@ public:
    * location
    * * depthSortedFacets : optional array of depthSortedFacets to store the
    * facet distances from the reference location
+   * The facet data is written in place in the options arrays. Large meshes are processed in
+   * parallel on the default thread pool, the result being identical to a sequential computation.
    */
-  static void ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
-                             Float32Array& normals,
-                             std::optional<FacetParameters> options = std::nullopt);
+  static void ComputeNormals(const ConstFloat32ArrayView& positions,
+                             const ConstIndicesArrayView& indices, Float32Array& normals,
+                             FacetParameters* options = nullptr);
 
   /**
    * @brief Applies VertexData created from the imported parameters to the
@@ -628,6 +630,16 @@ private:
   static std::unique_ptr<VertexData> _ExtractFrom(IGetSetVerticesData* meshOrGeometry,
                                                   bool copyWhenShared = false,
                                                   bool forceCopy      = false);
+  // Writes the normals of the [faceBegin, faceEnd) facets at the start of faceNormals
+  static void _ComputeFaceNormals(const ConstFloat32ArrayView& positions,
+                                  const ConstIndicesArrayView& indices, size_t faceBegin,
+                                  size_t faceEnd, float faceNormalSign, float* faceNormals);
+
+private:
+  // Number of facets per parallel task in ComputeNormals
+  static constexpr size_t _NormalsFaceChunkSize = 8192;
+  // Number of vertices per parallel task in ComputeNormals
+  static constexpr size_t _NormalsVertexChunkSize = 16384;
 
 public:
   /**
@@ -0,0 +1,140 @@
+#ifndef BABYLON_MESHES_VERTEX_QUANTIZATION_H
+#define BABYLON_MESHES_VERTEX_QUANTIZATION_H
+
+#include <string>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class AbstractMesh;
+class Matrix;
+
+/**
+ * @brief Options used to convert the vertex data of a mesh to compact formats.
+ * @see Mesh::quantizeVertexData
+ */
+struct BABYLON_SHARED_EXPORT VertexQuantizationOptions {
+  /**
+   * Stores the positions as 16-bit normalized integers (8 bytes per vertex instead of 12), the
+   * dequantization matrix being applied on top of the world matrix when rendering. Ignored when a
+   * mesh sharing the geometry is skinned or morphed, as bones and morph targets operate on the
+   * actual positions.
+   */
+  bool positions = true;
+  /**
+   * Stores the normals as octahedral encoded 16-bit normalized integers (4 bytes per vertex
+   * instead of 12). Ignored for morphed meshes and meshes whose material does not decode them
+   */
+  bool normals = true;
+  /**
+   * Stores the tangents as octahedral encoded 16-bit normalized integers plus the bitangent sign
+   * (8 bytes per vertex instead of 16). Ignored as the normals are
+   */
+  bool tangents = true;
+  /**
+   * Stores the texture coordinates as half floats (4 bytes per vertex instead of 8). Half floats
+   * keep 11 bits of precision, which is enough for coordinates in the [-2, 2] range
+   */
+  bool uvs = true;
+}; // end of struct VertexQuantizationOptions
+
+/**
+ * @brief Encoding and decoding helpers for the compact vertex formats.
+ *
+ * The encoded data is stored in the Float32Array storage used by the vertex buffers, the bytes
+ * being uploaded as is and interpreted by the GPU according to the vertex buffer type.
+ */
+struct BABYLON_SHARED_EXPORT VertexQuantization {
+
+  /**
+   * Byte stride of quantized positions (3 components, padded to 4 bytes)
+   */
+  static constexpr size_t PositionByteStride = 8;
+  /**
+   * Byte stride of octahedral encoded normals (2 components)
+   */
+  static constexpr size_t NormalByteStride = 4;
+  /**
+   * Byte stride of octahedral encoded tangents (2 components plus the sign, padded to 4 bytes)
+   */
+  static constexpr size_t TangentByteStride = 8;
+  /**
+   * Byte stride of half float texture coordinates (2 components)
+   */
+  static constexpr size_t UVByteStride = 4;
+
+  /**
+   * @brief Quantizes positions to 16-bit unsigned normalized integers.
+   * A single scale is used for the 3 axes so that the dequantization matrix only contains a uniform
+   * scaling and a translation, which keeps the normals transformed by the world matrix valid.
+   * @param positions the positions to quantize (3 floats per vertex)
+   * @param dequantizationMatrix receives the matrix transforming the normalized values back to
+   * positions
+   * @returns the encoded positions, using PositionByteStride bytes per vertex
+   */
+  static Float32Array QuantizePositions(const Float32Array& positions,
+                                        Matrix& dequantizationMatrix);
+
+  /**
+   * @brief Encodes unit vectors using the octahedral mapping on 16-bit signed normalized integers.
+   * @param vectors the vectors to encode (3 floats per vertex, or 4 for tangents in which case the
+   * fourth component is the bitangent sign)
+   * @param componentCount 3 for normals, 4 for tangents
+   * @returns the encoded vectors, using NormalByteStride or TangentByteStride bytes per vertex
+   */
+  static Float32Array EncodeOctahedral(const Float32Array& vectors, size_t componentCount);
+
+  /**
+   * @brief Encodes floats as half floats.
+   * @param values the values to encode (2 floats per vertex)
+   * @returns the encoded values, using UVByteStride bytes per vertex
+   */
+  static Float32Array EncodeHalfFloats(const Float32Array& values);
+
+  /**
+   * @brief Maps a unit vector to the [-1, 1] square using the octahedral mapping.
+   * @param x defines the x coordinate of the vector
+   * @param y defines the y coordinate of the vector
+   * @param z defines the z coordinate of the vector
+   * @param u receives the first coordinate on the square
+   * @param v receives the second coordinate on the square
+   */
+  static void OctahedralEncode(float x, float y, float z, float& u, float& v);
+
+  /**
+   * @brief Maps a point of the [-1, 1] square back to a unit vector.
+   * @param u defines the first coordinate on the square
+   * @param v defines the second coordinate on the square
+   * @param result receives the 3 coordinates of the unit vector
+   */
+  static void OctahedralDecode(float u, float v, float* result);
+
+  /**
+   * @brief Converts a float to its IEEE 754 half precision representation (rounded to nearest).
+   * @param value the value to convert
+   * @returns the half float bits
+   */
+  static uint16_t ToHalfFloat(float value);
+
+  /**
+   * @brief Converts the IEEE 754 half precision representation to a float.
+   * @param value the half float bits
+   * @returns the float value
+   */
+  static float FromHalfFloat(uint16_t value);
+
+  /**
+   * @brief Returns whether or not the given vertex data of a mesh is octahedral encoded.
+   * @param mesh the mesh to check
+   * @param kind the vertex data kind (normal or tangent)
+   * @returns true if the data is octahedral encoded
+   */
+  static bool IsOctahedralEncoded(AbstractMesh* mesh, const std::string& kind);
+
+}; // end of struct VertexQuantization
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MESHES_VERTEX_QUANTIZATION_H
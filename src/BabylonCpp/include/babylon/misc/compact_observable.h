@@ -0,0 +1,294 @@
+#ifndef BABYLON_MISC_COMPACT_OBSERVABLE_H
+#define BABYLON_MISC_COMPACT_OBSERVABLE_H
+
+#include <algorithm>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/core/inline_function.h>
+#include <babylon/misc/event_state.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Handle of an observer registered to a CompactObservable. The default handle does not
+ * refer to any observer.
+ */
+struct CompactObserverHandle {
+  uint32_t generation = 0;
+
+  explicit operator bool() const
+  {
+    return generation != 0;
+  }
+
+  bool operator==(const CompactObserverHandle& other) const
+  {
+    return generation == other.generation;
+  }
+
+  bool operator!=(const CompactObserverHandle& other) const
+  {
+    return generation != other.generation;
+  }
+}; // end of struct CompactObserverHandle
+
+/**
+ * @brief Allocation-free implementation of the Observable pattern, for the hooks notified many
+ * times per frame.
+ *
+ * Compared with Observable:
+ * - the observers are stored by value in a contiguous array and their callbacks in an inline
+ *   buffer, so that adding an observer does not allocate once the array has grown, and notifying
+ *   does not go through shared pointers;
+ * - the observers are referred to by a handle holding the generation at which they were added;
+ * - the observers removed while notifying are only flagged, and the ones added while notifying
+ *   are kept aside, the array being updated once the outermost notification is done, so that the
+ *   callbacks never move while they are called. The observers added while notifying are called
+ *   from the next notification;
+ * - hasObservers() and the notification of an observable without observers only read a counter;
+ * - the "lastReturnValue" of the event state is not set.
+ */
+template <class T, std::size_t CallbackCapacity = 4 * sizeof(void*)>
+class CompactObservable {
+
+public:
+  using CallbackFunc = InlineFunction<void(T* eventData, EventState& eventState), CallbackCapacity>;
+
+public:
+  CompactObservable()
+      : _eventState{0}, _activeCount{0}, _generation{0}, _notifyingDepth{0}, _dirty{false}
+  {
+  }
+
+  CompactObservable(const CompactObservable&) = delete;
+  CompactObservable& operator=(const CompactObservable&) = delete;
+
+  ~CompactObservable() = default;
+
+  /**
+   * @brief Registers a new observer with the specified callback.
+   * @param callback the callback that will be executed for that observer
+   * @param mask the mask used to filter observers
+   * @param insertFirst if true the callback will be inserted at the first position, hence executed
+   * before the others ones
+   * @param unregisterOnFirstCall defines if the observer as to be unregistered after the next
+   * notification
+   * @returns the handle of the new observer, or an empty handle if the callback is empty
+   */
+  CompactObserverHandle add(CallbackFunc&& callback, int mask = -1, bool insertFirst = false,
+                            bool unregisterOnFirstCall = false)
+  {
+    if (!callback) {
+      return CompactObserverHandle{};
+    }
+
+    if (++_generation == 0) {
+      ++_generation;
+    }
+    Entry entry{std::move(callback), mask, _generation, unregisterOnFirstCall, false};
+    if (_notifyingDepth > 0) {
+      // Growing the array would move the callbacks being called
+      (insertFirst ? _pendingFirst : _pendingLast).emplace_back(std::move(entry));
+      _dirty = true;
+    }
+    else if (insertFirst) {
+      _observers.insert(_observers.begin(), std::move(entry));
+    }
+    else {
+      _observers.emplace_back(std::move(entry));
+    }
+    ++_activeCount;
+
+    return CompactObserverHandle{_generation};
+  }
+
+  /**
+   * @brief Registers a new observer with the specified callback, which is unregistered after the
+   * next notification.
+   * @param callback the callback that will be executed for that observer
+   * @returns the handle of the new observer
+   */
+  CompactObserverHandle addOnce(CallbackFunc&& callback)
+  {
+    return add(std::move(callback), -1, false, true);
+  }
+
+  /**
+   * @brief Removes an observer from the observable.
+   * @param handle the handle of the observer to remove
+   * @returns false if it doesn't belong to this observable
+   */
+  bool remove(const CompactObserverHandle& handle)
+  {
+    if (!handle) {
+      return false;
+    }
+
+    for (auto* observers : {&_observers, &_pendingFirst, &_pendingLast}) {
+      auto it = std::find_if(observers->begin(), observers->end(), [&handle](const Entry& entry) {
+        return entry.generation == handle.generation;
+      });
+      if (it != observers->end() && !it->removed) {
+        _markRemoved(*it);
+        _compact();
+        return true;
+      }
+    }
+
+    return false;
+  }
+
+  /**
+   * @brief Notifies all observers by calling their respective callback with the given data.
+   * @param eventData defines the data to send to all observers
+   * @param mask defines the mask of the current notification (observers with incompatible mask
+   * (ie mask & observer.mask === 0) will not be notified)
+   * @param target defines the original target of the state
+   * @param currentTarget defines the current target of the state
+   * @returns false if the complete observer chain was not processed (because one observer set the
+   * skipNextObservers to true)
+   */
+  bool notifyObservers(T* eventData = nullptr, int mask = -1, any* target = nullptr,
+                       any* currentTarget = nullptr)
+  {
+    if (_activeCount == 0) {
+      return true;
+    }
+
+    auto& state             = _eventState;
+    state.mask              = mask;
+    state.target            = target;
+    state.currentTarget     = currentTarget;
+    state.skipNextObservers = false;
+
+    ++_notifyingDepth;
+    auto completed = true;
+    for (auto& entry : _observers) {
+      if (entry.removed || !(entry.mask & mask)) {
+        continue;
+      }
+
+      if (entry.unregisterOnNextCall) {
+        // The callback is only destroyed after the iteration
+        _markRemoved(entry);
+      }
+      entry.callback(eventData, state);
+
+      if (state.skipNextObservers) {
+        completed = false;
+        break;
+      }
+    }
+    --_notifyingDepth;
+
+    _compact();
+    return completed;
+  }
+
+  /**
+   * @brief Gets a boolean indicating if the observable has at least one observer.
+   */
+  [[nodiscard]] bool hasObservers() const
+  {
+    return _activeCount != 0;
+  }
+
+  /**
+   * @brief Gets the number of observers.
+   */
+  [[nodiscard]] size_t observerCount() const
+  {
+    return _activeCount;
+  }
+
+  /**
+   * @brief Does this observable handles observer registered with a given mask.
+   * @param mask defines the mask to be tested
+   * @return whether or not one observer registered with the given mask is handeled
+   */
+  [[nodiscard]] bool hasSpecificMask(int mask = -1) const
+  {
+    for (const auto* observers : {&_observers, &_pendingFirst, &_pendingLast}) {
+      for (const auto& entry : *observers) {
+        if (!entry.removed && (entry.mask & mask || entry.mask == mask)) {
+          return true;
+        }
+      }
+    }
+    return false;
+  }
+
+  /**
+   * @brief Removes all the observers. The observers are only flagged when called while notifying.
+   */
+  void clear()
+  {
+    for (auto* observers : {&_observers, &_pendingFirst, &_pendingLast}) {
+      for (auto& entry : *observers) {
+        entry.removed = true;
+      }
+    }
+    _activeCount = 0;
+    _dirty       = true;
+    _compact();
+  }
+
+private:
+  struct Entry {
+    CallbackFunc callback;
+    int mask;
+    uint32_t generation;
+    bool unregisterOnNextCall;
+    bool removed;
+  }; // end of struct Entry
+
+  void _markRemoved(Entry& entry)
+  {
+    entry.removed = true;
+    _dirty        = true;
+    --_activeCount;
+  }
+
+  // Erases the removed observers and inserts the pending ones, when not iterating over them
+  void _compact()
+  {
+    if (!_dirty || _notifyingDepth > 0) {
+      return;
+    }
+    _dirty = false;
+
+    const auto isRemoved = [](const Entry& entry) { return entry.removed; };
+    _observers.erase(std::remove_if(_observers.begin(), _observers.end(), isRemoved),
+                     _observers.end());
+
+    // The last observer inserted first is notified first
+    for (auto& entry : _pendingFirst) {
+      if (!entry.removed) {
+        _observers.insert(_observers.begin(), std::move(entry));
+      }
+    }
+    _pendingFirst.clear();
+    for (auto& entry : _pendingLast) {
+      if (!entry.removed) {
+        _observers.emplace_back(std::move(entry));
+      }
+    }
+    _pendingLast.clear();
+  }
+
+private:
+  std::vector<Entry> _observers;
+  std::vector<Entry> _pendingFirst;
+  std::vector<Entry> _pendingLast;
+  EventState _eventState;
+  size_t _activeCount;
+  uint32_t _generation;
+  unsigned int _notifyingDepth;
+  bool _dirty;
+
+}; // end of class CompactObservable
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_COMPACT_OBSERVABLE_H
@@ -0,0 +1,112 @@
+#ifndef BABYLON_MISC_HIGH_DYNAMIC_RANGE_HDR_CUBE_TEXTURE_CACHE_H
+#define BABYLON_MISC_HIGH_DYNAMIC_RANGE_HDR_CUBE_TEXTURE_CACHE_H
+
+#include <array>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+
+class ArrayBufferView;
+class SphericalPolynomial;
+using SphericalPolynomialPtr = std::shared_ptr<SphericalPolynomial>;
+
+/**
+ * @brief Parameters identifying one processed HDR cube texture in the cache.
+ */
+struct BABYLON_SHARED_EXPORT HDRCubeTextureCacheKey {
+  /**
+   * Hash of the raw .hdr file contents
+   */
+  uint64_t sourceHash = 0;
+  /**
+   * Size of the generated cube faces
+   */
+  size_t size = 0;
+  /**
+   * Whether the faces were converted to gamma space
+   */
+  bool gammaSpace = false;
+  /**
+   * Whether the faces are stored as floats (otherwise RGB bytes)
+   */
+  bool textureFloat = true;
+  /**
+   * Whether the spherical polynomial was computed
+   */
+  bool generateHarmonics = true;
+
+  /**
+   * @brief Returns the file name used to store the entry in the cache directory.
+   */
+  [[nodiscard]] std::string toFileName() const;
+}; // end of struct HDRCubeTextureCacheKey
+
+/**
+ * @brief On-disk cache of the cube faces and spherical polynomial generated from an equirectangular
+ * .hdr file by the HDRCubeTexture.
+ *
+ * Converting a panorama to a cube map and extracting its harmonics is expensive. When a cache
+ * directory is set, the first load of a given file writes the ready to upload faces next to the
+ * harmonics, and later loads of the same source (same content, size and options) read them back
+ * instead of reprocessing the panorama.
+ */
+class BABYLON_SHARED_EXPORT HDRCubeTextureCache {
+
+public:
+  /**
+   * Directory where the processed textures are stored. The cache is disabled when empty.
+   */
+  static std::string CacheDirectory;
+
+  /**
+   * @brief Returns whether or not the cache is enabled.
+   */
+  static bool IsEnabled();
+
+  /**
+   * @brief Computes the cache key of a raw .hdr file.
+   * @param buffer The raw .hdr file contents
+   * @param size The cube map size
+   * @param gammaSpace Whether the faces are converted to gamma space
+   * @param textureFloat Whether the faces are stored as floats
+   * @param generateHarmonics Whether the spherical polynomial is computed
+   * @returns the cache key
+   */
+  static HDRCubeTextureCacheKey ComputeKey(const ArrayBuffer& buffer, size_t size,
+                                           bool gammaSpace, bool textureFloat,
+                                           bool generateHarmonics);
+
+  /**
+   * @brief Loads a processed texture from the cache.
+   * @param key The cache key
+   * @param faces Receives the 6 faces data, ready to upload
+   * @param sphericalPolynomial Receives the spherical polynomial if stored
+   * @returns true if the entry was found and is valid
+   */
+  static bool Load(const HDRCubeTextureCacheKey& key, std::vector<ArrayBufferView>& faces,
+                   SphericalPolynomialPtr& sphericalPolynomial);
+
+  /**
+   * @brief Stores a processed texture in the cache.
+   * @param key The cache key
+   * @param faces The 6 faces data, as uploaded
+   * @param sphericalPolynomial The spherical polynomial if any
+   * @returns true if the entry was written
+   */
+  static bool Save(const HDRCubeTextureCacheKey& key, const std::vector<ArrayBufferView>& faces,
+                   const SphericalPolynomialPtr& sphericalPolynomial);
+
+private:
+  static const std::array<uint8_t, 8> _MagicBytes;
+  static constexpr uint32_t _Version = 1;
+
+}; // end of class HDRCubeTextureCache
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_MISC_HIGH_DYNAMIC_RANGE_HDR_CUBE_TEXTURE_CACHE_H
@@ -79,6 +79,13 @@ struct INavMeshParameters {
    * data. (For height detail only.) [Limit: >=0] [Units: wu]
    */
   float detailSampleMaxError;
+
+  /**
+   * The width and depth of the navigation mesh tiles, 0 to build a single tile navigation mesh.
+   * Tiled navigation meshes are built in parallel and support temporary obstacles. [Limit: >= 0]
+   * [Units: vx]
+   */
+  int tileSize = 0;
 }; // end of struct INavMeshParameters
 
 } // end of namespace BABYLON
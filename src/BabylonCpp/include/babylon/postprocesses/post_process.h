@@ -178,6 +178,38 @@ public:
    */
   EffectPtr apply();
 
+  /**
+   * @brief Hidden
+   * Returns whether the post process can be rendered in the same pass as the previous one.
+   * @param previous The previous post process of the fused pass, nullptr if this post process
+   * starts the pass.
+   */
+  [[nodiscard]] bool _canBeFused(const PostProcess* previous) const;
+
+  /**
+   * @brief Hidden
+   * Activates a post process rendered after the first one of a fused pass in place of activate():
+   * it takes the size of the pass, without render target, and notifies its size change and
+   * activate observers.
+   * @param camera The camera that will be used in the post process
+   * @param first The post process starting the fused pass
+   */
+  void _activateAsFusedStage(const CameraPtr& camera, const PostProcess& first);
+
+  /**
+   * @brief Hidden
+   * Binds the uniforms of the post process to the effect of a fused pass. The post process starting
+   * the pass also sets the states and binds its input texture.
+   */
+  void _applyToFusedEffect(const EffectPtr& effect, bool isFirst);
+
+  /**
+   * @brief Hidden
+   * Gives the textures acquired from the render target pool back to the pool, once the post process
+   * has been rendered.
+   */
+  void _releaseTransientTextures();
+
   void _disposeTextures();
 
   /**
@@ -262,7 +294,8 @@ protected:
    * @brief The input texture for this post process and the output texture of the previous post
    * process. When added to a pipeline the previous post process will render it's output into this
    * texture and this texture will be used as textureSampler in the fragment shader of this post
-   * process.
+   * process. Null while the post process has no texture, e.g. outside of its rendering when it
+   * uses transient textures.
    */
   InternalTexturePtr& get_inputTexture();
   void set_inputTexture(const InternalTexturePtr& value);
@@ -410,6 +443,23 @@ public:
    */
   bool adaptScaleToCurrentViewport;
 
+  /**
+   * Allow the post process to be merged with its neighbours in a single pass when the post process
+   * manager fuses the chain (default: false). Only post processes reading their input texture at
+   * the current pixel can follow another one, and their own textures, onActivate and
+   * onSizeChanged events are then skipped.
+   */
+  bool allowFusion;
+
+  /**
+   * Acquire the textures of the post process from the render target pool of the engine when it is
+   * activated, and give them back once it has been rendered, so that post processes rendered at
+   * different moments of the frame share the same memory (default: false). The input texture of
+   * the post process must not be read once it has been rendered, which excludes reusable post
+   * processes and the ones whose input is sampled by other post processes.
+   */
+  bool transientTextures;
+
   /**
    * Smart array of input and output textures for the post process.
    * Hidden
@@ -452,6 +502,10 @@ public:
 protected:
   std::unordered_map<std::string, unsigned int> _indexParameters;
 
+private:
+  void _applyStatesAndInputs(const EffectPtr& effect);
+  void _releaseRenderTargets();
+
 private:
   unsigned int _samples;
   CameraPtr _camera;
@@ -470,6 +524,8 @@ private:
   PostProcessPtr _shareOutputWithPostProcess;
   Vector2 _texelSize;
   InternalTexturePtr _forcedOutputTexture;
+  // Returned as input texture while there is no texture
+  InternalTexturePtr _noInputTexture;
   bool _blockCompilation;
   std::string _defines;
   // Events
@@ -0,0 +1,45 @@
+#ifndef BABYLON_POSTPROCESSES_POST_PROCESS_FUSION_H
+#define BABYLON_POSTPROCESSES_POST_PROCESS_FUSION_H
+
+#include <string>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+
+/**
+ * @brief Merges the fragment shaders of consecutive post processes into a single shader, so that
+ * they are rendered in one full-screen pass instead of one pass per post process.
+ *
+ * The first post process of the group reads its input texture freely. The following ones have to
+ * be per-pixel: they may only read "textureSampler" at "vUV", which is replaced by the color
+ * computed by the previous post processes. Each shader keeps its own functions and globals, which
+ * are renamed, and its macros, which are undefined after it. The uniforms and samplers keep their
+ * names so that the onApply callbacks of the post processes can set them on the fused effect.
+ */
+class BABYLON_SHARED_EXPORT PostProcessFusion {
+
+public:
+  /**
+   * @brief Fuses the fragment shaders of consecutive post processes.
+   * @param fragmentShaders defines the fragment shaders, in the order of the post processes, with
+   * their includes expanded and their preprocessor conditions already evaluated
+   * @returns the fragment shader of the fused pass, or an empty string if the shaders cannot be
+   * fused (non per-pixel shader, uniform declared twice, unsupported construct...)
+   */
+  static std::string FuseFragmentShaders(const std::vector<std::string>& fragmentShaders);
+
+  /**
+   * @brief Returns whether a fragment shader only reads "textureSampler" at "vUV", the pixel it
+   * writes.
+   * @param fragmentShader defines the fragment shader code
+   * @returns true if the shader can be fused after another post process
+   */
+  static bool IsPerPixel(const std::string& fragmentShader);
+
+}; // end of class PostProcessFusion
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_POSTPROCESSES_POST_PROCESS_FUSION_H
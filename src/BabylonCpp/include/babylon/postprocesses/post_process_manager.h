@@ -2,18 +2,22 @@
 #define BABYLON_POSTPROCESSES_POST_PROCESS_MANANGER_H
 
 #include <memory>
+#include <string>
 #include <unordered_map>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
 
 namespace BABYLON {
 
+class Effect;
 class InternalTexture;
 class PostProcess;
 class Scene;
 class VertexBuffer;
 class WebGLDataBuffer;
+using EffectPtr          = std::shared_ptr<Effect>;
 using InternalTexturePtr = std::shared_ptr<InternalTexture>;
 using PostProcessPtr     = std::shared_ptr<PostProcess>;
 using VertexBufferPtr    = std::shared_ptr<VertexBuffer>;
@@ -87,15 +91,43 @@ public:
    */
   void dispose();
 
+  /**
+   * Merge consecutive post processes allowing fusion in a single pass, saving the intermediate
+   * render targets (default: false).
+   */
+  bool fusionEnabled;
+
 private:
   void _prepareBuffers();
   void _buildIndexBuffer();
 
+  /**
+   * @brief Finds the longest group of post processes starting at the given index which can be
+   * rendered in a single pass.
+   * @param postProcesses The array of post processes to render.
+   * @param first The index of the first post process of the group.
+   * @param fusedEffect Set to the effect of the fused pass, or to null if the post process at the
+   * given index has to be rendered alone.
+   * @returns The index of the last post process of the group.
+   */
+  size_t _findFusedGroup(const std::vector<PostProcessPtr>& postProcesses, size_t first,
+                         EffectPtr& fusedEffect);
+
+  /**
+   * @brief Returns the effect rendering the given post processes in a single pass, or null if
+   * their shaders cannot be fused.
+   */
+  EffectPtr _getFusedEffect(const std::vector<PostProcessPtr>& postProcesses, size_t first,
+                            size_t last);
+
 private:
   Scene* _scene;
   WebGLDataBufferPtr _indexBuffer;
   Float32Array _vertexDeclaration;
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
+  // Fused effects, keyed by the effects of the fused post processes (null if they cannot be fused)
+  std::unordered_map<std::string, EffectPtr> _fusedEffects;
+  static std::unordered_map<std::string, size_t> _FusedShaderIds;
 
 }; // end of class PostProcessManager
 
@@ -247,6 +247,7 @@ private:
   void _rebuildBloom();
   void _setAutoClearAndTextureSharing(const PostProcessPtr& postProcess,
                                       bool skipTextureSharing = false);
+  void _setAutoClearAndTransientTextures(const PostProcessPtr& postProcess);
   void _buildPipeline();
   void _disposePostProcesses(bool disposeNonRecreated = false);
 
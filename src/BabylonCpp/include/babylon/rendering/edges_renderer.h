@@ -1,9 +1,11 @@
 ﻿#ifndef BABYLON_RENDERING_EDGES_RENDERER_H
 #define BABYLON_RENDERING_EDGES_RENDERER_H
 
+#include <array>
 #include <unordered_map>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/array_view.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/misc/observer.h>
 #include <babylon/rendering/iedges_renderer.h>
@@ -63,6 +65,20 @@ public:
    */
   void render() override;
 
+  /**
+   * @brief Finds the face sharing each edge of the triangles. The edges are matched through a hash
+   * map keyed on their vertex ids, which keeps the cost linear in the number of faces.
+   * @param positions defines the vertex positions
+   * @param indices defines the triangle indices
+   * @param checkVerticesInsteadOfIndices defines whether the vertices at the same position (within
+   * Math::Epsilon on each axis) are welded instead of comparing the indices
+   * @returns for each face, the index of the face sharing its p0p1, p1p2 and p2p0 edges, or -1 when
+   * the edge is not shared
+   */
+  static std::vector<std::array<int, 3>>
+  ComputeFaceAdjacencies(const ConstFloat32ArrayView& positions,
+                         const ConstIndicesArrayView& indices, bool checkVerticesInsteadOfIndices);
+
 protected:
   void _prepareResources();
   int _processEdgeForAdjacencies(unsigned int pa, unsigned int pb, unsigned int p0, unsigned int p1,
@@ -15,12 +15,17 @@ const char* backgroundVertexShader
 #include<__decl__backgroundVertex>
 
 #include<helperFunctions>
+#include<octahedralDecoding>
 
 // Attributes
 attribute vec3 position;
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+attribute vec2 normal;
+#else
 attribute vec3 normal;
 #endif
+#endif
 
 #include<bonesDeclaration>
 
@@ -95,8 +100,12 @@ void main(void) {
         normalWorld = transposeMat3(inverseMat3(normalWorld));
     #endif
 
+#ifdef NORMAL_OCTAHEDRAL
+    vNormalW = normalize(normalWorld * octahedralDecode(normal));
+#else
     vNormalW = normalize(normalWorld * normal);
 #endif
+#endif
 
 #if defined(REFLECTIONMAP_EQUIRECTANGULAR_FIXED) || defined(REFLECTIONMAP_MIRROREDEQUIRECTANGULAR_FIXED)
     vDirectionW = normalize(vec3(finalWorld * vec4(position, 0.0)));
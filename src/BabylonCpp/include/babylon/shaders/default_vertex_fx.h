@@ -15,11 +15,19 @@ const char* defaultVertexShader
 
 attribute vec3 position;
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+attribute vec2 normal;
+#else
 attribute vec3 normal;
 #endif
+#endif
 #ifdef TANGENT
+#ifdef TANGENT_OCTAHEDRAL
+attribute vec3 tangent;
+#else
 attribute vec4 tangent;
 #endif
+#endif
 #ifdef UV1
 attribute vec2 uv;
 #endif
@@ -31,6 +39,7 @@ attribute vec4 color;
 #endif
 
 #include<helperFunctions>
+#include<octahedralDecoding>
 
 #include<bonesDeclaration>
 
@@ -110,11 +119,19 @@ void main(void) {
 
     vec3 positionUpdated = position;
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+    vec3 normalUpdated = octahedralDecode(normal);
+#else
     vec3 normalUpdated = normal;
 #endif
+#endif
 #ifdef TANGENT
+#ifdef TANGENT_OCTAHEDRAL
+    vec4 tangentUpdated = vec4(octahedralDecode(tangent.xy), tangent.z);
+#else
     vec4 tangentUpdated = tangent;
 #endif
+#endif
 #ifdef UV1
     vec2 uvUpdated = uv;
 #endif
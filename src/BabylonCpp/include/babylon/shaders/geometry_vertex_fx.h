@@ -21,7 +21,13 @@ precision highp int;
 #include<instancesDeclaration>
 
 attribute vec3 position;
+#ifdef NORMAL_OCTAHEDRAL
+attribute vec2 normal;
+#else
 attribute vec3 normal;
+#endif
+
+#include<octahedralDecoding>
 
 #if defined(ALPHATEST) || defined(NEED_UV)
 varying vec2 vUV;
@@ -61,7 +67,11 @@ varying vec4 vPreviousPosition;
 void main(void)
 {
     vec3 positionUpdated = position;
+#ifdef NORMAL_OCTAHEDRAL
+    vec3 normalUpdated = octahedralDecode(normal);
+#else
     vec3 normalUpdated = normal;
+#endif
 #ifdef UV1
     vec2 uvUpdated = uv;
 #endif
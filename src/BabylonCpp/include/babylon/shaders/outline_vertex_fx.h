@@ -10,7 +10,13 @@ const char* outlineVertexShader
 
 // Attribute
 attribute vec3 position;
+#ifdef NORMAL_OCTAHEDRAL
+attribute vec2 normal;
+#else
 attribute vec3 normal;
+#endif
+
+#include<octahedralDecoding>
 
 #include<bonesDeclaration>
 
@@ -39,7 +45,11 @@ attribute vec2 uv2;
 void main(void)
 {
     vec3 positionUpdated = position;
+#ifdef NORMAL_OCTAHEDRAL
+    vec3 normalUpdated = octahedralDecode(normal);
+#else
     vec3 normalUpdated = normal;
+#endif
 #ifdef UV1
     vec2 uvUpdated = uv;
 #endif
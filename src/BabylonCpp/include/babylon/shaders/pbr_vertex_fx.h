@@ -19,11 +19,19 @@ const char* pbrVertexShader
 // Attributes
 attribute vec3 position;
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+attribute vec2 normal;
+#else
 attribute vec3 normal;
 #endif
+#endif
 #ifdef TANGENT
+#ifdef TANGENT_OCTAHEDRAL
+attribute vec3 tangent;
+#else
 attribute vec4 tangent;
 #endif
+#endif
 #ifdef UV1
 attribute vec2 uv;
 #endif
@@ -41,6 +49,7 @@ attribute vec4 color;
 #endif
 
 #include<helperFunctions>
+#include<octahedralDecoding>
 #include<bonesDeclaration>
 
 // Uniforms
@@ -153,11 +162,19 @@ void main(void) {
 
     vec3 positionUpdated = position;
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+    vec3 normalUpdated = octahedralDecode(normal);
+#else
     vec3 normalUpdated = normal;
 #endif
+#endif
 #ifdef TANGENT
+#ifdef TANGENT_OCTAHEDRAL
+    vec4 tangentUpdated = vec4(octahedralDecode(tangent.xy), tangent.z);
+#else
     vec4 tangentUpdated = tangent;
 #endif
+#endif
 #ifdef UV1
     vec2 uvUpdated = uv;
 #endif
@@ -0,0 +1,26 @@
+#ifndef BABYLON_SHADERS_SHADERS_INCLUDE_OCTAHEDRAL_DECODING_FX_H
+#define BABYLON_SHADERS_SHADERS_INCLUDE_OCTAHEDRAL_DECODING_FX_H
+
+namespace BABYLON {
+
+extern const char* octahedralDecoding;
+
+const char* octahedralDecoding
+  = R"ShaderCode(
+
+#if defined(NORMAL_OCTAHEDRAL) || defined(TANGENT_OCTAHEDRAL)
+    // Maps a point of the [-1, 1] square back to the unit vector it encodes
+    vec3 octahedralDecode(vec2 e) {
+        vec3 v = vec3(e.xy, 1.0 - abs(e.x) - abs(e.y));
+        float t = max(-v.z, 0.0);
+        v.x += v.x >= 0.0 ? -t : t;
+        v.y += v.y >= 0.0 ? -t : t;
+        return normalize(v);
+    }
+#endif
+
+)ShaderCode";
+
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_SHADERS_SHADERS_INCLUDE_OCTAHEDRAL_DECODING_FX_H
@@ -12,7 +12,11 @@ const char* shadowMapVertexShader
 attribute vec3 position;
 
 #ifdef NORMAL
+#ifdef NORMAL_OCTAHEDRAL
+    attribute vec2 normal;
+#else
     attribute vec3 normal;
+#endif
     uniform vec3 lightData;
 #endif
 
@@ -24,6 +28,7 @@ attribute vec3 position;
 // Uniforms
 #include<instancesDeclaration>
 #include<helperFunctions>
+#include<octahedralDecoding>
 
 uniform mat4 viewProjection;
 uniform vec3 biasAndScale;
@@ -64,7 +69,11 @@ vec4 worldPos = finalWorld * vec4(positionUpdated, 1.0);
         normalWorld = transposeMat3(inverseMat3(normalWorld));
     #endif
 
+#ifdef NORMAL_OCTAHEDRAL
+    vec3 worldNor = normalize(normalWorld * octahedralDecode(normal));
+#else
     vec3 worldNor = normalize(normalWorld * normal);
+#endif
 
     #ifdef DIRECTIONINLIGHTDATA
         vec3 worldLightDir = normalize(-lightData.xyz);
@@ -115,9 +115,30 @@ protected:
 
 private:
   void _makePacked(const std::string& imgUrl, const std::string& spriteJSON);
-  void _appendSpriteVertex(size_t index, Sprite& sprite, int offsetX, int offsetY,
+
+  /**
+   * @brief Writes the vertex data of a sprite corner, or of the sprite instance when instancing
+   * is used, and returns whether it changed since the previous frame.
+   */
+  bool _appendSpriteVertex(size_t index, const Sprite& sprite, int offsetX, int offsetY,
                            const ISize& baseSize);
 
+  /**
+   * @brief Writes the vertex data of the visible sprites in [begin, end).
+   * @returns the range of sprites whose vertex data changed, empty if none did
+   */
+  std::pair<size_t, size_t> _appendSprites(size_t begin, size_t end, const ISize& baseSize);
+
+  /**
+   * @brief Uploads the vertex data of the sprites in [first, last) to the GPU.
+   */
+  void _uploadSprites(size_t first, size_t last);
+
+  /**
+   * @brief Draws the given number of sprites, instanced when supported.
+   */
+  void _drawSprites(size_t spriteCount);
+
 public:
   /**
    * Defines the manager's name
@@ -182,8 +203,13 @@ private:
   TexturePtr _spriteTexture;
   float _epsilon;
   Scene* _scene;
+  bool _useInstancing;
+  size_t _vertexBufferSize;
   Float32Array _vertexData;
   std::unique_ptr<Buffer> _buffer;
+  std::unique_ptr<Buffer> _spriteBuffer;
+  std::vector<Sprite*> _visibleSprites;
+  std::vector<std::pair<size_t, size_t>> _dirtyRanges;
   std::unordered_map<std::string, VertexBufferPtr> _vertexBuffers;
   WebGLDataBufferPtr _indexBuffer;
   EffectPtr _effectBase;
@@ -42,20 +42,34 @@ std::optional<Vector3> PickingInfo::getNormal(bool useWorldCoordinates,
     return std::nullopt;
   }
 
-  auto indices = pickedMesh->getIndices();
+  auto indices = pickedMesh->getIndicesView();
 
   if (indices.empty()) {
     return std::nullopt;
   }
 
+  // Reads the picked face vertices without copying the whole vertex buffer when possible
+  Float32Array dataCopy;
+  const auto getData = [&](const std::string& kind) -> ConstFloat32ArrayView {
+    auto data = pickedMesh->getVerticesDataView(kind);
+    if (data.empty()) {
+      dataCopy = pickedMesh->getVerticesData(kind);
+      data     = dataCopy;
+    }
+    return data;
+  };
+  const auto getVector3 = [&](const ConstFloat32ArrayView& data, size_t offset) -> Vector3 {
+    return Vector3(data[offset], data[offset + 1], data[offset + 2]);
+  };
+
   Vector3 result;
 
   if (useVerticesNormals) {
-    auto normals = pickedMesh->getVerticesData(VertexBuffer::NormalKind);
+    auto normals = getData(VertexBuffer::NormalKind);
 
-    auto normal0 = Vector3::FromArray(normals, indices[faceId * 3] * 3);
-    auto normal1 = Vector3::FromArray(normals, indices[faceId * 3 + 1] * 3);
-    auto normal2 = Vector3::FromArray(normals, indices[faceId * 3 + 2] * 3);
+    auto normal0 = getVector3(normals, indices[faceId * 3] * 3);
+    auto normal1 = getVector3(normals, indices[faceId * 3 + 1] * 3);
+    auto normal2 = getVector3(normals, indices[faceId * 3 + 2] * 3);
 
     normal0 = normal0.scale(bu);
     normal1 = normal1.scale(bv);
@@ -66,11 +80,11 @@ std::optional<Vector3> PickingInfo::getNormal(bool useWorldCoordinates,
                      normal0.z + normal1.z + normal2.z);
   }
   else {
-    auto positions = pickedMesh->getVerticesData(VertexBuffer::PositionKind);
+    auto positions = getData(VertexBuffer::PositionKind);
 
-    auto vertex1 = Vector3::FromArray(positions, indices[faceId * 3] * 3);
-    auto vertex2 = Vector3::FromArray(positions, indices[faceId * 3 + 1] * 3);
-    auto vertex3 = Vector3::FromArray(positions, indices[faceId * 3 + 2] * 3);
+    auto vertex1 = getVector3(positions, indices[faceId * 3] * 3);
+    auto vertex2 = getVector3(positions, indices[faceId * 3 + 1] * 3);
+    auto vertex3 = getVector3(positions, indices[faceId * 3 + 2] * 3);
 
     auto p1p2 = vertex1.subtract(vertex2);
     auto p3p2 = vertex3.subtract(vertex2);
@@ -105,19 +119,27 @@ std::optional<Vector2> PickingInfo::getTextureCoordinates()
     return std::nullopt;
   }
 
-  const auto indices = pickedMesh->getIndices();
+  const auto indices = pickedMesh->getIndicesView();
   if (indices.empty()) {
     return std::nullopt;
   }
 
-  const auto uvs = pickedMesh->getVerticesData(VertexBuffer::UVKind);
+  Float32Array uvsCopy;
+  auto uvs = pickedMesh->getVerticesDataView(VertexBuffer::UVKind);
+  if (uvs.empty()) {
+    uvsCopy = pickedMesh->getVerticesData(VertexBuffer::UVKind);
+    uvs     = uvsCopy;
+  }
   if (uvs.empty()) {
     return std::nullopt;
   }
 
-  auto uv0 = Vector2::FromArray(uvs, indices[faceId * 3] * 2);
-  auto uv1 = Vector2::FromArray(uvs, indices[faceId * 3 + 1] * 2);
-  auto uv2 = Vector2::FromArray(uvs, indices[faceId * 3 + 2] * 2);
+  const auto getVector2 = [&uvs](size_t offset) -> Vector2 {
+    return Vector2(uvs[offset], uvs[offset + 1]);
+  };
+  auto uv0 = getVector2(indices[faceId * 3] * 2);
+  auto uv1 = getVector2(indices[faceId * 3 + 1] * 2);
+  auto uv2 = getVector2(indices[faceId * 3 + 2] * 2);
 
   uv0 = uv0.scale(bu);
   uv1 = uv1.scale(bv);
@@ -0,0 +1,172 @@
+#include <babylon/core/thread_pool.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <exception>
+
+namespace BABYLON {
+
+ThreadPool::ThreadPool(size_t threadCount) : _stopping{false}
+{
+  _workers.reserve(threadCount);
+  for (size_t i = 0; i < threadCount; ++i) {
+    _workers.emplace_back([this]() { _workerLoop(); });
+  }
+}
+
+ThreadPool::~ThreadPool()
+{
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _stopping = true;
+  }
+  _condition.notify_all();
+  for (auto& worker : _workers) {
+    worker.join();
+  }
+}
+
+ThreadPool& ThreadPool::Default()
+{
+#ifdef __EMSCRIPTEN__
+  static ThreadPool pool(0);
+#else
+  static ThreadPool pool(std::max(std::thread::hardware_concurrency(), 1u) - 1);
+#endif
+  return pool;
+}
+
+size_t ThreadPool::threadCount() const
+{
+  return _workers.size();
+}
+
+size_t ThreadPool::concurrency() const
+{
+  return _workers.size() + 1;
+}
+
+std::future<void> ThreadPool::submit(Task task)
+{
+  auto packagedTask = std::make_shared<std::packaged_task<void()>>(std::move(task));
+  auto future       = packagedTask->get_future();
+  if (_workers.empty()) {
+    (*packagedTask)();
+    return future;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _tasks.emplace_back([packagedTask]() { (*packagedTask)(); });
+  }
+  _condition.notify_one();
+  return future;
+}
+
+void ThreadPool::parallelFor(size_t begin, size_t end, size_t grainSize, const RangeTask& body)
+{
+  if (begin >= end) {
+    return;
+  }
+
+  grainSize              = std::max<size_t>(grainSize, 1);
+  const auto chunkCount  = (end - begin + grainSize - 1) / grainSize;
+  const auto helperCount = std::min(chunkCount - 1, _workers.size());
+  if (helperCount == 0) {
+    body(begin, end);
+    return;
+  }
+
+  // Chunks are grabbed from a shared counter by the helpers and the calling thread
+  struct State {
+    std::atomic<size_t> nextChunk{0};
+    std::atomic<size_t> runningHelpers{0};
+    std::mutex mutex;
+    std::condition_variable done;
+    std::exception_ptr exception;
+  };
+  auto state            = std::make_shared<State>();
+  state->runningHelpers = helperCount;
+
+  const auto processChunks = [state, begin, end, grainSize, chunkCount, &body]() {
+    for (auto chunk = state->nextChunk++; chunk < chunkCount; chunk = state->nextChunk++) {
+      const auto chunkBegin = begin + chunk * grainSize;
+      try {
+        body(chunkBegin, std::min(chunkBegin + grainSize, end));
+      }
+      catch (...) {
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (!state->exception) {
+          state->exception = std::current_exception();
+        }
+        // Skip the remaining chunks
+        state->nextChunk = chunkCount;
+      }
+    }
+  };
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    for (size_t i = 0; i < helperCount; ++i) {
+      _tasks.emplace_back([state, processChunks]() {
+        processChunks();
+        std::lock_guard<std::mutex> lock(state->mutex);
+        if (--state->runningHelpers == 0) {
+          state->done.notify_all();
+        }
+      });
+    }
+  }
+  _condition.notify_all();
+
+  processChunks();
+
+  // Help with the queued tasks while waiting, which also prevents nested parallelFor calls from
+  // deadlocking when all the workers are busy
+  while (state->runningHelpers > 0) {
+    if (!_runPendingTask()) {
+      std::unique_lock<std::mutex> lock(state->mutex);
+      state->done.wait_for(lock, std::chrono::microseconds(100),
+                           [&state]() { return state->runningHelpers == 0; });
+    }
+  }
+
+  if (state->exception) {
+    std::rethrow_exception(state->exception);
+  }
+}
+
+void ThreadPool::_workerLoop()
+{
+  for (;;) {
+    Task task;
+    {
+      std::unique_lock<std::mutex> lock(_mutex);
+      _condition.wait(lock, [this]() { return _stopping || !_tasks.empty(); });
+      if (_tasks.empty()) {
+        return;
+      }
+      task = std::move(_tasks.front());
+      _tasks.pop_front();
+    }
+    task();
+  }
+}
+
+bool ThreadPool::_runPendingTask()
+{
+  Task task;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_tasks.empty()) {
+      return false;
+    }
+    task = std::move(_tasks.front());
+    _tasks.pop_front();
+  }
+  task();
+  return true;
+}
+
+} // end of namespace BABYLON
@@ -1,17 +1,44 @@
 #include <babylon/culling/octrees/octree.h>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <unordered_set>
+
 #include <babylon/babylon_stl_util.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
 #include <babylon/culling/octrees/octree_block.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/plane.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 
 namespace BABYLON {
 
+namespace {
+
+// Minimum number of entries for the root blocks to be traversed in parallel
+constexpr size_t ParallelTraversalEntryCount = 16384;
+
+// Removes the entries already present earlier in the selection, as concat_with_no_duplicates
 template <class T>
-Octree<T>::Octree() = default;
+void RemoveDuplicates(std::vector<T>& selection)
+{
+  std::unordered_set<T> selected;
+  selected.reserve(selection.size());
+  stl_util::erase_remove_if(
+    selection, [&selected](const T& entry) { return !selected.insert(entry).second; });
+}
+
+} // end of anonymous namespace
+
+template <class T>
+Octree<T>::Octree() : maxDepth{2}, _maxBlockCapacity{64}, _flatNodesDirty{true}
+{
+}
 
 template <class T>
 Octree<T>::Octree(
@@ -20,6 +47,7 @@ Octree<T>::Octree(
     : maxDepth{iMaxDepth}
     , _maxBlockCapacity{maxBlockCapacity}
     , _creationFunc{creationFunc}
+    , _flatNodesDirty{true}
 {
   _selectionContent.resize(1024);
 }
@@ -33,6 +61,7 @@ void Octree<T>::update(const Vector3& worldMin, const Vector3& worldMax,
 {
   OctreeBlock<T>::_CreateBlocks(worldMin, worldMax, entries, _maxBlockCapacity,
                                 0, maxDepth, *this, _creationFunc);
+  _flatNodesDirty = true;
 }
 
 template <class T>
@@ -41,6 +70,7 @@ void Octree<T>::addMesh(T& entry)
   for (auto& block : IOctreeContainer<T>::blocks) {
     block.addEntry(entry);
   }
+  _flatNodesDirty = true;
 }
 
 template <class T>
@@ -49,24 +79,29 @@ void Octree<T>::removeMesh(T& entry)
   for (auto& block : IOctreeContainer<T>::blocks) {
     block.removeEntry(entry);
   }
+  _flatNodesDirty = true;
 }
 
 template <class T>
 std::vector<T>& Octree<T>::select(const std::array<Plane, 6>& frustumPlanes,
                                   bool allowDuplicate)
 {
-  _selectionContent.clear();
-
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.select(frustumPlanes, _selectionContent, allowDuplicate);
-  }
-
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
-  }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
-  }
+  // A box is outside when its corner the farthest along the normal of a plane is behind it. That
+  // corner is the same for all the boxes, so each plane is tested against the boxes in one pass.
+  const auto& nodes = _flatNodes;
+  _collect([&nodes, &frustumPlanes](size_t first, size_t count, uint8_t* result) {
+    std::fill(result, result + count, uint8_t(1));
+    for (const auto& plane : frustumPlanes) {
+      const auto nx = plane.normal.x, ny = plane.normal.y, nz = plane.normal.z, d = plane.d;
+      const auto* xs = (nx >= 0.f ? nodes.maxX : nodes.minX).data() + first;
+      const auto* ys = (ny >= 0.f ? nodes.maxY : nodes.minY).data() + first;
+      const auto* zs = (nz >= 0.f ? nodes.maxZ : nodes.minZ).data() + first;
+      for (size_t i = 0; i < count; ++i) {
+        result[i] &= static_cast<uint8_t>(nx * xs[i] + ny * ys[i] + nz * zs[i] + d >= 0.f);
+      }
+    }
+  }, allowDuplicate);
+  _appendDynamicContent(allowDuplicate);
 
   return _selectionContent;
 }
@@ -75,35 +110,191 @@ template <class T>
 std::vector<T>& Octree<T>::intersects(const Vector3& sphereCenter,
                                       float sphereRadius, bool allowDuplicate)
 {
-  _selectionContent.clear();
+  const auto& nodes = _flatNodes;
+  _collect([&nodes, &sphereCenter, sphereRadius](size_t first, size_t count, uint8_t* result) {
+    const auto cx = sphereCenter.x, cy = sphereCenter.y, cz = sphereCenter.z;
+    const auto radiusSquared = sphereRadius * sphereRadius;
+    for (size_t i = first; i < first + count; ++i) {
+      // Distance to the closest point of the box
+      const auto dx = cx - std::min(std::max(cx, nodes.minX[i]), nodes.maxX[i]);
+      const auto dy = cy - std::min(std::max(cy, nodes.minY[i]), nodes.maxY[i]);
+      const auto dz = cz - std::min(std::max(cz, nodes.minZ[i]), nodes.maxZ[i]);
+      result[i - first] = static_cast<uint8_t>(dx * dx + dy * dy + dz * dz <= radiusSquared);
+    }
+  }, allowDuplicate);
+  _appendDynamicContent(allowDuplicate);
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersects(sphereCenter, sphereRadius, _selectionContent,
-                     allowDuplicate);
-  }
+  return _selectionContent;
+}
 
-  if (allowDuplicate) {
-    stl_util::concat(_selectionContent, dynamicContent);
+template <class T>
+std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
+{
+  // Slab test of Ray::intersectsBoxMinMax, the axes parallel to the ray only checking the origin
+  const auto& nodes = _flatNodes;
+  _collect([&nodes, &ray](size_t first, size_t count, uint8_t* result) {
+    std::array<float, 3> origin{{ray.origin.x, ray.origin.y, ray.origin.z}};
+    std::array<float, 3> direction{{ray.direction.x, ray.direction.y, ray.direction.z}};
+    std::array<const float*, 3> mins{{nodes.minX.data(), nodes.minY.data(), nodes.minZ.data()}};
+    std::array<const float*, 3> maxs{{nodes.maxX.data(), nodes.maxY.data(), nodes.maxZ.data()}};
+    std::fill(result, result + count, uint8_t(1));
+    std::array<float, 64> tNear, tFar;
+    for (size_t batch = 0; batch < count; batch += tNear.size()) {
+      const auto batchSize = std::min(tNear.size(), count - batch);
+      std::fill(tNear.begin(), tNear.begin() + batchSize, 0.f);
+      std::fill(tFar.begin(), tFar.begin() + batchSize, std::numeric_limits<float>::max());
+      for (size_t axis = 0; axis < 3; ++axis) {
+        const auto* minValues = mins[axis] + first + batch;
+        const auto* maxValues = maxs[axis] + first + batch;
+        auto* batchResult     = result + batch;
+        if (std::abs(direction[axis]) < 0.0000001f) {
+          for (size_t i = 0; i < batchSize; ++i) {
+            batchResult[i] &= static_cast<uint8_t>(origin[axis] >= minValues[i]
+                                                   && origin[axis] <= maxValues[i]);
+          }
+          continue;
+        }
+        const auto inverse  = 1.f / direction[axis];
+        const auto infinity = std::numeric_limits<float>::infinity();
+        for (size_t i = 0; i < batchSize; ++i) {
+          const auto t0 = (minValues[i] - origin[axis]) * inverse;
+          auto t1       = (maxValues[i] - origin[axis]) * inverse;
+          t1            = t1 == -infinity ? infinity : t1;
+          tNear[i]      = std::max(tNear[i], std::min(t0, t1));
+          tFar[i]       = std::min(tFar[i], std::max(t0, t1));
+          batchResult[i] &= static_cast<uint8_t>(tNear[i] <= tFar[i]);
+        }
+      }
+    }
+  }, false);
+  _appendDynamicContent(false);
+
+  return _selectionContent;
+}
+
+template <class T>
+void Octree<T>::markAsDirty()
+{
+  _flatNodesDirty = true;
+}
+
+template <class T>
+void Octree<T>::_flattenBlocks()
+{
+  auto& nodes = _flatNodes;
+  nodes       = FlatNodes();
+
+  // Breadth first, so that the children of each block are contiguous
+  std::vector<OctreeBlock<T>*> pending;
+  for (auto& block : IOctreeContainer<T>::blocks) {
+    pending.emplace_back(&block);
   }
-  else {
-    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  nodes.rootCount    = pending.size();
+  nodes.maxGroupSize = pending.size();
+  for (size_t i = 0; i < pending.size(); ++i) {
+    auto& block = *pending[i];
+    nodes.minX.emplace_back(block.minPoint().x);
+    nodes.minY.emplace_back(block.minPoint().y);
+    nodes.minZ.emplace_back(block.minPoint().z);
+    nodes.maxX.emplace_back(block.maxPoint().x);
+    nodes.maxY.emplace_back(block.maxPoint().y);
+    nodes.maxZ.emplace_back(block.maxPoint().z);
+    const auto isLeaf = block.blocks.empty();
+    nodes.isLeaf.emplace_back(static_cast<uint8_t>(isLeaf));
+    if (isLeaf) {
+      nodes.first.emplace_back(static_cast<uint32_t>(nodes.entries.size()));
+      nodes.count.emplace_back(static_cast<uint32_t>(block.entries.size()));
+      stl_util::concat(nodes.entries, block.entries);
+    }
+    else {
+      nodes.first.emplace_back(static_cast<uint32_t>(pending.size()));
+      nodes.count.emplace_back(static_cast<uint32_t>(block.blocks.size()));
+      nodes.maxGroupSize = std::max(nodes.maxGroupSize, block.blocks.size());
+      for (auto& child : block.blocks) {
+        pending.emplace_back(&child);
+      }
+    }
   }
 
-  return _selectionContent;
+  _flatNodesDirty = false;
 }
 
 template <class T>
-std::vector<T>& Octree<T>::intersectsRay(const Ray& ray)
+template <typename GroupTest>
+void Octree<T>::_collect(const GroupTest& test, bool allowDuplicate)
 {
+  if (_flatNodesDirty) {
+    _flattenBlocks();
+  }
+
   _selectionContent.clear();
+  const auto& nodes = _flatNodes;
+  if (nodes.rootCount == 0) {
+    return;
+  }
 
-  for (auto& block : IOctreeContainer<T>::blocks) {
-    block.intersectsRay(ray, _selectionContent);
+  // Depth first traversal of the subtree of a root block, in the order of the blocks
+  const auto traverse = [&nodes, &test](size_t root, std::vector<T>& result) {
+    std::vector<uint8_t> passed(nodes.maxGroupSize);
+    std::vector<uint32_t> stack{static_cast<uint32_t>(root)};
+    while (!stack.empty()) {
+      const auto node = stack.back();
+      stack.pop_back();
+      const auto first = nodes.first[node], count = nodes.count[node];
+      if (nodes.isLeaf[node]) {
+        result.insert(result.end(), nodes.entries.begin() + first,
+                      nodes.entries.begin() + first + count);
+        continue;
+      }
+      test(first, count, passed.data());
+      for (auto i = count; i-- > 0;) {
+        if (passed[i]) {
+          stack.emplace_back(first + i);
+        }
+      }
+    }
+  };
+
+  std::vector<uint8_t> passed(nodes.rootCount);
+  test(0, nodes.rootCount, passed.data());
+  if (nodes.entries.size() < ParallelTraversalEntryCount
+      || ThreadPool::Default().concurrency() < 2) {
+    for (size_t root = 0; root < nodes.rootCount; ++root) {
+      if (passed[root]) {
+        traverse(root, _selectionContent);
+      }
+    }
+  }
+  else {
+    // Each root subtree writes to its own buffer, concatenated in order
+    std::vector<std::vector<T>> results(nodes.rootCount);
+    ThreadPool::Default().parallelFor(0, nodes.rootCount, 1, [&](size_t begin, size_t end) {
+      for (auto root = begin; root < end; ++root) {
+        if (passed[root]) {
+          traverse(root, results[root]);
+        }
+      }
+    });
+    for (const auto& result : results) {
+      stl_util::concat(_selectionContent, result);
+    }
   }
 
-  stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  // An entry overlapping several leaves is only kept in the first one
+  if (!allowDuplicate) {
+    RemoveDuplicates(_selectionContent);
+  }
+}
 
-  return _selectionContent;
+template <class T>
+void Octree<T>::_appendDynamicContent(bool allowDuplicate)
+{
+  if (allowDuplicate) {
+    stl_util::concat(_selectionContent, dynamicContent);
+  }
+  else {
+    stl_util::concat_with_no_duplicates(_selectionContent, dynamicContent);
+  }
 }
 
 template <class T>
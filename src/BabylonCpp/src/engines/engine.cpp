@@ -8,6 +8,7 @@
 #include <babylon/engines/extensions/occlusion_query_extension.h>
 #include <babylon/engines/extensions/raw_texture_extension.h>
 #include <babylon/engines/extensions/transform_feedback_extension.h>
+#include <babylon/engines/render_target_pool.h>
 #include <babylon/engines/scene.h>
 #include <babylon/engines/webgl/webgl_pipeline_context.h>
 #include <babylon/interfaces/icanvas.h>
@@ -67,6 +68,15 @@ Engine::Engine(ICanvas* canvas, const EngineOptions& options)
     , loadingUIBackgroundColor{this, &Engine::set_loadingUIBackgroundColor}
     , _rescalePostProcess{nullptr}
     , _performanceMonitor{std::make_unique<PerformanceMonitor>()}
+    , _renderTargetPool{std::make_unique<RenderTargetPool>(
+        [this](const ISize& size, const IRenderTargetOptions& options, unsigned int samples) {
+          auto texture = createRenderTargetTexture(size, options);
+          if (samples > 1) {
+            updateRenderTargetTextureSampleCount(texture, samples);
+          }
+          return texture;
+        },
+        [this](const InternalTexturePtr& texture) { _releaseTexture(texture); })}
     , _multiviewExtension{std::make_unique<MultiviewExtension>(this)}
     , _occlusionQueryExtension{std::make_unique<OcclusionQueryExtension>(this)}
     , _rawTextureExtension{std::make_unique<RawTextureExtension>(this)}
@@ -495,8 +505,7 @@ void Engine::setDepthStencilTexture(int channel, const WebGLUniformLocationPtr&
 
 void Engine::setTextureFromPostProcess(int channel, const PostProcessPtr& postProcess)
 {
-  const auto _ind = static_cast<size_t>(postProcess->_currentRenderTextureInd);
-  _bindTexture(channel, postProcess ? postProcess->_textures[_ind] : nullptr);
+  _bindTexture(channel, postProcess ? postProcess->inputTexture() : nullptr);
 }
 
 void Engine::setTextureFromPostProcessOutput(int channel, const PostProcessPtr& postProcess)
@@ -504,6 +513,11 @@ void Engine::setTextureFromPostProcessOutput(int channel, const PostProcessPtr&
   _bindTexture(channel, postProcess ? postProcess->_outputTexture : nullptr);
 }
 
+RenderTargetPool& Engine::getRenderTargetPool()
+{
+  return *_renderTargetPool;
+}
+
 ArrayBufferView Engine::_convertRGBtoRGBATextureData(const ArrayBufferView& rgbData, int width,
                                                      int height, unsigned int textureType)
 {
@@ -656,6 +670,7 @@ void Engine::endFrame()
 {
   ThinEngine::endFrame();
   _submitVRFrame();
+  _renderTargetPool->endFrame();
 
   onEndFrameObservable.notifyObservers(this);
 }
@@ -956,9 +971,17 @@ void Engine::updateDynamicIndexBuffer(const WebGLDataBufferPtr& indexBuffer,
   // Force cache update
   _currentBoundBuffer[GL::ELEMENT_ARRAY_BUFFER] = nullptr;
   bindIndexBuffer(indexBuffer);
-  auto arrayBuffer = indices;
 
-  _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::DYNAMIC_DRAW);
+  // Keep the index size the buffer was created with
+  if (indexBuffer->is32Bits) {
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, indices, GL::DYNAMIC_DRAW);
+  }
+  else {
+    Uint16Array arrayBuffer(indices.size());
+    std::transform(indices.begin(), indices.end(), arrayBuffer.begin(),
+                   [](uint32_t index) { return static_cast<uint16_t>(index); });
+    _gl->bufferData(GL::ELEMENT_ARRAY_BUFFER, arrayBuffer, GL::DYNAMIC_DRAW);
+  }
 
   _resetIndexBufferBinding();
 }
@@ -1174,6 +1197,9 @@ void Engine::dispose()
   }
   scenes.clear();
 
+  // Release the transient render targets
+  _renderTargetPool->clear();
+
   if (_dummyFramebuffer) {
     _gl->deleteFramebuffer(_dummyFramebuffer.get());
   }
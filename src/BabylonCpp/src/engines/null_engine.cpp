@@ -1,5 +1,7 @@
 ﻿#include <babylon/engines/null_engine.h>
 
+#include <numeric>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/materials/effect.h>
@@ -142,9 +144,12 @@ NullEngine::getUniforms(const IPipelineContextPtr& /*pipelineContext*/,
 }
 
 Int32Array NullEngine::getAttributes(const IPipelineContextPtr& /*pipelineContext*/,
-                                     const std::vector<std::string>& /*attributesNames*/)
+                                     const std::vector<std::string>& attributesNames)
 {
-  return {};
+  // One location per attribute, the effects reading a location for each of their attributes
+  Int32Array attributes(attributesNames.size());
+  std::iota(attributes.begin(), attributes.end(), 0);
+  return attributes;
 }
 
 void NullEngine::bindSamplers(Effect& /*effect*/)
@@ -517,7 +522,7 @@ void NullEngine::_bindTexture(int channel, const InternalTexturePtr& texture)
   _bindTextureDirectly(0, texture);
 }
 
-void NullEngine::_deleteBuffer(GL::IGLBuffer* /*buffer*/)
+void NullEngine::_deleteBuffer(const WebGLDataBufferPtr& /*buffer*/)
 {
 }
 
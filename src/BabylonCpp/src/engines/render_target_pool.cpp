@@ -0,0 +1,228 @@
+#include <babylon/engines/render_target_pool.h>
+
+#include <algorithm>
+
+#include <babylon/engines/constants.h>
+
+namespace BABYLON {
+
+namespace {
+
+/**
+ * @brief Returns the options with the default values of the engine filled in, so that textures
+ * created with implicit and explicit default options are shared.
+ */
+IRenderTargetOptions ResolvedOptions(const IRenderTargetOptions& options)
+{
+  IRenderTargetOptions resolved;
+  resolved.generateMipMaps     = options.generateMipMaps.value_or(false);
+  resolved.generateDepthBuffer = options.generateDepthBuffer.value_or(true);
+  resolved.generateStencilBuffer
+    = *resolved.generateDepthBuffer && options.generateStencilBuffer.value_or(false);
+  resolved.type         = options.type.value_or(Constants::TEXTURETYPE_UNSIGNED_INT);
+  resolved.format       = options.format.value_or(Constants::TEXTUREFORMAT_RGBA);
+  resolved.samplingMode = options.samplingMode.value_or(Constants::TEXTURE_TRILINEAR_SAMPLINGMODE);
+  return resolved;
+}
+
+bool SameOptions(const IRenderTargetOptions& lhs, const IRenderTargetOptions& rhs)
+{
+  return lhs.generateMipMaps == rhs.generateMipMaps
+         && lhs.generateDepthBuffer == rhs.generateDepthBuffer
+         && lhs.generateStencilBuffer == rhs.generateStencilBuffer && lhs.type == rhs.type
+         && lhs.format == rhs.format && lhs.samplingMode == rhs.samplingMode;
+}
+
+size_t BytesPerTexel(unsigned int type, unsigned int format)
+{
+  // Packed types
+  switch (type) {
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_4_4_4_4:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_5_5_1:
+    case Constants::TEXTURETYPE_UNSIGNED_SHORT_5_6_5:
+      return 2;
+    case Constants::TEXTURETYPE_UNSIGNED_INT_2_10_10_10_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_24_8:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_10F_11F_11F_REV:
+    case Constants::TEXTURETYPE_UNSIGNED_INT_5_9_9_9_REV:
+      return 4;
+    case Constants::TEXTURETYPE_FLOAT_32_UNSIGNED_INT_24_8_REV:
+      return 8;
+    default:
+      break;
+  }
+
+  size_t bytesPerChannel = 1;
+  if (type == Constants::TEXTURETYPE_FLOAT || type == Constants::TEXTURETYPE_INT
+      || type == Constants::TEXTURETYPE_UNSIGNED_INTEGER) {
+    bytesPerChannel = 4;
+  }
+  else if (type == Constants::TEXTURETYPE_HALF_FLOAT || type == Constants::TEXTURETYPE_SHORT
+           || type == Constants::TEXTURETYPE_UNSIGNED_SHORT) {
+    bytesPerChannel = 2;
+  }
+
+  size_t channels = 4;
+  switch (format) {
+    case Constants::TEXTUREFORMAT_ALPHA:
+    case Constants::TEXTUREFORMAT_LUMINANCE:
+    case Constants::TEXTUREFORMAT_RED:
+    case Constants::TEXTUREFORMAT_RED_INTEGER:
+      channels = 1;
+      break;
+    case Constants::TEXTUREFORMAT_LUMINANCE_ALPHA:
+    case Constants::TEXTUREFORMAT_RG:
+    case Constants::TEXTUREFORMAT_RG_INTEGER:
+      channels = 2;
+      break;
+    case Constants::TEXTUREFORMAT_RGB:
+    case Constants::TEXTUREFORMAT_RGB_INTEGER:
+      channels = 3;
+      break;
+    default:
+      break;
+  }
+
+  return bytesPerChannel * channels;
+}
+
+} // end of anonymous namespace
+
+RenderTargetPool::RenderTargetPool(const CreateTextureFunction& createTexture,
+                                   const ReleaseTextureFunction& releaseTexture)
+    : maxUnusedFrames{2}
+    , _createTexture{createTexture}
+    , _releaseTexture{releaseTexture}
+    , _frameId{0}
+    , _memory{0}
+    , _lastFrameMemory{0}
+    , _peakMemory{0}
+{
+}
+
+RenderTargetPool::~RenderTargetPool() = default;
+
+InternalTexturePtr RenderTargetPool::acquire(const ISize& size,
+                                             const IRenderTargetOptions& options,
+                                             unsigned int samples)
+{
+  const auto resolvedOptions = ResolvedOptions(options);
+  samples                    = std::max(samples, 1u);
+
+  for (auto& entry : _entries) {
+    if (!entry.inUse && entry.size == size && entry.samples == samples
+        && SameOptions(entry.options, resolvedOptions)) {
+      entry.inUse         = true;
+      entry.lastUsedFrame = _frameId;
+      return entry.texture;
+    }
+  }
+
+  Entry entry;
+  entry.size          = size;
+  entry.options       = resolvedOptions;
+  entry.samples       = samples;
+  entry.texture       = _createTexture(size, resolvedOptions, samples);
+  entry.memory        = EstimateMemory(size, resolvedOptions, samples);
+  entry.lastUsedFrame = _frameId;
+  entry.inUse         = true;
+  _entries.emplace_back(entry);
+
+  _memory += entry.memory;
+  _peakMemory = std::max(_peakMemory, _memory);
+
+  return entry.texture;
+}
+
+void RenderTargetPool::release(const InternalTexturePtr& texture)
+{
+  for (auto& entry : _entries) {
+    if (entry.texture == texture) {
+      entry.inUse = false;
+      return;
+    }
+  }
+}
+
+bool RenderTargetPool::owns(const InternalTexturePtr& texture) const
+{
+  return std::any_of(_entries.begin(), _entries.end(),
+                     [&texture](const Entry& entry) { return entry.texture == texture; });
+}
+
+void RenderTargetPool::endFrame()
+{
+  _lastFrameMemory = _memory;
+
+  // Dispose the textures which are not used anymore
+  for (auto it = _entries.begin(); it != _entries.end();) {
+    if (!it->inUse && _frameId - it->lastUsedFrame >= maxUnusedFrames) {
+      _releaseTexture(it->texture);
+      _memory -= it->memory;
+      it = _entries.erase(it);
+    }
+    else {
+      ++it;
+    }
+  }
+
+  ++_frameId;
+}
+
+void RenderTargetPool::clear()
+{
+  for (const auto& entry : _entries) {
+    _releaseTexture(entry.texture);
+  }
+  _entries.clear();
+  _memory = 0;
+}
+
+size_t RenderTargetPool::textureCount() const
+{
+  return _entries.size();
+}
+
+size_t RenderTargetPool::memory() const
+{
+  return _memory;
+}
+
+size_t RenderTargetPool::lastFrameMemory() const
+{
+  return _lastFrameMemory;
+}
+
+size_t RenderTargetPool::peakMemory() const
+{
+  return _peakMemory;
+}
+
+size_t RenderTargetPool::EstimateMemory(const ISize& size, const IRenderTargetOptions& options,
+                                        unsigned int samples)
+{
+  const auto resolvedOptions = ResolvedOptions(options);
+  const auto pixelCount      = static_cast<size_t>(std::max(size.width, 0))
+                               * static_cast<size_t>(std::max(size.height, 0));
+  const auto texelSize       = BytesPerTexel(*resolvedOptions.type, *resolvedOptions.format);
+
+  auto memory = pixelCount * texelSize;
+  if (*resolvedOptions.generateMipMaps) {
+    memory += memory / 3;
+  }
+
+  // Multisampled color buffer, resolved in the texture
+  const size_t sampleCount = std::max(samples, 1u);
+  if (sampleCount > 1) {
+    memory += pixelCount * sampleCount * texelSize;
+  }
+
+  // Depth (and stencil) buffer
+  if (*resolvedOptions.generateDepthBuffer) {
+    memory += pixelCount * sampleCount * 4;
+  }
+
+  return memory;
+}
+
+} // end of namespace BABYLON
@@ -4190,28 +4190,30 @@ void Scene::dispose()
     }
   }
 
+  // Disposed objects remove themselves from the scene, so copies of the lists are released
+
   // Release animation groups
-  for (const auto& animationGroup : animationGroups) {
+  for (const auto& animationGroup : std::vector<AnimationGroupPtr>(animationGroups)) {
     animationGroup->dispose();
   }
 
   // Release lights
-  for (const auto& light : lights) {
+  for (const auto& light : std::vector<LightPtr>(lights)) {
     light->dispose();
   }
 
   // Release meshes
-  for (const auto& mesh : meshes) {
+  for (const auto& mesh : std::vector<AbstractMeshPtr>(meshes)) {
     mesh->dispose(true);
   }
 
   // Release transform nodes
-  for (const auto& transformNode : transformNodes) {
+  for (const auto& transformNode : std::vector<TransformNodePtr>(transformNodes)) {
     removeTransformNode(transformNode);
   }
 
   // Release cameras
-  for (const auto& camera : cameras) {
+  for (const auto& camera : std::vector<CameraPtr>(cameras)) {
     camera->dispose();
   }
 
@@ -4219,25 +4221,25 @@ void Scene::dispose()
   if (defaultMaterial()) {
     defaultMaterial()->dispose();
   }
-  for (const auto& multiMaterial : multiMaterials) {
+  for (const auto& multiMaterial : std::vector<MultiMaterialPtr>(multiMaterials)) {
     multiMaterial->dispose();
   }
-  for (const auto& material : materials) {
+  for (const auto& material : std::vector<MaterialPtr>(materials)) {
     material->dispose();
   }
 
   // Release particles
-  for (const auto& particleSystem : particleSystems) {
+  for (const auto& particleSystem : std::vector<IParticleSystemPtr>(particleSystems)) {
     particleSystem->dispose();
   }
 
   // Release postProcesses
-  for (const auto& postProcess : postProcesses) {
+  for (const auto& postProcess : std::vector<PostProcessPtr>(postProcesses)) {
     postProcess->dispose();
   }
 
   // Release textures
-  for (const auto& texture : textures) {
+  for (const auto& texture : std::vector<BaseTexturePtr>(textures)) {
     texture->dispose();
   }
 
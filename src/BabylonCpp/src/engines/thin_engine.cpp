@@ -993,22 +993,18 @@ WebGLDataBufferPtr ThinEngine::createIndexBuffer(const IndicesArray& indices, bo
 void ThinEngine::_normalizeIndexData(const IndicesArray& indices, Uint16Array& uint16ArrayResult,
                                      Uint32Array& uint32ArrayResult)
 {
-  // Check 32 bit support
-  if (_caps.uintIndices) {
-    // number[] or Int32Array, check if 32 bit is necessary
-    using namespace std::placeholders;
-    auto it = std::find_if(indices.begin(), indices.end(),
-                           std::bind(std::greater<uint32_t>(), _1, 65535));
-    if (it != indices.end()) {
-      // 32 bit is necessary
-      uint32ArrayResult.assign(indices.begin(), indices.end());
-    }
-    else {
-      // 16 bit is sufficient
-      for (auto v : indices) {
-        uint16ArrayResult.push_back(static_cast<uint16_t>(v));
-      }
-    }
+  // 32 bit is only necessary when the indices reference more than 65536 vertices, otherwise 16 bit
+  // indices halve the index buffer size
+  const auto needs32Bits
+    = _caps.uintIndices
+      && std::any_of(indices.begin(), indices.end(), [](uint32_t index) { return index > 65535; });
+  if (needs32Bits) {
+    uint32ArrayResult.assign(indices.begin(), indices.end());
+  }
+  else {
+    uint16ArrayResult.resize(indices.size());
+    std::transform(indices.begin(), indices.end(), uint16ArrayResult.begin(),
+                   [](uint32_t index) { return static_cast<uint16_t>(index); });
   }
 }
 
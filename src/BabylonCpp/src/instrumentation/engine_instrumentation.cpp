@@ -1,6 +1,7 @@
 #include <babylon/instrumentation/engine_instrumentation.h>
 
 #include <babylon/engines/engine.h>
+#include <babylon/engines/render_target_pool.h>
 
 namespace BABYLON {
 
@@ -11,14 +12,21 @@ EngineInstrumentation::EngineInstrumentation(Engine* engine)
     , shaderCompilationTimeCounter{this, &EngineInstrumentation::get_shaderCompilationTimeCounter}
     , captureShaderCompilationTime{this, &EngineInstrumentation::get_captureShaderCompilationTime,
                                    &EngineInstrumentation::set_captureShaderCompilationTime}
+    , renderTargetPoolMemoryCounter{this,
+                                    &EngineInstrumentation::get_renderTargetPoolMemoryCounter}
+    , captureRenderTargetPoolMemory{this,
+                                    &EngineInstrumentation::get_captureRenderTargetPoolMemory,
+                                    &EngineInstrumentation::set_captureRenderTargetPoolMemory}
     , _engine{engine}
     , _captureGPUFrameTime{false}
     , _gpuFrameTimeToken{std::nullopt}
     , _captureShaderCompilationTime{false}
+    , _captureRenderTargetPoolMemory{false}
     , _onBeginFrameObserver{nullptr}
     , _onEndFrameObserver{nullptr}
     , _onBeforeShaderCompilationObserver{nullptr}
     , _onAfterShaderCompilationObserver{nullptr}
+    , _onEndFrameRenderTargetPoolObserver{nullptr}
 {
 }
 
@@ -108,6 +116,37 @@ void EngineInstrumentation::set_captureShaderCompilationTime(bool value)
   }
 }
 
+PerfCounter& EngineInstrumentation::get_renderTargetPoolMemoryCounter()
+{
+  return _renderTargetPoolMemory;
+}
+
+bool EngineInstrumentation::get_captureRenderTargetPoolMemory() const
+{
+  return _captureRenderTargetPoolMemory;
+}
+
+void EngineInstrumentation::set_captureRenderTargetPoolMemory(bool value)
+{
+  if (value == _captureRenderTargetPoolMemory) {
+    return;
+  }
+
+  _captureRenderTargetPoolMemory = value;
+
+  if (value) {
+    _onEndFrameRenderTargetPoolObserver
+      = _engine->onEndFrameObservable.add([this](Engine* engine, EventState& /*es*/) {
+          _renderTargetPoolMemory.fetchNewFrame();
+          _renderTargetPoolMemory.addCount(engine->getRenderTargetPool().lastFrameMemory(), true);
+        });
+  }
+  else {
+    _engine->onEndFrameObservable.remove(_onEndFrameRenderTargetPoolObserver);
+    _onEndFrameRenderTargetPoolObserver = nullptr;
+  }
+}
+
 void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
 {
   _engine->onBeginFrameObservable.remove(_onBeginFrameObserver);
@@ -122,6 +161,9 @@ void EngineInstrumentation::dispose(bool /*doNotRecurse*/, bool /*disposeMateria
   _engine->onAfterShaderCompilationObservable.remove(_onAfterShaderCompilationObserver);
   _onAfterShaderCompilationObserver = nullptr;
 
+  _engine->onEndFrameObservable.remove(_onEndFrameRenderTargetPoolObserver);
+  _onEndFrameRenderTargetPoolObserver = nullptr;
+
   _engine = nullptr;
 }
 
@@ -27,6 +27,7 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tools.h>
 #include <babylon/morph/morph_target_manager.h>
@@ -894,6 +895,9 @@ bool ShadowGenerator::isReady(SubMesh* subMesh, bool useInstances)
   if (normalBias() > 0.f && mesh->isVerticesDataPresent(VertexBuffer::NormalKind)) {
     attribs.emplace_back(VertexBuffer::NormalKind);
     defines.emplace_back("#define NORMAL");
+    if (VertexQuantization::IsOctahedralEncoded(mesh.get(), VertexBuffer::NormalKind)) {
+      defines.emplace_back("#define NORMAL_OCTAHEDRAL");
+    }
     if (mesh->nonUniformScaling()) {
       defines.emplace_back("#define NONUNIFORMSCALING");
     }
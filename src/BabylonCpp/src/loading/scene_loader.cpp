@@ -1,5 +1,7 @@
 #include <babylon/loading/scene_loader.h>
 
+#include <unordered_set>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/logging.h>
 #include <babylon/engines/engine.h>
@@ -12,6 +14,8 @@
 #include <babylon/loading/plugins/babylon/babylon_file_loader.h>
 #include <babylon/loading/scene_loader_flags.h>
 #include <babylon/loading/scene_loader_progress_event.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_optimizer.h>
 #include <babylon/misc/file_tools.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/misc/tools.h>
@@ -61,6 +65,16 @@ void SceneLoader::setCleanBoneMatrixWeights(bool value)
   SceneLoaderFlags::setCleanBoneMatrixWeights(value);
 }
 
+bool SceneLoader::OptimizeMeshes()
+{
+  return SceneLoaderFlags::OptimizeMeshes();
+}
+
+void SceneLoader::setOptimizeMeshes(bool value)
+{
+  SceneLoaderFlags::setOptimizeMeshes(value);
+}
+
 std::unordered_map<std::string, IRegisteredPlugin> SceneLoader::_registeredPlugins{};
 
 void SceneLoader::RegisterPlugins()
@@ -150,6 +164,27 @@ std::string SceneLoader::_getDirectLoad(const std::string& sceneFilename)
   return "";
 }
 
+void SceneLoader::_optimizeMeshes(const std::vector<AbstractMeshPtr>& meshes)
+{
+  // Geometries shared by several meshes are only optimized once
+  std::unordered_set<Geometry*> optimizedGeometries;
+  for (const auto& abstractMesh : meshes) {
+    auto mesh = std::dynamic_pointer_cast<Mesh>(abstractMesh);
+    if (!mesh || !mesh->geometry() || optimizedGeometries.count(mesh->geometry())) {
+      continue;
+    }
+    optimizedGeometries.insert(mesh->geometry());
+
+    const auto statistics = MeshOptimizer::OptimizeMesh(mesh.get());
+    if (SceneLoader::LoggingLevel() >= SceneLoader::DETAILED_LOGGING) {
+      BABYLON_LOGF_INFO("SceneLoader",
+                        "Optimized mesh %s: %zu -> %zu vertices, ACMR %.3f -> %.3f",
+                        mesh->name.c_str(), statistics.verticesBefore, statistics.verticesAfter,
+                        statistics.acmrBefore, statistics.acmrAfter)
+    }
+  }
+}
+
 std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr> SceneLoader::_loadData(
   const IFileInfo& fileInfo, Scene* scene,
   const std::function<
@@ -369,6 +404,10 @@ SceneLoader::ImportMesh(
                                   const std::vector<AnimationGroupPtr>& animationGroups) {
     scene->importedMeshesFiles.emplace_back(fileInfo->url);
 
+    if (SceneLoader::OptimizeMeshes()) {
+      SceneLoader::_optimizeMeshes(meshes);
+    }
+
     if (onSuccess) {
       try {
         onSuccess(meshes, particleSystems, skeletons, animationGroups);
@@ -490,7 +529,13 @@ std::optional<std::variant<ISceneLoaderPluginPtr, ISceneLoaderPluginAsyncPtr>> S
     };
   }
 
+  const auto meshCount      = scene->meshes.size();
   const auto successHandler = [=]() {
+    if (SceneLoader::OptimizeMeshes() && scene->meshes.size() > meshCount) {
+      SceneLoader::_optimizeMeshes(std::vector<AbstractMeshPtr>(
+        scene->meshes.begin() + static_cast<std::ptrdiff_t>(meshCount), scene->meshes.end()));
+    }
+
     if (onSuccess) {
       try {
         onSuccess(scene);
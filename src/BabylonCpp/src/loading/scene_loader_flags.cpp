@@ -8,6 +8,7 @@ namespace BABYLON {
 bool SceneLoaderFlags::_ForceFullSceneLoadingForIncremental = false;
 bool SceneLoaderFlags::_ShowLoadingScreen                   = true;
 bool SceneLoaderFlags::_CleanBoneMatrixWeights              = false;
+bool SceneLoaderFlags::_OptimizeMeshes                      = false;
 unsigned int SceneLoaderFlags::_loggingLevel
   = Constants::SCENELOADER_NO_LOGGING;
 
@@ -51,4 +52,14 @@ void SceneLoaderFlags::setCleanBoneMatrixWeights(bool value)
   SceneLoaderFlags::_CleanBoneMatrixWeights = value;
 }
 
+bool SceneLoaderFlags::OptimizeMeshes()
+{
+  return SceneLoaderFlags::_OptimizeMeshes;
+}
+
+void SceneLoaderFlags::setOptimizeMeshes(bool value)
+{
+  SceneLoaderFlags::_OptimizeMeshes = value;
+}
+
 } // end of namespace BABYLON
@@ -576,6 +576,11 @@ bool BackgroundMaterial::needAlphaTesting() const
   return true;
 }
 
+bool BackgroundMaterial::supportsOctahedralVertexData() const
+{
+  return true;
+}
+
 bool BackgroundMaterial::needAlphaBlending() const
 {
   return ((alpha() < 0.f) || (_diffuseTexture != nullptr && _diffuseTexture->hasAlpha()));
@@ -760,7 +765,7 @@ bool BackgroundMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subM
   MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances);
 
   // Attribs
-  if (MaterialHelper::PrepareDefinesForAttributes(mesh, defines, false, true, false)) {
+  if (MaterialHelper::PrepareDefinesForAttributes(mesh, defines, false, true, false, true, true)) {
     if (mesh) {
       if (!scene->getEngine()->getCaps().standardDerivatives
           && !mesh->isVerticesDataPresent(VertexBuffer::NormalKind)) {
@@ -263,6 +263,11 @@ std::vector<std::string>& Effect::getSamplers()
   return _samplerList;
 }
 
+std::vector<std::string>& Effect::getUniformNames()
+{
+  return _uniformsNames;
+}
+
 std::string Effect::getCompilationError()
 {
   return _compilationError;
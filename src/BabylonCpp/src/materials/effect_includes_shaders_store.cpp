@@ -45,6 +45,7 @@
 #include <babylon/shaders/shadersinclude/morph_targets_vertex_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/morph_targets_vertex_global_declaration_fx.h>
 #include <babylon/shaders/shadersinclude/mrt_fragment_declaration_fx.h>
+#include <babylon/shaders/shadersinclude/octahedral_decoding_fx.h>
 #include <babylon/shaders/shadersinclude/packing_functions_fx.h>
 #include <babylon/shaders/shadersinclude/pbr_brdf_functions_fx.h>
 #include <babylon/shaders/shadersinclude/pbr_debug_fx.h>
@@ -129,6 +130,7 @@ std::unordered_map<std::string, std::string>
      {"morphTargetsVertexDeclaration", morphTargetsVertexDeclaration},
      {"morphTargetsVertexGlobalDeclaration", morphTargetsVertexGlobalDeclaration},
      {"mrtFragmentDeclaration", mrtFragmentDeclaration},
+     {"octahedralDecoding", octahedralDecoding},
      {"packingFunctions", packingFunctions},
      {"pbrBRDFFunctions", pbrBRDFFunctions},
      {"pbrDebug", pbrDebug},
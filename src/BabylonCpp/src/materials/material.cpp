@@ -384,6 +384,11 @@ bool Material::needAlphaTesting() const
   return false;
 }
 
+bool Material::supportsOctahedralVertexData() const
+{
+  return false;
+}
+
 BaseTexturePtr Material::getAlphaTestTexture()
 {
   return nullptr;
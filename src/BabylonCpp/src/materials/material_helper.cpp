@@ -22,6 +22,7 @@
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
 #include <babylon/morph/morph_target_manager.h>
 
 namespace BABYLON {
@@ -206,7 +207,8 @@ void MaterialHelper::PrepareDefinesForMorphTargets(AbstractMesh* mesh, MaterialD
 
 bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDefines& defines,
                                                  bool useVertexColor, bool useBones,
-                                                 bool useMorphTargets, bool useVertexAlpha)
+                                                 bool useMorphTargets, bool useVertexAlpha,
+                                                 bool useOctahedralVertexData)
 {
   if (!defines._areAttributesDirty && defines._needNormals == defines._normals
       && defines._needUVs == defines._uvs) {
@@ -218,9 +220,15 @@ bool MaterialHelper::PrepareDefinesForAttributes(AbstractMesh* mesh, MaterialDef
 
   defines.boolDef["NORMAL"]
     = (defines._needNormals && mesh->isVerticesDataPresent(VertexBuffer::NormalKind));
+  defines.boolDef["NORMAL_OCTAHEDRAL"]
+    = useOctahedralVertexData && defines["NORMAL"]
+      && VertexQuantization::IsOctahedralEncoded(mesh, VertexBuffer::NormalKind);
 
   if (defines._needNormals && mesh->isVerticesDataPresent(VertexBuffer::TangentKind)) {
     defines.boolDef["TANGENT"] = true;
+    defines.boolDef["TANGENT_OCTAHEDRAL"]
+      = useOctahedralVertexData
+        && VertexQuantization::IsOctahedralEncoded(mesh, VertexBuffer::TangentKind);
   }
 
   if (defines._needUVs) {
@@ -69,6 +69,14 @@ std::string MultiMaterial::getClassName() const
   return "MultiMaterial";
 }
 
+bool MultiMaterial::supportsOctahedralVertexData() const
+{
+  return std::all_of(_subMaterials.begin(), _subMaterials.end(),
+                     [](const MaterialPtr& subMaterial) {
+                       return !subMaterial || subMaterial->supportsOctahedralVertexData();
+                     });
+}
+
 bool MultiMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMesh,
                                       bool useInstances)
 {
@@ -31,6 +31,7 @@
 namespace BABYLON {
 
 size_t NodeMaterial::_BuildIdGenerator = 0;
+std::unordered_map<std::string, size_t> NodeMaterial::_ShaderIds;
 
 NodeMaterial::NodeMaterial(const std::string& iName, Scene* iScene,
                            const INodeMaterialOptionsPtr& options)
@@ -50,7 +51,7 @@ NodeMaterial::NodeMaterial(const std::string& iName, Scene* iScene,
     , _animationFrame{-1}
     , _imageProcessingObserver{nullptr}
 {
-  _options = options;
+  _options = options ? options : std::make_shared<INodeMaterialOptions>();
 
   // Setup the default processing configuration to the scene.
   _attachImageProcessingConfiguration(nullptr);
@@ -370,6 +371,9 @@ void NodeMaterial::build(bool verbose)
   _sharedData->emitComments             = _options->emitComments;
   _sharedData->verbose                  = verbose;
 
+  // Optimize, before the blocks are initialized so that only the remaining ones are processed
+  optimize();
+
   // Initialize blocks
   std::vector<NodeMaterialBlockPtr> vertexNodes;
   std::vector<NodeMaterialBlockPtr> fragmentNodes;
@@ -384,9 +388,6 @@ void NodeMaterial::build(bool verbose)
     _initializeBlock(fragmentOutputNode, _fragmentCompilationState, vertexNodes);
   }
 
-  // Optimize
-  optimize();
-
   // Vertex
   for (const auto& vertexOutputNode : vertexNodes) {
     vertexOutputNode->build(*_vertexCompilationState, vertexNodes);
@@ -570,9 +571,17 @@ bool NodeMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMesh, b
     // Compilation
     auto join = defines->toString();
 
+    // Materials generating the same shaders share the same name, hence the same compiled effect
+    const auto shaderId = _ShaderIds
+                            .try_emplace(_vertexCompilationState->compilationString + "\n"
+                                           + _fragmentCompilationState->compilationString,
+                                         _ShaderIds.size())
+                            .first->second;
+    const auto shaderName = "nodeMaterial" + std::to_string(shaderId);
+
     std::unordered_map<std::string, std::string> baseName{
-      {"vertex", "nodeMaterial" + std::to_string(_buildId)},            //
-      {"fragment", "nodeMaterial" + std::to_string(_buildId)},          //
+      {"vertex", shaderName},                                           //
+      {"fragment", shaderName},                                         //
       {"vertexSource", _vertexCompilationState->compilationString},     //
       {"fragmentSource", _fragmentCompilationState->compilationString}, //
     };
@@ -1,5 +1,7 @@
 #include <babylon/materials/node/node_material_block.h>
 
+#include <limits>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json_util.h>
 #include <babylon/core/logging.h>
@@ -30,6 +32,10 @@ NodeMaterialBlock::NodeMaterialBlock(const std::string& iName, NodeMaterialBlock
   _isFinalMerger = isFinalMerger;
   _isInput       = isInput;
   uniqueId       = UniqueIdGenerator::UniqueId();
+
+  // Not built nor prepared yet, by any material
+  _buildId       = (std::numeric_limits<size_t>::max)();
+  _preparationId = (std::numeric_limits<size_t>::max)();
 }
 
 NodeMaterialBlock::~NodeMaterialBlock() = default;
@@ -149,8 +155,8 @@ NodeMaterialBlock::registerInput(const std::string& iName,
                                  const NodeMaterialBlockConnectionPointTypes& type, bool isOptional,
                                  const std::optional<NodeMaterialBlockTargets>& iTarget)
 {
-  auto point        = NodeMaterialConnectionPoint::New(iName, shared_from_this(),
-                                                NodeMaterialConnectionPointDirection::Input);
+  auto point
+    = NodeMaterialConnectionPoint::New(iName, this, NodeMaterialConnectionPointDirection::Input);
   point->type       = type;
   point->isOptional = isOptional;
   if (iTarget.has_value()) {
@@ -167,8 +173,8 @@ NodeMaterialBlock::registerOutput(const std::string& iName,
                                   const NodeMaterialBlockConnectionPointTypes& type,
                                   const std::optional<NodeMaterialBlockTargets>& iTarget)
 {
-  auto point  = NodeMaterialConnectionPoint::New(iName, shared_from_this(),
-                                                NodeMaterialConnectionPointDirection::Output);
+  auto point
+    = NodeMaterialConnectionPoint::New(iName, this, NodeMaterialConnectionPointDirection::Output);
   point->type = type;
   if (iTarget.has_value()) {
     point->target = *iTarget;
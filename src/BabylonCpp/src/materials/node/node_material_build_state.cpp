@@ -39,7 +39,7 @@ void NodeMaterialBuildState::finalize(const NodeMaterialBuildState& state)
     functionCode += functionItem.second + "\r\n";
   }
   compilationString
-    = StringTools::printf("\r\n\r\n%s", functionCode.c_str(), compilationString.c_str());
+    = StringTools::printf("\r\n%s\r\n%s", functionCode.c_str(), compilationString.c_str());
 
   if (!isFragmentMode && !_varyingTransfer.empty()) {
     compilationString
@@ -55,18 +55,18 @@ void NodeMaterialBuildState::finalize(const NodeMaterialBuildState& state)
   }
 
   if (!_samplerDeclaration.empty()) {
-    compilationString = StringTools::printf("\r\n%s%s\r\n%s)", emitComments ? "//Samplers\r\n" : "",
+    compilationString = StringTools::printf("\r\n%s%s\r\n%s", emitComments ? "//Samplers\r\n" : "",
                                             _samplerDeclaration.c_str(), compilationString.c_str());
   }
 
   if (!_uniformDeclaration.empty()) {
-    compilationString = StringTools::printf("\r\n%s%s\r\n%s)", emitComments ? "//Uniforms\r\n" : "",
+    compilationString = StringTools::printf("\r\n%s%s\r\n%s", emitComments ? "//Uniforms\r\n" : "",
                                             _uniformDeclaration.c_str(), compilationString.c_str());
   }
 
   if (!_attributeDeclaration.empty() && !isFragmentMode) {
     compilationString
-      = StringTools::printf("\r\n%s%s\r\n%s)", emitComments ? "//Attributes\r\n" : "",
+      = StringTools::printf("\r\n%s%s\r\n%s", emitComments ? "//Attributes\r\n" : "",
                             _attributeDeclaration.c_str(), compilationString.c_str());
   }
 
@@ -64,7 +64,7 @@ void NodeMaterialBuildStateSharedData::emitErrors()
                  << "] is not connected and is not optional.\r\n";
   }
 
-  if (errorMessage) {
+  if (!errorMessage.str().empty()) {
     throw std::runtime_error("Build of NodeMaterial failed:\r\n" + errorMessage.str());
   }
 }
@@ -8,7 +8,7 @@
 namespace BABYLON {
 
 NodeMaterialConnectionPoint::NodeMaterialConnectionPoint(
-  const std::string& iName, const NodeMaterialBlockPtr& ownerBlock,
+  const std::string& iName, NodeMaterialBlock* ownerBlock,
   const NodeMaterialConnectionPointDirection& direction)
     : _ownerBlock{nullptr}
     , _connectedPoint{nullptr}
@@ -40,9 +40,9 @@ NodeMaterialConnectionPoint::NodeMaterialConnectionPoint(
     , _connectInputBlock{nullptr}
     , _sourceBlock{nullptr}
 {
-  _ownerBlock = ownerBlock;
-  name        = iName;
-  _direction  = direction;
+  _ownerBlockPtr = ownerBlock;
+  name           = iName;
+  _direction     = direction;
 }
 
 NodeMaterialConnectionPointDirection& NodeMaterialConnectionPoint::get_direction()
@@ -52,8 +52,8 @@ NodeMaterialConnectionPointDirection& NodeMaterialConnectionPoint::get_direction
 
 std::string NodeMaterialConnectionPoint::get_associatedVariableName() const
 {
-  if (_ownerBlock->isInput()) {
-    auto inputBlock = std::static_pointer_cast<InputBlock>(_ownerBlock);
+  if (ownerBlock()->isInput()) {
+    auto inputBlock = std::static_pointer_cast<InputBlock>(ownerBlock());
     if (inputBlock) {
       return inputBlock->associatedVariableName();
     }
@@ -74,8 +74,8 @@ void NodeMaterialConnectionPoint::set_associatedVariableName(std::string value)
 NodeMaterialBlockConnectionPointTypes& NodeMaterialConnectionPoint::get_type()
 {
   if (_type == NodeMaterialBlockConnectionPointTypes::AutoDetect) {
-    if (_ownerBlock->isInput()) {
-      auto inputBlock = std::static_pointer_cast<InputBlock>(_ownerBlock);
+    if (ownerBlock()->isInput()) {
+      auto inputBlock = std::static_pointer_cast<InputBlock>(ownerBlock());
       if (inputBlock) {
         return inputBlock->type();
       }
@@ -104,7 +104,7 @@ void NodeMaterialConnectionPoint::set_type(const NodeMaterialBlockConnectionPoin
 
 NodeMaterialBlockTargets& NodeMaterialConnectionPoint::get_target()
 {
-  if (!_prioritizeVertex || !_ownerBlock) {
+  if (!_prioritizeVertex || !ownerBlock()) {
     return _target;
   }
 
@@ -112,7 +112,7 @@ NodeMaterialBlockTargets& NodeMaterialConnectionPoint::get_target()
     return _target;
   }
 
-  if (_ownerBlock->target() == NodeMaterialBlockTargets::Fragment) {
+  if (ownerBlock()->target() == NodeMaterialBlockTargets::Fragment) {
     _tmpTarget = NodeMaterialBlockTargets::Fragment;
     return _tmpTarget;
   }
@@ -154,6 +154,9 @@ NodeMaterialConnectionPointPtr& NodeMaterialConnectionPoint::get_connectedPoint(
 
 NodeMaterialBlockPtr& NodeMaterialConnectionPoint::get_ownerBlock()
 {
+  if (!_ownerBlock && _ownerBlockPtr) {
+    _ownerBlock = _ownerBlockPtr->weak_from_this().lock();
+  }
   return _ownerBlock;
 }
 
@@ -266,7 +269,7 @@ bool NodeMaterialConnectionPoint::canConnectTo(const NodeMaterialConnectionPoint
 NodeMaterialConnectionPointCompatibilityStates NodeMaterialConnectionPoint::checkCompatibilityState(
   const NodeMaterialConnectionPoint& connectionPoint)
 {
-  const auto& iOwnerBlock = _ownerBlock;
+  const auto& iOwnerBlock = ownerBlock();
 
   if (iOwnerBlock->target() == NodeMaterialBlockTargets::Fragment) {
     // Let's check we are not going reverse
@@ -338,6 +341,10 @@ NodeMaterialConnectionPoint::connectTo(const NodeMaterialConnectionPointPtr& con
     throw std::runtime_error("Cannot connect these two connectors.");
   }
 
+  // The connection points keep the blocks of the graph alive
+  get_ownerBlock();
+  connectionPoint->get_ownerBlock();
+
   _endpoints.emplace_back(connectionPoint);
   connectionPoint->_connectedPoint = shared_from_this();
 
@@ -1,12 +1,500 @@
 #include <babylon/materials/node/optimizers/node_material_optimizer.h>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <iomanip>
+#include <optional>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <babylon/animations/animation_value.h>
+#include <babylon/materials/node/blocks/clamp_block.h>
+#include <babylon/materials/node/blocks/input/animated_input_block_types.h>
+#include <babylon/materials/node/blocks/input/input_block.h>
+#include <babylon/materials/node/node_material_block.h>
+#include <babylon/materials/node/node_material_connection_point.h>
+#include <babylon/maths/color3.h>
+#include <babylon/maths/color4.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/maths/vector4.h>
+
 namespace BABYLON {
 
-void NodeMaterialOptimizer::optimize(
-  const std::vector<NodeMaterialBlockPtr>& /*vertexOutputNodes*/,
-  const std::vector<NodeMaterialBlockPtr>& /*fragmentOutputNodes*/)
+namespace {
+
+/**
+ * @brief Value of a constant input, stored as up to four float components.
+ */
+struct Constant {
+  NodeMaterialBlockConnectionPointTypes type;
+  size_t size;
+  std::array<float, 4> values;
+}; // end of struct Constant
+
+// Blocks computing their single output from their inputs only, without side effect
+const std::unordered_set<std::string> PureBlocks{
+  "AddBlock",      "SubtractBlock",   "MultiplyBlock",  "DivideBlock", "MinBlock", "MaxBlock",
+  "ScaleBlock",    "NegateBlock",     "OneMinusBlock",  "ReciprocalBlock", "NormalizeBlock",
+  "LerpBlock",     "PowBlock",        "StepBlock",      "ClampBlock",  "DotBlock", "LengthBlock"};
+
+// Pure blocks whose two inputs can be swapped
+const std::unordered_set<std::string> CommutativeBlocks{"AddBlock", "MultiplyBlock", "MinBlock",
+                                                        "MaxBlock", "DotBlock"};
+
+std::optional<size_t> ComponentCount(NodeMaterialBlockConnectionPointTypes type)
+{
+  switch (type) {
+    case NodeMaterialBlockConnectionPointTypes::Float:
+      return 1;
+    case NodeMaterialBlockConnectionPointTypes::Vector2:
+      return 2;
+    case NodeMaterialBlockConnectionPointTypes::Vector3:
+    case NodeMaterialBlockConnectionPointTypes::Color3:
+      return 3;
+    case NodeMaterialBlockConnectionPointTypes::Vector4:
+    case NodeMaterialBlockConnectionPointTypes::Color4:
+      return 4;
+    default:
+      return std::nullopt;
+  }
+}
+
+/**
+ * @brief Returns whether the value of an input block can never change: constant, without
+ * callback, animation or system value.
+ */
+bool IsConstant(const InputBlockPtr& inputBlock)
+{
+  return inputBlock && inputBlock->isConstant && inputBlock->isUniform()
+         && !inputBlock->isSystemValue() && !inputBlock->valueCallback()
+         && inputBlock->value() != nullptr
+         && inputBlock->animationType() == AnimatedInputBlockTypes::None;
+}
+
+InputBlockPtr ConnectedInputBlock(const NodeMaterialConnectionPointPtr& input)
+{
+  if (!input->connectedPoint() || !input->isConnectedToInputBlock()) {
+    return nullptr;
+  }
+  return input->connectInputBlock();
+}
+
+std::optional<Constant> ConstantValue(const InputBlockPtr& inputBlock)
+{
+  if (!IsConstant(inputBlock)) {
+    return std::nullopt;
+  }
+
+  const auto type   = inputBlock->type();
+  const auto& value = *inputBlock->value();
+  switch (type) {
+    case NodeMaterialBlockConnectionPointTypes::Float:
+      return Constant{type, 1, {{value.get<float>(), 0.f, 0.f, 0.f}}};
+    case NodeMaterialBlockConnectionPointTypes::Vector2: {
+      const auto& v = value.get<Vector2>();
+      return Constant{type, 2, {{v.x, v.y, 0.f, 0.f}}};
+    }
+    case NodeMaterialBlockConnectionPointTypes::Vector3: {
+      const auto& v = value.get<Vector3>();
+      return Constant{type, 3, {{v.x, v.y, v.z, 0.f}}};
+    }
+    case NodeMaterialBlockConnectionPointTypes::Vector4: {
+      const auto& v = value.get<Vector4>();
+      return Constant{type, 4, {{v.x, v.y, v.z, v.w}}};
+    }
+    case NodeMaterialBlockConnectionPointTypes::Color3: {
+      const auto& c = value.get<Color3>();
+      return Constant{type, 3, {{c.r, c.g, c.b, 0.f}}};
+    }
+    case NodeMaterialBlockConnectionPointTypes::Color4: {
+      const auto& c = value.get<Color4>();
+      return Constant{type, 4, {{c.r, c.g, c.b, c.a}}};
+    }
+    default:
+      return std::nullopt;
+  }
+}
+
+AnimationValuePtr ToAnimationValue(const Constant& constant)
+{
+  const auto& v = constant.values;
+  switch (constant.type) {
+    case NodeMaterialBlockConnectionPointTypes::Vector2:
+      return std::make_shared<AnimationValue>(Vector2(v[0], v[1]));
+    case NodeMaterialBlockConnectionPointTypes::Vector3:
+      return std::make_shared<AnimationValue>(Vector3(v[0], v[1], v[2]));
+    case NodeMaterialBlockConnectionPointTypes::Vector4:
+      return std::make_shared<AnimationValue>(Vector4(v[0], v[1], v[2], v[3]));
+    case NodeMaterialBlockConnectionPointTypes::Color3:
+      return std::make_shared<AnimationValue>(Color3(v[0], v[1], v[2]));
+    case NodeMaterialBlockConnectionPointTypes::Color4:
+      return std::make_shared<AnimationValue>(Color4(v[0], v[1], v[2], v[3]));
+    default:
+      return std::make_shared<AnimationValue>(v[0]);
+  }
+}
+
+bool AllComponentsEqual(const std::optional<Constant>& constant, float value)
+{
+  return constant
+         && std::all_of(constant->values.begin(), constant->values.begin() + constant->size,
+                        [value](float component) { return component == value; });
+}
+
+/**
+ * @brief Evaluates a pure block whose inputs are all constants, float operands being broadcast to
+ * the size of the other operands as in GLSL.
+ * @returns the value of the output, or nothing if it is not defined or cannot be computed
+ */
+std::optional<Constant> Evaluate(const NodeMaterialBlockPtr& block,
+                                 const std::vector<Constant>& operands)
+{
+  const auto className  = block->getClassName();
+  const auto outputType = block->outputs()[0]->type();
+  const auto size       = ComponentCount(outputType);
+  if (!size || operands.empty()) {
+    return std::nullopt;
+  }
+  for (const auto& operand : operands) {
+    if (operand.size != 1 && operand.size != *size && className != "DotBlock"
+        && className != "LengthBlock") {
+      return std::nullopt;
+    }
+  }
+
+  const auto component = [&operands](size_t operand, size_t index) {
+    const auto& constant = operands[operand];
+    return constant.values[constant.size == 1 ? 0 : index];
+  };
+  const auto length = [&operands](size_t operand) {
+    float sum = 0.f;
+    for (size_t i = 0; i < operands[operand].size; ++i) {
+      sum += operands[operand].values[i] * operands[operand].values[i];
+    }
+    return std::sqrt(sum);
+  };
+
+  Constant result{outputType, *size, {{0.f, 0.f, 0.f, 0.f}}};
+  for (size_t i = 0; i < *size; ++i) {
+    auto& value = result.values[i];
+    if (className == "AddBlock") {
+      value = component(0, i) + component(1, i);
+    }
+    else if (className == "SubtractBlock") {
+      value = component(0, i) - component(1, i);
+    }
+    else if (className == "MultiplyBlock" || className == "ScaleBlock") {
+      value = component(0, i) * component(1, i);
+    }
+    else if (className == "DivideBlock") {
+      if (component(1, i) == 0.f) {
+        return std::nullopt;
+      }
+      value = component(0, i) / component(1, i);
+    }
+    else if (className == "MinBlock") {
+      value = std::min(component(0, i), component(1, i));
+    }
+    else if (className == "MaxBlock") {
+      value = std::max(component(0, i), component(1, i));
+    }
+    else if (className == "NegateBlock") {
+      value = -component(0, i);
+    }
+    else if (className == "OneMinusBlock") {
+      value = 1.f - component(0, i);
+    }
+    else if (className == "ReciprocalBlock") {
+      if (component(0, i) == 0.f) {
+        return std::nullopt;
+      }
+      value = 1.f / component(0, i);
+    }
+    else if (className == "NormalizeBlock") {
+      const auto norm = length(0);
+      if (norm == 0.f) {
+        return std::nullopt;
+      }
+      value = component(0, i) / norm;
+    }
+    else if (className == "LerpBlock") {
+      value = component(0, i) * (1.f - component(2, i)) + component(1, i) * component(2, i);
+    }
+    else if (className == "PowBlock") {
+      // pow is undefined for negative values, or for 0 to a non positive power
+      if (component(0, i) < 0.f || (component(0, i) == 0.f && component(1, i) <= 0.f)) {
+        return std::nullopt;
+      }
+      value = std::pow(component(0, i), component(1, i));
+    }
+    else if (className == "StepBlock") {
+      value = component(0, i) < component(1, i) ? 0.f : 1.f;
+    }
+    else if (className == "ClampBlock") {
+      const auto clampBlock = std::static_pointer_cast<ClampBlock>(block);
+      value = std::min(std::max(component(0, i), clampBlock->minimum), clampBlock->maximum);
+    }
+    else if (className == "DotBlock") {
+      if (operands[0].size != operands[1].size) {
+        return std::nullopt;
+      }
+      for (size_t j = 0; j < operands[0].size; ++j) {
+        value += operands[0].values[j] * operands[1].values[j];
+      }
+    }
+    else if (className == "LengthBlock") {
+      value = length(0);
+    }
+    else {
+      return std::nullopt;
+    }
+
+    if (!std::isfinite(value)) {
+      return std::nullopt;
+    }
+  }
+
+  return result;
+}
+
+std::string ConstantKey(const Constant& constant, NodeMaterialBlockTargets target)
+{
+  std::ostringstream key;
+  key << "constant:" << static_cast<int>(constant.type) << ":" << static_cast<int>(target)
+      << std::hexfloat;
+  for (size_t i = 0; i < constant.size; ++i) {
+    key << ":" << constant.values[i];
+  }
+  return key.str();
+}
+
+/**
+ * @brief Returns the key identifying the value of an input block, or an empty key if the input
+ * cannot be merged with the other ones (uniforms can be modified independently).
+ */
+std::string InputKey(const InputBlockPtr& inputBlock)
+{
+  const auto target = static_cast<int>(inputBlock->target());
+  if (const auto constant = ConstantValue(inputBlock)) {
+    return ConstantKey(*constant, inputBlock->target());
+  }
+  if (inputBlock->isSystemValue() && inputBlock->systemValue().has_value()) {
+    return "system:" + std::to_string(static_cast<int>(*inputBlock->systemValue())) + ":"
+           + std::to_string(target);
+  }
+  if (inputBlock->isAttribute()) {
+    return "attribute:" + inputBlock->name + ":" + std::to_string(target);
+  }
+  return "";
+}
+
+/**
+ * @brief Collects the blocks reachable from the output nodes, each block appearing after the
+ * blocks connected to its inputs.
+ */
+std::vector<NodeMaterialBlockPtr>
+CollectBlocks(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+              const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes)
 {
-  // Do nothing by default
+  std::vector<NodeMaterialBlockPtr> blocks;
+  std::unordered_set<NodeMaterialBlock*> visited;
+  std::function<void(const NodeMaterialBlockPtr&)> visit
+    = [&blocks, &visited, &visit](const NodeMaterialBlockPtr& block) {
+        if (!block || !visited.insert(block.get()).second) {
+          return;
+        }
+        for (const auto& input : block->inputs()) {
+          if (input->connectedPoint()) {
+            visit(input->connectedPoint()->ownerBlock());
+          }
+        }
+        blocks.emplace_back(block);
+      };
+
+  for (const auto& outputNodes : {vertexOutputNodes, fragmentOutputNodes}) {
+    for (const auto& outputNode : outputNodes) {
+      visit(outputNode);
+    }
+  }
+  return blocks;
+}
+
+/**
+ * @brief Connects the endpoints of an output to another output.
+ */
+void Redirect(const NodeMaterialConnectionPointPtr& from, const NodeMaterialConnectionPointPtr& to)
+{
+  if (from == to) {
+    return;
+  }
+  const auto endpoints = from->endpoints();
+  for (const auto& endpoint : endpoints) {
+    from->disconnectFrom(endpoint);
+    to->connectTo(endpoint, true);
+  }
+}
+
+} // end of anonymous namespace
+
+void NodeMaterialOptimizer::optimize(const std::vector<NodeMaterialBlockPtr>& vertexOutputNodes,
+                                     const std::vector<NodeMaterialBlockPtr>& fragmentOutputNodes)
+{
+  // Outputs already in the graph, by value or expression
+  std::unordered_map<std::string, NodeMaterialConnectionPointPtr> equivalentOutputs;
+
+  // Returns the output of a constant input block holding the given value
+  const auto constantOutput = [&equivalentOutputs](const Constant& constant,
+                                                   const NodeMaterialBlockPtr& block,
+                                                   NodeMaterialBlockTargets target) {
+    auto& output = equivalentOutputs[ConstantKey(constant, target)];
+    if (!output) {
+      auto inputBlock        = InputBlock::New(block->name, target);
+      inputBlock->value      = ToAnimationValue(constant);
+      inputBlock->isConstant = true;
+      output                 = inputBlock->output();
+      // Resolves the owner of the output, which then keeps the new block alive
+      output->ownerBlock();
+    }
+    return output;
+  };
+
+  // Blocks are visited after their inputs, so simplifications cascade through the graph
+  const auto blocks = CollectBlocks(vertexOutputNodes, fragmentOutputNodes);
+  for (const auto& block : blocks) {
+    if (block->isInput()) {
+      const auto inputBlock = std::static_pointer_cast<InputBlock>(block);
+      const auto key        = InputKey(inputBlock);
+      if (!key.empty()) {
+        auto& equivalentOutput = equivalentOutputs[key];
+        if (!equivalentOutput) {
+          equivalentOutput = inputBlock->output();
+        }
+        Redirect(inputBlock->output(), equivalentOutput);
+      }
+      continue;
+    }
+
+    const auto className = block->getClassName();
+    if (!PureBlocks.count(className) || block->outputs().size() != 1) {
+      continue;
+    }
+
+    const auto& inputs = block->inputs();
+    const auto& output = block->outputs()[0];
+    if (std::any_of(inputs.begin(), inputs.end(),
+                    [](const NodeMaterialConnectionPointPtr& input) {
+                      return !input->connectedPoint();
+                    })) {
+      continue;
+    }
+
+    // Constant folding
+    std::vector<Constant> operands;
+    NodeMaterialBlockTargets constantTarget = NodeMaterialBlockTargets::Vertex;
+    for (const auto& input : inputs) {
+      const auto inputBlock = ConnectedInputBlock(input);
+      const auto constant   = ConstantValue(inputBlock);
+      if (!constant) {
+        break;
+      }
+      constantTarget = inputBlock->target();
+      operands.emplace_back(*constant);
+    }
+    if (operands.size() == inputs.size()) {
+      if (const auto result = Evaluate(block, operands)) {
+        Redirect(output, constantOutput(*result, block, constantTarget));
+        continue;
+      }
+    }
+
+    // Identities
+    NodeMaterialConnectionPointPtr passthrough = nullptr;
+    const auto constantAt = [&inputs](size_t index) {
+      return ConstantValue(ConnectedInputBlock(inputs[index]));
+    };
+    const auto sourceAt   = [&inputs](size_t index) { return inputs[index]->connectedPoint(); };
+    if (className == "AddBlock") {
+      passthrough = AllComponentsEqual(constantAt(1), 0.f) ? sourceAt(0) :
+                    AllComponentsEqual(constantAt(0), 0.f) ? sourceAt(1) :
+                                                             nullptr;
+    }
+    else if (className == "SubtractBlock") {
+      passthrough = AllComponentsEqual(constantAt(1), 0.f) ? sourceAt(0) : nullptr;
+    }
+    else if (className == "MultiplyBlock" || className == "ScaleBlock") {
+      for (size_t index : {size_t{0}, size_t{1}}) {
+        const auto constant = constantAt(index);
+        if (AllComponentsEqual(constant, 1.f)) {
+          passthrough = sourceAt(1 - index);
+          break;
+        }
+        const auto size = ComponentCount(output->type());
+        if (AllComponentsEqual(constant, 0.f) && size) {
+          const Constant zero{output->type(), *size, {{0.f, 0.f, 0.f, 0.f}}};
+          passthrough
+            = constantOutput(zero, block, ConnectedInputBlock(inputs[index])->target());
+          break;
+        }
+      }
+    }
+    else if (className == "DivideBlock") {
+      passthrough = AllComponentsEqual(constantAt(1), 1.f) ? sourceAt(0) : nullptr;
+    }
+    else if (className == "LerpBlock") {
+      passthrough = AllComponentsEqual(constantAt(2), 0.f) ? sourceAt(0) :
+                    AllComponentsEqual(constantAt(2), 1.f) ? sourceAt(1) :
+                                                             nullptr;
+    }
+    if (passthrough && passthrough->type() == output->type()) {
+      Redirect(output, passthrough);
+      continue;
+    }
+
+    // Common subexpression elimination
+    std::vector<std::string> sources;
+    for (const auto& input : inputs) {
+      std::ostringstream source;
+      source << input->connectedPoint().get();
+      sources.emplace_back(source.str());
+    }
+    if (CommutativeBlocks.count(className)) {
+      std::sort(sources.begin(), sources.end());
+    }
+    std::ostringstream key;
+    key << className << ":" << static_cast<int>(block->target());
+    for (const auto& source : sources) {
+      key << ":" << source;
+    }
+    if (className == "ClampBlock") {
+      const auto clampBlock = std::static_pointer_cast<ClampBlock>(block);
+      key << std::hexfloat << ":" << clampBlock->minimum << ":" << clampBlock->maximum;
+    }
+    auto& equivalentOutput = equivalentOutputs[key.str()];
+    if (!equivalentOutput) {
+      equivalentOutput = output;
+    }
+    Redirect(output, equivalentOutput);
+  }
+
+  // Dead block elimination: the blocks bypassed above are still listed as endpoints of the blocks
+  // feeding them, which would keep their outputs flagged as used in the shaders
+  const auto reachableBlocks = CollectBlocks(vertexOutputNodes, fragmentOutputNodes);
+  const std::unordered_set<NodeMaterialBlockPtr> liveBlocks(reachableBlocks.begin(),
+                                                            reachableBlocks.end());
+  for (const auto& block : blocks) {
+    for (const auto& output : block->outputs()) {
+      const auto endpoints = output->endpoints();
+      for (const auto& endpoint : endpoints) {
+        if (!liveBlocks.count(endpoint->ownerBlock())) {
+          output->disconnectFrom(endpoint);
+        }
+      }
+    }
+  }
 }
 
 } // end of namespace BABYLON
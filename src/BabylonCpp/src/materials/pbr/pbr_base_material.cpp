@@ -274,6 +274,11 @@ bool PBRBaseMaterial::needAlphaTesting() const
              || *_transparencyMode == PBRBaseMaterial::PBRMATERIAL_ALPHATEST);
 }
 
+bool PBRBaseMaterial::supportsOctahedralVertexData() const
+{
+  return true;
+}
+
 bool PBRBaseMaterial::_shouldUseAlphaFromAlbedoTexture() const
 {
   return _albedoTexture != nullptr && _albedoTexture->hasAlpha() && _useAlphaFromAlbedoTexture
@@ -1019,7 +1024,8 @@ void PBRBaseMaterial::_prepareDefines(AbstractMesh* mesh, PBRMaterialDefines& de
 
   // Attribs
   MaterialHelper::PrepareDefinesForAttributes(
-    mesh, defines, true, true, true, _transparencyMode != PBRBaseMaterial::PBRMATERIAL_OPAQUE);
+    mesh, defines, true, true, true, _transparencyMode != PBRBaseMaterial::PBRMATERIAL_OPAQUE,
+    true);
 }
 
 void PBRBaseMaterial::forceCompilation(AbstractMesh* mesh,
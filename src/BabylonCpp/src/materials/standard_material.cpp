@@ -389,6 +389,11 @@ bool StandardMaterial::needAlphaTesting() const
   return _diffuseTexture != nullptr && _diffuseTexture->hasAlpha();
 }
 
+bool StandardMaterial::supportsOctahedralVertexData() const
+{
+  return true;
+}
+
 bool StandardMaterial::_shouldUseAlphaFromDiffuseTexture() const
 {
   return _diffuseTexture != nullptr && _diffuseTexture->hasAlpha() && _useAlphaFromDiffuseTexture;
@@ -676,7 +681,7 @@ bool StandardMaterial::isReadyForSubMesh(AbstractMesh* mesh, BaseSubMesh* subMes
                                         fogEnabled(), _shouldTurnAlphaTestOn(mesh), defines);
 
   // Attribs
-  MaterialHelper::PrepareDefinesForAttributes(mesh, defines, true, true, true, true);
+  MaterialHelper::PrepareDefinesForAttributes(mesh, defines, true, true, true, true, true);
 
   // Values that need to be evaluated on every frame
   MaterialHelper::PrepareDefinesForFrameBoundValues(scene, engine, defines, useInstances);
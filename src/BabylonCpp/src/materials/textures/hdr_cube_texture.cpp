@@ -11,6 +11,7 @@
 #include <babylon/materials/textures/internal_texture.h>
 #include <babylon/materials/textures/texture_constants.h>
 #include <babylon/misc/highdynamicrange/cube_map_to_spherical_polynomial_tools.h>
+#include <babylon/misc/highdynamicrange/hdr_cube_texture_cache.h>
 #include <babylon/misc/highdynamicrange/hdr_tools.h>
 #include <babylon/misc/tools.h>
 
@@ -140,6 +141,23 @@ void HDRCubeTexture::loadTexture()
     if (!scene) {
       return {};
     }
+
+    // Reuse the faces and harmonics processed by a previous load of the same file.
+    const auto textureFloat = scene->getEngine()->getCaps().textureFloat;
+    HDRCubeTextureCacheKey cacheKey;
+    if (HDRCubeTextureCache::IsEnabled()) {
+      cacheKey = HDRCubeTextureCache::ComputeKey(buffer, _size, gammaSpace, textureFloat,
+                                                 _generateHarmonics);
+      std::vector<ArrayBufferView> cachedFaces;
+      SphericalPolynomialPtr cachedPolynomial = nullptr;
+      if (HDRCubeTextureCache::Load(cacheKey, cachedFaces, cachedPolynomial)) {
+        if (_generateHarmonics) {
+          sphericalPolynomial = cachedPolynomial;
+        }
+        return cachedFaces;
+      }
+    }
+
     // Extract the raw linear data.
     auto data = HDRTools::GetCubeMapTextureData(buffer, _size);
 
@@ -157,7 +175,7 @@ void HDRCubeTexture::loadTexture()
     for (unsigned int j = 0; j < 6; ++j) {
 
       // Create uintarray fallback.
-      if (!scene->getEngine()->getCaps().textureFloat) {
+      if (!textureFloat) {
         // 3 channels of 1 bytes per pixel in bytes.
         byteArray.resize(_size * _size * 3);
       }
@@ -204,6 +222,12 @@ void HDRCubeTexture::loadTexture()
         results.emplace_back(dataFace);
       }
     }
+
+    if (HDRCubeTextureCache::IsEnabled()) {
+      HDRCubeTextureCache::Save(cacheKey, results,
+                                _generateHarmonics ? sphericalPolynomial() : nullptr);
+    }
+
     return results;
   };
 
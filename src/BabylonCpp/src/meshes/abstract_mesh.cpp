@@ -793,6 +793,16 @@ Float32Array AbstractMesh::getVerticesData(const std::string& /*kind*/, bool /*c
   return Float32Array();
 }
 
+ConstFloat32ArrayView AbstractMesh::getVerticesDataView(const std::string& /*kind*/)
+{
+  return {};
+}
+
+ConstIndicesArrayView AbstractMesh::getIndicesView()
+{
+  return {};
+}
+
 AbstractMesh* AbstractMesh::setVerticesData(const std::string& /*kind*/,
                                             const Float32Array& /*data*/, bool /*updatable*/,
                                             const std::optional<size_t>& /*stride*/)
@@ -950,11 +960,12 @@ AbstractMesh& AbstractMesh::refreshBoundingInfo(bool applySkeleton)
     return *this;
   }
 
-  _refreshBoundingInfo(_getPositionData(applySkeleton), std::nullopt);
+  Float32Array skinnedData;
+  _refreshBoundingInfo(_getPositionDataView(applySkeleton, skinnedData), std::nullopt);
   return *this;
 }
 
-void AbstractMesh::_refreshBoundingInfo(const Float32Array& data,
+void AbstractMesh::_refreshBoundingInfo(const ConstFloat32ArrayView& data,
                                         const std::optional<Vector2>& bias)
 {
   if (!data.empty()) {
@@ -976,6 +987,20 @@ void AbstractMesh::_refreshBoundingInfo(const Float32Array& data,
   _updateBoundingInfo();
 }
 
+ConstFloat32ArrayView AbstractMesh::_getPositionDataView(bool applySkeleton,
+                                                         Float32Array& storage)
+{
+  if (!applySkeleton || !skeleton()) {
+    auto data = getVerticesDataView(VertexBuffer::PositionKind);
+    if (!data.empty()) {
+      return data;
+    }
+  }
+
+  storage = _getPositionData(applySkeleton);
+  return storage;
+}
+
 Float32Array AbstractMesh::_getPositionData(bool applySkeleton)
 {
   auto data = getVerticesData(VertexBuffer::PositionKind);
@@ -1416,6 +1441,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, bool fastCheck,
   // Octrees
   auto _subMeshes = _scene->getIntersectingSubMeshCandidates(this, ray);
   auto len        = _subMeshes.size();
+  auto indices    = getIndicesView();
   for (size_t index = 0; index < len; ++index) {
     auto& subMesh = _subMeshes[index];
 
@@ -1425,7 +1451,7 @@ PickingInfo AbstractMesh::intersects(Ray& ray, bool fastCheck,
     }
 
     auto currentIntersectInfo
-      = subMesh->intersects(ray, _positions(), getIndices(), fastCheck, trianglePredicate);
+      = subMesh->intersects(ray, _positions(), indices, fastCheck, trianglePredicate);
 
     if (currentIntersectInfo) {
       if (fastCheck || !intersectInfo || currentIntersectInfo->distance < intersectInfo->distance) {
@@ -1646,8 +1672,13 @@ AbstractMesh& AbstractMesh::updateFacetData()
   if (!data.facetDataEnabled) {
     _initFacetData();
   }
-  auto positions    = getVerticesData(VertexBuffer::PositionKind);
-  auto indices      = getIndices();
+  Float32Array positionsCopy;
+  auto positions = getVerticesDataView(VertexBuffer::PositionKind);
+  if (positions.empty()) {
+    positionsCopy = getVerticesData(VertexBuffer::PositionKind);
+    positions     = positionsCopy;
+  }
+  auto indices      = getIndicesView();
   auto normals      = getVerticesData(VertexBuffer::NormalKind);
   const auto& bInfo = *getBoundingInfo();
 
@@ -1656,7 +1687,7 @@ AbstractMesh& AbstractMesh::updateFacetData()
     data.facetDepthSortEnabled = true;
     // indices instanceof Uint32Array
     {
-      data.depthSortedIndices = Uint32Array(indices);
+      data.depthSortedIndices = indices.toArray();
     }
 
     data.facetDepthSortFunction = [](const DepthSortedFacet& f1, const DepthSortedFacet& f2) {
@@ -1699,10 +1730,11 @@ AbstractMesh& AbstractMesh::updateFacetData()
   data.subDiv.X = data.subDiv.X < 1 ? 1 : data.subDiv.X;
   data.subDiv.Y = data.subDiv.Y < 1 ? 1 : data.subDiv.Y;
   data.subDiv.Z = data.subDiv.Z < 1 ? 1 : data.subDiv.Z;
-  // set the parameters for ComputeNormals()
-  data.facetParameters.facetNormals      = getFacetLocalNormals();
-  data.facetParameters.facetPositions    = getFacetLocalPositions();
-  data.facetParameters.facetPartitioning = getFacetLocalPartitioning();
+  // set the parameters for ComputeNormals(), the facet arrays are moved in and out of the
+  // parameters so that ComputeNormals() updates them in place
+  data.facetParameters.facetNormals      = std::move(data.facetNormals);
+  data.facetParameters.facetPositions    = std::move(data.facetPositions);
+  data.facetParameters.facetPartitioning = std::move(data.facetPartitioning);
   data.facetParameters.bInfo             = bInfo;
   data.facetParameters.bbSize            = data.bbSize;
   data.facetParameters.subDiv            = data.subDiv;
@@ -1715,8 +1747,12 @@ AbstractMesh& AbstractMesh::updateFacetData()
                                        data.facetDepthSortOrigin);
     data.facetParameters.distanceTo = data.facetDepthSortOrigin;
   }
-  data.facetParameters.depthSortedFacets = data.depthSortedFacets;
-  VertexData::ComputeNormals(positions, indices, normals, data.facetParameters);
+  data.facetParameters.depthSortedFacets = std::move(data.depthSortedFacets);
+  VertexData::ComputeNormals(positions, indices, normals, &data.facetParameters);
+  data.facetNormals      = std::move(data.facetParameters.facetNormals);
+  data.facetPositions    = std::move(data.facetParameters.facetPositions);
+  data.facetPartitioning = std::move(data.facetParameters.facetPartitioning);
+  data.depthSortedFacets = std::move(data.facetParameters.depthSortedFacets);
 
   if (data.facetDepthSort && data.facetDepthSortEnabled) {
     BABYLON::stl_util::sort_js_style(data.depthSortedFacets, data.facetDepthSortFunction);
@@ -1943,7 +1979,7 @@ AbstractMesh& AbstractMesh::createNormals(bool updatable)
 
   FacetParameters options;
   options.useRightHandedSystem = getScene()->useRightHandedSystem();
-  VertexData::ComputeNormals(positions, indices, normals, options);
+  VertexData::ComputeNormals(positions, indices, normals, &options);
   setVerticesData(VertexBuffer::NormalKind, normals, updatable);
 
   return *this;
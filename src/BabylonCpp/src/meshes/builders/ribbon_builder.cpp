@@ -97,8 +97,8 @@ MeshPtr RibbonBuilder::CreateRibbon(const std::string& name,
       auto indices = instance->getIndices();
       auto normals = instance->getVerticesData(VertexBuffer::NormalKind);
       if (instance->isFacetDataEnabled()) {
-        auto params = instance->getFacetDataParameters();
-        VertexData::ComputeNormals(positions, indices, normals, params);
+        auto& params = instance->getFacetDataParameters();
+        VertexData::ComputeNormals(positions, indices, normals, &params);
       }
       else {
         VertexData::ComputeNormals(positions, indices, normals);
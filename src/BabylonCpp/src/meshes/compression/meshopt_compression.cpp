@@ -0,0 +1,500 @@
+#include <babylon/meshes/compression/meshopt_compression.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stdexcept>
+
+#include <babylon/misc/string_tools.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Vertex codec: vertices are encoded in blocks, each byte of the vertex being stored as deltas to
+// the previous vertex in groups of 16 bytes using 0, 2, 4 or 8 bits per delta
+constexpr uint8_t VertexHeader             = 0xa0;
+constexpr size_t VertexBlockSizeBytes      = 8192;
+constexpr size_t VertexBlockMaxSize        = 256;
+constexpr size_t ByteGroupSize             = 16;
+constexpr size_t ByteGroupDecodeLimit      = 24;
+constexpr size_t TailMaxSize               = 32;
+constexpr uint8_t IndexHeader              = 0xe0;
+constexpr uint8_t SequenceHeader           = 0xd0;
+constexpr size_t IndexCodeAuxTableSize     = 16;
+constexpr size_t IndexSequenceTailSize     = 4;
+constexpr unsigned int FifoMask            = 15;
+constexpr unsigned int FreeVertexCode      = 15;
+constexpr unsigned int CachedVertexCodeMax = 13;
+
+[[noreturn]] void ThrowMalformed(const char* codec)
+{
+  throw std::runtime_error(StringTools::printf("Malformed meshopt %s data", codec));
+}
+
+size_t GetVertexBlockSize(size_t vertexSize)
+{
+  // The block fits in the scratch buffer and is a multiple of the byte group size
+  auto result = (VertexBlockSizeBytes / vertexSize) & ~(ByteGroupSize - 1);
+  return result < VertexBlockMaxSize ? result : VertexBlockMaxSize;
+}
+
+uint8_t Unzigzag8(uint8_t value)
+{
+  return static_cast<uint8_t>(-(value & 1) ^ (value >> 1));
+}
+
+// Decodes a group of 16 bytes stored with 2^bitsLog2 bits per byte. Values with all their bits
+// set are escapes, the actual byte following the packed bits.
+const uint8_t* DecodeBytesGroup(const uint8_t* data, uint8_t* buffer, int bitsLog2)
+{
+  switch (bitsLog2) {
+    case 0:
+      std::memset(buffer, 0, ByteGroupSize);
+      return data;
+    case 1:
+    case 2: {
+      const unsigned int bits     = bitsLog2 == 1 ? 2 : 4;
+      const unsigned int escape   = (1u << bits) - 1;
+      const auto packedByteLength = ByteGroupSize * bits / 8;
+      auto escapes                = data + packedByteLength;
+      for (size_t i = 0; i < packedByteLength; ++i) {
+        auto byte = data[i];
+        for (unsigned int j = 0; j < 8 / bits; ++j) {
+          const auto value = static_cast<unsigned int>(byte >> (8 - bits));
+          byte             = static_cast<uint8_t>(byte << bits);
+          *buffer++        = value == escape ? *escapes++ : static_cast<uint8_t>(value);
+        }
+      }
+      return escapes;
+    }
+    default:
+      std::memcpy(buffer, data, ByteGroupSize);
+      return data + ByteGroupSize;
+  }
+}
+
+const uint8_t* DecodeBytes(const uint8_t* data, const uint8_t* dataEnd, uint8_t* buffer,
+                           size_t bufferSize)
+{
+  // 2 bits of header per group
+  const auto header     = data;
+  const auto headerSize = (bufferSize / ByteGroupSize + 3) / 4;
+  if (static_cast<size_t>(dataEnd - data) < headerSize) {
+    return nullptr;
+  }
+  data += headerSize;
+
+  for (size_t i = 0; i < bufferSize; i += ByteGroupSize) {
+    if (static_cast<size_t>(dataEnd - data) < ByteGroupDecodeLimit) {
+      return nullptr;
+    }
+    const auto headerOffset = i / ByteGroupSize;
+    const auto bitsLog2     = (header[headerOffset / 4] >> ((headerOffset % 4) * 2)) & 3;
+    data                    = DecodeBytesGroup(data, buffer + i, bitsLog2);
+  }
+
+  return data;
+}
+
+const uint8_t* DecodeVertexBlock(const uint8_t* data, const uint8_t* dataEnd, uint8_t* vertexData,
+                                 size_t vertexCount, size_t vertexSize, uint8_t* lastVertex)
+{
+  uint8_t buffer[VertexBlockMaxSize];
+  uint8_t transposed[VertexBlockSizeBytes];
+
+  const auto vertexCountAligned = (vertexCount + ByteGroupSize - 1) & ~(ByteGroupSize - 1);
+  for (size_t k = 0; k < vertexSize; ++k) {
+    data = DecodeBytes(data, dataEnd, buffer, vertexCountAligned);
+    if (!data) {
+      return nullptr;
+    }
+
+    auto previous = lastVertex[k];
+    for (size_t i = 0, offset = k; i < vertexCount; ++i, offset += vertexSize) {
+      previous           = static_cast<uint8_t>(Unzigzag8(buffer[i]) + previous);
+      transposed[offset] = previous;
+    }
+  }
+
+  std::memcpy(vertexData, transposed, vertexCount * vertexSize);
+  std::memcpy(lastVertex, transposed + vertexSize * (vertexCount - 1), vertexSize);
+  return data;
+}
+
+// Index codecs: variable length integers with 7 bits per byte
+unsigned int DecodeVByte(const uint8_t*& data)
+{
+  const auto lead = *data++;
+  if (lead < 128) {
+    return lead;
+  }
+
+  auto result = static_cast<unsigned int>(lead & 127);
+  auto shift  = 7u;
+  for (int i = 0; i < 4; ++i) {
+    const auto group = *data++;
+    result |= static_cast<unsigned int>(group & 127) << shift;
+    shift += 7;
+    if (group < 128) {
+      break;
+    }
+  }
+  return result;
+}
+
+unsigned int DecodeIndex(const uint8_t*& data, unsigned int last)
+{
+  const auto value = DecodeVByte(data);
+  return last + ((value >> 1) ^ (0u - (value & 1)));
+}
+
+void WriteIndex(uint8_t* destination, size_t index, size_t indexSize, unsigned int value)
+{
+  if (indexSize == 2) {
+    const auto shortValue = static_cast<uint16_t>(value);
+    std::memcpy(destination + index * 2, &shortValue, 2);
+  }
+  else {
+    std::memcpy(destination + index * 4, &value, 4);
+  }
+}
+
+// Fifos of the last 16 edges and vertices referenced by the triangle codes
+struct IndexFifos {
+  unsigned int edges[16][2];
+  unsigned int vertices[16];
+  unsigned int edgeOffset   = 0;
+  unsigned int vertexOffset = 0;
+
+  IndexFifos()
+  {
+    std::memset(edges, -1, sizeof(edges));
+    std::memset(vertices, -1, sizeof(vertices));
+  }
+
+  void pushEdge(unsigned int a, unsigned int b)
+  {
+    edges[edgeOffset][0] = a;
+    edges[edgeOffset][1] = b;
+    edgeOffset           = (edgeOffset + 1) & FifoMask;
+  }
+
+  void pushVertex(unsigned int v, bool push = true)
+  {
+    vertices[vertexOffset] = v;
+    vertexOffset           = (vertexOffset + (push ? 1 : 0)) & FifoMask;
+  }
+}; // end of struct IndexFifos
+
+int RoundToInt(float value)
+{
+  return static_cast<int>(value + (value >= 0.f ? 0.5f : -0.5f));
+}
+
+template <typename T>
+void DecodeOct(uint8_t* data, size_t count, size_t stride)
+{
+  const auto max = static_cast<float>((1 << (sizeof(T) * 8 - 1)) - 1);
+  for (size_t i = 0; i < count; ++i) {
+    T components[4];
+    std::memcpy(components, data + i * stride, sizeof(components));
+
+    // Reconstructs z, which stores 1 at the same scale as x and y, then folds the lower hemisphere
+    auto x       = static_cast<float>(components[0]);
+    auto y       = static_cast<float>(components[1]);
+    auto z       = static_cast<float>(components[2]) - std::abs(x) - std::abs(y);
+    const auto t = z >= 0.f ? 0.f : z;
+    x += x >= 0.f ? t : -t;
+    y += y >= 0.f ? t : -t;
+
+    const auto scale = max / std::sqrt(x * x + y * y + z * z);
+    components[0]    = static_cast<T>(RoundToInt(x * scale));
+    components[1]    = static_cast<T>(RoundToInt(y * scale));
+    components[2]    = static_cast<T>(RoundToInt(z * scale));
+    std::memcpy(data + i * stride, components, sizeof(components));
+  }
+}
+
+} // end of anonymous namespace
+
+void MeshoptCompression::DecodeVertexBuffer(uint8_t* destination, size_t vertexCount,
+                                            size_t vertexSize, const uint8_t* buffer,
+                                            size_t bufferSize)
+{
+  if (vertexSize == 0 || vertexSize > VertexBlockMaxSize || vertexSize % 4 != 0) {
+    throw std::runtime_error(
+      StringTools::printf("Invalid meshopt vertex size %ld", static_cast<long>(vertexSize)));
+  }
+
+  const auto dataEnd = buffer + bufferSize;
+  if (bufferSize < 1 + vertexSize || (buffer[0] & 0xf0) != VertexHeader
+      || (buffer[0] & 0x0f) > 0) {
+    ThrowMalformed("vertex");
+  }
+
+  // The encoding ends with the vertex the first deltas are relative to
+  uint8_t lastVertex[VertexBlockMaxSize];
+  std::memcpy(lastVertex, dataEnd - vertexSize, vertexSize);
+
+  const auto blockSize = GetVertexBlockSize(vertexSize);
+  auto data            = buffer + 1;
+  for (size_t offset = 0; offset < vertexCount; offset += blockSize) {
+    const auto count = std::min(blockSize, vertexCount - offset);
+    data = DecodeVertexBlock(data, dataEnd, destination + offset * vertexSize, count, vertexSize,
+                             lastVertex);
+    if (!data) {
+      ThrowMalformed("vertex");
+    }
+  }
+
+  const auto tailSize = vertexSize < TailMaxSize ? TailMaxSize : vertexSize;
+  if (static_cast<size_t>(dataEnd - data) != tailSize) {
+    ThrowMalformed("vertex");
+  }
+}
+
+void MeshoptCompression::DecodeIndexBuffer(uint8_t* destination, size_t indexCount,
+                                           size_t indexSize, const uint8_t* buffer,
+                                           size_t bufferSize)
+{
+  if (indexCount % 3 != 0 || (indexSize != 2 && indexSize != 4)) {
+    throw std::runtime_error("Invalid meshopt index buffer layout");
+  }
+
+  // Header, one code per triangle and the table of the most common auxiliary codes
+  if (bufferSize < 1 + indexCount / 3 + IndexCodeAuxTableSize
+      || (buffer[0] & 0xf0) != IndexHeader || (buffer[0] & 0x0f) > 1) {
+    ThrowMalformed("index");
+  }
+  const auto version = buffer[0] & 0x0f;
+  const auto fecMax  = version >= 1 ? CachedVertexCodeMax : FreeVertexCode;
+
+  IndexFifos fifos;
+  unsigned int next = 0, last = 0;
+
+  auto code               = buffer + 1;
+  auto data               = code + indexCount / 3;
+  const auto dataSafeEnd  = buffer + bufferSize - IndexCodeAuxTableSize;
+  const auto codeAuxTable = dataSafeEnd;
+
+  for (size_t i = 0; i < indexCount; i += 3) {
+    // A triangle reads at most 16 bytes, which the code aux table guarantees
+    if (data > dataSafeEnd) {
+      ThrowMalformed("index");
+    }
+
+    const auto codeTri = *code++;
+    unsigned int a = 0, b = 0, c = 0;
+    if (codeTri < 0xf0) {
+      // Triangle sharing an edge of the fifo, its third vertex being new, cached or free
+      const auto fe   = static_cast<unsigned int>(codeTri >> 4);
+      const auto& ab  = fifos.edges[(fifos.edgeOffset - 1 - fe) & FifoMask];
+      a               = ab[0];
+      b               = ab[1];
+      const auto fec  = static_cast<unsigned int>(codeTri & 15);
+      auto pushVertex = true;
+      if (fec < fecMax) {
+        pushVertex = fec == 0;
+        c          = fec == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - 1 - fec) & FifoMask];
+      }
+      else {
+        // 13 and 14 encode the last free index -1 and +1, 15 an explicit delta
+        last = c = fec != FreeVertexCode ? last + (fec == 13 ? -1 : 1) : DecodeIndex(data, last);
+      }
+      WriteIndex(destination, i + 0, indexSize, a);
+      WriteIndex(destination, i + 1, indexSize, b);
+      WriteIndex(destination, i + 2, indexSize, c);
+      fifos.pushVertex(c, pushVertex);
+      fifos.pushEdge(c, b);
+      fifos.pushEdge(a, c);
+      continue;
+    }
+
+    unsigned int feb = 0, fec = 0;
+    auto pushB = false, pushC = false;
+    if (codeTri < 0xfe) {
+      // First vertex is new, the other two new or cached as given by the code aux table
+      const auto codeAux = codeAuxTable[codeTri & 15];
+      feb                = static_cast<unsigned int>(codeAux >> 4);
+      fec                = static_cast<unsigned int>(codeAux & 15);
+      a                  = next++;
+      b     = feb == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - feb) & FifoMask];
+      c     = fec == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - fec) & FifoMask];
+      pushB = feb == 0;
+      pushC = fec == 0;
+    }
+    else {
+      // Explicit code aux byte, a zero one resetting the new vertex counter
+      const auto codeAux = *data++;
+      const auto fea     = codeTri == 0xfe ? 0u : FreeVertexCode;
+      feb                = static_cast<unsigned int>(codeAux >> 4);
+      fec                = static_cast<unsigned int>(codeAux & 15);
+      if (codeAux == 0) {
+        next = 0;
+      }
+      a = fea == 0 ? next++ : 0;
+      b = feb == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - feb) & FifoMask];
+      c = fec == 0 ? next++ : fifos.vertices[(fifos.vertexOffset - fec) & FifoMask];
+      if (fea == FreeVertexCode) {
+        last = a = DecodeIndex(data, last);
+      }
+      if (feb == FreeVertexCode) {
+        last = b = DecodeIndex(data, last);
+      }
+      if (fec == FreeVertexCode) {
+        last = c = DecodeIndex(data, last);
+      }
+      pushB = feb == 0 || feb == FreeVertexCode;
+      pushC = fec == 0 || fec == FreeVertexCode;
+    }
+    WriteIndex(destination, i + 0, indexSize, a);
+    WriteIndex(destination, i + 1, indexSize, b);
+    WriteIndex(destination, i + 2, indexSize, c);
+    fifos.pushVertex(a);
+    fifos.pushVertex(b, pushB);
+    fifos.pushVertex(c, pushC);
+    fifos.pushEdge(b, a);
+    fifos.pushEdge(c, b);
+    fifos.pushEdge(a, c);
+  }
+
+  // All the data is read up to the code aux table
+  if (data != dataSafeEnd) {
+    ThrowMalformed("index");
+  }
+}
+
+void MeshoptCompression::DecodeIndexSequence(uint8_t* destination, size_t indexCount,
+                                             size_t indexSize, const uint8_t* buffer,
+                                             size_t bufferSize)
+{
+  if (indexSize != 2 && indexSize != 4) {
+    throw std::runtime_error("Invalid meshopt index sequence layout");
+  }
+
+  // Header, at least one byte per index and a 4 bytes tail
+  if (bufferSize < 1 + indexCount + IndexSequenceTailSize || (buffer[0] & 0xf0) != SequenceHeader
+      || (buffer[0] & 0x0f) > 1) {
+    ThrowMalformed("index sequence");
+  }
+
+  auto data              = buffer + 1;
+  const auto dataSafeEnd = buffer + bufferSize - IndexSequenceTailSize;
+  unsigned int last[2]   = {0, 0};
+  for (size_t i = 0; i < indexCount; ++i) {
+    // An index reads at most 5 bytes, which the tail guarantees
+    if (data >= dataSafeEnd) {
+      ThrowMalformed("index sequence");
+    }
+
+    // Deltas are relative to one of the last two baselines
+    auto value          = DecodeVByte(data);
+    const auto baseline = value & 1;
+    value >>= 1;
+    last[baseline] += (value >> 1) ^ (0u - (value & 1));
+    WriteIndex(destination, i, indexSize, last[baseline]);
+  }
+
+  if (data != dataSafeEnd) {
+    ThrowMalformed("index sequence");
+  }
+}
+
+void MeshoptCompression::DecodeFilterOct(uint8_t* data, size_t count, size_t stride)
+{
+  if (stride == 4) {
+    DecodeOct<int8_t>(data, count, stride);
+  }
+  else if (stride == 8) {
+    DecodeOct<int16_t>(data, count, stride);
+  }
+  else {
+    throw std::runtime_error("Invalid meshopt octahedral filter stride");
+  }
+}
+
+void MeshoptCompression::DecodeFilterQuat(uint8_t* data, size_t count, size_t stride)
+{
+  if (stride != 8) {
+    throw std::runtime_error("Invalid meshopt quaternion filter stride");
+  }
+
+  const auto scale = 1.f / std::sqrt(2.f);
+  for (size_t i = 0; i < count; ++i) {
+    int16_t components[4];
+    std::memcpy(components, data + i * stride, sizeof(components));
+
+    // The fourth component stores the index of the largest component, which is reconstructed, and
+    // the scale of the other three
+    const auto scaleFactor = scale / static_cast<float>(components[3] | 3);
+    const auto x           = static_cast<float>(components[0]) * scaleFactor;
+    const auto y           = static_cast<float>(components[1]) * scaleFactor;
+    const auto z           = static_cast<float>(components[2]) * scaleFactor;
+    const auto ww          = 1.f - x * x - y * y - z * z;
+    const auto w           = std::sqrt(ww >= 0.f ? ww : 0.f);
+
+    const auto maxComponent = components[3] & 3;
+    int16_t result[4];
+    result[(maxComponent + 1) & 3] = static_cast<int16_t>(RoundToInt(x * 32767.f));
+    result[(maxComponent + 2) & 3] = static_cast<int16_t>(RoundToInt(y * 32767.f));
+    result[(maxComponent + 3) & 3] = static_cast<int16_t>(RoundToInt(z * 32767.f));
+    result[maxComponent]           = static_cast<int16_t>(static_cast<int>(w * 32767.f + 0.5f));
+    std::memcpy(data + i * stride, result, sizeof(result));
+  }
+}
+
+void MeshoptCompression::DecodeFilterExp(uint8_t* data, size_t count, size_t stride)
+{
+  if (stride == 0 || stride % 4 != 0) {
+    throw std::runtime_error("Invalid meshopt exponential filter stride");
+  }
+
+  for (size_t i = 0; i < count * stride / 4; ++i) {
+    uint32_t value;
+    std::memcpy(&value, data + i * 4, 4);
+
+    // Signed 24-bit mantissa and signed 8-bit exponent
+    const auto mantissa = static_cast<int32_t>(value << 8) >> 8;
+    const auto exponent = static_cast<int32_t>(value) >> 24;
+    const auto decoded  = std::ldexp(static_cast<float>(mantissa), exponent);
+    std::memcpy(data + i * 4, &decoded, 4);
+  }
+}
+
+ArrayBuffer MeshoptCompression::DecodeGltfBuffer(const uint8_t* source, size_t sourceSize,
+                                                 size_t count, size_t stride,
+                                                 const std::string& mode,
+                                                 const std::string& filter)
+{
+  ArrayBuffer result(count * stride);
+  if (mode == "ATTRIBUTES") {
+    DecodeVertexBuffer(result.data(), count, stride, source, sourceSize);
+  }
+  else if (mode == "TRIANGLES") {
+    DecodeIndexBuffer(result.data(), count, stride, source, sourceSize);
+  }
+  else if (mode == "INDICES") {
+    DecodeIndexSequence(result.data(), count, stride, source, sourceSize);
+  }
+  else {
+    throw std::runtime_error(StringTools::printf("Invalid meshopt mode %s", mode.c_str()));
+  }
+
+  if (filter == "OCTAHEDRAL") {
+    DecodeFilterOct(result.data(), count, stride);
+  }
+  else if (filter == "QUATERNION") {
+    DecodeFilterQuat(result.data(), count, stride);
+  }
+  else if (filter == "EXPONENTIAL") {
+    DecodeFilterExp(result.data(), count, stride);
+  }
+  else if (!filter.empty() && filter != "NONE") {
+    throw std::runtime_error(StringTools::printf("Invalid meshopt filter %s", filter.c_str()));
+  }
+
+  return result;
+}
+
+} // end of namespace BABYLON
@@ -0,0 +1,333 @@
+#include <babylon/meshes/csg/bvh.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/csg/plane.h>
+#include <babylon/meshes/csg/polygon_arena.h>
+#include <babylon/meshes/csg/vertex.h>
+
+namespace BABYLON {
+
+namespace {
+
+using Float3 = std::array<float, 3>;
+
+// Maximum number of triangles in a leaf
+constexpr size_t LeafSize = 4;
+// Median splits keep the depth under log2 of the triangle count
+constexpr size_t MaxStackSize = 64;
+// Direction of the rays classifying points, chosen not to be aligned with common geometry
+constexpr std::array<double, 3> RayDirection{{0.3428425, 0.7162937, 0.6078132}};
+
+Float3 ToFloat3(const Vector3& vector)
+{
+  return {{vector.x, vector.y, vector.z}};
+}
+
+float Dot(const Float3& a, const Float3& b)
+{
+  return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+}
+
+Float3 Cross(const Float3& a, const Float3& b)
+{
+  return {{a[1] * b[2] - a[2] * b[1], a[2] * b[0] - a[0] * b[2], a[0] * b[1] - a[1] * b[0]}};
+}
+
+// Interval covered by the crossing of a convex polygon with a plane, projected on a direction
+template <typename Point, typename Distance>
+bool CrossingInterval(size_t count, const Point& point, const Distance& distance,
+                      const Float3& direction, float& min, float& max)
+{
+  const auto epsilon = CSG::Plane::EPSILON;
+  min                = std::numeric_limits<float>::max();
+  max                = std::numeric_limits<float>::lowest();
+  for (size_t i = 0; i < count; ++i) {
+    const auto j  = (i + 1) % count;
+    const auto di = distance(i), dj = distance(j);
+    const auto& vi = point(i);
+    if (std::abs(di) <= epsilon) {
+      const auto projection = Dot(vi, direction);
+      min                   = std::min(min, projection);
+      max                   = std::max(max, projection);
+    }
+    if ((di > epsilon && dj < -epsilon) || (di < -epsilon && dj > epsilon)) {
+      const auto& vj = point(j);
+      const auto t   = di / (di - dj);
+      const Float3 crossing{{vi[0] + (vj[0] - vi[0]) * t, vi[1] + (vj[1] - vi[1]) * t,
+                             vi[2] + (vj[2] - vi[2]) * t}};
+      const auto projection = Dot(crossing, direction);
+      min                   = std::min(min, projection);
+      max                   = std::max(max, projection);
+    }
+  }
+  return min <= max;
+}
+
+} // end of anonymous namespace
+
+CSG::BVH::BVH(const PolygonArena& polygons)
+{
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    const auto vertices = polygons.vertexData(i);
+    const auto& entry   = polygons.polygons[i];
+    const auto normal   = ToFloat3(entry.plane.normal);
+    for (size_t j = 2; j < entry.vertexCount; ++j) {
+      _triangles.emplace_back(Triangle{ToFloat3(vertices[0].pos), ToFloat3(vertices[j - 1].pos),
+                                       ToFloat3(vertices[j].pos), normal, i});
+    }
+  }
+  if (_triangles.empty()) {
+    return;
+  }
+
+  struct BuildEntry {
+    uint32_t node;
+    size_t begin, end;
+  };
+  const auto centroid = [](const Triangle& triangle, size_t axis) {
+    return triangle.a[axis] + triangle.b[axis] + triangle.c[axis];
+  };
+
+  _nodes.reserve(2 * (_triangles.size() / LeafSize) + 1);
+  _nodes.emplace_back();
+  std::vector<BuildEntry> pending{{0, 0, _triangles.size()}};
+  while (!pending.empty()) {
+    const auto entry = pending.back();
+    pending.pop_back();
+
+    Float3 min{{std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                std::numeric_limits<float>::max()}};
+    Float3 max{{std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                std::numeric_limits<float>::lowest()}};
+    auto centroidMin = min, centroidMax = max;
+    for (auto i = entry.begin; i < entry.end; ++i) {
+      const auto& triangle = _triangles[i];
+      for (size_t axis = 0; axis < 3; ++axis) {
+        min[axis] = std::min({min[axis], triangle.a[axis], triangle.b[axis], triangle.c[axis]});
+        max[axis] = std::max({max[axis], triangle.a[axis], triangle.b[axis], triangle.c[axis]});
+        centroidMin[axis] = std::min(centroidMin[axis], centroid(triangle, axis));
+        centroidMax[axis] = std::max(centroidMax[axis], centroid(triangle, axis));
+      }
+    }
+    _nodes[entry.node].min = min;
+    _nodes[entry.node].max = max;
+
+    // Median split along the largest extent of the centroids
+    size_t axis = 0;
+    for (size_t i = 1; i < 3; ++i) {
+      if (centroidMax[i] - centroidMin[i] > centroidMax[axis] - centroidMin[axis]) {
+        axis = i;
+      }
+    }
+    const auto count = entry.end - entry.begin;
+    if (count <= LeafSize || centroidMax[axis] <= centroidMin[axis]) {
+      _nodes[entry.node].first = static_cast<uint32_t>(entry.begin);
+      _nodes[entry.node].count = static_cast<uint32_t>(count);
+      continue;
+    }
+
+    const auto middle = entry.begin + count / 2;
+    std::nth_element(_triangles.begin() + static_cast<std::ptrdiff_t>(entry.begin),
+                     _triangles.begin() + static_cast<std::ptrdiff_t>(middle),
+                     _triangles.begin() + static_cast<std::ptrdiff_t>(entry.end),
+                     [&centroid, axis](const Triangle& a, const Triangle& b) {
+                       return centroid(a, axis) < centroid(b, axis);
+                     });
+    const auto left          = static_cast<uint32_t>(_nodes.size());
+    _nodes[entry.node].first = left;
+    _nodes[entry.node].count = 0;
+    _nodes.emplace_back();
+    _nodes.emplace_back();
+    pending.push_back({left, entry.begin, middle});
+    pending.push_back({left + 1, middle, entry.end});
+  }
+}
+
+CSG::BVH::~BVH() = default;
+
+void CSG::BVH::intersectingPolygons(const Vertex* vertices, size_t count, const Plane& plane,
+                                    std::vector<size_t>& result) const
+{
+  result.clear();
+  if (_nodes.empty() || count < 3) {
+    return;
+  }
+
+  const auto epsilon = Plane::EPSILON;
+  Float3 min{{vertices[0].pos.x, vertices[0].pos.y, vertices[0].pos.z}}, max = min;
+  for (size_t i = 1; i < count; ++i) {
+    const auto position = ToFloat3(vertices[i].pos);
+    for (size_t axis = 0; axis < 3; ++axis) {
+      min[axis] = std::min(min[axis], position[axis]);
+      max[axis] = std::max(max[axis], position[axis]);
+    }
+  }
+  for (size_t axis = 0; axis < 3; ++axis) {
+    min[axis] -= epsilon;
+    max[axis] += epsilon;
+  }
+  const auto overlaps = [&min, &max](const Float3& otherMin, const Float3& otherMax) {
+    return min[0] <= otherMax[0] && max[0] >= otherMin[0] && min[1] <= otherMax[1]
+           && max[1] >= otherMin[1] && min[2] <= otherMax[2] && max[2] >= otherMin[2];
+  };
+
+  const auto normal   = ToFloat3(plane.normal);
+  const auto w        = plane.w;
+  const auto position = [vertices](size_t i) { return ToFloat3(vertices[i].pos); };
+  const auto intersects = [&](const Triangle& triangle) {
+    // Separated when one of the shapes lies strictly on one side of the plane of the other
+    const Float3 triangleDistances{{Dot(normal, triangle.a) - w, Dot(normal, triangle.b) - w,
+                                    Dot(normal, triangle.c) - w}};
+    if ((triangleDistances[0] > epsilon && triangleDistances[1] > epsilon
+         && triangleDistances[2] > epsilon)
+        || (triangleDistances[0] < -epsilon && triangleDistances[1] < -epsilon
+            && triangleDistances[2] < -epsilon)) {
+      return false;
+    }
+    if (std::abs(triangleDistances[0]) <= epsilon && std::abs(triangleDistances[1]) <= epsilon
+        && std::abs(triangleDistances[2]) <= epsilon) {
+      // Coplanar, the bounding boxes overlapping
+      return true;
+    }
+    const auto triangleW       = Dot(triangle.normal, triangle.a);
+    const auto polygonDistance = [&](size_t i) {
+      return Dot(triangle.normal, position(i)) - triangleW;
+    };
+    auto front = false, back = false;
+    for (size_t i = 0; i < count; ++i) {
+      const auto distance = polygonDistance(i);
+      front               = front || distance >= -epsilon;
+      back                = back || distance <= epsilon;
+    }
+    if (!front || !back) {
+      return false;
+    }
+
+    // Both shapes cross the line where the planes meet, they intersect if their intervals on it
+    // overlap
+    const auto direction = Cross(normal, triangle.normal);
+    const auto tolerance = epsilon * std::sqrt(Dot(direction, direction));
+    const Float3* trianglePoints[3]{&triangle.a, &triangle.b, &triangle.c};
+    float polygonMin, polygonMax, triangleMin, triangleMax;
+    if (!CrossingInterval(count, position, polygonDistance, direction, polygonMin, polygonMax)
+        || !CrossingInterval(
+          3, [&trianglePoints](size_t i) { return *trianglePoints[i]; },
+          [&triangleDistances](size_t i) { return triangleDistances[i]; }, direction,
+          triangleMin, triangleMax)) {
+      return true;
+    }
+    return std::max(polygonMin, triangleMin) <= std::min(polygonMax, triangleMax) + tolerance;
+  };
+
+  std::array<uint32_t, MaxStackSize> stack;
+  size_t stackSize    = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto& node = _nodes[stack[--stackSize]];
+    if (!overlaps(node.min, node.max)) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack[stackSize++] = node.first;
+      stack[stackSize++] = node.first + 1;
+      continue;
+    }
+    for (auto i = node.first; i < node.first + node.count; ++i) {
+      const auto& triangle = _triangles[i];
+      if ((result.empty() || result.back() != triangle.polygon) && intersects(triangle)) {
+        result.emplace_back(triangle.polygon);
+      }
+    }
+  }
+
+  std::sort(result.begin(), result.end());
+  result.erase(std::unique(result.begin(), result.end()), result.end());
+}
+
+bool CSG::BVH::isInside(const Vector3& point) const
+{
+  if (_nodes.empty()) {
+    return false;
+  }
+
+  const std::array<double, 3> origin{{point.x, point.y, point.z}};
+  const std::array<double, 3> inverseDirection{
+    {1.0 / RayDirection[0], 1.0 / RayDirection[1], 1.0 / RayDirection[2]}};
+  auto nearest       = std::numeric_limits<double>::max();
+  auto nearestInside = false;
+
+  std::array<uint32_t, MaxStackSize> stack;
+  size_t stackSize    = 0;
+  stack[stackSize++] = 0;
+  while (stackSize > 0) {
+    const auto& node = _nodes[stack[--stackSize]];
+
+    // Slab test, the nodes farther than the nearest hit being skipped
+    auto tMin = 0.0, tMax = nearest;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      auto t0 = (node.min[axis] - origin[axis]) * inverseDirection[axis];
+      auto t1 = (node.max[axis] - origin[axis]) * inverseDirection[axis];
+      if (t0 > t1) {
+        std::swap(t0, t1);
+      }
+      tMin = std::max(tMin, t0);
+      tMax = std::min(tMax, t1);
+    }
+    if (tMin > tMax) {
+      continue;
+    }
+    if (node.count == 0) {
+      stack[stackSize++] = node.first;
+      stack[stackSize++] = node.first + 1;
+      continue;
+    }
+
+    // Möller-Trumbore intersection, in double precision as the points are close to the surface
+    for (auto i = node.first; i < node.first + node.count; ++i) {
+      const auto& triangle = _triangles[i];
+      std::array<double, 3> edge1, edge2, s;
+      for (size_t axis = 0; axis < 3; ++axis) {
+        edge1[axis] = static_cast<double>(triangle.b[axis]) - triangle.a[axis];
+        edge2[axis] = static_cast<double>(triangle.c[axis]) - triangle.a[axis];
+        s[axis]     = origin[axis] - triangle.a[axis];
+      }
+      const std::array<double, 3> p{{RayDirection[1] * edge2[2] - RayDirection[2] * edge2[1],
+                                     RayDirection[2] * edge2[0] - RayDirection[0] * edge2[2],
+                                     RayDirection[0] * edge2[1] - RayDirection[1] * edge2[0]}};
+      const auto determinant = edge1[0] * p[0] + edge1[1] * p[1] + edge1[2] * p[2];
+      if (std::abs(determinant) < 1e-14) {
+        continue;
+      }
+      const auto inverseDeterminant = 1.0 / determinant;
+      const auto u = (s[0] * p[0] + s[1] * p[1] + s[2] * p[2]) * inverseDeterminant;
+      if (u < -1e-9 || u > 1.0 + 1e-9) {
+        continue;
+      }
+      const std::array<double, 3> q{{s[1] * edge1[2] - s[2] * edge1[1],
+                                     s[2] * edge1[0] - s[0] * edge1[2],
+                                     s[0] * edge1[1] - s[1] * edge1[0]}};
+      const auto v
+        = (RayDirection[0] * q[0] + RayDirection[1] * q[1] + RayDirection[2] * q[2])
+          * inverseDeterminant;
+      if (v < -1e-9 || u + v > 1.0 + 1e-9) {
+        continue;
+      }
+      const auto t = (edge2[0] * q[0] + edge2[1] * q[1] + edge2[2] * q[2]) * inverseDeterminant;
+      if (t > 0.0 && t < nearest) {
+        // Leaving the solid through the face when the ray goes along its normal
+        nearest       = t;
+        nearestInside = RayDirection[0] * triangle.normal[0] + RayDirection[1] * triangle.normal[1]
+                          + RayDirection[2] * triangle.normal[2]
+                        > 0.0;
+      }
+    }
+  }
+
+  return nearestInside;
+}
+
+} // end of namespace BABYLON
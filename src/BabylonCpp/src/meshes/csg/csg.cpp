@@ -1,16 +1,317 @@
 #include <babylon/meshes/csg/csg.h>
 
+#include <algorithm>
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
 #include <babylon/babylon_stl_util.h>
-#include <babylon/meshes/csg/node.h>
-#include <babylon/meshes/csg/polygon.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/meshes/csg/bvh.h>
 #include <babylon/meshes/csg/vertex.h>
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
-#include <babylon/misc/string_tools.h>
+#include <babylon/meshes/vertex_data.h>
 
 namespace BABYLON {
 
+namespace {
+
+// The operations keep the parts of the polygons of each solid lying inside or outside of the other
+// solid. A polygon crossing no polygon of the other solid is classified as a whole, the others are
+// first split along the polygons they cross. The solids are expected to be closed.
+
+// Number of polygons classified by a parallel task
+constexpr size_t ChunkSize = 256;
+
+/**
+ * @brief Describes which parts of the polygons of a solid are kept by an operation. The points
+ * tested lie just in front of and behind the polygon, which tells whether a polygon coplanar with
+ * a face of the other solid lies on its boundary with the same or the opposite orientation.
+ */
+struct ClipRule {
+  bool testFront;
+  bool testBack;
+  // Whether the polygon is kept when the tested points are inside the other solid, rather than
+  // outside
+  bool keepInside;
+  bool flip;
+}; // end of struct ClipRule
+
+// Rules derived from the clipping sequences of csg.js, for the polygons of the first and second
+// operand
+constexpr ClipRule UnionRuleA{true, false, false, false};
+constexpr ClipRule UnionRuleB{true, true, false, false};
+constexpr ClipRule SubtractRuleA{false, true, false, false};
+constexpr ClipRule SubtractRuleB{true, true, true, true};
+constexpr ClipRule IntersectRuleA{false, true, true, false};
+constexpr ClipRule IntersectRuleB{true, true, true, false};
+
+/**
+ * @brief Scratch memory of a task, reused across polygons.
+ */
+struct ClipScratch {
+  std::vector<size_t> candidates;
+  CSG::PolygonArena fragments;
+  CSG::PolygonArena splitFragments;
+  std::vector<CSG::Vertex> front;
+  std::vector<CSG::Vertex> back;
+}; // end of struct ClipScratch
+
+// Splits the fragments by a plane, keeping the parts on both sides
+void SplitFragments(const CSG::Plane& plane, ClipScratch& scratch)
+{
+  const auto epsilon = CSG::Plane::EPSILON;
+  auto& fragments    = scratch.fragments;
+  auto& result       = scratch.splitFragments;
+  result.clear();
+  for (size_t index = 0; index < fragments.size(); ++index) {
+    const auto& entry   = fragments.polygons[index];
+    const auto vertices = fragments.vertexData(index);
+    auto front = false, back = false;
+    for (size_t i = 0; i < entry.vertexCount; ++i) {
+      const auto distance = Vector3::Dot(plane.normal, vertices[i].pos) - plane.w;
+      front               = front || distance > epsilon;
+      back                = back || distance < -epsilon;
+    }
+    if (!front || !back) {
+      result.add(fragments, index);
+      continue;
+    }
+
+    scratch.front.clear();
+    scratch.back.clear();
+    for (size_t i = 0; i < entry.vertexCount; ++i) {
+      const auto j  = (i + 1) % entry.vertexCount;
+      const auto di = Vector3::Dot(plane.normal, vertices[i].pos) - plane.w;
+      const auto dj = Vector3::Dot(plane.normal, vertices[j].pos) - plane.w;
+      if (di >= -epsilon) {
+        scratch.front.emplace_back(vertices[i]);
+      }
+      if (di <= epsilon) {
+        scratch.back.emplace_back(vertices[i]);
+      }
+      if ((di > epsilon && dj < -epsilon) || (di < -epsilon && dj > epsilon)) {
+        auto vertex = vertices[i];
+        scratch.front.emplace_back(vertex.interpolate(vertices[j], di / (di - dj)));
+        scratch.back.emplace_back(scratch.front.back());
+      }
+    }
+    if (scratch.front.size() >= 3) {
+      result.add(scratch.front.data(), scratch.front.size(), entry.shared, entry.plane);
+    }
+    if (scratch.back.size() >= 3) {
+      result.add(scratch.back.data(), scratch.back.size(), entry.shared, entry.plane);
+    }
+  }
+  std::swap(fragments, result);
+}
+
+// Adds the kept parts of a polygon to the result
+void ClipPolygon(const CSG::PolygonArena& polygons, size_t index, const CSG::PolygonArena& others,
+                 const CSG::BVH& otherBVH, const ClipRule& rule, ClipScratch& scratch,
+                 CSG::PolygonArena& result)
+{
+  const auto epsilon  = CSG::Plane::EPSILON;
+  const auto& entry   = polygons.polygons[index];
+  const auto& plane   = entry.plane;
+  auto& fragments     = scratch.fragments;
+  auto hasCoplanar    = false;
+  otherBVH.intersectingPolygons(polygons.vertexData(index), entry.vertexCount, plane,
+                                scratch.candidates);
+
+  fragments.clear();
+  fragments.add(polygons, index);
+  for (const auto candidate : scratch.candidates) {
+    const auto& other        = others.polygons[candidate];
+    const auto otherVertices = others.vertexData(candidate);
+    auto coplanar            = true;
+    for (size_t i = 0; i < other.vertexCount && coplanar; ++i) {
+      coplanar = std::abs(Vector3::Dot(plane.normal, otherVertices[i].pos) - plane.w) <= epsilon;
+    }
+    if (!coplanar) {
+      SplitFragments(other.plane, scratch);
+      continue;
+    }
+
+    // Coplanar polygons are cut along their edges, so that each fragment is either fully covered by
+    // the other polygon or not at all
+    hasCoplanar = true;
+    for (size_t i = 0; i < other.vertexCount; ++i) {
+      const auto& a = otherVertices[i].pos;
+      const auto& b = otherVertices[(i + 1) % other.vertexCount].pos;
+      auto normal   = Vector3::Cross(b.subtract(a), other.plane.normal);
+      if (normal.lengthSquared() > 0.f) {
+        normal.normalize();
+        SplitFragments(CSG::Plane(normal, Vector3::Dot(normal, a)), scratch);
+      }
+    }
+  }
+
+  // Classify the fragments from their centroid, moved away from the surface when the fragment may
+  // lie on the surface of the other solid
+  const auto offset = plane.normal.scale(10.f * epsilon);
+  for (size_t i = 0; i < fragments.size(); ++i) {
+    const auto vertices = fragments.vertexData(i);
+    const auto count    = fragments.polygons[i].vertexCount;
+    auto centroid       = Vector3::Zero();
+    for (size_t j = 0; j < count; ++j) {
+      centroid.addInPlace(vertices[j].pos);
+    }
+    centroid.scaleInPlace(1.f / static_cast<float>(count));
+
+    auto keep = true;
+    if (!hasCoplanar) {
+      keep = otherBVH.isInside(centroid) == rule.keepInside;
+    }
+    else {
+      if (rule.testFront) {
+        keep = otherBVH.isInside(centroid.add(offset)) == rule.keepInside;
+      }
+      if (keep && rule.testBack) {
+        keep = otherBVH.isInside(centroid.subtract(offset)) == rule.keepInside;
+      }
+    }
+    if (keep) {
+      result.add(fragments, i, rule.flip);
+    }
+  }
+}
+
+// Adds the kept parts of the polygons to the result, in the order of the polygons
+void ClipPolygons(const CSG::PolygonArena& polygons, const CSG::PolygonArena& others,
+                  const CSG::BVH& otherBVH, const ClipRule& rule, CSG::PolygonArena& result)
+{
+  const auto chunkCount = (polygons.size() + ChunkSize - 1) / ChunkSize;
+  std::vector<CSG::PolygonArena> chunkResults(chunkCount);
+  ThreadPool::Default().parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+    ClipScratch scratch;
+    for (auto chunk = begin; chunk < end; ++chunk) {
+      const auto last = std::min((chunk + 1) * ChunkSize, polygons.size());
+      for (auto i = chunk * ChunkSize; i < last; ++i) {
+        ClipPolygon(polygons, i, others, otherBVH, rule, scratch, chunkResults[chunk]);
+      }
+    }
+  });
+  for (const auto& chunkResult : chunkResults) {
+    result.append(chunkResult);
+  }
+}
+
+CSG::PolygonArena Combine(const CSG::PolygonArena& a, const CSG::PolygonArena& b,
+                          const ClipRule& ruleA, const ClipRule& ruleB)
+{
+  const CSG::BVH bvhA(a), bvhB(b);
+  CSG::PolygonArena result;
+  ClipPolygons(a, b, bvhB, ruleA, result);
+  ClipPolygons(b, a, bvhA, ruleB, result);
+  return result;
+}
+
+using SubMeshObj = std::array<unsigned int, 3>;
+
+/**
+ * @brief Indexed geometry built from the polygons of a CSG.
+ */
+struct GeometryData {
+  Float32Array positions;
+  Float32Array normals;
+  Float32Array uvs;
+  Uint32Array indices;
+  // Index start, index end and material index of the submeshes, by mesh id and submesh id
+  std::map<unsigned int, std::map<unsigned int, SubMeshObj>> subMeshes;
+}; // end of struct GeometryData
+
+// Bit pattern of a position, used to merge the vertices sharing it
+using PositionKey = std::array<uint32_t, 3>;
+
+struct PositionKeyHash {
+  size_t operator()(const PositionKey& key) const
+  {
+    return (static_cast<size_t>(key[0]) * 73856093u) ^ (static_cast<size_t>(key[1]) * 19349663u)
+           ^ (static_cast<size_t>(key[2]) * 83492791u);
+  }
+}; // end of struct PositionKeyHash
+
+PositionKey ToPositionKey(const Vector3& position)
+{
+  // Adding zero turns -0 into +0
+  const std::array<float, 3> values{{position.x + 0.f, position.y + 0.f, position.z + 0.f}};
+  PositionKey key;
+  std::memcpy(key.data(), values.data(), sizeof(key));
+  return key;
+}
+
+GeometryData BuildGeometry(const CSG::PolygonArena& polygons, const Matrix& matrix,
+                           bool sortBySubMesh)
+{
+  auto inverseMatrix = matrix;
+  inverseMatrix.invert();
+
+  std::vector<size_t> order(polygons.size());
+  for (size_t i = 0; i < order.size(); ++i) {
+    order[i] = i;
+  }
+  if (sortBySubMesh) {
+    // Sort Polygons, since subMeshes are indices range
+    std::stable_sort(order.begin(), order.end(), [&polygons](size_t a, size_t b) {
+      const auto& sharedA = polygons.polygons[a].shared;
+      const auto& sharedB = polygons.polygons[b].shared;
+      return sharedA.meshId != sharedB.meshId ? sharedA.meshId < sharedB.meshId :
+                                                sharedA.subMeshId < sharedB.subMeshId;
+    });
+  }
+
+  GeometryData data;
+  std::unordered_map<PositionKey, size_t, PositionKeyHash> vertexDict;
+  unsigned int currentIndex = 0;
+  for (const auto index : order) {
+    const auto& entry   = polygons.polygons[index];
+    const auto vertices = polygons.vertexData(index);
+    auto& subMeshObj    = data.subMeshes[entry.shared.meshId]
+                         .try_emplace(entry.shared.subMeshId,
+                                      SubMeshObj{{std::numeric_limits<unsigned int>::max(),
+                                                  std::numeric_limits<unsigned int>::min(),
+                                                  entry.shared.materialIndex}})
+                         .first->second;
+
+    for (size_t j = 2; j < entry.vertexCount; ++j) {
+      for (const auto k : {size_t(0), j - 1, j}) {
+        const auto& vertex     = vertices[k];
+        const auto localVertex = Vector3::TransformCoordinates(vertex.pos, inverseMatrix);
+        const auto localNormal = Vector3::TransformNormal(vertex.normal, inverseMatrix);
+
+        // Check if 2 points can be merged
+        const auto key   = ToPositionKey(localVertex);
+        auto it          = vertexDict.find(key);
+        const auto merge = it != vertexDict.end() && [&data, &localNormal, &vertex](size_t i) {
+          return stl_util::almost_equal(data.normals[i * 3], localNormal.x)
+                 && stl_util::almost_equal(data.normals[i * 3 + 1], localNormal.y)
+                 && stl_util::almost_equal(data.normals[i * 3 + 2], localNormal.z)
+                 && stl_util::almost_equal(data.uvs[i * 2], vertex.uv.x)
+                 && stl_util::almost_equal(data.uvs[i * 2 + 1], vertex.uv.y);
+        }(it->second);
+        if (!merge) {
+          stl_util::concat(data.positions, {localVertex.x, localVertex.y, localVertex.z});
+          stl_util::concat(data.normals, {localNormal.x, localNormal.y, localNormal.z});
+          stl_util::concat(data.uvs, {vertex.uv.x, vertex.uv.y});
+          it = vertexDict.insert_or_assign(key, data.positions.size() / 3 - 1).first;
+        }
+
+        data.indices.emplace_back(static_cast<uint32_t>(it->second));
+        subMeshObj[0] = std::min(currentIndex, subMeshObj[0]);
+        subMeshObj[1] = std::max(currentIndex, subMeshObj[1]);
+        ++currentIndex;
+      }
+    }
+  }
+
+  return data;
+}
+
+} // end of anonymous namespace
+
 unsigned int CSG::CSG::currentCSGMeshId = 0;
 
 CSG::CSG::CSG() = default;
@@ -24,7 +325,6 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   Vector3 normal;
   Vector2 uv;
   Vector3 position;
-  std::vector<Polygon> polygons;
 
   Matrix matrix;
   Vector3 meshPosition;
@@ -41,47 +341,53 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   }
   meshScaling = mesh->scaling();
 
-  IndicesArray indices   = mesh->getIndices();
-  Float32Array positions = mesh->getVerticesData(VertexBuffer::PositionKind);
-  Float32Array normals   = mesh->getVerticesData(VertexBuffer::NormalKind);
-  Float32Array uvs       = mesh->getVerticesData(VertexBuffer::UVKind);
-
+  // Read the geometry in place, only copying the attributes that can not be viewed directly
+  std::array<Float32Array, 3> dataCopies;
+  const auto getData = [&mesh, &dataCopies](const std::string& kind, size_t copyIndex) {
+    auto data = mesh->getVerticesDataView(kind);
+    if (data.empty()) {
+      dataCopies[copyIndex] = mesh->getVerticesData(kind);
+      data                  = dataCopies[copyIndex];
+    }
+    return data;
+  };
+  const auto indices   = mesh->getIndicesView();
+  const auto positions = getData(VertexBuffer::PositionKind, 0);
+  const auto normals   = getData(VertexBuffer::NormalKind, 1);
+  const auto uvs       = getData(VertexBuffer::UVKind, 2);
+
+  PolygonArena polygons;
+  polygons.polygons.reserve(indices.size() / 3);
+  polygons.vertices.reserve(indices.size());
   unsigned int sm = 0;
   for (auto& subMesh : mesh->subMeshes) {
+    PolygonOptions shared;
+    shared.subMeshId     = sm;
+    shared.meshId        = currentCSGMeshId;
+    shared.materialIndex = subMesh->materialIndex;
+
     for (size_t i = subMesh->indexStart, il = subMesh->indexCount + subMesh->indexStart; i < il;
          i += 3) {
-      std::vector<Vertex> vertices;
+      std::array<Vertex, 3> vertices{{{position, normal, uv}, {position, normal, uv},
+                                      {position, normal, uv}}};
       for (unsigned int j = 0; j < 3; ++j) {
         Vector3 sourceNormal(normals[indices[i + j] * 3], normals[indices[i + j] * 3 + 1],
                              normals[indices[i + j] * 3 + 2]);
         Vector2 _uv(uvs[indices[i + j] * 2], uvs[indices[i + j] * 2 + 1]);
         Vector3 sourcePosition(positions[indices[i + j] * 3], positions[indices[i + j] * 3 + 1],
                                positions[indices[i + j] * 3 + 2]);
-        position = Vector3::TransformCoordinates(sourcePosition, matrix);
-        normal   = Vector3::TransformNormal(sourceNormal, matrix);
-
-        vertices.emplace_back(Vertex(position, normal, _uv));
+        vertices[j].pos    = Vector3::TransformCoordinates(sourcePosition, matrix);
+        vertices[j].normal = Vector3::TransformNormal(sourceNormal, matrix);
+        vertices[j].uv     = _uv;
       }
 
-      PolygonOptions shared;
-      shared.subMeshId     = sm;
-      shared.meshId        = currentCSGMeshId;
-      shared.materialIndex = subMesh->materialIndex;
-
-      Polygon polygon(vertices, shared);
-      polygon.plane = Plane::FromPoints(vertices[0].pos, vertices[1].pos, vertices[2].pos);
-
-      // To handle the case of degenerated triangle
-      // polygon.plane == null <=> the polygon does not represent 1 single plane
-      // <=> the triangle is degenerated
-      if (polygon.plane.first) {
-        polygons.emplace_back(polygon);
-      }
+      // Degenerated triangles do not represent 1 single plane and are skipped
+      polygons.add(vertices.data(), vertices.size(), shared);
     }
     ++sm;
   }
 
-  auto csg                = CSG::FromPolygons(polygons);
+  auto csg                = CSG::FromPolygons(std::move(polygons));
   csg->matrix             = matrix;
   csg->position           = meshPosition;
   csg->rotation           = meshRotation;
@@ -92,118 +398,94 @@ std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromMesh(const MeshPtr& mesh)
   return csg;
 }
 
-std::unique_ptr<BABYLON::CSG::CSG>
-CSG::CSG::FromPolygons(const std::vector<BABYLON::CSG::Polygon>& _polygons)
+std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromVertexData(const VertexData& vertexData)
+{
+  const auto& positions = vertexData.positions;
+  const auto& normals   = vertexData.normals;
+  const auto& uvs       = vertexData.uvs;
+  const auto& indices   = vertexData.indices;
+
+  PolygonArena polygons;
+  polygons.polygons.reserve(indices.size() / 3);
+  polygons.vertices.reserve(indices.size());
+  PolygonOptions shared;
+  shared.subMeshId     = 0;
+  shared.meshId        = currentCSGMeshId;
+  shared.materialIndex = 0;
+
+  std::array<Vertex, 3> vertices{{{Vector3::Zero(), Vector3::Zero(), Vector2::Zero()},
+                                  {Vector3::Zero(), Vector3::Zero(), Vector2::Zero()},
+                                  {Vector3::Zero(), Vector3::Zero(), Vector2::Zero()}}};
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    for (unsigned int j = 0; j < 3; ++j) {
+      const auto index   = indices[i + j];
+      vertices[j].pos    = Vector3::FromArray(positions, index * 3);
+      vertices[j].normal = Vector3::Zero();
+      vertices[j].uv     = Vector2::Zero();
+      if (normals.size() >= index * 3 + 3) {
+        vertices[j].normal = Vector3::FromArray(normals, index * 3);
+      }
+      if (uvs.size() >= index * 2 + 2) {
+        vertices[j].uv = Vector2::FromArray(uvs, index * 2);
+      }
+    }
+    polygons.add(vertices.data(), vertices.size(), shared);
+  }
+
+  auto csg     = CSG::FromPolygons(std::move(polygons));
+  csg->matrix  = Matrix::Identity();
+  csg->scaling = Vector3::One();
+  ++currentCSGMeshId;
+
+  return csg;
+}
+
+std::unique_ptr<BABYLON::CSG::CSG> CSG::CSG::FromPolygons(PolygonArena&& polygons)
 {
   auto csg       = std::make_unique<BABYLON::CSG::CSG>();
-  csg->_polygons = _polygons;
+  csg->_polygons = std::move(polygons);
   return csg;
 }
 
 std::unique_ptr<CSG::CSG> CSG::CSG::clone() const
 {
-  auto csg = std::make_unique<CSG>();
-  for (auto& p : _polygons) {
-    csg->_polygons.emplace_back(p.clone());
-  }
+  auto csg       = std::make_unique<CSG>();
+  csg->_polygons = _polygons;
   csg->copyTransformAttributes(*this);
   return csg;
 }
 
 CSG::CSG CSG::CSG::_union(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(Combine(_polygons, csg->_polygons, UnionRuleA, UnionRuleB))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::unionInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-
-  _polygons = a.allPolygons();
+  _polygons = Combine(_polygons, csg->_polygons, UnionRuleA, UnionRuleB);
 }
 
 CSG::CSG CSG::CSG::subtract(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(Combine(_polygons, csg->_polygons, SubtractRuleA, SubtractRuleB))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::subtractInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  b.invert();
-  b.clipTo(a);
-  b.invert();
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = Combine(_polygons, csg->_polygons, SubtractRuleA, SubtractRuleB);
 }
 
 CSG::CSG CSG::CSG::intersect(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-  return CSG::FromPolygons(a.allPolygons())->copyTransformAttributes(*this);
+  return CSG::FromPolygons(Combine(_polygons, csg->_polygons, IntersectRuleA, IntersectRuleB))
+    ->copyTransformAttributes(*this);
 }
 
 void CSG::CSG::intersectInPlace(const BABYLON::CSG::CSGPtr& csg)
 {
-  Node a{_polygons};
-  Node b{csg->_polygons};
-
-  a.invert();
-  b.clipTo(a);
-  b.invert();
-  a.clipTo(b);
-  b.clipTo(a);
-  auto allPolygonsB = b.allPolygons();
-  a.build(allPolygonsB);
-  a.invert();
-
-  _polygons = a.allPolygons();
+  _polygons = Combine(_polygons, csg->_polygons, IntersectRuleA, IntersectRuleB);
 }
 
 std::unique_ptr<CSG::CSG> CSG::CSG::inverse()
@@ -215,9 +497,7 @@ std::unique_ptr<CSG::CSG> CSG::CSG::inverse()
 
 void CSG::CSG::inverseInPlace()
 {
-  for (auto& p : _polygons) {
-    p.flip();
-  }
+  _polygons.flip();
 }
 
 CSG::CSG& CSG::CSG::copyTransformAttributes(const BABYLON::CSG::CSG& csg)
@@ -233,109 +513,13 @@ CSG::CSG& CSG::CSG::copyTransformAttributes(const BABYLON::CSG::CSG& csg)
 
 MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool keepSubMeshes)
 {
-  Matrix _matrix = matrix;
-  _matrix.invert();
-
-  using SubMeshObj = std::array<unsigned int, 3>;
-
   auto mesh = Mesh::New(name, scene);
-  Float32Array vertices;
-  Uint32Array indices;
-  Float32Array normals;
-  Float32Array uvs;
-  auto vertex   = Vector3::Zero();
-  auto normal   = Vector3::Zero();
-  auto uv       = Vector2::Zero();
-  auto polygons = _polygons;
-  std::array<unsigned int, 3> polygonIndices{{0, 0, 0}};
-  std::unordered_map<std::string, size_t> vertice_dict;
-  bool vertexIdxDefined     = false;
-  size_t vertex_idx         = 0;
-  unsigned int currentIndex = 0;
-  std::unordered_map<unsigned int, std::unordered_map<unsigned int, SubMeshObj>> subMesh_dict;
-  SubMeshObj subMesh_obj;
-
-  if (keepSubMeshes) {
-    // Sort Polygons, since subMeshes are indices range
-    BABYLON::stl_util::sort_js_style(polygons, [](const Polygon& a, const Polygon& b) {
-      if (a.shared.meshId == b.shared.meshId) {
-        return a.shared.subMeshId - b.shared.subMeshId;
-      }
-      else {
-        return a.shared.meshId - b.shared.meshId;
-      }
-    });
-  }
-
-  for (auto& polygon : polygons) {
-    // Building SubMeshes
-    if (subMesh_dict.find(polygon.shared.meshId) == subMesh_dict.end()) {
-      subMesh_dict[polygon.shared.meshId] = std::unordered_map<unsigned int, SubMeshObj>();
-    }
-    if (subMesh_dict[polygon.shared.meshId].find(polygon.shared.subMeshId)
-        == subMesh_dict[polygon.shared.meshId].end()) {
-      // IndexStart
-      subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId][0]
-        = std::numeric_limits<unsigned int>::max();
-      // IndexEnd
-      subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId][1]
-        = std::numeric_limits<unsigned int>::min();
-      // materialIndex
-      subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId][2]
-        = polygon.shared.materialIndex;
-    }
-    subMesh_obj = subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId];
-
-    for (unsigned int j = 2; j < polygon.vertices.size(); ++j) {
-
-      polygonIndices[0] = 0;
-      polygonIndices[1] = j - 1;
-      polygonIndices[2] = j;
-
-      for (unsigned int k = 0; k < 3; ++k) {
-        vertex.copyFrom(polygon.vertices[polygonIndices[k]].pos);
-        normal.copyFrom(polygon.vertices[polygonIndices[k]].normal);
-        uv.copyFrom(polygon.vertices[polygonIndices[k]].uv);
-        Vector3 localVertex = Vector3::TransformCoordinates(vertex, _matrix);
-        Vector3 localNormal = Vector3::TransformNormal(normal, _matrix);
+  auto data = BuildGeometry(_polygons, matrix, keepSubMeshes);
 
-        std::string vertexId
-          = StringTools::concat(localVertex.x, ",", localVertex.y, ",", localVertex.z);
-
-        if (stl_util::contains(vertice_dict, vertexId)) {
-          vertex_idx       = vertice_dict[vertexId];
-          vertexIdxDefined = true;
-        }
-
-        // Check if 2 points can be merged
-        if (!(vertexIdxDefined && stl_util::almost_equal(normals[vertex_idx * 3], localNormal.x)
-              && stl_util::almost_equal(normals[vertex_idx * 3 + 1], localNormal.y)
-              && stl_util::almost_equal(normals[vertex_idx * 3 + 2], localNormal.z)
-              && stl_util::almost_equal(uvs[vertex_idx * 2], uv.x)
-              && stl_util::almost_equal(uvs[vertex_idx * 2 + 1], uv.y))) {
-          stl_util::concat(vertices, {localVertex.x, localVertex.y, localVertex.z});
-          stl_util::concat(uvs, {uv.x, uv.y});
-          stl_util::concat(normals, {normal.x, normal.y, normal.z});
-          vertex_idx             = (vertices.size() / 3) - 1;
-          vertice_dict[vertexId] = vertex_idx;
-          vertexIdxDefined       = true;
-        }
-
-        indices.emplace_back(static_cast<unsigned int>(vertex_idx));
-
-        // indexStart
-        subMesh_obj[0] = std::min(currentIndex, subMesh_obj[0]);
-        subMesh_obj[1] = std::max(currentIndex, subMesh_obj[1]);
-        subMesh_dict[polygon.shared.meshId][polygon.shared.subMeshId] = subMesh_obj;
-        ++currentIndex;
-      }
-    }
-  }
-
-  mesh->setVerticesData(VertexBuffer::PositionKind, vertices);
-  mesh->setVerticesData(VertexBuffer::NormalKind, normals);
-  mesh->setVerticesData(VertexBuffer::UVKind, uvs);
-  mesh->setIndices(indices);
+  mesh->setVerticesData(VertexBuffer::PositionKind, data.positions);
+  mesh->setVerticesData(VertexBuffer::NormalKind, data.normals);
+  mesh->setVerticesData(VertexBuffer::UVKind, data.uvs);
+  mesh->setIndices(data.indices);
 
   if (keepSubMeshes) {
     // We offset the materialIndex by the previous number of materials in the
@@ -345,10 +529,10 @@ MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool
 
     mesh->subMeshes.clear();
 
-    for (auto& m : subMesh_dict) {
+    for (auto& m : data.subMeshes) {
       materialMaxIndex = -1;
       for (auto& sm : m.second) {
-        subMesh_obj = sm.second;
+        const auto& subMesh_obj = sm.second;
         SubMesh::CreateFromIndices(subMesh_obj[2] + materialIndexOffset, subMesh_obj[0],
                                    subMesh_obj[1] - subMesh_obj[0] + 1, mesh);
         materialMaxIndex = std::max(static_cast<int>(subMesh_obj[2]), materialMaxIndex);
@@ -360,6 +544,17 @@ MeshPtr CSG::CSG::buildMeshGeometry(const std::string& name, Scene* scene, bool
   return mesh;
 }
 
+std::unique_ptr<VertexData> CSG::CSG::toVertexData() const
+{
+  auto data       = BuildGeometry(_polygons, matrix, false);
+  auto vertexData = std::make_unique<VertexData>();
+  vertexData->positions = std::move(data.positions);
+  vertexData->normals   = std::move(data.normals);
+  vertexData->uvs       = std::move(data.uvs);
+  vertexData->indices   = std::move(data.indices);
+  return vertexData;
+}
+
 MeshPtr CSG::CSG::toMesh(const std::string& name, const MaterialPtr& material, Scene* scene,
                          bool keepSubMeshes)
 {
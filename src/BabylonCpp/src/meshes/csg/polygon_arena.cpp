@@ -0,0 +1,102 @@
+#include <babylon/meshes/csg/polygon_arena.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+
+void CSG::PolygonArena::clear()
+{
+  vertices.clear();
+  polygons.clear();
+}
+
+bool CSG::PolygonArena::add(const Vertex* polygonVertices, size_t count,
+                            const PolygonOptions& shared)
+{
+  if (count < 3) {
+    return false;
+  }
+
+  const auto plane
+    = Plane::FromPoints(polygonVertices[0].pos, polygonVertices[1].pos, polygonVertices[2].pos);
+  if (!plane.first) {
+    return false;
+  }
+
+  add(polygonVertices, count, shared, plane.second);
+  return true;
+}
+
+void CSG::PolygonArena::add(const Vertex* polygonVertices, size_t count,
+                            const PolygonOptions& shared, const Plane& plane)
+{
+  polygons.emplace_back(Entry{vertices.size(), count, shared, plane});
+  vertices.insert(vertices.end(), polygonVertices, polygonVertices + count);
+}
+
+void CSG::PolygonArena::add(const PolygonArena& other, size_t index, bool flip)
+{
+  const auto& entry = other.polygons[index];
+  add(other.vertexData(index), entry.vertexCount, entry.shared, entry.plane);
+  if (flip) {
+    auto& added = polygons.back();
+    std::reverse(vertices.begin() + static_cast<std::ptrdiff_t>(added.firstVertex),
+                 vertices.end());
+    for (auto i = added.firstVertex; i < vertices.size(); ++i) {
+      vertices[i].flip();
+    }
+    added.plane.flip();
+  }
+}
+
+void CSG::PolygonArena::append(const PolygonArena& other)
+{
+  const auto vertexOffset = vertices.size();
+  vertices.insert(vertices.end(), other.vertices.begin(), other.vertices.end());
+  polygons.reserve(polygons.size() + other.polygons.size());
+  for (const auto& entry : other.polygons) {
+    polygons.emplace_back(entry);
+    polygons.back().firstVertex += vertexOffset;
+  }
+}
+
+void CSG::PolygonArena::flip()
+{
+  for (auto& entry : polygons) {
+    const auto first = vertices.begin() + static_cast<std::ptrdiff_t>(entry.firstVertex);
+    std::reverse(first, first + static_cast<std::ptrdiff_t>(entry.vertexCount));
+    entry.plane.flip();
+  }
+  for (auto& vertex : vertices) {
+    vertex.flip();
+  }
+}
+
+std::vector<CSG::Polygon> CSG::PolygonArena::toPolygons() const
+{
+  std::vector<Polygon> result;
+  result.reserve(polygons.size());
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    const auto first = vertexData(i);
+    Polygon polygon(std::vector<Vertex>(first, first + polygons[i].vertexCount),
+                    polygons[i].shared);
+    polygon.plane = std::make_pair(true, polygons[i].plane);
+    result.emplace_back(std::move(polygon));
+  }
+  return result;
+}
+
+CSG::PolygonArena CSG::PolygonArena::FromPolygons(const std::vector<Polygon>& polygonList)
+{
+  PolygonArena arena;
+  arena.polygons.reserve(polygonList.size());
+  for (const auto& polygon : polygonList) {
+    if (polygon.plane.first && polygon.vertices.size() >= 3) {
+      arena.add(polygon.vertices.data(), polygon.vertices.size(), polygon.shared,
+                polygon.plane.second);
+    }
+  }
+  return arena;
+}
+
+} // end of namespace BABYLON
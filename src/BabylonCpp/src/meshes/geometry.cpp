@@ -87,7 +87,7 @@ void Geometry::set_boundingBias(const std::optional<Vector2>& value)
     _boundingBias = value;
   }
 
-  _updateBoundingInfo(true, Float32Array());
+  _updateBoundingInfo(true, {});
 }
 
 GeometryPtr Geometry::CreateGeometryForMesh(Mesh* mesh)
@@ -102,7 +102,7 @@ GeometryPtr Geometry::CreateGeometryForMesh(Mesh* mesh)
 MinMax& Geometry::get_extend()
 {
   if (!_extend) {
-    _updateExtend(Float32Array());
+    _updateExtend();
   }
   return *_extend;
 }
@@ -200,7 +200,7 @@ void Geometry::setVerticesBuffer(const VertexBufferPtr& buffer,
       }
     }
 
-    _updateExtend(data);
+    _updateExtend();
     _resetPointsArrayCache();
 
     for (const auto& mesh : _meshes) {
@@ -251,7 +251,7 @@ AbstractMesh* Geometry::updateVerticesData(const std::string& kind, const Float3
   return nullptr;
 }
 
-void Geometry::_updateBoundingInfo(bool updateExtends, const Float32Array& data)
+void Geometry::_updateBoundingInfo(bool updateExtends, const ConstFloat32ArrayView& data)
 {
   if (updateExtends) {
     _updateExtend(data);
@@ -320,20 +320,18 @@ Float32Array Geometry::getVerticesData(const std::string& kind, bool copyWhenSha
     return Float32Array();
   }
 
-  auto data = vertexBuffer->getData();
+  const auto& data = vertexBuffer->getData();
   if (data.empty()) {
     return Float32Array();
   }
 
   const auto tightlyPackedByteStride
     = vertexBuffer->getSize() * VertexBuffer::GetTypeByteLength(vertexBuffer->type);
-  const auto count = _totalVertices * vertexBuffer->getSize();
 
   if (vertexBuffer->type != VertexBuffer::FLOAT
-      || vertexBuffer->byteStride != tightlyPackedByteStride) {
-    Float32Array copy(count);
-    vertexBuffer->forEach(count, [&](float value, size_t index) { copy[index] = value; });
-    return copy;
+      || vertexBuffer->byteStride != tightlyPackedByteStride || vertexBuffer->octahedralEncoded
+      || vertexBuffer->dequantizationMatrix) {
+    return vertexBuffer->getFloatData(_totalVertices);
   }
 
   if (forceCopy || (copyWhenShared && _meshes.size() != 1)) {
@@ -343,6 +341,56 @@ Float32Array Geometry::getVerticesData(const std::string& kind, bool copyWhenSha
   return data;
 }
 
+ConstFloat32ArrayView Geometry::getVerticesDataView(const std::string& kind)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer) {
+    return {};
+  }
+
+  const auto tightlyPackedByteStride
+    = vertexBuffer->getSize() * VertexBuffer::GetTypeByteLength(vertexBuffer->type);
+  if (vertexBuffer->type != VertexBuffer::FLOAT
+      || vertexBuffer->byteStride != tightlyPackedByteStride || vertexBuffer->byteOffset != 0
+      || vertexBuffer->octahedralEncoded || vertexBuffer->dequantizationMatrix) {
+    return {};
+  }
+
+  const auto& data = vertexBuffer->getData();
+  const auto count = std::min(data.size(), _totalVertices * vertexBuffer->getSize());
+  return ConstFloat32ArrayView(data.data(), count);
+}
+
+Float32ArrayView Geometry::getWritableVerticesDataView(const std::string& kind)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+  if (!vertexBuffer || !vertexBuffer->isUpdatable() || getVerticesDataView(kind).empty()) {
+    return {};
+  }
+
+  auto& data       = vertexBuffer->getData();
+  const auto count = std::min(data.size(), _totalVertices * vertexBuffer->getSize());
+  return Float32ArrayView(data.data(), count);
+}
+
+void Geometry::updateVerticesDataFromView(const std::string& kind, bool updateExtends)
+{
+  auto vertexBuffer = getVertexBuffer(kind);
+
+  if (!vertexBuffer) {
+    return;
+  }
+
+  // The CPU copy was modified in place, only the GPU buffer needs to be refreshed
+  const auto& data = vertexBuffer->getData();
+  vertexBuffer->updateDirectly(data, 0);
+
+  if (kind == VertexBuffer::PositionKind) {
+    _updateBoundingInfo(updateExtends, data);
+  }
+  notifyUpdate(kind);
+}
+
 bool Geometry::isVertexBufferUpdatable(const std::string& kind) const
 {
   auto it = _vertexBuffers.find(kind);
@@ -473,6 +521,14 @@ IndicesArray Geometry::getIndices(bool copyWhenShared, bool forceCopy)
   }
 }
 
+ConstIndicesArrayView Geometry::getIndicesView() const
+{
+  if (!isReady()) {
+    return {};
+  }
+  return _indices;
+}
+
 WebGLDataBufferPtr Geometry::getIndexBuffer()
 {
   if (!isReady()) {
@@ -537,13 +593,21 @@ void Geometry::applyToMesh(Mesh* mesh)
   }
 }
 
-void Geometry::_updateExtend(Float32Array data)
+void Geometry::_updateExtend(const ConstFloat32ArrayView& data)
 {
-  if (data.empty()) {
-    data = getVerticesData(VertexBuffer::PositionKind);
+  if (!data.empty()) {
+    _extend = extractMinAndMax(data, 0, _totalVertices, boundingBias(), 3);
+    return;
   }
 
-  _extend = extractMinAndMax(data, 0, _totalVertices, boundingBias(), 3);
+  auto positions = getVerticesDataView(VertexBuffer::PositionKind);
+  if (!positions.empty()) {
+    _extend = extractMinAndMax(positions, 0, _totalVertices, boundingBias(), 3);
+  }
+  else {
+    _extend = extractMinAndMax(getVerticesData(VertexBuffer::PositionKind), 0, _totalVertices,
+                               boundingBias(), 3);
+  }
 }
 
 void Geometry::_applyToMesh(Mesh* mesh)
@@ -564,7 +628,7 @@ void Geometry::_applyToMesh(Mesh* mesh)
 
     if (kind == VertexBuffer::PositionKind) {
       if (!_extend) {
-        _updateExtend(Float32Array());
+        _updateExtend();
       }
       mesh->_boundingInfo = std::make_unique<BoundingInfo>(extend().min, extend().max);
 
@@ -665,16 +729,22 @@ bool Geometry::_generatePointsArray()
     return true;
   }
 
-  auto data = getVerticesData(VertexBuffer::PositionKind);
+  auto data = getVerticesDataView(VertexBuffer::PositionKind);
+  Float32Array copy;
+  if (data.empty()) {
+    copy = getVerticesData(VertexBuffer::PositionKind);
+    data = copy;
+  }
 
   if (data.empty()) {
     return false;
   }
 
   _positions.clear();
+  _positions.reserve(data.size() / 3);
 
-  for (unsigned int index = 0; index < data.size(); index += 3) {
-    _positions.emplace_back(Vector3::FromArray(data, index));
+  for (size_t index = 0; index + 2 < data.size(); index += 3) {
+    _positions.emplace_back(data[index], data[index + 1], data[index + 2]);
   }
 
   return true;
@@ -134,6 +134,11 @@ Float32Array InstancedMesh::getVerticesData(const std::string& kind, bool copyWh
   return _sourceMesh->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+ConstFloat32ArrayView InstancedMesh::getVerticesDataView(const std::string& kind)
+{
+  return _sourceMesh->getVerticesDataView(kind);
+}
+
 AbstractMesh* InstancedMesh::setVerticesData(const std::string& kind, const Float32Array& data,
                                              bool updatable, const std::optional<size_t>& stride)
 {
@@ -171,6 +176,11 @@ IndicesArray InstancedMesh::getIndices(bool /*copyWhenShared*/, bool /*forceCopy
   return _sourceMesh->getIndices();
 }
 
+ConstIndicesArrayView InstancedMesh::getIndicesView()
+{
+  return _sourceMesh->getIndicesView();
+}
+
 std::vector<Vector3>& InstancedMesh::_positions()
 {
   return _sourceMesh->_positions();
@@ -184,7 +194,8 @@ InstancedMesh& InstancedMesh::refreshBoundingInfo(bool applySkeleton)
 
   const auto bias
     = _sourceMesh->geometry() ? _sourceMesh->geometry()->boundingBias() : std::nullopt;
-  _refreshBoundingInfo(_sourceMesh->_getPositionData(applySkeleton), bias);
+  Float32Array skinnedData;
+  _refreshBoundingInfo(_sourceMesh->_getPositionDataView(applySkeleton, skinnedData), bias);
   return *this;
 }
 
@@ -347,8 +347,8 @@ std::string Mesh::toString(bool fullDetails)
 
   if (fullDetails) {
     if (_geometry) {
-      auto ib = getIndices();
-      auto vb = getVerticesData(VertexBuffer::PositionKind);
+      auto ib = getIndicesView();
+      auto vb = getVerticesDataView(VertexBuffer::PositionKind);
 
       if (!vb.empty() && !ib.empty()) {
         oss << ", flat shading: " << (vb.size() / 3 == ib.size() ? "YES" : "NO");
@@ -520,6 +520,14 @@ Float32Array Mesh::getVerticesData(const std::string& kind, bool copyWhenShared,
   return _geometry->getVerticesData(kind, copyWhenShared, forceCopy);
 }
 
+ConstFloat32ArrayView Mesh::getVerticesDataView(const std::string& kind)
+{
+  if (!_geometry) {
+    return {};
+  }
+  return _geometry->getVerticesDataView(kind);
+}
+
 VertexBufferPtr Mesh::getVertexBuffer(const std::string& kind) const
 {
   if (!_geometry) {
@@ -586,6 +594,14 @@ IndicesArray Mesh::getIndices(bool copyWhenShared, bool forceCopy)
   return _geometry->getIndices(copyWhenShared, forceCopy);
 }
 
+ConstIndicesArrayView Mesh::getIndicesView()
+{
+  if (!_geometry) {
+    return {};
+  }
+  return _geometry->getIndicesView();
+}
+
 bool Mesh::get_isBlocked() const
 {
   return _masterMesh != nullptr;
@@ -732,20 +748,21 @@ Mesh& Mesh::refreshBoundingInfo(bool applySkeleton)
   }
 
   std::optional<Vector2> bias = geometry() ? geometry()->boundingBias() : std::nullopt;
-  _refreshBoundingInfo(_getPositionData(applySkeleton), bias);
+  Float32Array skinnedData;
+  _refreshBoundingInfo(_getPositionDataView(applySkeleton, skinnedData), bias);
   return *this;
 }
 
 SubMeshPtr Mesh::_createGlobalSubMesh(bool force)
 {
   auto totalVertices = getTotalVertices();
-  if (!totalVertices || (!_geometry->isReady() && getIndices().empty())) {
+  if (!totalVertices || (!_geometry->isReady() && getIndicesView().empty())) {
     return nullptr;
   }
 
   // Check if we need to recreate the submeshes
   if (!subMeshes.empty()) {
-    auto ib = getIndices();
+    auto ib = getIndicesView();
 
     if (ib.empty()) {
       return nullptr;
@@ -974,7 +991,7 @@ void Mesh::_bind(SubMesh* subMesh, const EffectPtr& effect, unsigned int fillMod
         indexToBind = nullptr;
         break;
       case Material::WireFrameFillMode: {
-        const auto& linesIndexBuffer = subMesh->_getLinesIndexBuffer(getIndices(), engine);
+        const auto& linesIndexBuffer = subMesh->_getLinesIndexBuffer(getIndicesView(), engine);
         indexToBind                  = linesIndexBuffer ? linesIndexBuffer : nullptr;
       } break;
       default:
@@ -1121,18 +1138,27 @@ Mesh& Mesh::_renderWithInstances(SubMesh* subMesh, unsigned int fillMode,
   const auto& renderSelf = batch->renderSelf[subMesh->_id];
 
   if (!_instanceDataStorage->manualUpdate) {
-    auto world = _effectiveMesh()->getWorldMatrix();
+    auto dequantizationMatrix = _getPositionDequantizationMatrix();
+    Matrix dequantizedWorld;
+    const auto copyWorldMatrix = [&](Matrix& world) {
+      if (dequantizationMatrix) {
+        dequantizationMatrix->multiplyToRef(world, dequantizedWorld);
+        dequantizedWorld.copyToArray(instanceStorage->instancesData, offset);
+      }
+      else {
+        world.copyToArray(instanceStorage->instancesData, offset);
+      }
+      offset += 16;
+    };
 
     if (renderSelf) {
-      world.copyToArray(instanceStorage->instancesData, offset);
-      offset += 16;
+      copyWorldMatrix(_effectiveMesh()->getWorldMatrix());
       instancesCount++;
     }
 
     if (!visibleInstances.empty()) {
       for (auto instance : visibleInstances) {
-        instance->getWorldMatrix().copyToArray(instanceStorage->instancesData, offset);
-        offset += 16;
+        copyWorldMatrix(instance->getWorldMatrix());
         ++instancesCount;
       }
     }
@@ -1195,11 +1221,22 @@ Mesh& Mesh::_processRendering(
     _renderWithInstances(subMesh, static_cast<unsigned>(fillMode), batch, effect, engine);
   }
   else {
+    // Quantized positions are dequantized by the world matrix sent to the shaders
+    auto dequantizationMatrix = _getPositionDequantizationMatrix();
+    Matrix dequantizedWorld;
+
     size_t instanceCount = 0;
     if (batch->renderSelf[subMesh->_id]) {
       // Draw
       if (iOnBeforeDraw) {
-        iOnBeforeDraw(false, _effectiveMesh()->getWorldMatrix(), effectiveMaterial);
+        if (dequantizationMatrix) {
+          dequantizationMatrix->multiplyToRef(_effectiveMesh()->getWorldMatrix(),
+                                              dequantizedWorld);
+          iOnBeforeDraw(false, dequantizedWorld, effectiveMaterial);
+        }
+        else {
+          iOnBeforeDraw(false, _effectiveMesh()->getWorldMatrix(), effectiveMaterial);
+        }
       }
       ++instanceCount;
 
@@ -1218,7 +1255,13 @@ Mesh& Mesh::_processRendering(
         // World
         auto world = instance->getWorldMatrix();
         if (iOnBeforeDraw) {
-          iOnBeforeDraw(true, world, effectiveMaterial);
+          if (dequantizationMatrix) {
+            dequantizationMatrix->multiplyToRef(world, dequantizedWorld);
+            iOnBeforeDraw(true, dequantizedWorld, effectiveMaterial);
+          }
+          else {
+            iOnBeforeDraw(true, world, effectiveMaterial);
+          }
         }
 
         // Draw
@@ -1233,6 +1276,12 @@ Mesh& Mesh::_processRendering(
   return *this;
 }
 
+Matrix* Mesh::_getPositionDequantizationMatrix() const
+{
+  const auto vertexBuffer = getVertexBuffer(VertexBuffer::PositionKind);
+  return vertexBuffer ? vertexBuffer->dequantizationMatrix.get() : nullptr;
+}
+
 void Mesh::_rebuild()
 {
   if (_instanceDataStorage->instancesBuffer) {
@@ -1387,6 +1436,9 @@ Mesh& Mesh::render(SubMesh* subMesh, bool enableAlphaMode,
   }
 
   auto _world = effectiveMesh.getWorldMatrix();
+  if (auto dequantizationMatrix = _getPositionDequantizationMatrix()) {
+    _world = dequantizationMatrix->multiply(_world);
+  }
 
   if (_effectiveMaterial->_storeEffectOnSubMeshes) {
     _effectiveMaterial->bindForSubMesh(_world, this, subMesh);
@@ -2322,6 +2374,123 @@ void Mesh::increaseVertices(size_t numberPerEdge)
   }
 }
 
+Mesh& Mesh::quantizeVertexData(const VertexQuantizationOptions& options)
+{
+  if (!_geometry) {
+    return *this;
+  }
+
+  auto engine              = getScene()->getEngine();
+  const auto totalVertices = getTotalVertices();
+
+  // Only convert the float vertex data that is not updated afterwards
+  const auto getSourceData = [this](const std::string& kind) -> Float32Array {
+    auto vertexBuffer = getVertexBuffer(kind);
+    if (!vertexBuffer || vertexBuffer->isUpdatable() || vertexBuffer->type != VertexBuffer::FLOAT
+        || vertexBuffer->getIsInstanced()) {
+      return {};
+    }
+    return getVerticesData(kind);
+  };
+
+  const auto createVertexBuffer
+    = [engine](const Float32Array& data, const std::string& kind, size_t byteStride, size_t size,
+               unsigned int type, bool normalized) {
+        return std::make_shared<VertexBuffer>(engine, data, kind, false, false, byteStride, false,
+                                              0, size, type, normalized, true);
+      };
+
+  // Normals and tangents are only encoded when all the meshes sharing the geometry render them
+  // with shaders decoding them, morph targets being applied on the decoded vectors. Positions are
+  // only quantized when none of them is skinned or morphed, bones and morph targets being applied
+  // before the dequantization folded in the world matrix
+  auto canEncodeOctahedral = true;
+  auto canQuantizePositions = true;
+  for (auto mesh : _geometry->_meshes) {
+    auto material = mesh->getMaterial();
+    if (!material) {
+      material = getScene()->defaultMaterial();
+    }
+    if (mesh->morphTargetManager() || (material && !material->supportsOctahedralVertexData())) {
+      canEncodeOctahedral = false;
+    }
+    if (mesh->skeleton() || mesh->morphTargetManager()) {
+      canQuantizePositions = false;
+    }
+  }
+  if ((options.normals || options.tangents) && !canEncodeOctahedral) {
+    BABYLON_LOGF_WARN("Mesh",
+                      "Normals and tangents of mesh %s are not quantized (morph targets or "
+                      "material not decoding them)",
+                      name.c_str())
+  }
+
+  // Normals and tangents
+  if (options.normals && canEncodeOctahedral) {
+    auto normals = getSourceData(VertexBuffer::NormalKind);
+    if (!normals.empty()) {
+      auto vertexBuffer = createVertexBuffer(VertexQuantization::EncodeOctahedral(normals, 3),
+                                             VertexBuffer::NormalKind,
+                                             VertexQuantization::NormalByteStride, 2,
+                                             VertexBuffer::SHORT, true);
+      vertexBuffer->octahedralEncoded = true;
+      _geometry->setVerticesBuffer(vertexBuffer, totalVertices);
+    }
+  }
+
+  if (options.tangents && canEncodeOctahedral) {
+    auto tangents = getSourceData(VertexBuffer::TangentKind);
+    if (!tangents.empty()) {
+      auto vertexBuffer = createVertexBuffer(VertexQuantization::EncodeOctahedral(tangents, 4),
+                                             VertexBuffer::TangentKind,
+                                             VertexQuantization::TangentByteStride, 3,
+                                             VertexBuffer::SHORT, true);
+      vertexBuffer->octahedralEncoded = true;
+      _geometry->setVerticesBuffer(vertexBuffer, totalVertices);
+    }
+  }
+
+  // Texture coordinates
+  if (options.uvs) {
+    for (const auto& kind : {VertexBuffer::UVKind, VertexBuffer::UV2Kind, VertexBuffer::UV3Kind,
+                             VertexBuffer::UV4Kind, VertexBuffer::UV5Kind, VertexBuffer::UV6Kind}) {
+      auto uvs = getSourceData(kind);
+      if (!uvs.empty()) {
+        _geometry->setVerticesBuffer(createVertexBuffer(VertexQuantization::EncodeHalfFloats(uvs),
+                                                        kind, VertexQuantization::UVByteStride,
+                                                        2, VertexBuffer::HALF_FLOAT, false),
+                                     totalVertices);
+      }
+    }
+  }
+
+  // Positions, last so that the extend is computed from the quantized values
+  if (options.positions) {
+    if (!canQuantizePositions) {
+      BABYLON_LOGF_WARN("Mesh",
+                        "Positions of mesh %s are not quantized (skinned or morphed mesh sharing "
+                        "its geometry)",
+                        name.c_str())
+    }
+    else {
+      auto positions = getSourceData(VertexBuffer::PositionKind);
+      if (!positions.empty()) {
+        Matrix dequantizationMatrix;
+        auto vertexBuffer = createVertexBuffer(
+          VertexQuantization::QuantizePositions(positions, dequantizationMatrix),
+          VertexBuffer::PositionKind, VertexQuantization::PositionByteStride, 3,
+          VertexBuffer::UNSIGNED_SHORT, true);
+        vertexBuffer->dequantizationMatrix = std::make_unique<Matrix>(dequantizationMatrix);
+        _geometry->setVerticesBuffer(vertexBuffer, totalVertices);
+      }
+    }
+  }
+
+  _markSubMeshesAsAttributesDirty();
+
+  return *this;
+}
+
 void Mesh::forceSharedVertices()
 {
   auto vertex_data       = VertexData::ExtractFromMesh(this);
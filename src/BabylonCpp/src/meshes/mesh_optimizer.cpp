@@ -0,0 +1,773 @@
+#include <babylon/meshes/mesh_optimizer.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+#include <numeric>
+#include <unordered_set>
+
+#include <babylon/core/logging.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+#include <babylon/morph/morph_target_manager.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Size of the LRU cache modeled by the Forsyth algorithm
+constexpr size_t ForsythCacheSize = 32;
+// Remaining triangle counts above this value get the same valence score
+constexpr size_t ForsythMaxValence = 32;
+
+/**
+ * @brief FIFO post-transform cache simulation, a vertex being in the cache if it was transformed
+ * less than cacheSize misses ago.
+ */
+class FifoCache {
+
+public:
+  FifoCache(size_t vertexCount, unsigned int cacheSize)
+      : _timestamps(vertexCount, 0), _timestamp{cacheSize + 1}, _cacheSize{cacheSize}
+  {
+  }
+
+  /**
+   * @brief Accesses a vertex and returns 1 on cache miss, 0 on cache hit.
+   */
+  unsigned int access(uint32_t vertex)
+  {
+    if (_timestamp - _timestamps[vertex] > _cacheSize) {
+      _timestamps[vertex] = _timestamp++;
+      return 1;
+    }
+    return 0;
+  }
+
+  unsigned int accessTriangle(const IndicesArray& indices, size_t triangle)
+  {
+    return access(indices[triangle * 3]) + access(indices[triangle * 3 + 1])
+           + access(indices[triangle * 3 + 2]);
+  }
+
+  /**
+   * @brief Flushes the cache.
+   */
+  void reset()
+  {
+    _timestamp += _cacheSize + 1;
+  }
+
+private:
+  std::vector<uint32_t> _timestamps;
+  uint32_t _timestamp;
+  uint32_t _cacheSize;
+
+}; // end of class FifoCache
+
+/**
+ * @brief Vertex to triangles adjacency, stored as compressed rows.
+ */
+struct TriangleAdjacency {
+  TriangleAdjacency(const IndicesArray& indices, size_t vertexCount)
+      : counts(vertexCount, 0), offsets(vertexCount + 1, 0), triangles(indices.size())
+  {
+    for (const auto index : indices) {
+      ++counts[index];
+    }
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+      offsets[vertex + 1] = offsets[vertex] + counts[vertex];
+    }
+    std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+    for (size_t corner = 0; corner < indices.size(); ++corner) {
+      triangles[fill[indices[corner]]++] = static_cast<uint32_t>(corner / 3);
+    }
+  }
+
+  std::vector<uint32_t> counts;
+  std::vector<uint32_t> offsets;
+  std::vector<uint32_t> triangles;
+}; // end of struct TriangleAdjacency
+
+float ForsythVertexScore(int cachePosition, uint32_t remainingTriangles)
+{
+  if (remainingTriangles == 0) {
+    // No triangle needs this vertex anymore
+    return -1.f;
+  }
+
+  auto score = 0.f;
+  if (cachePosition >= 0) {
+    if (cachePosition < 3) {
+      // The vertices of the last triangle get a fixed score so that the algorithm does not favor
+      // strips over fans
+      score = 0.75f;
+    }
+    else {
+      const auto scaler = 1.f / static_cast<float>(ForsythCacheSize - 3);
+      score = std::pow(1.f - static_cast<float>(cachePosition - 3) * scaler, 1.5f);
+    }
+  }
+
+  // Boost the vertices with few remaining triangles to get rid of them quickly
+  score += 2.f * std::pow(static_cast<float>(remainingTriangles), -0.5f);
+  return score;
+}
+
+size_t CountUsedVertices(const IndicesArray& indices, size_t vertexCount)
+{
+  std::vector<bool> used(vertexCount, false);
+  size_t count = 0;
+  for (const auto index : indices) {
+    if (!used[index]) {
+      used[index] = true;
+      ++count;
+    }
+  }
+  return count;
+}
+
+} // end of anonymous namespace
+
+MeshOptimizerStatistics MeshOptimizer::OptimizeMesh(Mesh* mesh,
+                                                    const MeshOptimizerOptions& options)
+{
+  if (!mesh || !mesh->geometry()) {
+    return MeshOptimizerStatistics();
+  }
+
+  auto indices = mesh->getIndices();
+  if (indices.empty() || indices.size() % 3 != 0) {
+    return MeshOptimizerStatistics();
+  }
+
+  auto vertexCount = mesh->getTotalVertices();
+  auto positions   = mesh->getVerticesData(VertexBuffer::PositionKind);
+  if (positions.size() != vertexCount * 3) {
+    return MeshOptimizerStatistics();
+  }
+
+  // Vertices can only be welded and reordered when all the vertex data is stored as floats and
+  // indexed by vertex
+  auto remapVertices = mesh->morphTargetManager() == nullptr;
+  std::vector<std::string> kinds;
+  std::vector<Float32Array> data;
+  std::vector<bool> updatables;
+  for (const auto& kind : mesh->getVerticesDataKinds()) {
+    const auto vertexBuffer = mesh->getVertexBuffer(kind);
+    if (!vertexBuffer || vertexBuffer->getIsInstanced()) {
+      continue;
+    }
+    if (vertexBuffer->type != VertexBuffer::FLOAT || vertexBuffer->dequantizationMatrix) {
+      remapVertices = false;
+      break;
+    }
+    if (kind == VertexBuffer::PositionKind) {
+      continue;
+    }
+    kinds.emplace_back(kind);
+    data.emplace_back(mesh->getVerticesData(kind));
+    updatables.emplace_back(vertexBuffer->isUpdatable());
+    if (data.back().size() != vertexCount * vertexBuffer->getSize()) {
+      remapVertices = false;
+      break;
+    }
+  }
+
+  std::vector<Float32Array*> streams{&positions};
+  if (remapVertices) {
+    for (auto& stream : data) {
+      streams.emplace_back(&stream);
+    }
+  }
+
+  // Triangles are only reordered within each sub-mesh
+  std::vector<std::pair<size_t, size_t>> indexRanges;
+  for (const auto& subMesh : mesh->subMeshes) {
+    indexRanges.emplace_back(subMesh->indexStart, subMesh->indexCount);
+  }
+  if (indexRanges.empty()) {
+    indexRanges.emplace_back(0, indices.size());
+  }
+
+  const auto statistics
+    = _Optimize(streams, &positions, indices, vertexCount, indexRanges, remapVertices, options);
+
+  // Save the sub-meshes as setIndices recreates a global one
+  struct SubMeshRange {
+    unsigned int materialIndex;
+    unsigned int indexStart;
+    size_t indexCount;
+  };
+  std::vector<SubMeshRange> subMeshRanges;
+  for (const auto& subMesh : mesh->subMeshes) {
+    subMeshRanges.emplace_back(
+      SubMeshRange{subMesh->materialIndex, subMesh->indexStart, subMesh->indexCount});
+  }
+
+  if (remapVertices) {
+    mesh->setVerticesData(VertexBuffer::PositionKind, positions,
+                          mesh->isVertexBufferUpdatable(VertexBuffer::PositionKind));
+    for (size_t i = 0; i < kinds.size(); ++i) {
+      mesh->setVerticesData(kinds[i], data[i], updatables[i]);
+    }
+  }
+  mesh->setIndices(indices, vertexCount);
+
+  if (subMeshRanges.size() > 1) {
+    mesh->releaseSubMeshes();
+    const auto meshPtr = mesh->shared_from_base<Mesh>();
+    for (const auto& subMeshRange : subMeshRanges) {
+      SubMesh::CreateFromIndices(subMeshRange.materialIndex, subMeshRange.indexStart,
+                                 subMeshRange.indexCount, meshPtr);
+    }
+  }
+
+  return statistics;
+}
+
+MeshOptimizerStatistics MeshOptimizer::OptimizeVertexData(VertexData& vertexData,
+                                                          const MeshOptimizerOptions& options)
+{
+  auto& indices = vertexData.indices;
+  if (indices.empty() || indices.size() % 3 != 0 || vertexData.positions.empty()) {
+    return MeshOptimizerStatistics();
+  }
+
+  auto vertexCount   = vertexData.positions.size() / 3;
+  auto remapVertices = true;
+  std::vector<Float32Array*> streams;
+  for (auto* stream :
+       {&vertexData.positions, &vertexData.normals, &vertexData.tangents, &vertexData.uvs,
+        &vertexData.uvs2, &vertexData.uvs3, &vertexData.uvs4, &vertexData.uvs5, &vertexData.uvs6,
+        &vertexData.colors, &vertexData.matricesIndices, &vertexData.matricesWeights,
+        &vertexData.matricesIndicesExtra, &vertexData.matricesWeightsExtra}) {
+    if (!stream->empty()) {
+      remapVertices = remapVertices && (stream->size() % vertexCount == 0);
+      streams.emplace_back(stream);
+    }
+  }
+
+  return _Optimize(streams, &vertexData.positions, indices, vertexCount, {{0, indices.size()}},
+                   remapVertices, options);
+}
+
+MeshOptimizerStatistics
+MeshOptimizer::_Optimize(const std::vector<Float32Array*>& streams, Float32Array* positions,
+                         IndicesArray& indices, size_t& vertexCount,
+                         const std::vector<std::pair<size_t, size_t>>& indexRanges,
+                         bool remapVertices, const MeshOptimizerOptions& options)
+{
+  MeshOptimizerStatistics statistics;
+  statistics.verticesBefore = vertexCount;
+  statistics.acmrBefore     = ComputeACMR(indices, vertexCount, options.cacheSize);
+  statistics.atvrBefore     = ComputeATVR(indices, vertexCount, options.cacheSize);
+
+  Uint32Array remap;
+
+  // Welding
+  if (remapVertices && options.weldVertices) {
+    const std::vector<const Float32Array*> constStreams(streams.begin(), streams.end());
+    const auto uniqueVertexCount = GenerateVertexRemap(constStreams, vertexCount, remap);
+    if (uniqueVertexCount < vertexCount) {
+      ApplyVertexRemap(remap, uniqueVertexCount, indices, streams);
+      vertexCount = uniqueVertexCount;
+    }
+  }
+
+  // Triangles reordering
+  for (const auto& [indexStart, indexCount] : indexRanges) {
+    if (indexCount == 0 || indexCount % 3 != 0 || indexStart + indexCount > indices.size()) {
+      continue;
+    }
+
+    const auto begin = indices.begin() + static_cast<std::ptrdiff_t>(indexStart);
+    const auto end   = begin + static_cast<std::ptrdiff_t>(indexCount);
+    IndicesArray rangeIndices(begin, end);
+    if (options.optimizeVertexCache) {
+      rangeIndices
+        = options.vertexCacheOptimizationType == VertexCacheOptimizationType::TIPSIFY ?
+            OptimizeVertexCacheTipsify(rangeIndices, vertexCount, options.cacheSize) :
+            OptimizeVertexCacheForsyth(rangeIndices, vertexCount);
+    }
+    if (options.optimizeOverdraw && positions && positions->size() == vertexCount * 3) {
+      rangeIndices = OptimizeOverdraw(rangeIndices, *positions, options.overdrawThreshold,
+                                      options.cacheSize);
+    }
+    std::copy(rangeIndices.begin(), rangeIndices.end(), begin);
+  }
+
+  // Vertex fetch reordering
+  if (remapVertices && options.optimizeVertexFetch) {
+    const auto usedVertexCount = GenerateVertexFetchRemap(indices, vertexCount, remap);
+    ApplyVertexRemap(remap, usedVertexCount, indices, streams);
+    vertexCount = usedVertexCount;
+  }
+
+  statistics.verticesAfter = vertexCount;
+  statistics.acmrAfter     = ComputeACMR(indices, vertexCount, options.cacheSize);
+  statistics.atvrAfter     = ComputeATVR(indices, vertexCount, options.cacheSize);
+  return statistics;
+}
+
+float MeshOptimizer::ComputeACMR(const IndicesArray& indices, size_t vertexCount,
+                                 unsigned int cacheSize)
+{
+  const auto triangleCount = indices.size() / 3;
+  if (triangleCount == 0) {
+    return 0.f;
+  }
+
+  FifoCache cache(vertexCount, cacheSize);
+  size_t misses = 0;
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    misses += cache.accessTriangle(indices, triangle);
+  }
+  return static_cast<float>(misses) / static_cast<float>(triangleCount);
+}
+
+float MeshOptimizer::ComputeATVR(const IndicesArray& indices, size_t vertexCount,
+                                 unsigned int cacheSize)
+{
+  const auto usedVertexCount = CountUsedVertices(indices, vertexCount);
+  if (usedVertexCount == 0) {
+    return 0.f;
+  }
+
+  const auto triangleCount = indices.size() / 3;
+  return ComputeACMR(indices, vertexCount, cacheSize) * static_cast<float>(triangleCount)
+         / static_cast<float>(usedVertexCount);
+}
+
+IndicesArray MeshOptimizer::OptimizeVertexCacheForsyth(const IndicesArray& indices,
+                                                       size_t vertexCount)
+{
+  const auto triangleCount = indices.size() / 3;
+  if (triangleCount == 0) {
+    return indices;
+  }
+
+  // Score lookup tables
+  std::array<std::array<float, ForsythMaxValence + 1>, ForsythCacheSize + 1> scoreTable{};
+  for (size_t position = 0; position <= ForsythCacheSize; ++position) {
+    for (size_t valence = 0; valence <= ForsythMaxValence; ++valence) {
+      const auto cachePosition
+        = position == ForsythCacheSize ? -1 : static_cast<int>(position);
+      scoreTable[position][valence]
+        = ForsythVertexScore(cachePosition, static_cast<uint32_t>(valence));
+    }
+  }
+  const auto vertexScore = [&scoreTable](int cachePosition, uint32_t remainingTriangles) {
+    const auto position = cachePosition < 0 ? ForsythCacheSize : static_cast<size_t>(cachePosition);
+    return scoreTable[position][std::min<size_t>(remainingTriangles, ForsythMaxValence)];
+  };
+
+  TriangleAdjacency adjacency(indices, vertexCount);
+  auto& remaining = adjacency.counts;
+
+  std::vector<int> cachePositions(vertexCount, -1);
+  std::vector<float> vertexScores(vertexCount, 0.f);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    vertexScores[vertex] = vertexScore(-1, remaining[vertex]);
+  }
+
+  std::vector<float> triangleScores(triangleCount, 0.f);
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    triangleScores[triangle] = vertexScores[indices[triangle * 3]]
+                               + vertexScores[indices[triangle * 3 + 1]]
+                               + vertexScores[indices[triangle * 3 + 2]];
+  }
+
+  std::vector<bool> emitted(triangleCount, false);
+  std::array<uint32_t, ForsythCacheSize + 3> cache{};
+  std::array<uint32_t, ForsythCacheSize + 3> newCache{};
+  size_t cacheCount  = 0;
+  size_t inputCursor = 0;
+
+  IndicesArray result;
+  result.reserve(indices.size());
+
+  auto bestTriangle = static_cast<size_t>(
+    std::max_element(triangleScores.begin(), triangleScores.end()) - triangleScores.begin());
+  while (bestTriangle < triangleCount) {
+    const auto* triangleIndices = &indices[bestTriangle * 3];
+    result.insert(result.end(), triangleIndices, triangleIndices + 3);
+    emitted[bestTriangle] = true;
+
+    // Remove the triangle from the adjacency of its vertices
+    for (size_t corner = 0; corner < 3; ++corner) {
+      const auto vertex = triangleIndices[corner];
+      auto first        = adjacency.triangles.begin() + adjacency.offsets[vertex];
+      auto last         = first + remaining[vertex];
+      auto it           = std::find(first, last, static_cast<uint32_t>(bestTriangle));
+      std::iter_swap(it, last - 1);
+      --remaining[vertex];
+    }
+
+    // Move the vertices of the triangle to the front of the LRU cache
+    size_t newCacheCount = 0;
+    for (size_t corner = 0; corner < 3; ++corner) {
+      const auto vertex = triangleIndices[corner];
+      if (std::find(newCache.begin(), newCache.begin() + newCacheCount, vertex)
+          == newCache.begin() + newCacheCount) {
+        newCache[newCacheCount++] = vertex;
+      }
+    }
+    for (size_t i = 0; i < cacheCount; ++i) {
+      const auto vertex = cache[i];
+      if (vertex != triangleIndices[0] && vertex != triangleIndices[1]
+          && vertex != triangleIndices[2]) {
+        newCache[newCacheCount++] = vertex;
+      }
+    }
+
+    // Update the scores of the vertices in the cache, or pushed out of it, and of their triangles
+    for (size_t i = 0; i < newCacheCount; ++i) {
+      const auto vertex   = newCache[i];
+      const auto position = i < ForsythCacheSize ? static_cast<int>(i) : -1;
+      cachePositions[vertex] = position;
+
+      const auto score  = vertexScore(position, remaining[vertex]);
+      const auto delta  = score - vertexScores[vertex];
+      vertexScores[vertex] = score;
+      const auto offset = adjacency.offsets[vertex];
+      for (size_t j = 0; j < remaining[vertex]; ++j) {
+        triangleScores[adjacency.triangles[offset + j]] += delta;
+      }
+    }
+    cacheCount = std::min(newCacheCount, ForsythCacheSize);
+    std::swap(cache, newCache);
+
+    // The next triangle is the best scored one using a cached vertex
+    bestTriangle   = triangleCount;
+    auto bestScore = -1.f;
+    for (size_t i = 0; i < cacheCount; ++i) {
+      const auto vertex = cache[i];
+      const auto offset = adjacency.offsets[vertex];
+      for (size_t j = 0; j < remaining[vertex]; ++j) {
+        const auto triangle = adjacency.triangles[offset + j];
+        if (triangleScores[triangle] > bestScore) {
+          bestScore    = triangleScores[triangle];
+          bestTriangle = triangle;
+        }
+      }
+    }
+
+    // Dead end, continue with the next triangle in input order
+    if (bestTriangle == triangleCount) {
+      while (inputCursor < triangleCount && emitted[inputCursor]) {
+        ++inputCursor;
+      }
+      bestTriangle = inputCursor;
+    }
+  }
+
+  return result;
+}
+
+IndicesArray MeshOptimizer::OptimizeVertexCacheTipsify(const IndicesArray& indices,
+                                                       size_t vertexCount, unsigned int cacheSize)
+{
+  const auto triangleCount = indices.size() / 3;
+  if (triangleCount == 0) {
+    return indices;
+  }
+
+  TriangleAdjacency adjacency(indices, vertexCount);
+  auto& liveTriangles = adjacency.counts;
+
+  std::vector<uint32_t> cacheTimestamps(vertexCount, 0);
+  std::vector<uint32_t> deadEndStack;
+  deadEndStack.reserve(indices.size());
+  std::vector<bool> emitted(triangleCount, false);
+  std::vector<uint32_t> candidates;
+  uint32_t timestamp = cacheSize + 1;
+  size_t inputCursor = 0;
+
+  IndicesArray result;
+  result.reserve(indices.size());
+
+  // Returns the most recently referenced vertex having live triangles, or the next one in input
+  // order
+  const auto skipDeadEnd = [&]() -> int64_t {
+    while (!deadEndStack.empty()) {
+      const auto vertex = deadEndStack.back();
+      deadEndStack.pop_back();
+      if (liveTriangles[vertex] > 0) {
+        return vertex;
+      }
+    }
+    while (inputCursor < vertexCount) {
+      if (liveTriangles[inputCursor] > 0) {
+        return static_cast<int64_t>(inputCursor);
+      }
+      ++inputCursor;
+    }
+    return -1;
+  };
+
+  auto fanningVertex = skipDeadEnd();
+  while (fanningVertex >= 0) {
+    candidates.clear();
+
+    // Emit all the triangles of the fanning vertex
+    const auto first = adjacency.offsets[static_cast<size_t>(fanningVertex)];
+    const auto last  = adjacency.offsets[static_cast<size_t>(fanningVertex) + 1];
+    for (auto a = first; a < last; ++a) {
+      const auto triangle = adjacency.triangles[a];
+      if (emitted[triangle]) {
+        continue;
+      }
+
+      for (size_t corner = 0; corner < 3; ++corner) {
+        const auto vertex = indices[triangle * 3 + corner];
+        result.emplace_back(vertex);
+        deadEndStack.emplace_back(vertex);
+        candidates.emplace_back(vertex);
+        --liveTriangles[vertex];
+        if (timestamp - cacheTimestamps[vertex] > cacheSize) {
+          cacheTimestamps[vertex] = timestamp++;
+        }
+      }
+      emitted[triangle] = true;
+    }
+
+    // The next fanning vertex is the oldest candidate which will still be in the cache once all
+    // its triangles are emitted
+    int64_t nextVertex = -1;
+    uint32_t bestPriority = 0;
+    for (const auto vertex : candidates) {
+      if (liveTriangles[vertex] == 0) {
+        continue;
+      }
+      uint32_t priority = 0;
+      if (timestamp - cacheTimestamps[vertex] + 2 * liveTriangles[vertex] <= cacheSize) {
+        priority = timestamp - cacheTimestamps[vertex];
+      }
+      if (priority > bestPriority) {
+        bestPriority = priority;
+        nextVertex   = vertex;
+      }
+    }
+
+    fanningVertex = nextVertex >= 0 ? nextVertex : skipDeadEnd();
+  }
+
+  return result;
+}
+
+IndicesArray MeshOptimizer::OptimizeOverdraw(const IndicesArray& indices,
+                                             const Float32Array& positions, float threshold,
+                                             unsigned int cacheSize)
+{
+  const auto triangleCount = indices.size() / 3;
+  const auto vertexCount   = positions.size() / 3;
+  if (triangleCount < 2) {
+    return indices;
+  }
+
+  // Hard boundaries, where the vertex cache is entirely missed
+  FifoCache cache(vertexCount, cacheSize);
+  std::vector<size_t> hardClusters{0};
+  for (size_t triangle = 0; triangle < triangleCount; ++triangle) {
+    if (cache.accessTriangle(indices, triangle) == 3 && triangle > 0) {
+      hardClusters.emplace_back(triangle);
+    }
+  }
+
+  // Soft boundaries, splitting the hard clusters as soon as the ACMR of the current cluster is
+  // within the threshold
+  std::vector<size_t> clusters;
+  for (size_t i = 0; i < hardClusters.size(); ++i) {
+    const auto start = hardClusters[i];
+    const auto end   = i + 1 < hardClusters.size() ? hardClusters[i + 1] : triangleCount;
+
+    cache.reset();
+    size_t clusterMisses = 0;
+    for (auto triangle = start; triangle < end; ++triangle) {
+      clusterMisses += cache.accessTriangle(indices, triangle);
+    }
+    const auto clusterThreshold
+      = threshold * static_cast<float>(clusterMisses) / static_cast<float>(end - start);
+
+    cache.reset();
+    clusters.emplace_back(start);
+    size_t runningMisses = 0, runningTriangles = 0;
+    for (auto triangle = start; triangle < end; ++triangle) {
+      runningMisses += cache.accessTriangle(indices, triangle);
+      ++runningTriangles;
+      if (static_cast<float>(runningMisses) / static_cast<float>(runningTriangles)
+          <= clusterThreshold) {
+        clusters.emplace_back(triangle + 1);
+        cache.reset();
+        runningMisses = runningTriangles = 0;
+      }
+    }
+
+    // The last cluster is either empty or did not reach the threshold, merge it with the previous
+    // one
+    if (clusters.back() == end || clusters.back() > start) {
+      clusters.pop_back();
+    }
+  }
+
+  // Mesh centroid
+  std::array<double, 3> meshCentroid{0.0, 0.0, 0.0};
+  for (const auto index : indices) {
+    for (size_t c = 0; c < 3; ++c) {
+      meshCentroid[c] += positions[index * 3 + c];
+    }
+  }
+  for (auto& coordinate : meshCentroid) {
+    coordinate /= static_cast<double>(indices.size());
+  }
+
+  // Sort key of each cluster: distance of its centroid to the mesh centroid along its average
+  // normal, outward facing clusters being drawn first as they are likely to occlude the others
+  std::vector<float> sortKeys(clusters.size(), 0.f);
+  for (size_t i = 0; i < clusters.size(); ++i) {
+    const auto start = clusters[i];
+    const auto end   = i + 1 < clusters.size() ? clusters[i + 1] : triangleCount;
+
+    std::array<float, 3> centroid{0.f, 0.f, 0.f}, normal{0.f, 0.f, 0.f};
+    auto totalArea = 0.f;
+    for (auto triangle = start; triangle < end; ++triangle) {
+      const auto* p0 = &positions[indices[triangle * 3] * 3];
+      const auto* p1 = &positions[indices[triangle * 3 + 1] * 3];
+      const auto* p2 = &positions[indices[triangle * 3 + 2] * 3];
+
+      // Same orientation as the face normals computed by VertexData::ComputeNormals
+      const std::array<float, 3> p0p1{p0[0] - p1[0], p0[1] - p1[1], p0[2] - p1[2]};
+      const std::array<float, 3> p2p1{p2[0] - p1[0], p2[1] - p1[1], p2[2] - p1[2]};
+      const std::array<float, 3> cross{p0p1[1] * p2p1[2] - p0p1[2] * p2p1[1],
+                                       p0p1[2] * p2p1[0] - p0p1[0] * p2p1[2],
+                                       p0p1[0] * p2p1[1] - p0p1[1] * p2p1[0]};
+      const auto area = std::sqrt(cross[0] * cross[0] + cross[1] * cross[1] + cross[2] * cross[2]);
+      for (size_t c = 0; c < 3; ++c) {
+        centroid[c] += area * (p0[c] + p1[c] + p2[c]) / 3.f;
+        normal[c] += cross[c];
+      }
+      totalArea += area;
+    }
+
+    const auto normalLength
+      = std::sqrt(normal[0] * normal[0] + normal[1] * normal[1] + normal[2] * normal[2]);
+    if (totalArea > 0.f && normalLength > 0.f) {
+      for (size_t c = 0; c < 3; ++c) {
+        sortKeys[i] += (centroid[c] / totalArea - static_cast<float>(meshCentroid[c])) * normal[c]
+                       / normalLength;
+      }
+    }
+  }
+
+  std::vector<size_t> clusterOrder(clusters.size());
+  std::iota(clusterOrder.begin(), clusterOrder.end(), 0);
+  std::stable_sort(clusterOrder.begin(), clusterOrder.end(),
+                   [&sortKeys](size_t a, size_t b) { return sortKeys[a] > sortKeys[b]; });
+
+  IndicesArray result;
+  result.reserve(indices.size());
+  for (const auto cluster : clusterOrder) {
+    const auto start = clusters[cluster] * 3;
+    const auto end   = cluster + 1 < clusters.size() ? clusters[cluster + 1] * 3 : indices.size();
+    result.insert(result.end(), indices.begin() + static_cast<std::ptrdiff_t>(start),
+                  indices.begin() + static_cast<std::ptrdiff_t>(end));
+  }
+
+  return result;
+}
+
+size_t MeshOptimizer::GenerateVertexRemap(const std::vector<const Float32Array*>& streams,
+                                          size_t vertexCount, Uint32Array& remap)
+{
+  remap.assign(vertexCount, InvalidIndex);
+  if (vertexCount == 0) {
+    return 0;
+  }
+
+  std::vector<size_t> componentCounts;
+  for (const auto* stream : streams) {
+    componentCounts.emplace_back(stream->size() / vertexCount);
+  }
+
+  // Vertices are compared bitwise, 64-bit FNV-1a over the attributes bytes
+  const auto hash = [&](uint32_t vertex) {
+    uint64_t result = 0xcbf29ce484222325ull;
+    for (size_t s = 0; s < streams.size(); ++s) {
+      const auto* bytes = reinterpret_cast<const uint8_t*>(streams[s]->data()
+                                                           + vertex * componentCounts[s]);
+      for (size_t b = 0; b < componentCounts[s] * sizeof(float); ++b) {
+        result ^= bytes[b];
+        result *= 0x100000001b3ull;
+      }
+    }
+    return static_cast<size_t>(result);
+  };
+  const auto equal = [&](uint32_t a, uint32_t b) {
+    for (size_t s = 0; s < streams.size(); ++s) {
+      const auto* data = streams[s]->data();
+      if (std::memcmp(data + a * componentCounts[s], data + b * componentCounts[s],
+                      componentCounts[s] * sizeof(float))
+          != 0) {
+        return false;
+      }
+    }
+    return true;
+  };
+
+  std::unordered_set<uint32_t, decltype(hash), decltype(equal)> uniqueVertices(vertexCount, hash,
+                                                                               equal);
+  uint32_t uniqueVertexCount = 0;
+  for (uint32_t vertex = 0; vertex < vertexCount; ++vertex) {
+    const auto [it, inserted] = uniqueVertices.insert(vertex);
+    remap[vertex]             = inserted ? uniqueVertexCount++ : remap[*it];
+  }
+
+  return uniqueVertexCount;
+}
+
+size_t MeshOptimizer::GenerateVertexFetchRemap(const IndicesArray& indices, size_t vertexCount,
+                                               Uint32Array& remap)
+{
+  remap.assign(vertexCount, InvalidIndex);
+
+  uint32_t usedVertexCount = 0;
+  for (const auto index : indices) {
+    if (remap[index] == InvalidIndex) {
+      remap[index] = usedVertexCount++;
+    }
+  }
+
+  return usedVertexCount;
+}
+
+void MeshOptimizer::ApplyVertexRemap(const Uint32Array& remap, size_t newVertexCount,
+                                     IndicesArray& indices,
+                                     const std::vector<Float32Array*>& streams)
+{
+  const auto vertexCount = remap.size();
+  for (auto& index : indices) {
+    index = remap[index];
+  }
+
+  for (auto* stream : streams) {
+    if (vertexCount == 0) {
+      continue;
+    }
+    const auto componentCount = stream->size() / vertexCount;
+    Float32Array remapped(newVertexCount * componentCount);
+    for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+      if (remap[vertex] != InvalidIndex) {
+        std::copy_n(stream->begin() + static_cast<std::ptrdiff_t>(vertex * componentCount),
+                    componentCount,
+                    remapped.begin() + static_cast<std::ptrdiff_t>(remap[vertex] * componentCount));
+      }
+    }
+    *stream = std::move(remapped);
+  }
+}
+
+} // end of namespace BABYLON
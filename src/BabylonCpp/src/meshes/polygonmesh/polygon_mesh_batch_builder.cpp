@@ -0,0 +1,396 @@
+#include <babylon/meshes/polygonmesh/polygon_mesh_batch_builder.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+
+#include <babylon/babylon_constants.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/engine.h>
+#include <babylon/maths/scalar.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+#ifdef __GNUC__
+#pragma GCC diagnostic push
+// Conversion from int to char
+#pragma GCC diagnostic ignored "-Wconversion"
+#if __GNUC__ > 6
+// Use of GNU statement expression extension
+#endif
+#endif
+#if _MSC_VER && !__INTEL_COMPILER
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+#include <earcut.hpp>
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+#ifdef __GNUC__
+#pragma GCC diagnostic pop
+#endif
+
+namespace BABYLON {
+
+namespace {
+
+// Number of polygons triangulated and written by a parallel task
+constexpr size_t ChunkSize = 64;
+
+/**
+ * @brief Ring of a polygon read by earcut directly from the interleaved coordinates.
+ */
+struct RingView {
+  using value_type = std::array<float, 2>;
+
+  const float* coordinates;
+  size_t count;
+
+  [[nodiscard]] size_t size() const
+  {
+    return count;
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return count == 0;
+  }
+
+  value_type operator[](size_t index) const
+  {
+    return {{coordinates[2 * index], coordinates[2 * index + 1]}};
+  }
+}; // end of struct RingView
+
+/**
+ * @brief Writes the vertices and indices of a polygon at its range in the shared buffers.
+ */
+struct PolygonWriter {
+  float* positions;
+  float* normals;
+  float* uvs;
+  uint32_t* indices;
+  // Index in the shared buffers of the next vertex
+  uint32_t vertex;
+
+  void addVertex(float x, float y, float z, float nx, float ny, float nz, float u, float v)
+  {
+    *positions++ = x;
+    *positions++ = y;
+    *positions++ = z;
+    *normals++   = nx;
+    *normals++   = ny;
+    *normals++   = nz;
+    *uvs++       = u;
+    *uvs++       = v;
+    ++vertex;
+  }
+
+  void addTriangle(uint32_t i0, uint32_t i1, uint32_t i2)
+  {
+    *indices++ = i0;
+    *indices++ = i1;
+    *indices++ = i2;
+  }
+
+  // Adds the sides of a ring, as PolygonMeshBuilder::addSide does
+  void addSide(const float* points, size_t count, float depth, float width, bool flip)
+  {
+    float ulength = 0.f;
+    for (size_t i = 0; i < count; ++i) {
+      const auto j  = (i + 1 < count) ? i + 1 : 0;
+      const auto x0 = points[2 * i], y0 = points[2 * i + 1];
+      const auto x1 = points[2 * j], y1 = points[2 * j + 1];
+
+      // Cross product of the edge with the up vector
+      const auto dx     = x1 - x0;
+      const auto dz     = y1 - y0;
+      const auto length = std::sqrt(dx * dx + dz * dz);
+      auto nx = -dz, nz = dx;
+      if (length != 0.f) {
+        nx /= length;
+        nz /= length;
+      }
+      if (!flip) {
+        nx = -nx;
+        nz = -nz;
+      }
+
+      const auto u0 = ulength / width;
+      ulength += length;
+      const auto u1 = ulength / width;
+
+      const auto base = vertex;
+      addVertex(x0, 0.f, y0, nx, 0.f, nz, u0, 0.f);
+      addVertex(x0, -depth, y0, nx, 0.f, nz, u0, 1.f);
+      addVertex(x1, 0.f, y1, nx, 0.f, nz, u1, 0.f);
+      addVertex(x1, -depth, y1, nx, 0.f, nz, u1, 1.f);
+
+      if (!flip) {
+        addTriangle(base + 0, base + 1, base + 2);
+        addTriangle(base + 1, base + 3, base + 2);
+      }
+      else {
+        addTriangle(base + 0, base + 2, base + 1);
+        addTriangle(base + 1, base + 2, base + 3);
+      }
+    }
+  }
+}; // end of struct PolygonWriter
+
+} // end of anonymous namespace
+
+PolygonMeshBatchBuilder::PolygonMeshBatchBuilder(const std::string& name, Scene* scene)
+    : _name{name}
+{
+  _scene = scene ? scene : Engine::LastCreatedScene();
+}
+
+PolygonMeshBatchBuilder::~PolygonMeshBatchBuilder() = default;
+
+void PolygonMeshBatchBuilder::reserve(size_t polygonCount, size_t pointCount)
+{
+  _polygons.reserve(polygonCount);
+  _coordinates.reserve(2 * pointCount);
+}
+
+size_t PolygonMeshBatchBuilder::addPolygon(const Float32Array& coordinates,
+                                           const Uint32Array& holeIndices, float depth)
+{
+  PolygonEntry entry{_coordinates.size() / 2, 0, _holeIndices.size(), 0, depth};
+  const auto pointCount = coordinates.size() / 2;
+  size_t start          = 0;
+  for (size_t ring = 0; ring <= holeIndices.size(); ++ring) {
+    auto end = pointCount;
+    if (ring < holeIndices.size()) {
+      end = std::clamp<size_t>(holeIndices[ring], start, pointCount);
+    }
+    const auto ringStart = _coordinates.size();
+    _coordinates.insert(_coordinates.end(), coordinates.begin() + static_cast<long>(2 * start),
+                        coordinates.begin() + static_cast<long>(2 * end));
+    _endRing(entry, ringStart, ring > 0);
+    start = end;
+  }
+  _polygons.emplace_back(entry);
+
+  return _polygons.size() - 1;
+}
+
+size_t PolygonMeshBatchBuilder::addPolygon(const std::vector<Vector2>& contour,
+                                           const std::vector<std::vector<Vector2>>& holes,
+                                           float depth)
+{
+  PolygonEntry entry{_coordinates.size() / 2, 0, _holeIndices.size(), 0, depth};
+  for (size_t ring = 0; ring <= holes.size(); ++ring) {
+    const auto ringStart = _coordinates.size();
+    for (const auto& point : ring == 0 ? contour : holes[ring - 1]) {
+      _coordinates.insert(_coordinates.end(), {point.x, point.y});
+    }
+    _endRing(entry, ringStart, ring > 0);
+  }
+  _polygons.emplace_back(entry);
+
+  return _polygons.size() - 1;
+}
+
+void PolygonMeshBatchBuilder::_endRing(PolygonEntry& entry, size_t ringStart, bool isHole)
+{
+  auto count = (_coordinates.size() - ringStart) / 2;
+  if (count > 1) {
+    const auto last = _coordinates.size() - 2;
+    if (Scalar::WithinEpsilon(_coordinates[ringStart], _coordinates[last], Math::Epsilon)
+        && Scalar::WithinEpsilon(_coordinates[ringStart + 1], _coordinates[last + 1],
+                                 Math::Epsilon)) {
+      _coordinates.resize(last);
+      --count;
+    }
+  }
+
+  if (isHole) {
+    if (count == 0) {
+      return;
+    }
+    _holeIndices.emplace_back(static_cast<uint32_t>(entry.pointCount));
+    ++entry.holeCount;
+  }
+  entry.pointCount += count;
+}
+
+size_t PolygonMeshBatchBuilder::polygonCount() const
+{
+  return _polygons.size();
+}
+
+void PolygonMeshBatchBuilder::clear()
+{
+  _coordinates.clear();
+  _holeIndices.clear();
+  _polygons.clear();
+  _ranges.clear();
+}
+
+MeshPtr PolygonMeshBatchBuilder::build(bool updatable, bool createSubMeshes, bool addPolygonIds)
+{
+  auto result = Mesh::New(_name, _scene);
+
+  const auto vertexData    = buildVertexData();
+  const auto totalVertices = vertexData->positions.size() / 3;
+
+  result->setVerticesData(VertexBuffer::PositionKind, vertexData->positions, updatable);
+  result->setVerticesData(VertexBuffer::NormalKind, vertexData->normals, updatable);
+  result->setVerticesData(VertexBuffer::UVKind, vertexData->uvs, updatable);
+  if (addPolygonIds) {
+    Float32Array polygonIds(totalVertices);
+    for (size_t i = 0; i < _ranges.size(); ++i) {
+      const auto start = polygonIds.begin() + static_cast<long>(_ranges[i].verticesStart);
+      std::fill(start, start + static_cast<long>(_ranges[i].verticesCount),
+                static_cast<float>(i));
+    }
+    result->setVerticesData(PolygonIdKind, polygonIds, updatable, 1);
+  }
+  result->setIndices(vertexData->indices, totalVertices);
+
+  if (createSubMeshes) {
+    result->releaseSubMeshes();
+    for (const auto& range : _ranges) {
+      SubMesh::AddToMesh(0, range.verticesStart, range.verticesCount, range.indexStart,
+                         range.indexCount, result);
+    }
+  }
+
+  return result;
+}
+
+std::unique_ptr<VertexData> PolygonMeshBatchBuilder::buildVertexData()
+{
+  const auto polygonCount = _polygons.size();
+  const auto chunkCount   = (polygonCount + ChunkSize - 1) / ChunkSize;
+  auto& threadPool        = ThreadPool::Default();
+
+  // Triangulate the caps, the indices of the polygons of a chunk being stored one after the other
+  std::vector<Uint32Array> chunkCapIndices(chunkCount);
+  std::vector<size_t> capIndexCounts(polygonCount);
+  threadPool.parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+    std::vector<RingView> rings;
+    for (auto chunk = begin; chunk < end; ++chunk) {
+      const auto last = std::min((chunk + 1) * ChunkSize, polygonCount);
+      for (auto i = chunk * ChunkSize; i < last; ++i) {
+        const auto& polygon = _polygons[i];
+        const auto* points  = _coordinates.data() + 2 * polygon.pointStart;
+        const auto* holes   = _holeIndices.data() + polygon.holeStart;
+        // Earcut.hpp has no 'holes' argument, adding the holes to the input array
+        rings.clear();
+        for (size_t ring = 0; ring <= polygon.holeCount; ++ring) {
+          const size_t start = ring == 0 ? 0 : holes[ring - 1];
+          const size_t end   = ring < polygon.holeCount ? holes[ring] : polygon.pointCount;
+          rings.emplace_back(RingView{points + 2 * start, end - start});
+        }
+        const auto capIndices = mapbox::earcut<uint32_t>(rings); // NOLINT
+        chunkCapIndices[chunk].insert(chunkCapIndices[chunk].end(), capIndices.begin(),
+                                      capIndices.end());
+        capIndexCounts[i] = capIndices.size();
+      }
+    }
+  });
+
+  // Place the polygons in the shared buffers
+  _ranges.resize(polygonCount);
+  size_t totalVertices = 0, totalIndices = 0;
+  for (size_t i = 0; i < polygonCount; ++i) {
+    const auto& polygon = _polygons[i];
+    const auto extruded = polygon.depth > 0.f;
+    auto& range         = _ranges[i];
+    range.verticesStart = static_cast<unsigned int>(totalVertices);
+    range.indexStart    = static_cast<unsigned int>(totalIndices);
+    // Top cap, then bottom cap and 4 vertices per side
+    range.verticesCount = polygon.pointCount * (extruded ? 6 : 1);
+    range.indexCount    = extruded ? 2 * capIndexCounts[i] + 6 * polygon.pointCount :
+                                     capIndexCounts[i];
+    totalVertices += range.verticesCount;
+    totalIndices += range.indexCount;
+  }
+
+  auto result = std::make_unique<VertexData>();
+  result->positions.resize(3 * totalVertices);
+  result->normals.resize(3 * totalVertices);
+  result->uvs.resize(2 * totalVertices);
+  result->indices.resize(totalIndices);
+
+  // Write the geometry of each polygon, as PolygonMeshBuilder::buildVertexData does
+  threadPool.parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+    for (auto chunk = begin; chunk < end; ++chunk) {
+      const auto* capIndices = chunkCapIndices[chunk].data();
+      const auto last        = std::min((chunk + 1) * ChunkSize, polygonCount);
+      for (auto i = chunk * ChunkSize; i < last; ++i) {
+        const auto& polygon = _polygons[i];
+        const auto& range   = _ranges[i];
+        const auto* points  = _coordinates.data() + 2 * polygon.pointStart;
+        const auto* holes   = _holeIndices.data() + polygon.holeStart;
+        const auto count    = polygon.pointCount;
+        const auto depth    = polygon.depth;
+
+        PolygonWriter writer{result->positions.data() + 3 * range.verticesStart,
+                             result->normals.data() + 3 * range.verticesStart,
+                             result->uvs.data() + 2 * range.verticesStart,
+                             result->indices.data() + range.indexStart, range.verticesStart};
+
+        auto minX = count > 0 ? points[0] : 0.f, maxX = minX;
+        auto minY = count > 0 ? points[1] : 0.f, maxY = minY;
+        for (size_t p = 1; p < count; ++p) {
+          minX = std::min(minX, points[2 * p]);
+          maxX = std::max(maxX, points[2 * p]);
+          minY = std::min(minY, points[2 * p + 1]);
+          maxY = std::max(maxY, points[2 * p + 1]);
+        }
+        // Degenerate polygons get constant uvs rather than NaNs
+        const auto width  = maxX > minX ? maxX - minX : 1.f;
+        const auto height = maxY > minY ? maxY - minY : 1.f;
+
+        for (size_t p = 0; p < count; ++p) {
+          const auto x = points[2 * p], y = points[2 * p + 1];
+          writer.addVertex(x, 0.f, y, 0.f, 1.f, 0.f, (x - minX) / width, (y - minY) / height);
+        }
+        const auto topStart      = range.verticesStart;
+        const auto capIndexCount = capIndexCounts[i];
+        for (size_t k = 0; k < capIndexCount; k += 3) {
+          writer.addTriangle(capIndices[k] + topStart, capIndices[k + 1] + topStart,
+                             capIndices[k + 2] + topStart);
+        }
+
+        if (depth > 0.f) {
+          for (size_t p = 0; p < count; ++p) {
+            const auto x = points[2 * p], y = points[2 * p + 1];
+            writer.addVertex(x, -depth, y, 0.f, -1.f, 0.f, 1.f - (x - minX) / width,
+                             1.f - (y - minY) / height);
+          }
+          const auto bottomStart = topStart + static_cast<uint32_t>(count);
+          for (size_t k = 0; k < capIndexCount; k += 3) {
+            writer.addTriangle(capIndices[k + 2] + bottomStart, capIndices[k + 1] + bottomStart,
+                               capIndices[k] + bottomStart);
+          }
+
+          // Add the sides, the holes facing inwards
+          for (size_t ring = 0; ring <= polygon.holeCount; ++ring) {
+            const size_t start = ring == 0 ? 0 : holes[ring - 1];
+            const size_t end   = ring < polygon.holeCount ? holes[ring] : count;
+            writer.addSide(points + 2 * start, end - start, depth, width, ring > 0);
+          }
+        }
+        capIndices += capIndexCount;
+      }
+    }
+  });
+
+  return result;
+}
+
+const std::vector<PolygonMeshBatchRange>& PolygonMeshBatchBuilder::ranges() const
+{
+  return _ranges;
+}
+
+} // end of namespace BABYLON
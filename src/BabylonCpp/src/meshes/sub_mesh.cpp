@@ -120,7 +120,7 @@ MaterialPtr SubMesh::getMaterial()
 }
 
 // Methods
-SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
+SubMesh& SubMesh::refreshBoundingInfo(const ConstFloat32ArrayView& iData)
 {
   _lastColliderWorldVertices.clear();
 
@@ -128,14 +128,22 @@ SubMesh& SubMesh::refreshBoundingInfo(const Float32Array& iData)
     return *this;
   }
 
-  auto data = !iData.empty() ? iData : _renderingMesh->getVerticesData(VertexBuffer::PositionKind);
+  auto data = iData;
+  Float32Array copy;
+  if (data.empty()) {
+    data = _renderingMesh->getVerticesDataView(VertexBuffer::PositionKind);
+  }
+  if (data.empty()) {
+    copy = _renderingMesh->getVerticesData(VertexBuffer::PositionKind);
+    data = copy;
+  }
 
   if (data.empty()) {
     _boundingInfo = std::make_unique<BoundingInfo>(*_mesh->_boundingInfo);
     return *this;
   }
 
-  auto indices = _renderingMesh->getIndices();
+  auto indices = _renderingMesh->getIndicesView();
   MinMax extend;
 
   // Is this the only submesh?
@@ -215,7 +223,8 @@ SubMesh& SubMesh::render(bool enableAlphaMode)
   return *this;
 }
 
-WebGLDataBufferPtr& SubMesh::_getLinesIndexBuffer(const IndicesArray& indices, Engine* engine)
+WebGLDataBufferPtr& SubMesh::_getLinesIndexBuffer(const ConstIndicesArrayView& indices,
+                                                  Engine* engine)
 {
   if (!_linesIndexBuffer) {
     Uint32Array linesIndices;
@@ -243,8 +252,9 @@ bool SubMesh::canIntersects(const Ray& ray)
 }
 
 std::optional<IntersectionInfo>
-SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint32Array& indices,
-                    bool fastCheck, const TrianglePickingPredicate& trianglePredicate)
+SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions,
+                    const ConstIndicesArrayView& indices, bool fastCheck,
+                    const TrianglePickingPredicate& trianglePredicate)
 {
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
@@ -284,7 +294,8 @@ SubMesh::intersects(Ray& ray, const std::vector<Vector3>& positions, const Uint3
 
 std::optional<IntersectionInfo>
 SubMesh::_intersectLines(Ray& ray, const std::vector<Vector3>& positions,
-                         const IndicesArray& indices, float intersectionThreshold, bool fastCheck)
+                         const ConstIndicesArrayView& indices, float intersectionThreshold,
+                         bool fastCheck)
 {
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
@@ -312,8 +323,8 @@ SubMesh::_intersectLines(Ray& ray, const std::vector<Vector3>& positions,
 
 std::optional<IntersectionInfo>
 SubMesh::_intersectUnIndexedLines(Ray& ray, const std::vector<Vector3>& positions,
-                                  const IndicesArray& /*indices*/, float intersectionThreshold,
-                                  bool fastCheck)
+                                  const ConstIndicesArrayView& /*indices*/,
+                                  float intersectionThreshold, bool fastCheck)
 {
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
 
@@ -341,7 +352,7 @@ SubMesh::_intersectUnIndexedLines(Ray& ray, const std::vector<Vector3>& position
 
 std::optional<IntersectionInfo>
 SubMesh::_intersectTriangles(Ray& ray, const std::vector<Vector3>& positions,
-                             const IndicesArray& indices, bool fastCheck,
+                             const ConstIndicesArrayView& indices, bool fastCheck,
                              const TrianglePickingPredicate& trianglePredicate)
 {
   if (positions.empty())
@@ -382,7 +393,7 @@ SubMesh::_intersectTriangles(Ray& ray, const std::vector<Vector3>& positions,
 
 std::optional<IntersectionInfo>
 SubMesh::_intersectUnIndexedTriangles(Ray& ray, const std::vector<Vector3>& positions,
-                                      const IndicesArray& /*indices*/, bool fastCheck,
+                                      const ConstIndicesArrayView& /*indices*/, bool fastCheck,
                                       const TrianglePickingPredicate& trianglePredicate)
 {
   std::optional<IntersectionInfo> intersectInfo = std::nullopt;
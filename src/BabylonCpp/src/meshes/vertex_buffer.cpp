@@ -1,8 +1,13 @@
 ﻿#include <babylon/meshes/vertex_buffer.h>
 
+#include <cstring>
+
 #include <babylon/core/data_view.h>
 #include <babylon/engines/engine.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
 #include <babylon/meshes/buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
 #include <babylon/misc/string_tools.h>
 
 namespace BABYLON {
@@ -15,6 +20,8 @@ VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buff
                            std::optional<unsigned int> iType, bool iNormalized, bool useBytes,
                            unsigned int divisor)
     : instanceDivisor{this, &VertexBuffer::get_instanceDivisor, &VertexBuffer::set_instanceDivisor}
+    , octahedralEncoded{false}
+    , dequantizationMatrix{nullptr}
 {
   if (std::holds_alternative<Buffer*>(data)) {
     _buffer      = std::get<Buffer*>(data);
@@ -25,7 +32,7 @@ VertexBuffer::VertexBuffer(Engine* engine, const std::variant<Float32Array, Buff
     _ownedBuffer = std::make_unique<Buffer>(
       engine, std::get<Float32Array>(data), updatable, stride,
       postponeInternalCreation.has_value() ? *postponeInternalCreation : false,
-      instanced.has_value() ? *instanced : false);
+      instanced.has_value() ? *instanced : false, useBytes);
     _buffer     = nullptr;
     _ownsBuffer = true;
   }
@@ -132,6 +139,11 @@ size_t VertexBuffer::getSize() const
   return _size;
 }
 
+size_t VertexBuffer::getDecodedSize() const
+{
+  return octahedralEncoded ? _size + 1 : _size;
+}
+
 bool VertexBuffer::getIsInstanced() const
 {
   return _instanced;
@@ -174,8 +186,45 @@ void VertexBuffer::dispose()
 void VertexBuffer::forEach(size_t count,
                            const std::function<void(float value, size_t index)>& callback)
 {
-  VertexBuffer::ForEach(_buffer->getData(), byteOffset, byteStride, _size, type, count, normalized,
-                        callback);
+  VertexBuffer::ForEach(_getBuffer()->getData(), byteOffset, byteStride, _size, type, count,
+                        normalized, callback);
+}
+
+Float32Array VertexBuffer::getFloatData(size_t totalVertices)
+{
+  const auto decodedSize = getDecodedSize();
+  Float32Array result(totalVertices * decodedSize);
+
+  if (!octahedralEncoded) {
+    forEach(totalVertices * _size, [&result](float value, size_t index) { result[index] = value; });
+  }
+  else {
+    // Expand the 2 components of the octahedral mapping to the unit vector, the extra components
+    // (bitangent sign) being kept as is
+    Float32Array encoded(totalVertices * _size);
+    forEach(totalVertices * _size,
+            [&encoded](float value, size_t index) { encoded[index] = value; });
+    for (size_t vertex = 0; vertex < totalVertices; ++vertex) {
+      const auto* source = &encoded[vertex * _size];
+      auto* destination  = &result[vertex * decodedSize];
+      VertexQuantization::OctahedralDecode(source[0], source[1], destination);
+      std::copy(source + 2, source + _size, destination + 3);
+    }
+  }
+
+  if (dequantizationMatrix && decodedSize >= 3) {
+    Vector3 decoded;
+    for (size_t index = 0; index + 2 < result.size(); index += decodedSize) {
+      Vector3::TransformCoordinatesFromFloatsToRef(result[index], result[index + 1],
+                                                   result[index + 2], *dequantizationMatrix,
+                                                   decoded);
+      result[index]     = decoded.x;
+      result[index + 1] = decoded.y;
+      result[index + 2] = decoded.z;
+    }
+  }
+
+  return result;
 }
 
 size_t VertexBuffer::DeduceStride(const std::string& kind)
@@ -209,6 +258,7 @@ unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
       return 1;
     case VertexBuffer::SHORT:
     case VertexBuffer::UNSIGNED_SHORT:
+    case VertexBuffer::HALF_FLOAT:
       return 2;
     case VertexBuffer::INT:
     case VertexBuffer::UNSIGNED_INT:
@@ -220,17 +270,37 @@ unsigned int VertexBuffer::GetTypeByteLength(unsigned int type)
 }
 
 void VertexBuffer::ForEach(const Float32Array& data, size_t byteOffset, size_t byteStride,
-                           size_t componentCount, unsigned int /*componentType*/, size_t count,
-                           bool /*normalized*/,
+                           size_t componentCount, unsigned int componentType, size_t count,
+                           bool normalized,
                            const std::function<void(float value, size_t index)>& callback)
 {
-  auto offset = byteOffset / 4;
-  auto stride = byteStride / 4;
+  if (componentType == VertexBuffer::FLOAT && byteOffset % 4 == 0 && byteStride % 4 == 0) {
+    auto offset = byteOffset / 4;
+    auto stride = byteStride / 4;
+    for (size_t index = 0; index < count; index += componentCount) {
+      for (size_t componentIndex = 0; componentIndex < componentCount; componentIndex++) {
+        callback(data[offset + componentIndex], index + componentIndex);
+      }
+      offset += stride;
+    }
+    return;
+  }
+
+  // Compact formats are stored as raw bytes in the float storage
+  const auto bytes               = reinterpret_cast<const uint8_t*>(data.data());
+  const auto byteLength          = data.size() * sizeof(float);
+  const auto componentByteLength = VertexBuffer::GetTypeByteLength(componentType);
   for (size_t index = 0; index < count; index += componentCount) {
+    auto componentByteOffset = byteOffset;
     for (size_t componentIndex = 0; componentIndex < componentCount; componentIndex++) {
-      callback(data[offset + componentIndex], index + componentIndex);
+      if (componentByteOffset + componentByteLength > byteLength) {
+        return;
+      }
+      callback(VertexBuffer::_GetFloatValue(bytes + componentByteOffset, componentType, normalized),
+               index + componentIndex);
+      componentByteOffset += componentByteLength;
     }
-    offset += stride;
+    byteOffset += byteStride;
   }
 }
 
@@ -296,6 +366,52 @@ float VertexBuffer::_GetFloatValue(const DataView& dataView, unsigned int type,
     case VertexBuffer::FLOAT: {
       return dataView.getFloat32(byteOffset, true);
     }
+    case VertexBuffer::HALF_FLOAT: {
+      return VertexQuantization::FromHalfFloat(dataView.getUint16(byteOffset, true));
+    }
+    default: {
+      throw std::runtime_error("Invalid component type " + std::to_string(type));
+    }
+  }
+}
+
+float VertexBuffer::_GetFloatValue(const uint8_t* bytes, unsigned int type, bool normalized)
+{
+  // The storage uses the native (little endian) byte order
+  const auto read = [bytes](auto value) {
+    std::memcpy(&value, bytes, sizeof(value));
+    return value;
+  };
+
+  switch (type) {
+    case VertexBuffer::BYTE: {
+      auto value = static_cast<float>(read(int8_t{}));
+      return normalized ? std::max(value / 127.f, -1.f) : value;
+    }
+    case VertexBuffer::UNSIGNED_BYTE: {
+      auto value = static_cast<float>(read(uint8_t{}));
+      return normalized ? value / 255.f : value;
+    }
+    case VertexBuffer::SHORT: {
+      auto value = static_cast<float>(read(int16_t{}));
+      return normalized ? std::max(value / 32767.f, -1.f) : value;
+    }
+    case VertexBuffer::UNSIGNED_SHORT: {
+      auto value = static_cast<float>(read(uint16_t{}));
+      return normalized ? value / 65535.f : value;
+    }
+    case VertexBuffer::INT: {
+      return static_cast<float>(read(int32_t{}));
+    }
+    case VertexBuffer::UNSIGNED_INT: {
+      return static_cast<float>(read(uint32_t{}));
+    }
+    case VertexBuffer::FLOAT: {
+      return read(float{});
+    }
+    case VertexBuffer::HALF_FLOAT: {
+      return VertexQuantization::FromHalfFloat(read(uint16_t{}));
+    }
     default: {
       throw std::runtime_error("Invalid component type " + std::to_string(type));
     }
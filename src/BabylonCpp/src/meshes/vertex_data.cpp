@@ -1,7 +1,10 @@
 #include <babylon/meshes/vertex_data.h>
 
+#include <numeric>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/core/json_util.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/maths/axis.h>
 #include <babylon/maths/vector2.h>
@@ -3254,34 +3257,10 @@ std::unique_ptr<VertexData> VertexData::CreateTorusKnot(TorusKnotOptions& option
 
 // Tools
 
-void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array& indices,
-                                Float32Array& normals, std::optional<FacetParameters> options)
+void VertexData::ComputeNormals(const ConstFloat32ArrayView& positions,
+                                const ConstIndicesArrayView& indices, Float32Array& normals,
+                                FacetParameters* options)
 {
-  if (normals.size() < positions.size()) {
-    normals.resize(positions.size());
-  }
-
-  // temporary scalar variables
-  uint32_t index                    = 0;   // facet index
-  float p1p2x                       = 0.f; // p1p2 vector x coordinate
-  float p1p2y                       = 0.f; // p1p2 vector y coordinate
-  float p1p2z                       = 0.f; // p1p2 vector z coordinate
-  float p3p2x                       = 0.f; // p3p2 vector x coordinate
-  float p3p2y                       = 0.f; // p3p2 vector y coordinate
-  float p3p2z                       = 0.f; // p3p2 vector z coordinate
-  float faceNormalx                 = 0.f; // facet normal x coordinate
-  float faceNormaly                 = 0.f; // facet normal y coordinate
-  float faceNormalz                 = 0.f; // facet normal z coordinate
-  float length                      = 0.f; // facet normal length before normalization
-  uint32_t v1x                      = 0;   // vector1 x index in the positions array
-  uint32_t v1y                      = 0;   // vector1 y index in the positions array
-  uint32_t v1z                      = 0;   // vector1 z index in the positions array
-  uint32_t v2x                      = 0;   // vector2 x index in the positions array
-  uint32_t v2y                      = 0;   // vector2 y index in the positions array
-  uint32_t v2z                      = 0;   // vector2 z index in the positions array
-  uint32_t v3x                      = 0;   // vector3 x index in the positions array
-  uint32_t v3y                      = 0;   // vector3 y index in the positions array
-  uint32_t v3z                      = 0;   // vector3 z index in the positions array
   bool computeFacetNormals          = false;
   bool computeFacetPositions        = false;
   bool computeFacetPartitioning     = false;
@@ -3289,7 +3268,6 @@ void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array
   float faceNormalSign              = 1.f;
   float ratio                       = 0.f;
   std::optional<Vector3> distanceTo = std::nullopt;
-  std::vector<DepthSortedFacet> depthSortedFacets;
   if (options) {
     computeFacetNormals      = !options->facetNormals.empty();
     computeFacetPositions    = !options->facetPositions.empty();
@@ -3302,34 +3280,18 @@ void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array
       if (!distanceTo.has_value()) {
         distanceTo = Vector3::Zero();
       }
-      depthSortedFacets = options->depthSortedFacets;
     }
   }
 
+  const auto nbFaces    = indices.size() / 3;
+  const auto nbVertices = positions.size() / 3;
+
   // facetPartitioning reinit if needed
   float xSubRatio = 0.f;
   float ySubRatio = 0.f;
   float zSubRatio = 0.f;
   uint32_t subSq  = 0;
-
-  uint32_t ox           = 0; // X partitioning index for facet position
-  uint32_t oy           = 0; // Y partinioning index for facet position
-  uint32_t oz           = 0; // Z partinioning index for facet position
-  uint32_t b1x          = 0; // X partitioning index for facet v1 vertex
-  uint32_t b1y          = 0; // Y partitioning index for facet v1 vertex
-  uint32_t b1z          = 0; // z partitioning index for facet v1 vertex
-  uint32_t b2x          = 0; // X partitioning index for facet v2 vertex
-  uint32_t b2y          = 0; // Y partitioning index for facet v2 vertex
-  uint32_t b2z          = 0; // Z partitioning index for facet v2 vertex
-  uint32_t b3x          = 0; // X partitioning index for facet v3 vertex
-  uint32_t b3y          = 0; // Y partitioning index for facet v3 vertex
-  uint32_t b3z          = 0; // Z partitioning index for facet v3 vertex
-  uint32_t block_idx_o  = 0; // facet barycenter block index
-  uint32_t block_idx_v1 = 0; // v1 vertex block index
-  uint32_t block_idx_v2 = 0; // v2 vertex block index
-  uint32_t block_idx_v3 = 0; // v3 vertex block index
-
-  if (computeFacetPartitioning && options && (*options).bbSize) {
+  if (computeFacetPartitioning && options->bbSize) {
     const auto& bbSize = *options->bbSize;
     xSubRatio          = options->subDiv.X * ratio / bbSize.x;
     ySubRatio          = options->subDiv.Y * ratio / bbSize.y;
@@ -3337,155 +3299,227 @@ void VertexData::ComputeNormals(const Float32Array& positions, const Uint32Array
     subSq              = options->subDiv.max * options->subDiv.max;
     options->facetPartitioning.clear();
   }
+  // facetPositions is required for facetPartitioning and depth sort
+  computeFacetPartitioning = computeFacetPartitioning && computeFacetPositions;
+  computeDepthSort         = computeDepthSort && computeFacetPositions;
+  if (computeDepthSort && options->depthSortedFacets.size() < nbFaces) {
+    options->depthSortedFacets.resize(nbFaces);
+  }
 
   // reset the normals
   normals.resize(positions.size());
-  std::fill(normals.begin(), normals.end(), 0.f);
-
-  // Loop : 1 indice triplet = 1 facet
-  size_t nbFaces = indices.size() / 3;
-  for (index = 0; index < nbFaces; index++) {
-
-    // get the indexes of the coordinates of each vertex of the facet
-    v1x = indices[index * 3] * 3;
-    v1y = v1x + 1;
-    v1z = v1x + 2;
-    v2x = indices[index * 3 + 1] * 3;
-    v2y = v2x + 1;
-    v2z = v2x + 2;
-    v3x = indices[index * 3 + 2] * 3;
-    v3y = v3x + 1;
-    v3z = v3x + 2;
-
-    // compute two vectors per facet : p1p2 and p3p2
-    p1p2x = positions[v1x] - positions[v2x];
-    p1p2y = positions[v1y] - positions[v2y];
-    p1p2z = positions[v1z] - positions[v2z];
-
-    p3p2x = positions[v3x] - positions[v2x];
-    p3p2y = positions[v3y] - positions[v2y];
-    p3p2z = positions[v3z] - positions[v2z];
-
-    // compute the face normal with the cross product
-    faceNormalx = faceNormalSign * (p1p2y * p3p2z - p1p2z * p3p2y);
-    faceNormaly = faceNormalSign * (p1p2z * p3p2x - p1p2x * p3p2z);
-    faceNormalz = faceNormalSign * (p1p2x * p3p2y - p1p2y * p3p2x);
-
-    // normalize this normal and store it in the array facetData
-    length = std::sqrt(faceNormalx * faceNormalx + faceNormaly * faceNormaly
-                       + faceNormalz * faceNormalz);
-    length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
-    faceNormalx /= length;
-    faceNormaly /= length;
-    faceNormalz /= length;
-
-    if (computeFacetNormals && options) {
-      options->facetNormals[index].x = faceNormalx;
-      options->facetNormals[index].y = faceNormaly;
-      options->facetNormals[index].z = faceNormalz;
-    }
-
-    if (computeFacetPositions && options) {
-      // compute and the facet barycenter coordinates in the array
-      // facetPositions
-      options->facetPositions[index].x = (positions[v1x] + positions[v2x] + positions[v3x]) / 3.f;
-      options->facetPositions[index].y = (positions[v1y] + positions[v2y] + positions[v3y]) / 3.f;
-      options->facetPositions[index].z = (positions[v1z] + positions[v2z] + positions[v3z]) / 3.f;
-    }
-
-    if (computeFacetPartitioning && options) {
-      // store the facet indexes in arrays in the main facetPartitioning array :
-      // compute each facet vertex (+ facet barycenter) index in the partiniong
-      // array
-      ox  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].x - options->bInfo.minimum().x * ratio) * xSubRatio));
-      oy  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].y - options->bInfo.minimum().y * ratio) * ySubRatio));
-      oz  = static_cast<unsigned>(std::floor(
-        (options->facetPositions[index].z - options->bInfo.minimum().z * ratio) * zSubRatio));
-      b1x = static_cast<unsigned>(
-        std::floor((positions[v1x] - options->bInfo.minimum().x * ratio) * xSubRatio));
-      b1y = static_cast<unsigned>(
-        std::floor((positions[v1y] - options->bInfo.minimum().y * ratio) * ySubRatio));
-      b1z = static_cast<unsigned>(
-        std::floor((positions[v1z] - options->bInfo.minimum().z * ratio) * zSubRatio));
-      b2x = static_cast<unsigned>(
-        std::floor((positions[v2x] - options->bInfo.minimum().x * ratio) * xSubRatio));
-      b2y = static_cast<unsigned>(
-        std::floor((positions[v2y] - options->bInfo.minimum().y * ratio) * ySubRatio));
-      b2z = static_cast<unsigned>(
-        std::floor((positions[v2z] - options->bInfo.minimum().z * ratio) * zSubRatio));
-      b3x = static_cast<unsigned>(
-        std::floor((positions[v3x] - options->bInfo.minimum().x * ratio) * xSubRatio));
-      b3y = static_cast<unsigned>(
-        std::floor((positions[v3y] - options->bInfo.minimum().y * ratio) * ySubRatio));
-      b3z = static_cast<unsigned>(
-        std::floor((positions[v3z] - options->bInfo.minimum().z * ratio) * zSubRatio));
-
-      block_idx_v1 = b1x + options->subDiv.max * b1y + subSq * b1z;
-      block_idx_v2 = b2x + options->subDiv.max * b2y + subSq * b2z;
-      block_idx_v3 = b3x + options->subDiv.max * b3y + subSq * b3z;
-      block_idx_o  = ox + options->subDiv.max * oy + subSq * oz;
-
-      const std::array<uint32_t, 4> block_idxs{
-        {block_idx_o, block_idx_v1, block_idx_v2, block_idx_v3}};
-      for (auto& block_idx : block_idxs) {
-        // Check if facetPartitioning needs to be resized
-        if (options->facetPartitioning.size() <= block_idx) {
-          options->facetPartitioning.resize(block_idx + 1);
+
+  auto& threadPool      = ThreadPool::Default();
+  const auto chunkCount = (nbFaces + _NormalsFaceChunkSize - 1) / _NormalsFaceChunkSize;
+  const auto sequential = threadPool.concurrency() == 1 || chunkCount < 2;
+
+  // Computes the face normals of the [begin, end) facets in faceNormals and the facet data
+  const auto computeFacets = [&](size_t begin, size_t end, float* faceNormals) {
+    _ComputeFaceNormals(positions, indices, begin, end, faceNormalSign, faceNormals);
+    if (!options) {
+      return;
+    }
+    for (auto index = begin; index < end; ++index) {
+      if (computeFacetNormals) {
+        const auto* faceNormal         = &faceNormals[(index - begin) * 3];
+        options->facetNormals[index].x = faceNormal[0];
+        options->facetNormals[index].y = faceNormal[1];
+        options->facetNormals[index].z = faceNormal[2];
+      }
+
+      if (computeFacetPositions) {
+        // compute and the facet barycenter coordinates in the array facetPositions
+        const auto v1x = indices[index * 3] * 3;
+        const auto v2x = indices[index * 3 + 1] * 3;
+        const auto v3x = indices[index * 3 + 2] * 3;
+        options->facetPositions[index].x
+          = (positions[v1x] + positions[v2x] + positions[v3x]) / 3.f;
+        options->facetPositions[index].y
+          = (positions[v1x + 1] + positions[v2x + 1] + positions[v3x + 1]) / 3.f;
+        options->facetPositions[index].z
+          = (positions[v1x + 2] + positions[v2x + 2] + positions[v3x + 2]) / 3.f;
+      }
+
+      if (computeDepthSort) {
+        auto& dsf      = options->depthSortedFacets[index];
+        dsf.ind        = static_cast<unsigned int>(index * 3);
+        dsf.sqDistance = Vector3::DistanceSquared(options->facetPositions[index], *distanceTo);
+      }
+    }
+  };
+
+  // Step 1 : the face normals and the facet data only depend on each facet. Without worker thread
+  // they are accumulated chunk by chunk in the vertex normals while still in cache, otherwise they
+  // are computed in parallel over the facets
+  Float32Array faceNormals;
+  if (sequential) {
+    std::fill(normals.begin(), normals.end(), 0.f);
+    faceNormals.resize(std::min(nbFaces, _NormalsFaceChunkSize) * 3);
+    for (size_t begin = 0; begin < nbFaces; begin += _NormalsFaceChunkSize) {
+      const auto end = std::min(begin + _NormalsFaceChunkSize, nbFaces);
+      computeFacets(begin, end, faceNormals.data());
+      for (auto face = begin; face < end; ++face) {
+        const auto* faceNormal = &faceNormals[(face - begin) * 3];
+        for (size_t corner = 0; corner < 3; ++corner) {
+          auto* normal = &normals[indices[face * 3 + corner] * 3];
+          normal[0] += faceNormal[0];
+          normal[1] += faceNormal[1];
+          normal[2] += faceNormal[2];
         }
       }
+    }
+  }
+  else {
+    faceNormals.resize(nbFaces * 3);
+    threadPool.parallelFor(0, nbFaces, _NormalsFaceChunkSize, [&](size_t begin, size_t end) {
+      computeFacets(begin, end, faceNormals.data() + begin * 3);
+    });
+  }
+
+  // Step 2 : the facet indexes are pushed in the partitioning blocks in facet order
+  if (computeFacetPartitioning) {
+    const auto& minimum = options->bInfo.minimum();
+    const auto minX = minimum.x * ratio, minY = minimum.y * ratio, minZ = minimum.z * ratio;
+    const auto blockIndex = [&](float x, float y, float z) {
+      const auto bx = static_cast<uint32_t>(std::floor((x - minX) * xSubRatio));
+      const auto by = static_cast<uint32_t>(std::floor((y - minY) * ySubRatio));
+      const auto bz = static_cast<uint32_t>(std::floor((z - minZ) * zSubRatio));
+      return bx + options->subDiv.max * by + subSq * bz;
+    };
+
+    auto& facetPartitioning = options->facetPartitioning;
+    for (uint32_t index = 0; index < nbFaces; ++index) {
+      // compute each facet vertex (+ facet barycenter) index in the partitioning array
+      const auto v1x          = indices[index * 3] * 3;
+      const auto v2x          = indices[index * 3 + 1] * 3;
+      const auto v3x          = indices[index * 3 + 2] * 3;
+      const auto& facetPos    = options->facetPositions[index];
+      const auto block_idx_v1 = blockIndex(positions[v1x], positions[v1x + 1], positions[v1x + 2]);
+      const auto block_idx_v2 = blockIndex(positions[v2x], positions[v2x + 1], positions[v2x + 2]);
+      const auto block_idx_v3 = blockIndex(positions[v3x], positions[v3x + 1], positions[v3x + 2]);
+      const auto block_idx_o  = blockIndex(facetPos.x, facetPos.y, facetPos.z);
+
+      // Check if facetPartitioning needs to be resized
+      const auto maxBlockIndex = std::max({block_idx_o, block_idx_v1, block_idx_v2, block_idx_v3});
+      if (facetPartitioning.size() <= maxBlockIndex) {
+        facetPartitioning.resize(maxBlockIndex + 1);
+      }
 
       // push each facet index in each block containing the vertex
-      options->facetPartitioning[block_idx_v1].emplace_back(index);
+      facetPartitioning[block_idx_v1].emplace_back(index);
       if (block_idx_v2 != block_idx_v1) {
-        options->facetPartitioning[block_idx_v2].emplace_back(index);
+        facetPartitioning[block_idx_v2].emplace_back(index);
       }
       if (!(block_idx_v3 == block_idx_v2 || block_idx_v3 == block_idx_v1)) {
-        options->facetPartitioning[block_idx_v3].emplace_back(index);
+        facetPartitioning[block_idx_v3].emplace_back(index);
       }
       if (!(block_idx_o == block_idx_v1 || block_idx_o == block_idx_v2
             || block_idx_o == block_idx_v3)) {
-        options->facetPartitioning[block_idx_o].emplace_back(index);
-      }
-    }
-
-    if (computeDepthSort && options && !options->facetPositions.empty()) {
-      if (nbFaces >= depthSortedFacets.size()) {
-        depthSortedFacets.resize(nbFaces);
-      }
-      auto& dsf      = depthSortedFacets[index];
-      dsf.ind        = index * 3;
-      dsf.sqDistance = Vector3::DistanceSquared(options->facetPositions[index], *distanceTo);
-    }
-
-    // compute the normals anyway
-    normals[v1x] += faceNormalx; // accumulate all the normals per face
-    normals[v1y] += faceNormaly;
-    normals[v1z] += faceNormalz;
-    normals[v2x] += faceNormalx;
-    normals[v2y] += faceNormaly;
-    normals[v2z] += faceNormalz;
-    normals[v3x] += faceNormalx;
-    normals[v3y] += faceNormaly;
-    normals[v3z] += faceNormalz;
-  }
-  // last normalization of each normal
-  for (index = 0; index < normals.size() / 3; ++index) {
-    faceNormalx = normals[index * 3];
-    faceNormaly = normals[index * 3 + 1];
-    faceNormalz = normals[index * 3 + 2];
-
-    length = std::sqrt(faceNormalx * faceNormalx + faceNormaly * faceNormaly
-                       + faceNormalz * faceNormalz);
-    length = stl_util::almost_equal(length, 0.f) ? 1.f : length;
-    faceNormalx /= length;
-    faceNormaly /= length;
-    faceNormalz /= length;
-
-    normals[index * 3]     = faceNormalx;
-    normals[index * 3 + 1] = faceNormaly;
-    normals[index * 3 + 2] = faceNormalz;
+        facetPartitioning[block_idx_o].emplace_back(index);
+      }
+    }
+  }
+
+  // Step 3 : each vertex accumulates the normals of the facets referencing it. The facets of each
+  // vertex are listed in facet order in compressed rows, built with a counting pass and a filling
+  // pass over the indices, so that the work is linear whatever the order of the indices. Every
+  // vertex is owned by a single range so no atomic is needed, and the facets are accumulated in
+  // order which gives the sequential result.
+  std::vector<size_t> vertexFaceOffsets;
+  Uint32Array vertexFaces;
+  if (!sequential) {
+    vertexFaceOffsets.assign(nbVertices + 1, 0);
+    for (size_t corner = 0; corner < nbFaces * 3; ++corner) {
+      ++vertexFaceOffsets[indices[corner] + 1];
+    }
+    std::partial_sum(vertexFaceOffsets.begin(), vertexFaceOffsets.end(), vertexFaceOffsets.begin());
+    // The offsets are used as insertion cursors, each one ending at the start of the next row
+    vertexFaces.resize(nbFaces * 3);
+    for (size_t corner = 0; corner < nbFaces * 3; ++corner) {
+      vertexFaces[vertexFaceOffsets[indices[corner]]++] = static_cast<uint32_t>(corner / 3);
+    }
+    std::copy_backward(vertexFaceOffsets.begin(), vertexFaceOffsets.end() - 1,
+                       vertexFaceOffsets.end());
+    vertexFaceOffsets[0] = 0;
+  }
+
+  threadPool.parallelFor(0, nbVertices, _NormalsVertexChunkSize, [&](size_t begin, size_t end) {
+    if (!sequential) {
+      for (auto vertex = begin; vertex < end; ++vertex) {
+        float x = 0.f, y = 0.f, z = 0.f;
+        for (auto row = vertexFaceOffsets[vertex]; row < vertexFaceOffsets[vertex + 1]; ++row) {
+          const auto* faceNormal = &faceNormals[vertexFaces[row] * 3];
+          x += faceNormal[0];
+          y += faceNormal[1];
+          z += faceNormal[2];
+        }
+        normals[vertex * 3]     = x;
+        normals[vertex * 3 + 1] = y;
+        normals[vertex * 3 + 2] = z;
+      }
+    }
+
+    // last normalization of each normal
+    for (auto index = begin; index < end; ++index) {
+      const auto x = normals[index * 3];
+      const auto y = normals[index * 3 + 1];
+      const auto z = normals[index * 3 + 2];
+      auto length  = std::sqrt(x * x + y * y + z * z);
+      length       = length < std::numeric_limits<float>::min() ? 1.f : length;
+      normals[index * 3]     = x / length;
+      normals[index * 3 + 1] = y / length;
+      normals[index * 3 + 2] = z / length;
+    }
+  });
+}
+
+void VertexData::_ComputeFaceNormals(const ConstFloat32ArrayView& positions,
+                                     const ConstIndicesArrayView& indices, size_t faceBegin,
+                                     size_t faceEnd, float faceNormalSign, float* faceNormals)
+{
+  // The facets are processed by batches: the vertices are gathered in structure of arrays lanes
+  // and the cross products and normalizations are computed on full lanes, which the compiler turns
+  // into SIMD instructions
+  constexpr size_t BatchSize = 8;
+  using Lane                 = std::array<float, BatchSize>;
+
+  for (auto batchStart = faceBegin; batchStart < faceEnd; batchStart += BatchSize) {
+    const auto count = std::min(BatchSize, faceEnd - batchStart);
+
+    // p1p2 and p3p2 vectors of each facet
+    Lane p1p2x{}, p1p2y{}, p1p2z{}, p3p2x{}, p3p2y{}, p3p2z{};
+    for (size_t lane = 0; lane < count; ++lane) {
+      const auto* faceIndices = &indices[(batchStart + lane) * 3];
+      const auto* p1          = &positions[faceIndices[0] * 3];
+      const auto* p2          = &positions[faceIndices[1] * 3];
+      const auto* p3          = &positions[faceIndices[2] * 3];
+      p1p2x[lane]             = p1[0] - p2[0];
+      p1p2y[lane]             = p1[1] - p2[1];
+      p1p2z[lane]             = p1[2] - p2[2];
+      p3p2x[lane]             = p3[0] - p2[0];
+      p3p2y[lane]             = p3[1] - p2[1];
+      p3p2z[lane]             = p3[2] - p2[2];
+    }
+
+    // compute the face normal with the cross product and normalize it
+    Lane faceNormalx, faceNormaly, faceNormalz;
+    for (size_t lane = 0; lane < BatchSize; ++lane) {
+      const auto x = faceNormalSign * (p1p2y[lane] * p3p2z[lane] - p1p2z[lane] * p3p2y[lane]);
+      const auto y = faceNormalSign * (p1p2z[lane] * p3p2x[lane] - p1p2x[lane] * p3p2z[lane]);
+      const auto z = faceNormalSign * (p1p2x[lane] * p3p2y[lane] - p1p2y[lane] * p3p2x[lane]);
+      auto length  = std::sqrt(x * x + y * y + z * z);
+      length       = length < std::numeric_limits<float>::min() ? 1.f : length;
+      faceNormalx[lane] = x / length;
+      faceNormaly[lane] = y / length;
+      faceNormalz[lane] = z / length;
+    }
+
+    for (size_t lane = 0; lane < count; ++lane) {
+      auto* faceNormal = &faceNormals[(batchStart - faceBegin + lane) * 3];
+      faceNormal[0]    = faceNormalx[lane];
+      faceNormal[1]    = faceNormaly[lane];
+      faceNormal[2]    = faceNormalz[lane];
+    }
   }
 }
 
@@ -0,0 +1,219 @@
+#include <babylon/meshes/vertex_quantization.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstring>
+
+#include <babylon/maths/matrix.h>
+#include <babylon/meshes/instanced_mesh.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Copies the encoded values into the float storage used by the buffers, padding it to a multiple
+// of 4 bytes
+template <typename T>
+Float32Array PackBytes(const std::vector<T>& values)
+{
+  const auto byteLength = values.size() * sizeof(T);
+  Float32Array result((byteLength + sizeof(float) - 1) / sizeof(float), 0.f);
+  std::memcpy(result.data(), values.data(), byteLength);
+  return result;
+}
+
+int16_t ToSNorm16(float value)
+{
+  return static_cast<int16_t>(std::round(std::clamp(value, -1.f, 1.f) * 32767.f));
+}
+
+} // end of anonymous namespace
+
+Float32Array VertexQuantization::QuantizePositions(const Float32Array& positions,
+                                                   Matrix& dequantizationMatrix)
+{
+  const auto vertexCount = positions.size() / 3;
+
+  std::array<float, 3> minimum{0.f, 0.f, 0.f};
+  std::array<float, 3> maximum{0.f, 0.f, 0.f};
+  if (vertexCount > 0) {
+    std::copy(positions.begin(), positions.begin() + 3, minimum.begin());
+    std::copy(positions.begin(), positions.begin() + 3, maximum.begin());
+  }
+  for (size_t index = 3; index < vertexCount * 3; index += 3) {
+    for (size_t component = 0; component < 3; ++component) {
+      minimum[component] = std::min(minimum[component], positions[index + component]);
+      maximum[component] = std::max(maximum[component], positions[index + component]);
+    }
+  }
+
+  auto extent = std::max({maximum[0] - minimum[0], maximum[1] - minimum[1],
+                          maximum[2] - minimum[2]});
+  if (extent <= 0.f) {
+    extent = 1.f;
+  }
+
+  const auto factor = 65535.f / extent;
+  Uint16Array encoded(vertexCount * PositionByteStride / sizeof(uint16_t), 0);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    for (size_t component = 0; component < 3; ++component) {
+      const auto value = (positions[vertex * 3 + component] - minimum[component]) * factor;
+      encoded[vertex * 4 + component]
+        = static_cast<uint16_t>(std::clamp(value + 0.5f, 0.f, 65535.f));
+    }
+  }
+
+  dequantizationMatrix = Matrix::Scaling(extent, extent, extent);
+  dequantizationMatrix.setTranslationFromFloats(minimum[0], minimum[1], minimum[2]);
+
+  return PackBytes(encoded);
+}
+
+Float32Array VertexQuantization::EncodeOctahedral(const Float32Array& vectors,
+                                                  size_t componentCount)
+{
+  const auto vertexCount   = vectors.size() / componentCount;
+  const auto encodedStride = componentCount == 4 ? 4 : 2;
+  Int16Array encoded(vertexCount * encodedStride, 0);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    const auto* vector = &vectors[vertex * componentCount];
+    float u = 0.f, v = 0.f;
+    OctahedralEncode(vector[0], vector[1], vector[2], u, v);
+    encoded[vertex * encodedStride + 0] = ToSNorm16(u);
+    encoded[vertex * encodedStride + 1] = ToSNorm16(v);
+    if (componentCount == 4) {
+      encoded[vertex * encodedStride + 2] = vector[3] < 0.f ? -32767 : 32767;
+    }
+  }
+
+  return PackBytes(encoded);
+}
+
+Float32Array VertexQuantization::EncodeHalfFloats(const Float32Array& values)
+{
+  Uint16Array encoded(values.size());
+  std::transform(values.begin(), values.end(), encoded.begin(), &VertexQuantization::ToHalfFloat);
+  return PackBytes(encoded);
+}
+
+void VertexQuantization::OctahedralEncode(float x, float y, float z, float& u, float& v)
+{
+  const auto l1Norm = std::abs(x) + std::abs(y) + std::abs(z);
+  if (l1Norm <= 0.f) {
+    u = v = 0.f;
+    return;
+  }
+
+  u = x / l1Norm;
+  v = y / l1Norm;
+  if (z < 0.f) {
+    // Fold the lower hemisphere over the diagonals
+    const auto previousU = u;
+    u                    = (1.f - std::abs(v)) * (previousU >= 0.f ? 1.f : -1.f);
+    v                    = (1.f - std::abs(previousU)) * (v >= 0.f ? 1.f : -1.f);
+  }
+}
+
+void VertexQuantization::OctahedralDecode(float u, float v, float* result)
+{
+  auto x       = u;
+  auto y       = v;
+  const auto z = 1.f - std::abs(u) - std::abs(v);
+  const auto t = std::max(-z, 0.f);
+  x += x >= 0.f ? -t : t;
+  y += y >= 0.f ? -t : t;
+
+  const auto length = std::sqrt(x * x + y * y + z * z);
+  const auto scale  = length > 0.f ? 1.f / length : 0.f;
+  result[0]         = x * scale;
+  result[1]         = y * scale;
+  result[2]         = z * scale;
+}
+
+uint16_t VertexQuantization::ToHalfFloat(float value)
+{
+  uint32_t bits = 0;
+  std::memcpy(&bits, &value, sizeof(float));
+
+  const auto sign          = static_cast<uint32_t>((bits >> 16) & 0x8000);
+  const auto floatExponent = static_cast<int32_t>((bits >> 23) & 0xff);
+  auto mantissa            = bits & 0x007fffff;
+
+  // Infinity or NaN
+  if (floatExponent == 0xff) {
+    return static_cast<uint16_t>(sign | 0x7c00 | (mantissa ? 0x0200 : 0));
+  }
+
+  const auto exponent = floatExponent - 127 + 15;
+  // Overflow, return infinity
+  if (exponent >= 31) {
+    return static_cast<uint16_t>(sign | 0x7c00);
+  }
+
+  // Denormal or underflow
+  if (exponent <= 0) {
+    if (exponent < -10) {
+      return static_cast<uint16_t>(sign);
+    }
+    mantissa |= 0x00800000;
+    const auto shift = static_cast<uint32_t>(14 - exponent);
+    auto half        = mantissa >> shift;
+    if ((mantissa >> (shift - 1)) & 1) {
+      ++half;
+    }
+    return static_cast<uint16_t>(sign | half);
+  }
+
+  // Round to nearest, a carry correctly bumps the exponent
+  auto half = sign | (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+  if (mantissa & 0x00001000) {
+    ++half;
+  }
+  return static_cast<uint16_t>(half);
+}
+
+float VertexQuantization::FromHalfFloat(uint16_t value)
+{
+  const auto sign     = static_cast<uint32_t>(value & 0x8000) << 16;
+  const auto exponent = static_cast<uint32_t>(value >> 10) & 0x1f;
+  const auto mantissa = static_cast<uint32_t>(value) & 0x03ff;
+
+  uint32_t bits = 0;
+  if (exponent == 0) {
+    if (mantissa == 0) {
+      bits = sign;
+    }
+    else {
+      const auto result = std::ldexp(static_cast<float>(mantissa), -24);
+      return sign ? -result : result;
+    }
+  }
+  else if (exponent == 0x1f) {
+    bits = sign | 0x7f800000 | (mantissa << 13);
+  }
+  else {
+    bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+  }
+
+  float result = 0.f;
+  std::memcpy(&result, &bits, sizeof(float));
+  return result;
+}
+
+bool VertexQuantization::IsOctahedralEncoded(AbstractMesh* mesh, const std::string& kind)
+{
+  auto instancedMesh = dynamic_cast<InstancedMesh*>(mesh);
+  auto sourceMesh
+    = instancedMesh ? instancedMesh->sourceMesh().get() : dynamic_cast<Mesh*>(mesh);
+  if (!sourceMesh) {
+    return false;
+  }
+
+  const auto vertexBuffer = sourceMesh->getVertexBuffer(kind);
+  return vertexBuffer && vertexBuffer->octahedralEncoded;
+}
+
+} // end of namespace BABYLON
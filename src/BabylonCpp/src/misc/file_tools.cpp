@@ -113,10 +113,11 @@ Image FileTools::ArrayBufferToImage(const ArrayBuffer& buffer, bool flipVertical
   int w = -1, h = -1, n = -1;
   int req_comp = STBI_rgb_alpha;
 
-  stbi_set_flip_vertically_on_load(flipVertically);
+  // The flip flag is set for the calling thread only, so that images can be decoded concurrently
+  // (e.g. by the glTF loader)
+  stbi_set_flip_vertically_on_load_thread(flipVertically);
   unsigned char* ucharBuffer
     = stbi_load_from_memory(buffer.data(), bufferSize, &w, &h, &n, req_comp);
-  stbi_set_flip_vertically_on_load(false);
 
   if (!ucharBuffer)
     return Image();
@@ -247,7 +248,7 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
     req_comp = 4;
     int bits = 8;
 
-    stbi_set_flip_vertically_on_load(flipVertically);
+    stbi_set_flip_vertically_on_load_thread(flipVertically);
 
     // It is possible that the image we want to load is a 16bit per channel
     // image We are going to attempt to load it as 16bit per channel, and if it
@@ -280,8 +281,6 @@ Image FileTools::StringToImage(const std::string& uri, bool flipVertically)
       return false;
     }
 
-    stbi_set_flip_vertically_on_load(false);
-
     if ((w < 1) || (h < 1)) {
       stbi_image_free(data);
       BABYLON_LOG_ERROR("StringToImage", "Invalid image data for image")
@@ -0,0 +1,194 @@
+#include <babylon/misc/highdynamicrange/hdr_cube_texture_cache.h>
+
+#include <cstdio>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/filesystem.h>
+#include <babylon/core/logging.h>
+#include <babylon/maths/spherical_polynomial.h>
+
+namespace BABYLON {
+
+std::string HDRCubeTextureCache::CacheDirectory = "";
+
+const std::array<uint8_t, 8> HDRCubeTextureCache::_MagicBytes
+  = {0x42, 0x48, 0x44, 0x52, 0x43, 0x55, 0x42, 0x45}; // "BHDRCUBE"
+
+namespace {
+
+// 64-bit FNV-1a, the 32-bit Hash() variant collides too easily on large files
+uint64_t HashBytes(const uint8_t* data, size_t length)
+{
+  uint64_t hash = 0xcbf29ce484222325ull;
+  for (size_t i = 0; i < length; ++i) {
+    hash ^= data[i];
+    hash *= 0x100000001b3ull;
+  }
+  return hash;
+}
+
+template <typename T>
+void WriteValue(std::ofstream& out, const T& value)
+{
+  out.write(reinterpret_cast<const char*>(&value), sizeof(T));
+}
+
+template <typename T>
+bool ReadValue(std::ifstream& in, T& value)
+{
+  in.read(reinterpret_cast<char*>(&value), sizeof(T));
+  return static_cast<bool>(in);
+}
+
+} // end of anonymous namespace
+
+std::string HDRCubeTextureCacheKey::toFileName() const
+{
+  std::ostringstream oss;
+  oss << std::hex << std::setw(16) << std::setfill('0') << sourceHash << std::dec << "_" << size
+      << (gammaSpace ? "_g" : "_l") << (textureFloat ? "f" : "b") << (generateHarmonics ? "h" : "")
+      << ".hdrcache";
+  return oss.str();
+}
+
+bool HDRCubeTextureCache::IsEnabled()
+{
+  return !CacheDirectory.empty();
+}
+
+HDRCubeTextureCacheKey HDRCubeTextureCache::ComputeKey(const ArrayBuffer& buffer, size_t size,
+                                                       bool gammaSpace, bool textureFloat,
+                                                       bool generateHarmonics)
+{
+  HDRCubeTextureCacheKey key;
+  key.sourceHash        = HashBytes(buffer.data(), buffer.size());
+  key.size              = size;
+  key.gammaSpace        = gammaSpace;
+  key.textureFloat      = textureFloat;
+  key.generateHarmonics = generateHarmonics;
+  return key;
+}
+
+bool HDRCubeTextureCache::Load(const HDRCubeTextureCacheKey& key,
+                               std::vector<ArrayBufferView>& faces,
+                               SphericalPolynomialPtr& sphericalPolynomial)
+{
+  if (!IsEnabled()) {
+    return false;
+  }
+
+  const auto filename = Filesystem::joinPath(CacheDirectory, key.toFileName());
+  std::ifstream in(filename, std::ios::in | std::ios::binary);
+  if (!in) {
+    return false;
+  }
+
+  // Header
+  std::array<uint8_t, 8> magic{};
+  uint32_t version = 0, hasHarmonics = 0;
+  uint64_t sourceHash = 0, size = 0;
+  in.read(reinterpret_cast<char*>(magic.data()), static_cast<std::streamsize>(magic.size()));
+  if (!in || magic != _MagicBytes || !ReadValue(in, version) || version != _Version
+      || !ReadValue(in, sourceHash) || sourceHash != key.sourceHash || !ReadValue(in, size)
+      || size != key.size || !ReadValue(in, hasHarmonics)) {
+    BABYLON_LOGF_WARN("HDRCubeTextureCache", "Ignoring invalid cache entry %s", filename.c_str())
+    return false;
+  }
+
+  // Spherical polynomial
+  SphericalPolynomialPtr polynomial = nullptr;
+  if (hasHarmonics) {
+    std::vector<Float32Array> coefficients(9, Float32Array(3));
+    for (auto& coefficient : coefficients) {
+      in.read(reinterpret_cast<char*>(coefficient.data()), 3 * sizeof(float));
+    }
+    if (!in) {
+      return false;
+    }
+    polynomial
+      = std::make_shared<SphericalPolynomial>(SphericalPolynomial::FromArray(coefficients));
+  }
+
+  // Faces
+  std::vector<ArrayBufferView> results;
+  results.reserve(6);
+  for (unsigned int j = 0; j < 6; ++j) {
+    uint64_t byteLength = 0;
+    if (!ReadValue(in, byteLength)) {
+      return false;
+    }
+    ArrayBuffer bytes(static_cast<size_t>(byteLength));
+    in.read(reinterpret_cast<char*>(bytes.data()), static_cast<std::streamsize>(byteLength));
+    if (!in) {
+      return false;
+    }
+    results.emplace_back(bytes);
+  }
+
+  faces               = std::move(results);
+  sphericalPolynomial = polynomial;
+  return true;
+}
+
+bool HDRCubeTextureCache::Save(const HDRCubeTextureCacheKey& key,
+                               const std::vector<ArrayBufferView>& faces,
+                               const SphericalPolynomialPtr& sphericalPolynomial)
+{
+  if (!IsEnabled() || faces.size() != 6) {
+    return false;
+  }
+
+  if (!Filesystem::isDirectory(CacheDirectory)) {
+    Filesystem::createDirectory(CacheDirectory);
+  }
+
+  // Write to a temporary file first so that a concurrent or interrupted run never leaves a
+  // truncated entry behind
+  const auto filename    = Filesystem::joinPath(CacheDirectory, key.toFileName());
+  const auto tmpFilename = filename + ".tmp";
+  {
+    std::ofstream out(tmpFilename, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!out) {
+      BABYLON_LOGF_WARN("HDRCubeTextureCache", "Unable to write cache entry %s", filename.c_str())
+      return false;
+    }
+
+    // Header
+    out.write(reinterpret_cast<const char*>(_MagicBytes.data()),
+              static_cast<std::streamsize>(_MagicBytes.size()));
+    WriteValue(out, _Version);
+    WriteValue(out, key.sourceHash);
+    WriteValue(out, static_cast<uint64_t>(key.size));
+    WriteValue(out, static_cast<uint32_t>(sphericalPolynomial ? 1 : 0));
+
+    // Spherical polynomial
+    if (sphericalPolynomial) {
+      const auto& sp = *sphericalPolynomial;
+      for (const auto* v : {&sp.x, &sp.y, &sp.z, &sp.xx, &sp.yy, &sp.zz, &sp.yz, &sp.zx, &sp.xy}) {
+        const std::array<float, 3> coefficient{v->x, v->y, v->z};
+        out.write(reinterpret_cast<const char*>(coefficient.data()), 3 * sizeof(float));
+      }
+    }
+
+    // Faces
+    for (const auto& face : faces) {
+      const auto& bytes = face.uint8Array();
+      WriteValue(out, static_cast<uint64_t>(bytes.size()));
+      out.write(reinterpret_cast<const char*>(bytes.data()),
+                static_cast<std::streamsize>(bytes.size()));
+    }
+
+    if (!out) {
+      Filesystem::removeFile(tmpFilename);
+      return false;
+    }
+  }
+
+  Filesystem::removeFile(filename);
+  return std::rename(tmpFilename.c_str(), filename.c_str()) == 0;
+}
+
+} // end of namespace BABYLON
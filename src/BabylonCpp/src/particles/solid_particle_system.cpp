@@ -165,10 +165,20 @@ SolidParticleSystem& SolidParticleSystem::digest(Mesh* _mesh,
   auto size    = options.facetNb;
   auto number  = options.number;
   auto delta   = options.delta;
-  auto meshPos = _mesh->getVerticesData(VertexBuffer::PositionKind);
-  auto meshInd = _mesh->getIndices();
-  auto meshUV  = _mesh->getVerticesData(VertexBuffer::UVKind);
-  auto meshCol = _mesh->getVerticesData(VertexBuffer::ColorKind);
+  // Read the source geometry in place, only copy the attributes that can not be viewed directly
+  std::array<Float32Array, 3> dataCopies;
+  const auto getData = [_mesh, &dataCopies](const std::string& kind, size_t copyIndex) {
+    auto data = _mesh->getVerticesDataView(kind);
+    if (data.empty()) {
+      dataCopies[copyIndex] = _mesh->getVerticesData(kind);
+      data                  = dataCopies[copyIndex];
+    }
+    return data;
+  };
+  auto meshPos = getData(VertexBuffer::PositionKind, 0);
+  auto meshInd = _mesh->getIndicesView();
+  auto meshUV  = getData(VertexBuffer::UVKind, 1);
+  auto meshCol = getData(VertexBuffer::ColorKind, 2);
   auto meshNor = mesh->getVerticesData(VertexBuffer::NormalKind);
 
   auto f = 0ull; // facet counter
@@ -965,10 +975,10 @@ SolidParticleSystem& SolidParticleSystem::setParticles(unsigned int start, unsig
         // then also the normal reference array _fixedNormal32[]
         if (mesh->isFacetDataEnabled) {
           VertexData::ComputeNormals(positions32, indices32, normals32,
-                                     mesh->getFacetDataParameters());
+                                     &mesh->getFacetDataParameters());
         }
         else {
-          VertexData::ComputeNormals(positions32, indices32, normals32, std::nullopt);
+          VertexData::ComputeNormals(positions32, indices32, normals32);
         }
         for (size_t i = 0; i < normals32.size(); ++i) {
           fixedNormal32[i] = normals32[i];
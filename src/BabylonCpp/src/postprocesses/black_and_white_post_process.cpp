@@ -12,6 +12,8 @@ BlackAndWhitePostProcess::BlackAndWhitePostProcess(const std::string& iName, flo
                   camera, samplingMode,    engine,     reusable}
     , degree{1.f}
 {
+  allowFusion = true;
+
   onApplyObservable.add(
     [this](Effect* effect, EventState&) { effect->setFloat("degree", degree); });
 }
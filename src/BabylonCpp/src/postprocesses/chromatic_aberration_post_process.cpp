@@ -32,6 +32,8 @@ ChromaticAberrationPostProcess::ChromaticAberrationPostProcess(
     , screenWidth{static_cast<float>(iScreenWidth)}
     , screenHeight{static_cast<float>(iScreenHeight)}
 {
+  allowFusion = true;
+
   onApplyObservable.add([&](Effect* effect, EventState&) {
     effect->setFloat("chromatic_aberration", aberrationAmount);
     effect->setFloat("screen_width", screenWidth);
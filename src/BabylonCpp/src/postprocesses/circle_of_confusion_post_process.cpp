@@ -22,9 +22,9 @@ CircleOfConfusionPostProcess::CircleOfConfusionPostProcess(
                   samplingMode,
                   engine,
                   reusable,
-                  nullptr,
-                  textureType,
                   "",
+                  textureType,
+                  "postprocess",
                   {},
                   blockCompilation}
     , lensSize{50.f}
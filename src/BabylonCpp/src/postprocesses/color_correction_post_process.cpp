@@ -12,6 +12,8 @@ ColorCorrectionPostProcess::ColorCorrectionPostProcess(
     : PostProcess{iName,  "colorCorrection", {},     {"colorTable"}, ratio,
                   camera, samplingMode,      engine, reusable}
 {
+  allowFusion = true;
+
   _colorTableTexture = Texture::New(colorTableUrl, camera->getScene(), true, false,
                                     TextureConstants::TRILINEAR_SAMPLINGMODE);
   _colorTableTexture->anisotropicFilteringLevel = 1;
@@ -12,6 +12,8 @@ FilterPostProcess::FilterPostProcess(const std::string& iName, const Matrix& _ke
                   camera, samplingMode, engine,           reusable}
     , kernelMatrix{_kernelMatrix}
 {
+  allowFusion = true;
+
   onApply = [&](Effect* effect, EventState&) { effect->setMatrix("kernelMatrix", kernelMatrix); };
 }
 
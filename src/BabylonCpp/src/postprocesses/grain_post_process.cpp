@@ -18,6 +18,8 @@ GrainPostProcess::GrainPostProcess(const std::string& iName,
     , intensity{30.f}
     , animated{false}
 {
+  allowFusion = true;
+
   onApplyObservable.add([&](Effect* effect, EventState& /*es*/) {
     effect->setFloat("intensity", intensity);
     effect->setFloat("animatedSeed", animated ? Math::random() + 1.f : 1.f);
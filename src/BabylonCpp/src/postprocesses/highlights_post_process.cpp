@@ -10,6 +10,7 @@ HighlightsPostProcess::HighlightsPostProcess(const std::string& iName, float rat
     : PostProcess{iName,        "highlights", {},       {},      ratio,      camera,
                   samplingMode, engine,       reusable, nullptr, textureType}
 {
+  allowFusion = true;
 }
 
 HighlightsPostProcess::~HighlightsPostProcess() = default;
@@ -55,6 +55,8 @@ ImageProcessingPostProcess::ImageProcessingPostProcess(
     , _imageProcessingObserver{nullptr}
     , _fromLinearSpace{false}
 {
+  allowFusion = true;
+
   // Setup the configuration as forced by the constructor. This would then not
   // force the scene materials output in linear space and let untouched the
   // default forward pass.
@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/engine.h>
+#include <babylon/engines/render_target_pool.h>
 #include <babylon/engines/scene.h>
 #include <babylon/interfaces/icanvas.h>
 #include <babylon/materials/effect.h>
@@ -40,6 +41,8 @@ PostProcess::PostProcess(const std::string& iName, const std::string& fragmentUr
     , onAfterRender{this, &PostProcess::set_onAfterRender}
     , inputTexture{this, &PostProcess::get_inputTexture, &PostProcess::set_inputTexture}
     , adaptScaleToCurrentViewport{false}
+    , allowFusion{false}
+    , transientTextures{false}
     , _currentRenderTextureInd{0}
     , _samples{1}
     , _camera{nullptr}
@@ -52,6 +55,7 @@ PostProcess::PostProcess(const std::string& iName, const std::string& fragmentUr
     , _shareOutputWithPostProcess{nullptr}
     , _texelSize{Vector2::Zero()}
     , _forcedOutputTexture{nullptr}
+    , _noInputTexture{nullptr}
     , _blockCompilation{blockCompilation}
     , _defines{defines}
     , _onActivateObserver{nullptr}
@@ -173,6 +177,11 @@ void PostProcess::set_onAfterRender(
 
 InternalTexturePtr& PostProcess::get_inputTexture()
 {
+  if (_currentRenderTextureInd >= _textures.size()) {
+    _noInputTexture = nullptr;
+    return _noInputTexture;
+  }
+
   return _textures[_currentRenderTextureInd];
 }
 
@@ -226,7 +235,7 @@ PostProcess& PostProcess::shareOutputWith(const PostProcessPtr& postProcess)
 void PostProcess::useOwnOutput()
 {
   if (_textures.empty()) {
-    _textures.resize(2);
+    _textures.reserve(2);
   }
 
   _shareOutputWithPostProcess = nullptr;
@@ -275,12 +284,11 @@ InternalTexturePtr PostProcess::activate(const CameraPtr& camera,
   const int maxSize = engine->getCaps().maxTextureSize;
 
   const int requiredWidth = static_cast<int>(
-    static_cast<float>(sourceTexture ? sourceTexture->width : _engine->getRenderingCanvas()->width)
+    static_cast<float>(sourceTexture ? sourceTexture->width : _engine->getRenderWidth(true))
+    * _renderRatio);
+  const int requiredHeight = static_cast<int>(
+    static_cast<float>(sourceTexture ? sourceTexture->height : _engine->getRenderHeight(true))
     * _renderRatio);
-  const int requiredHeight
-    = static_cast<int>(static_cast<float>(sourceTexture ? sourceTexture->height :
-                                                          _engine->getRenderingCanvas()->height)
-                       * _renderRatio);
 
   int desiredWidth = std::holds_alternative<PostProcessOptions>(_options) ?
                        std::get<PostProcessOptions>(_options).width :
@@ -314,13 +322,12 @@ InternalTexturePtr PostProcess::activate(const CameraPtr& camera,
       }
     }
 
-    if (width != desiredWidth || height != desiredHeight) {
-      if (!_textures.empty()) {
-        for (const auto& texture : _textures) {
-          _engine->_releaseTexture(texture);
-        }
-        _textures.clear();
-      }
+    // The textures are also missing when they were released, or when the post process was only
+    // rendered in fused passes
+    const auto transient   = transientTextures && !_reusable;
+    const auto sizeChanged = width != desiredWidth || height != desiredHeight;
+    if (sizeChanged || _textures.empty()) {
+      _releaseRenderTargets();
       width  = desiredWidth;
       height = desiredHeight;
 
@@ -342,15 +349,23 @@ InternalTexturePtr PostProcess::activate(const CameraPtr& camera,
       textureOptions.samplingMode = renderTargetSamplingMode;
       textureOptions.type         = _textureType;
 
-      _textures.emplace_back(_engine->createRenderTargetTexture(textureSize, textureOptions));
-
-      if (_reusable) {
+      if (transient) {
+        _textures.emplace_back(
+          _engine->getRenderTargetPool().acquire(textureSize, textureOptions, _samples));
+      }
+      else {
         _textures.emplace_back(_engine->createRenderTargetTexture(textureSize, textureOptions));
+
+        if (_reusable) {
+          _textures.emplace_back(_engine->createRenderTargetTexture(textureSize, textureOptions));
+        }
       }
 
-      _texelSize.copyFromFloats(1.f / width, 1.f / height);
+      if (sizeChanged) {
+        _texelSize.copyFromFloats(1.f / width, 1.f / height);
 
-      onSizeChangedObservable.notifyObservers(this);
+        onSizeChangedObservable.notifyObservers(this);
+      }
     }
 
     for (auto& texture : _textures) {
@@ -431,8 +446,81 @@ EffectPtr PostProcess::apply()
     return nullptr;
   }
 
+  _applyStatesAndInputs(_effect);
+
+  return _effect;
+}
+
+bool PostProcess::_canBeFused(const PostProcess* previous) const
+{
+  if (!allowFusion || !isReady() || _vertexUrl != "postprocess"
+      || alphaMode != Constants::ALPHA_DISABLE || alphaConstants || enablePixelPerfectMode) {
+    return false;
+  }
+
+  if (!previous) {
+    return true;
+  }
+
+  // The following post processes are rendered at the size of the first one
+  return !adaptScaleToCurrentViewport && !_forcedOutputTexture && !_shareOutputWithPostProcess
+         && !previous->adaptScaleToCurrentViewport && std::holds_alternative<float>(_options)
+         && std::holds_alternative<float>(previous->_options)
+         && std::get<float>(_options) == std::get<float>(previous->_options);
+}
+
+void PostProcess::_activateAsFusedStage(const CameraPtr& camera, const PostProcess& first)
+{
+  // Only the post processes rendered at the size of the first one are fused
+  if (width != first.width || height != first.height) {
+    width  = first.width;
+    height = first.height;
+    _texelSize.copyFromFloats(1.f / width, 1.f / height);
+
+    onSizeChangedObservable.notifyObservers(this);
+  }
+  _scaleRatio.copyFromFloats(1.f, 1.f);
+
+  onActivateObservable.notifyObservers(camera ? camera.get() : _camera.get());
+}
+
+void PostProcess::_applyToFusedEffect(const EffectPtr& effect, bool isFirst)
+{
+  if (isFirst) {
+    _applyStatesAndInputs(effect);
+  }
+  else {
+    onApplyObservable.notifyObservers(effect.get());
+  }
+}
+
+void PostProcess::_releaseTransientTextures()
+{
+  if (!transientTextures || _reusable || _shareOutputWithPostProcess || _forcedOutputTexture) {
+    return;
+  }
+
+  _releaseRenderTargets();
+}
+
+void PostProcess::_releaseRenderTargets()
+{
+  auto& renderTargetPool = _engine->getRenderTargetPool();
+  for (const auto& texture : _textures) {
+    if (renderTargetPool.owns(texture)) {
+      renderTargetPool.release(texture);
+    }
+    else {
+      _engine->_releaseTexture(texture);
+    }
+  }
+  _textures.clear();
+}
+
+void PostProcess::_applyStatesAndInputs(const EffectPtr& effect)
+{
   // States
-  _engine->enableEffect(_effect);
+  _engine->enableEffect(effect);
   _engine->setState(false);
   _engine->setDepthBuffer(false);
   _engine->setDepthWrite(false);
@@ -458,13 +546,11 @@ EffectPtr PostProcess::apply()
       source = inputTexture();
     }
   }
-  _effect->_bindTexture("textureSampler", source);
+  effect->_bindTexture("textureSampler", source);
 
   // Parameters
-  _effect->setVector2("scale", _scaleRatio);
-  onApplyObservable.notifyObservers(_effect.get());
-
-  return _effect;
+  effect->setVector2("scale", _scaleRatio);
+  onApplyObservable.notifyObservers(effect.get());
 }
 
 void PostProcess::_disposeTextures()
@@ -473,13 +559,7 @@ void PostProcess::_disposeTextures()
     return;
   }
 
-  if (!_textures.empty()) {
-    for (const auto& texture : _textures) {
-      _engine->_releaseTexture(texture);
-    }
-  }
-
-  _textures.clear();
+  _releaseRenderTargets();
 }
 
 void PostProcess::dispose(Camera* camera)
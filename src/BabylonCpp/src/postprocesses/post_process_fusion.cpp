@@ -0,0 +1,285 @@
+#include <babylon/postprocesses/post_process_fusion.h>
+
+#include <algorithm>
+#include <cctype>
+#include <functional>
+#include <optional>
+#include <regex>
+#include <sstream>
+#include <unordered_map>
+#include <unordered_set>
+
+#include <babylon/misc/string_tools.h>
+
+namespace BABYLON {
+
+namespace {
+
+// Reads of the input texture at the current pixel
+const std::regex InputRead(R"(texture2D\s*\(\s*textureSampler\s*,\s*vUV\s*\))");
+
+// Declarations at the top level of a shader
+const std::regex FunctionDeclaration(R"(^(?:[A-Za-z_]\w*\s+)+([A-Za-z_]\w*)\s*\()");
+const std::regex StructDeclaration(R"(^struct\s+([A-Za-z_]\w*))");
+const std::regex VariableDeclaration(R"(^(?:(?:const|highp|mediump|lowp)\s+)*[A-Za-z_]\w*\s+)"
+                                     R"(([A-Za-z_]\w*)\s*(?:\[[^\]]*\])?\s*[=;,])");
+
+/**
+ * @brief Calls the given function on each identifier of the code which is not a member access
+ * and replaces the identifier by the returned string.
+ */
+std::string TransformIdentifiers(const std::string& code,
+                                 const std::function<std::string(const std::string&)>& transform)
+{
+  std::string result;
+  result.reserve(code.size());
+  const auto isIdentifierChar
+    = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) || c == '_'; };
+  char previous = '\0';
+  for (size_t i = 0; i < code.size();) {
+    const auto c = code[i];
+    if (std::isdigit(static_cast<unsigned char>(c))) {
+      // Numbers, including their suffixes and exponents
+      const auto start = i;
+      while (i < code.size() && (isIdentifierChar(code[i]) || code[i] == '.')) {
+        ++i;
+      }
+      result.append(code, start, i - start);
+      previous = code[i - 1];
+    }
+    else if (isIdentifierChar(c)) {
+      const auto start = i;
+      while (i < code.size() && isIdentifierChar(code[i])) {
+        ++i;
+      }
+      const auto identifier = code.substr(start, i - start);
+      result += previous == '.' ? identifier : transform(identifier);
+      previous = code[i - 1];
+    }
+    else {
+      result += c;
+      if (!std::isspace(static_cast<unsigned char>(c))) {
+        previous = c;
+      }
+      ++i;
+    }
+  }
+  return result;
+}
+
+bool ContainsIdentifier(const std::string& code, const std::string& identifier)
+{
+  auto found = false;
+  TransformIdentifiers(code, [&found, &identifier](const std::string& token) {
+    found = found || token == identifier;
+    return token;
+  });
+  return found;
+}
+
+std::string RemoveComments(const std::string& code)
+{
+  std::string result;
+  result.reserve(code.size());
+  for (size_t i = 0; i < code.size(); ++i) {
+    if (code.compare(i, 2, "/*") == 0) {
+      const auto end = code.find("*/", i + 2);
+      if (end == std::string::npos) {
+        break;
+      }
+      i = end + 1;
+    }
+    else if (code.compare(i, 2, "//") == 0) {
+      const auto end = code.find('\n', i);
+      if (end == std::string::npos) {
+        break;
+      }
+      result += '\n';
+      i = end;
+    }
+    else {
+      result += code[i];
+    }
+  }
+  return result;
+}
+
+/**
+ * @brief Global state of the fused shader, shared by its stages.
+ */
+struct FusedShader {
+  std::vector<std::string> directives;
+  std::unordered_set<std::string> uniforms;
+  std::string stages;
+}; // end of struct FusedShader
+
+/**
+ * @brief Adds the code of a post process to the fused shader, its main function becoming
+ * "fusedStage<index>_main" and writing "fusedColor".
+ * @returns false if the code cannot be fused
+ */
+bool AddStage(const std::string& fragmentShader, size_t index, FusedShader& fused)
+{
+  const auto prefix = "fusedStage" + std::to_string(index) + "_";
+  std::unordered_set<std::string> globals;
+  std::vector<std::string> macros;
+  std::string body;
+
+  size_t depth = 0;
+  std::smatch match;
+  for (const auto& rawLine : StringTools::split(RemoveComments(fragmentShader), '\n')) {
+    const auto line = StringTools::trimCopy(rawLine);
+    if (line.empty()) {
+      continue;
+    }
+
+    if (line[0] == '#') {
+      if (StringTools::startsWith(line, "#extension")) {
+        if (std::find(fused.directives.begin(), fused.directives.end(), line)
+            == fused.directives.end()) {
+          fused.directives.emplace_back(line);
+        }
+      }
+      else if (StringTools::startsWith(line, "#define")) {
+        // Macros are scoped to their stage, and refer to its renamed declarations
+        const auto definition = StringTools::trimCopy(line.substr(7));
+        macros.emplace_back(definition.substr(0, definition.find_first_of(" \t(")));
+        body += line + "\n";
+      }
+      else if (!StringTools::startsWith(line, "#version")) {
+        // Remaining conditions or pragmas are not supported
+        return false;
+      }
+      continue;
+    }
+
+    if (depth == 0) {
+      if (StringTools::startsWith(line, "precision ")) {
+        continue;
+      }
+      if (StringTools::startsWith(line, "varying ") || StringTools::startsWith(line, "in ")) {
+        // The fused pass only provides the varying of the post process vertex shader
+        if (!std::regex_match(line, std::regex(R"(varying\s+(?:\w+\s+)?vec2\s+vUV\s*;)"))) {
+          return false;
+        }
+        continue;
+      }
+      if (StringTools::startsWith(line, "uniform ")) {
+        auto declaration = StringTools::replace(line.substr(8), ";", "");
+        std::istringstream words(declaration);
+        std::string word;
+        words >> word;
+        if (word == "lowp" || word == "mediump" || word == "highp") {
+          words >> word;
+        }
+        std::string names;
+        std::getline(words, names);
+        auto skipLine = false;
+        for (auto name : StringTools::split(names, ',')) {
+          name = StringTools::trimCopy(name.substr(0, name.find('[')));
+          if (name == "textureSampler") {
+            // Declared once by the fused shader
+            skipLine = true;
+          }
+          else if (!fused.uniforms.insert(name).second) {
+            // The post processes would both set the same uniform
+            return false;
+          }
+        }
+        if (!skipLine) {
+          body += line + "\n";
+        }
+        continue;
+      }
+      if (std::regex_search(line, match, FunctionDeclaration)
+          || std::regex_search(line, match, StructDeclaration)
+          || std::regex_search(line, match, VariableDeclaration)) {
+        globals.insert(match[1].str());
+      }
+    }
+
+    for (const auto c : line) {
+      if (c == '{') {
+        ++depth;
+      }
+      else if (c == '}' && depth > 0) {
+        --depth;
+      }
+    }
+    body += rawLine.substr(0, rawLine.find_last_not_of(" \t\r") + 1) + "\n";
+  }
+
+  if (!globals.count("main") || ContainsIdentifier(body, "gl_FragData")) {
+    return false;
+  }
+
+  // The stages after the first one read the color computed by the previous ones
+  if (index > 0) {
+    if (!PostProcessFusion::IsPerPixel(body)) {
+      return false;
+    }
+    body = std::regex_replace(body, InputRead, "fusedInput");
+  }
+
+  fused.stages += TransformIdentifiers(body, [&globals, &prefix](const std::string& token) {
+    if (token == "gl_FragColor") {
+      return std::string("fusedColor");
+    }
+    return globals.count(token) ? prefix + token : token;
+  });
+  for (const auto& macro : macros) {
+    fused.stages += "#undef " + macro + "\n";
+  }
+  fused.stages += "\n";
+  return true;
+}
+
+} // end of anonymous namespace
+
+std::string PostProcessFusion::FuseFragmentShaders(const std::vector<std::string>& fragmentShaders)
+{
+  if (fragmentShaders.size() < 2) {
+    return "";
+  }
+
+  FusedShader fused;
+  for (size_t index = 0; index < fragmentShaders.size(); ++index) {
+    if (!AddStage(fragmentShaders[index], index, fused)) {
+      return "";
+    }
+  }
+
+  std::ostringstream shader;
+  for (const auto& directive : fused.directives) {
+    shader << directive << "\n";
+  }
+  shader << "\n"
+         << "varying vec2 vUV;\n"
+         << "uniform sampler2D textureSampler;\n"
+         << "\n"
+         << "vec4 fusedInput;\n"
+         << "vec4 fusedColor;\n"
+         << "\n"
+         << fused.stages << "void main(void)\n"
+         << "{\n"
+         << "    fusedColor = vec4(0.);\n";
+  for (size_t index = 0; index < fragmentShaders.size(); ++index) {
+    if (index > 0) {
+      shader << "    fusedInput = fusedColor;\n";
+    }
+    shader << "    fusedStage" << index << "_main();\n";
+  }
+  shader << "    gl_FragColor = fusedColor;\n"
+         << "}\n";
+  return shader.str();
+}
+
+bool PostProcessFusion::IsPerPixel(const std::string& fragmentShader)
+{
+  static const std::regex inputDeclaration(R"(uniform\s+(?:\w+\s+)?sampler2D\s+textureSampler)");
+  auto code = std::regex_replace(RemoveComments(fragmentShader), InputRead, "");
+  code      = std::regex_replace(code, inputDeclaration, "");
+  return !ContainsIdentifier(code, "textureSampler");
+}
+
+} // end of namespace BABYLON
@@ -1,17 +1,66 @@
 #include <babylon/postprocesses/post_process_manager.h>
 
+#include <sstream>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/engines/constants.h>
 #include <babylon/engines/engine.h>
+#include <babylon/engines/processors/ishader_processor.h>
+#include <babylon/engines/processors/processing_options.h>
+#include <babylon/engines/processors/shader_processor.h>
 #include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/ieffect_creation_options.h>
 #include <babylon/materials/material.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/misc/string_tools.h>
 #include <babylon/postprocesses/post_process.h>
+#include <babylon/postprocesses/post_process_fusion.h>
 
 namespace BABYLON {
 
-PostProcessManager::PostProcessManager(Scene* scene) : _scene{scene}, _indexBuffer{nullptr}
+namespace {
+
+/**
+ * @brief Returns the fragment shader of a post process with its includes expanded and its
+ * preprocessor conditions evaluated, or an empty string if its source is not in the shaders store.
+ */
+std::string ProcessedFragmentShader(PostProcess& postProcess, ThinEngine* engine)
+{
+  const auto& shadersStore = Effect::ShadersStore();
+  const auto& name         = postProcess.getEffectName();
+  auto it                  = shadersStore.find(name + "FragmentShader");
+  if (it == shadersStore.end()) {
+    it = shadersStore.find(name + "PixelShader");
+  }
+  if (it == shadersStore.end()) {
+    return "";
+  }
+
+  // The identity processor keeps the WebGL1 syntax, the fused shader being migrated on creation
+  ProcessingOptions options;
+  options.defines              = StringTools::split(postProcess.getEffect()->defines, '\n');
+  options.isFragment           = true;
+  options.processor            = std::make_shared<IShaderProcessor>();
+  options.shadersRepository    = Effect::ShadersRepository;
+  options.includesShadersStore = Effect::IncludesShadersStore();
+  options.version      = std::to_string(static_cast<int>(engine->webGLVersion() * 100));
+  options.platformName = engine->webGLVersion() >= 2 ? "WEBGL2" : "WEBGL1";
+
+  std::string processedCode;
+  ShaderProcessor::Process(it->second, options, [&processedCode](const std::string& code) {
+    processedCode = code;
+  });
+  return processedCode;
+}
+
+} // end of anonymous namespace
+
+std::unordered_map<std::string, size_t> PostProcessManager::_FusedShaderIds;
+
+PostProcessManager::PostProcessManager(Scene* scene)
+    : fusionEnabled{false}, _scene{scene}, _indexBuffer{nullptr}
 {
 }
 
@@ -147,9 +196,14 @@ void PostProcessManager::_finalizeFrame(bool doNotPresent, const InternalTexture
   auto engine = _scene->getEngine();
 
   for (size_t index = 0, len = postProcesses.size(); index < len; ++index) {
+    // Consecutive per-pixel post processes are rendered in a single pass
+    EffectPtr fusedEffect = nullptr;
+    const auto last
+      = fusionEnabled && !doNotPresent ? _findFusedGroup(postProcesses, index, fusedEffect) : index;
+
     auto& pp = postProcesses[index];
-    if (index < len - 1) {
-      pp->_outputTexture = postProcesses[index + 1]->activate(camera, targetTexture);
+    if (last < len - 1) {
+      pp->_outputTexture = postProcesses[last + 1]->activate(camera, targetTexture);
     }
     else {
       if (targetTexture) {
@@ -166,6 +220,36 @@ void PostProcessManager::_finalizeFrame(bool doNotPresent, const InternalTexture
       break;
     }
 
+    if (fusedEffect) {
+      // The later stages are not activated by the previous ones, but their size and activation
+      // are used by their callbacks, e.g. for the aspect ratio of the image processing
+      for (auto i = index + 1; i <= last; ++i) {
+        postProcesses[i]->_activateAsFusedStage(camera, *pp);
+      }
+      for (auto i = index; i <= last; ++i) {
+        postProcesses[i]->_outputTexture = pp->_outputTexture;
+        postProcesses[i]->_applyToFusedEffect(fusedEffect, i == index);
+      }
+      for (auto i = index; i <= last; ++i) {
+        postProcesses[i]->onBeforeRenderObservable.notifyObservers(fusedEffect.get());
+      }
+
+      // VBOs
+      _prepareBuffers();
+      engine->bindBuffers(_vertexBuffers, _indexBuffer, fusedEffect);
+
+      // Draw order
+      engine->drawElementsType(Material::TriangleFillMode, 0, 6);
+
+      for (auto i = index; i <= last; ++i) {
+        postProcesses[i]->onAfterRenderObservable.notifyObservers(fusedEffect.get());
+      }
+      pp->_releaseTransientTextures();
+
+      index = last;
+      continue;
+    }
+
     auto effect = pp->apply();
 
     if (effect) {
@@ -179,6 +263,9 @@ void PostProcessManager::_finalizeFrame(bool doNotPresent, const InternalTexture
       engine->drawElementsType(Material::TriangleFillMode, 0, 6);
 
       pp->onAfterRenderObservable.notifyObservers(effect.get());
+
+      // The input texture of the post process can now be used by the following ones
+      pp->_releaseTransientTextures();
     }
   }
 
@@ -188,6 +275,110 @@ void PostProcessManager::_finalizeFrame(bool doNotPresent, const InternalTexture
   engine->setAlphaMode(Constants::ALPHA_DISABLE);
 }
 
+size_t PostProcessManager::_findFusedGroup(const std::vector<PostProcessPtr>& postProcesses,
+                                           size_t first, EffectPtr& fusedEffect)
+{
+  fusedEffect = nullptr;
+  if (!postProcesses[first]->_canBeFused(nullptr)) {
+    return first;
+  }
+
+  auto last = first;
+  while (last + 1 < postProcesses.size()
+         && postProcesses[last + 1]->_canBeFused(postProcesses[last].get())) {
+    ++last;
+  }
+
+  // Shrink the group until its shaders can be fused, the shorter groups being tried while the
+  // effect of the longer one compiles
+  for (; last > first; --last) {
+    auto effect = _getFusedEffect(postProcesses, first, last);
+    if (effect && effect->isReady()) {
+      fusedEffect = std::move(effect);
+      return last;
+    }
+  }
+
+  return first;
+}
+
+EffectPtr PostProcessManager::_getFusedEffect(const std::vector<PostProcessPtr>& postProcesses,
+                                              size_t first, size_t last)
+{
+  std::string key;
+  for (auto i = first; i <= last; ++i) {
+    key += postProcesses[i]->getEffect()->key() + "|";
+  }
+  if (stl_util::contains(_fusedEffects, key)) {
+    return _fusedEffects[key];
+  }
+  auto& fusedEffect = _fusedEffects[key];
+
+  auto engine = _scene->getEngine();
+  std::vector<std::string> fragmentShaders;
+  std::vector<std::string> defines;
+  std::unordered_map<std::string, std::string> defineLines;
+  IEffectCreationOptions options;
+  options.attributes    = {"position"};
+  options.uniformsNames = {"scale"};
+  for (auto i = first; i <= last; ++i) {
+    auto& effect = postProcesses[i]->getEffect();
+    fragmentShaders.emplace_back(ProcessedFragmentShader(*postProcesses[i], engine));
+    if (fragmentShaders.back().empty()) {
+      return nullptr;
+    }
+
+    // The defines of the post processes are shared by the fused pass
+    for (const auto& define : StringTools::split(effect->defines, '\n')) {
+      const auto line = StringTools::trimCopy(define);
+      if (line.empty()) {
+        continue;
+      }
+      std::istringstream words(line);
+      std::string directive;
+      std::string name;
+      words >> directive >> name;
+      const auto it = defineLines.find(name);
+      if (it == defineLines.end()) {
+        defineLines[name] = line;
+        defines.emplace_back(line);
+      }
+      else if (it->second != line) {
+        return nullptr;
+      }
+    }
+
+    const auto& samplers = effect->getSamplers();
+    for (const auto& uniform : effect->getUniformNames()) {
+      if (!stl_util::contains(samplers, uniform)
+          && !stl_util::contains(options.uniformsNames, uniform)) {
+        options.uniformsNames.emplace_back(uniform);
+      }
+    }
+    for (const auto& sampler : samplers) {
+      if (!stl_util::contains(options.samplers, sampler)) {
+        options.samplers.emplace_back(sampler);
+      }
+    }
+  }
+
+  const auto code = PostProcessFusion::FuseFragmentShaders(fragmentShaders);
+  if (code.empty()) {
+    return nullptr;
+  }
+
+  // Groups generating the same shader share the same name, hence the same compiled effect
+  const auto shaderId   = _FusedShaderIds.try_emplace(code, _FusedShaderIds.size()).first->second;
+  const auto shaderName = "fusedPostProcess" + std::to_string(shaderId);
+  std::unordered_map<std::string, std::string> baseName{{"vertex", "postprocess"},
+                                                        {"fragment", shaderName},
+                                                        {"fragmentSource", code}};
+  options.defines = StringTools::join(defines, '\n');
+
+  fusedEffect = engine->createEffect(baseName, options, engine);
+  return fusedEffect;
+}
+
 void PostProcessManager::dispose()
 {
   if (stl_util::contains(_vertexBuffers, VertexBuffer::PositionKind)) {
@@ -470,6 +470,17 @@ void DefaultRenderingPipeline::_setAutoClearAndTextureSharing(
   }
 }
 
+void DefaultRenderingPipeline::_setAutoClearAndTransientTextures(
+  const PostProcessPtr& postProcess)
+{
+  // The input of the post processes after the merges is not sampled by the following ones: it is
+  // taken from the render target pool and given back once read, the pool alternating between two
+  // textures as the texture sharing does
+  _setAutoClearAndTextureSharing(postProcess, true);
+  postProcess->useOwnOutput();
+  postProcess->transientTextures = true;
+}
+
 void DefaultRenderingPipeline::_buildPipeline()
 {
   if (!_buildAllowed) {
@@ -550,7 +561,7 @@ void DefaultRenderingPipeline::_buildPipeline()
         iEngine, ImageProcessingPostProcessId,
         [this]() -> std::vector<PostProcessPtr> { return {imageProcessing}; },
         true));
-      _setAutoClearAndTextureSharing(imageProcessing);
+      _setAutoClearAndTransientTextures(imageProcessing);
     }
     else {
       _scene->imageProcessingConfiguration()->applyByPostProcess = false;
@@ -562,7 +573,7 @@ void DefaultRenderingPipeline::_buildPipeline()
       sharpen->updateEffect();
     }
     addEffect(_sharpenEffect);
-    _setAutoClearAndTextureSharing(sharpen);
+    _setAutoClearAndTransientTextures(sharpen);
   }
 
   if (grainEnabled) {
@@ -570,7 +581,7 @@ void DefaultRenderingPipeline::_buildPipeline()
       grain->updateEffect();
     }
     addEffect(_grainEffect);
-    _setAutoClearAndTextureSharing(grain);
+    _setAutoClearAndTransientTextures(grain);
   }
 
   if (chromaticAberrationEnabled) {
@@ -578,7 +589,7 @@ void DefaultRenderingPipeline::_buildPipeline()
       chromaticAberration->updateEffect();
     }
     addEffect(_chromaticAberrationEffect);
-    _setAutoClearAndTextureSharing(chromaticAberration);
+    _setAutoClearAndTransientTextures(chromaticAberration);
   }
 
   if (fxaaEnabled) {
@@ -588,7 +599,7 @@ void DefaultRenderingPipeline::_buildPipeline()
     addEffect(PostProcessRenderEffect::New(
       iEngine, FxaaPostProcessId,
       [this]() -> std::vector<PostProcessPtr> { return {fxaa}; }, true));
-    _setAutoClearAndTextureSharing(fxaa, true);
+    _setAutoClearAndTransientTextures(fxaa);
   }
 
   if (!_cameras.empty()) {
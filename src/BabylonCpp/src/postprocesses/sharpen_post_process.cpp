@@ -21,6 +21,8 @@ SharpenPostProcess::SharpenPostProcess(const std::string& iName,
     , colorAmount{1.f}
     , edgeAmount{0.3f}
 {
+  allowFusion = true;
+
   onApply = [this](Effect* effect, EventState& /*ev*/) {
     effect->setFloat2("screenSize", static_cast<float>(width), static_cast<float>(height));
     effect->setFloat2("sharpnessAmounts", edgeAmount, colorAmount);
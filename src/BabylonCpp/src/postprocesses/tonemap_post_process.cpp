@@ -24,6 +24,8 @@ TonemapPostProcess::TonemapPostProcess(const std::string& iName,
                   textureFormat}
     , _operator{operator_}
 {
+  allowFusion = true;
+
   std::ostringstream defines;
   defines << "#define ";
 
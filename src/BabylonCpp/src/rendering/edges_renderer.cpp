@@ -1,17 +1,89 @@
 #include <babylon/rendering/edges_renderer.h>
 
+#include <cmath>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
 #include <babylon/materials/ishader_material_options.h>
 #include <babylon/materials/shader_material.h>
 #include <babylon/meshes/abstract_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
-#include <babylon/rendering/face_adjacencies.h>
 
 namespace BABYLON {
 
+namespace {
+
+// Number of faces processed by a parallel task
+constexpr size_t FaceChunkSize = 4096;
+
+using CellKey = std::array<int64_t, 3>;
+
+struct CellKeyHash {
+  size_t operator()(const CellKey& key) const
+  {
+    return static_cast<size_t>(key[0] * 73856093) ^ static_cast<size_t>(key[1] * 19349663)
+           ^ static_cast<size_t>(key[2] * 83492791);
+  }
+}; // end of struct CellKeyHash
+
+// Returns the welded id of each vertex: vertices within Math::Epsilon of a previous vertex on each
+// axis take its id. The vertices keeping their own id are listed in a grid whose cells are twice as
+// large as the welding distance, so that only the one to eight cells overlapping the neighborhood
+// of a vertex have to be searched.
+std::vector<uint32_t> WeldVertices(const ConstFloat32ArrayView& positions)
+{
+  constexpr auto NoVertex = std::numeric_limits<uint32_t>::max();
+  const auto epsilon      = Math::Epsilon;
+  const auto cellSize     = 2.f * epsilon;
+  const auto vertexCount  = positions.size() / 3;
+  std::vector<uint32_t> ids(vertexCount);
+  std::vector<uint32_t> nextInCell(vertexCount, NoVertex);
+  std::unordered_map<CellKey, uint32_t, CellKeyHash> cells;
+  cells.reserve(vertexCount);
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    const auto* position = &positions[vertex * 3];
+    CellKey first, last;
+    for (size_t axis = 0; axis < 3; ++axis) {
+      first[axis] = static_cast<int64_t>(std::floor((position[axis] - epsilon) / cellSize));
+      last[axis]  = static_cast<int64_t>(std::floor((position[axis] + epsilon) / cellSize));
+    }
+
+    auto id = static_cast<uint32_t>(vertex);
+    for (auto x = first[0]; x <= last[0] && id == vertex; ++x) {
+      for (auto y = first[1]; y <= last[1] && id == vertex; ++y) {
+        for (auto z = first[2]; z <= last[2] && id == vertex; ++z) {
+          const auto it = cells.find({{x, y, z}});
+          for (auto other = it == cells.end() ? NoVertex : it->second;
+               other != NoVertex && id == vertex; other = nextInCell[other]) {
+            const auto* otherPosition = &positions[other * 3];
+            if (std::abs(position[0] - otherPosition[0]) <= epsilon
+                && std::abs(position[1] - otherPosition[1]) <= epsilon
+                && std::abs(position[2] - otherPosition[2]) <= epsilon) {
+              id = other;
+            }
+          }
+        }
+      }
+    }
+    ids[vertex] = id;
+
+    if (id == vertex) {
+      const CellKey cell{{static_cast<int64_t>(std::floor(position[0] / cellSize)),
+                          static_cast<int64_t>(std::floor(position[1] / cellSize)),
+                          static_cast<int64_t>(std::floor(position[2] / cellSize))}};
+      auto& head         = cells.try_emplace(cell, NoVertex).first->second;
+      nextInCell[vertex] = head;
+      head               = static_cast<uint32_t>(vertex);
+    }
+  }
+  return ids;
+}
+
+} // end of anonymous namespace
+
 EdgesRenderer::EdgesRenderer(const AbstractMeshPtr& source, float epsilon,
                              bool checkVerticesInsteadOfIndices, bool generateEdgesLines)
     : edgesWidthScalerForOrthographic{1000.f}
@@ -184,131 +256,108 @@ void EdgesRenderer::createLine(const Vector3& p0, const Vector3& p1, uint32_t of
                                   });
 }
 
-void EdgesRenderer::_generateEdgesLines()
+std::vector<std::array<int, 3>>
+EdgesRenderer::ComputeFaceAdjacencies(const ConstFloat32ArrayView& positions,
+                                      const ConstIndicesArrayView& indices,
+                                      bool checkVerticesInsteadOfIndices)
 {
-  auto positions = _source->getVerticesData(VertexBuffer::PositionKind);
-  auto indices   = _source->getIndices();
-
-  if (indices.empty() || positions.empty()) {
-    return;
-  }
-
-  // First let's find adjacencies
-  std::vector<FaceAdjacencies> adjacencies;
-  std::vector<Vector3> faceNormals;
-
-  // Prepare faces
-  for (unsigned int index = 0; index < indices.size(); index += 3) {
-    FaceAdjacencies _faceAdjacencies;
-    unsigned int p0Index = indices[index + 0];
-    unsigned int p1Index = indices[index + 1];
-    unsigned int p2Index = indices[index + 2];
-
-    _faceAdjacencies.edges = {0, 0, 0};
-
-    _faceAdjacencies.p0
-      = Vector3(positions[p0Index * 3 + 0], positions[p0Index * 3 + 1], positions[p0Index * 3 + 2]);
-    _faceAdjacencies.p1
-      = Vector3(positions[p1Index * 3 + 0], positions[p1Index * 3 + 1], positions[p1Index * 3 + 2]);
-    _faceAdjacencies.p2
-      = Vector3(positions[p2Index * 3 + 0], positions[p2Index * 3 + 1], positions[p2Index * 3 + 2]);
-    auto faceNormal = Vector3::Cross(_faceAdjacencies.p1.subtract(_faceAdjacencies.p0),
-                                     _faceAdjacencies.p2.subtract(_faceAdjacencies.p1));
-
-    faceNormal.normalize();
-
-    faceNormals.emplace_back(faceNormal);
-    adjacencies.emplace_back(_faceAdjacencies);
-  }
-
-  // Scan
-  for (unsigned int index = 0; index < adjacencies.size(); ++index) {
-    auto& faceAdjacencies = adjacencies[index];
-
-    for (unsigned int otherIndex = index + 1; otherIndex < adjacencies.size(); ++otherIndex) {
-      auto& otherFaceAdjacencies = adjacencies[otherIndex];
-
-      if (faceAdjacencies.edgesConnectedCount == 3) { // Full
-        break;
+  const auto faceCount = indices.size() / 3;
+  std::vector<std::array<int, 3>> adjacencies(faceCount, {{-1, -1, -1}});
+  const auto weldedIds
+    = checkVerticesInsteadOfIndices ? WeldVertices(positions) : std::vector<uint32_t>();
+
+  // Key of each edge, made of its sorted vertex ids
+  auto& threadPool = ThreadPool::Default();
+  std::vector<uint64_t> edgeKeys(faceCount * 3);
+  threadPool.parallelFor(0, faceCount, FaceChunkSize, [&](size_t begin, size_t end) {
+    for (auto edge = begin * 3; edge < end * 3; ++edge) {
+      auto a = indices[edge];
+      auto b = indices[edge % 3 == 2 ? edge - 2 : edge + 1];
+      if (!weldedIds.empty()) {
+        a = weldedIds[a];
+        b = weldedIds[b];
       }
-
-      if (otherFaceAdjacencies.edgesConnectedCount == 3) { // Full
-        continue;
-      }
-
-      const auto& otherP0 = indices[otherIndex * 3 + 0];
-      const auto& otherP1 = indices[otherIndex * 3 + 1];
-      const auto& otherP2 = indices[otherIndex * 3 + 2];
-
-      for (unsigned int edgeIndex = 0; edgeIndex < 3; ++edgeIndex) {
-        int otherEdgeIndex = 0;
-
-        if (edgeIndex >= faceAdjacencies.edges.size()) {
+      edgeKeys[edge] = (static_cast<uint64_t>(std::min(a, b)) << 32) | std::max(a, b);
+    }
+  });
+
+  // Match the edges, each task owning the keys of a hash partition and visiting the edges in face
+  // order so that the result does not depend on the number of tasks. An edge is paired with the
+  // next unpaired edge sharing its key, like the faces were previously scanned.
+  const auto partitionCount = faceCount >= FaceChunkSize ? threadPool.concurrency() : 1;
+  threadPool.parallelFor(0, partitionCount, 1, [&](size_t begin, size_t end) {
+    std::unordered_map<uint64_t, size_t> pendingEdges;
+    for (auto partition = begin; partition < end; ++partition) {
+      pendingEdges.clear();
+      for (size_t edge = 0; edge < edgeKeys.size(); ++edge) {
+        const auto key = edgeKeys[edge];
+        if ((key ^ (key >> 29)) % partitionCount != partition) {
           continue;
         }
-
-        switch (edgeIndex) {
-          case 0:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p0, faceAdjacencies.p1, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3], indices[index * 3 + 1], otherP0, otherP1, otherP2);
-            }
-            break;
-          case 1:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p1, faceAdjacencies.p2, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 1], indices[index * 3 + 2], otherP0, otherP1, otherP2);
-            }
-            break;
-          case 2:
-          default:
-            if (_checkVerticesInsteadOfIndices) {
-              otherEdgeIndex = _processEdgeForAdjacenciesWithVertices(
-                faceAdjacencies.p2, faceAdjacencies.p0, otherFaceAdjacencies.p0,
-                otherFaceAdjacencies.p1, otherFaceAdjacencies.p2);
-            }
-            else {
-              otherEdgeIndex = _processEdgeForAdjacencies(
-                indices[index * 3 + 2], indices[index * 3], otherP0, otherP1, otherP2);
-            }
-        }
-
-        if (otherEdgeIndex == -1) {
+        const auto [it, inserted] = pendingEdges.try_emplace(key, edge);
+        const auto otherEdge      = it->second;
+        if (inserted || otherEdge / 3 == edge / 3) {
           continue;
         }
+        adjacencies[edge / 3][edge % 3]           = static_cast<int>(otherEdge / 3);
+        adjacencies[otherEdge / 3][otherEdge % 3] = static_cast<int>(edge / 3);
+        pendingEdges.erase(it);
+      }
+    }
+  });
 
-        faceAdjacencies.edges[edgeIndex] = static_cast<int>(otherIndex);
-        otherFaceAdjacencies.edges[static_cast<size_t>(otherEdgeIndex)] = static_cast<int>(index);
+  return adjacencies;
+}
 
-        ++faceAdjacencies.edgesConnectedCount;
-        ++otherFaceAdjacencies.edgesConnectedCount;
+void EdgesRenderer::_generateEdgesLines()
+{
+  // Read the geometry in place, only copying the data that can not be viewed directly
+  Float32Array positionsCopy;
+  IndicesArray indicesCopy;
+  auto positions = _source->getVerticesDataView(VertexBuffer::PositionKind);
+  if (positions.empty()) {
+    positionsCopy = _source->getVerticesData(VertexBuffer::PositionKind);
+    positions     = positionsCopy;
+  }
+  auto indices = _source->getIndicesView();
+  if (indices.empty()) {
+    indicesCopy = _source->getIndices();
+    indices     = indicesCopy;
+  }
 
-        if (faceAdjacencies.edgesConnectedCount == 3) {
-          break;
-        }
-      }
-    }
+  if (indices.empty() || positions.empty()) {
+    return;
   }
 
+  // First let's find adjacencies
+  const auto adjacencies
+    = ComputeFaceAdjacencies(positions, indices, _checkVerticesInsteadOfIndices);
+  const auto faceCount = adjacencies.size();
+  const auto vertex    = [&positions, &indices](size_t index) {
+    const auto offset = indices[index] * 3;
+    return Vector3(positions[offset], positions[offset + 1], positions[offset + 2]);
+  };
+
+  // Face normals
+  std::vector<Vector3> faceNormals(faceCount);
+  ThreadPool::Default().parallelFor(0, faceCount, FaceChunkSize, [&](size_t begin, size_t end) {
+    for (auto face = begin; face < end; ++face) {
+      const auto p0 = vertex(face * 3), p1 = vertex(face * 3 + 1), p2 = vertex(face * 3 + 2);
+      faceNormals[face] = Vector3::Cross(p1.subtract(p0), p2.subtract(p1));
+      faceNormals[face].normalize();
+    }
+  });
+
   // Create lines
-  for (unsigned index = 0; index < adjacencies.size(); ++index) {
+  for (size_t index = 0; index < faceCount; ++index) {
     // We need a line when a face has no adjacency on a specific edge or if all
     // the adjacencies has an angle greater than epsilon
     const auto& current = adjacencies[index];
+    const auto p0 = vertex(index * 3), p1 = vertex(index * 3 + 1), p2 = vertex(index * 3 + 2);
 
-    _checkEdge(index, current.edges[0], faceNormals, current.p0, current.p1);
-    _checkEdge(index, current.edges[1], faceNormals, current.p1, current.p2);
-    _checkEdge(index, current.edges[2], faceNormals, current.p2, current.p0);
+    _checkEdge(index, current[0], faceNormals, p0, p1);
+    _checkEdge(index, current[1], faceNormals, p1, p2);
+    _checkEdge(index, current[2], faceNormals, p2, p0);
   }
 
   // Merge into a single mesh
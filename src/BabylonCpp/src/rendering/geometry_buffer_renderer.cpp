@@ -15,6 +15,7 @@
 #include <babylon/meshes/mesh.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/morph/morph_target_manager.h>
 #include <babylon/rendering/geometry_buffer_renderer_scene_component.h>
@@ -135,6 +136,10 @@ bool GeometryBufferRenderer::isReady(SubMesh* subMesh, bool useInstances)
 
   auto mesh = subMesh->getMesh();
 
+  if (VertexQuantization::IsOctahedralEncoded(mesh.get(), VertexBuffer::NormalKind)) {
+    defines.emplace_back("#define NORMAL_OCTAHEDRAL");
+  }
+
   // Alpha test
   if (material && material->needAlphaTesting()) {
     defines.emplace_back("#define ALPHATEST");
@@ -14,6 +14,7 @@
 #include <babylon/meshes/_instances_batch.h>
 #include <babylon/meshes/sub_mesh.h>
 #include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
 #include <babylon/misc/string_tools.h>
 #include <babylon/morph/morph_target_manager.h>
 #include <babylon/states/alpha_state.h>
@@ -127,6 +128,10 @@ bool OutlineRenderer::isReady(SubMesh* subMesh, bool useInstances)
   auto mesh     = subMesh->getMesh();
   auto material = subMesh->getMaterial();
 
+  if (VertexQuantization::IsOctahedralEncoded(mesh.get(), VertexBuffer::NormalKind)) {
+    defines.emplace_back("#define NORMAL_OCTAHEDRAL");
+  }
+
   if (material) {
     // Alpha test
     if (material->needAlphaTesting()) {
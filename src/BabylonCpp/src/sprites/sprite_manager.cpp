@@ -1,10 +1,14 @@
 #include <babylon/sprites/sprite_manager.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/collisions/picking_info.h>
 #include <babylon/culling/ray.h>
 #include <babylon/engines/engine.h>
+#include <babylon/engines/engine_capabilities.h>
 #include <babylon/engines/scene.h>
 #include <babylon/engines/scene_component_constants.h>
 #include <babylon/materials/effect.h>
@@ -22,6 +26,13 @@
 
 namespace BABYLON {
 
+namespace {
+
+// Number of sprites whose vertex data is written by a parallel task
+constexpr size_t SpriteChunkSize = 2048;
+
+} // end of anonymous namespace
+
 SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl,
                              unsigned int capacity, const ISize& cellSize, Scene* scene,
                              float epsilon, unsigned int samplingMode, bool fromPacked,
@@ -35,6 +46,8 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
     , _onDisposeObserver{nullptr}
     , _epsilon{epsilon}
     , _scene{scene}
+    , _useInstancing{false}
+    , _vertexBufferSize{18}
 {
   auto component = std::static_pointer_cast<SpriteSceneComponent>(
     scene->_getComponent(SceneComponentConstants::NAME_SPRITE));
@@ -72,34 +85,65 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
     return;
   }
 
-  IndicesArray indices;
-  int index = 0;
-  for (unsigned int count = 0; count < capacity; ++count) {
-    indices.emplace_back(index + 0);
-    indices.emplace_back(index + 1);
-    indices.emplace_back(index + 2);
-    indices.emplace_back(index + 0);
-    indices.emplace_back(index + 2);
-    indices.emplace_back(index + 3);
-    index += 4;
-  }
+  auto engine    = scene->getEngine();
+  _useInstancing = engine->getCaps().instancedArrays;
+
+  if (!_useInstancing) {
+    IndicesArray indices;
+    int index = 0;
+    for (unsigned int count = 0; count < capacity; ++count) {
+      indices.emplace_back(index + 0);
+      indices.emplace_back(index + 1);
+      indices.emplace_back(index + 2);
+      indices.emplace_back(index + 0);
+      indices.emplace_back(index + 2);
+      indices.emplace_back(index + 3);
+      index += 4;
+    }
 
-  _indexBuffer = scene->getEngine()->createIndexBuffer(indices);
+    _indexBuffer = engine->createIndexBuffer(indices);
+  }
 
   // VBO
-  // 18 floats per sprite (x, y, z, angle, sizeX, sizeY, offsetX, offsetY, invertU, invertV,
-  // cellLeft, cellTop, cellWidth, cellHeight, color r, color g, color b, color a)
-  _vertexData.resize(capacity * 18 * 4);
-  _buffer = std::make_unique<Buffer>(scene->getEngine(), _vertexData, true, 18);
-
-  auto positions = _buffer->createVertexBuffer(VertexBuffer::PositionKind, 0, 4);
-  auto options   = _buffer->createVertexBuffer(VertexBuffer::OptionsKind, 4, 4);
-  auto inverts   = _buffer->createVertexBuffer(VertexBuffer::InvertsKind, 8, 2);
-  auto cellInfo  = _buffer->createVertexBuffer(VertexBuffer::CellInfoKind, 10, 4);
-  auto colors    = _buffer->createVertexBuffer(VertexBuffer::ColorKind, 14, 4);
+  // 16 floats per sprite instance (x, y, z, angle, sizeX, sizeY, invertU, invertV, cellLeft,
+  // cellTop, cellWidth, cellHeight, color r, color g, color b, color a), the corner offsets being
+  // shared by the instances. Without instancing, 18 floats per sprite corner, the offsets
+  // (offsetX, offsetY) following the size.
+  _vertexBufferSize = _useInstancing ? 16 : 18;
+  _vertexData.resize(capacity * _vertexBufferSize * (_useInstancing ? 1 : 4));
+  _buffer = std::make_unique<Buffer>(engine, _vertexData, true, _vertexBufferSize);
+
+  size_t dataOffset = 0;
+  auto positions    = _buffer->createVertexBuffer(VertexBuffer::PositionKind, dataOffset, 4,
+                                               _vertexBufferSize, _useInstancing);
+  dataOffset += 4;
+  auto options = _buffer->createVertexBuffer(VertexBuffer::OptionsKind, dataOffset, 2,
+                                             _vertexBufferSize, _useInstancing);
+  dataOffset += 2;
+  std::unique_ptr<VertexBuffer> offsets = nullptr;
+  if (_useInstancing) {
+    Float32Array spriteData{_epsilon,       _epsilon,       1.f - _epsilon, _epsilon,
+                            1.f - _epsilon, 1.f - _epsilon, _epsilon,       1.f - _epsilon};
+    _spriteBuffer = std::make_unique<Buffer>(engine, spriteData, false, 2);
+    offsets       = _spriteBuffer->createVertexBuffer(VertexBuffer::OffsetKind, 0, 2);
+  }
+  else {
+    offsets = _buffer->createVertexBuffer(VertexBuffer::OffsetKind, dataOffset, 2,
+                                          _vertexBufferSize, _useInstancing);
+    dataOffset += 2;
+  }
+  auto inverts = _buffer->createVertexBuffer(VertexBuffer::InvertsKind, dataOffset, 2,
+                                             _vertexBufferSize, _useInstancing);
+  dataOffset += 2;
+  auto cellInfo = _buffer->createVertexBuffer(VertexBuffer::CellInfoKind, dataOffset, 4,
+                                              _vertexBufferSize, _useInstancing);
+  dataOffset += 4;
+  auto colors = _buffer->createVertexBuffer(VertexBuffer::ColorKind, dataOffset, 4,
+                                            _vertexBufferSize, _useInstancing);
 
   _vertexBuffers[VertexBuffer::PositionKind] = std::move(positions);
   _vertexBuffers[VertexBuffer::OptionsKind]  = std::move(options);
+  _vertexBuffers[VertexBuffer::OffsetKind]   = std::move(offsets);
   _vertexBuffers[VertexBuffer::InvertsKind]  = std::move(inverts);
   _vertexBuffers[VertexBuffer::CellInfoKind] = std::move(cellInfo);
   _vertexBuffers[VertexBuffer::ColorKind]    = std::move(colors);
@@ -109,23 +153,25 @@ SpriteManager::SpriteManager(const std::string& iName, const std::string& imgUrl
   {
     IEffectCreationOptions spriteOptions;
     spriteOptions.attributes
-      = {VertexBuffer::PositionKind, "options", "inverts", "cellInfo", VertexBuffer::ColorKind};
+      = {VertexBuffer::PositionKind, "options", "offset", "inverts", "cellInfo",
+         VertexBuffer::ColorKind};
     spriteOptions.uniformsNames = {"view", "projection", "textureInfos", "alphaTest"};
     spriteOptions.samplers      = {"diffuseSampler"};
 
-    _effectBase = _scene->getEngine()->createEffect("sprites", spriteOptions, _scene->getEngine());
+    _effectBase = engine->createEffect("sprites", spriteOptions, engine);
   }
 
   {
     IEffectCreationOptions spriteOptions;
     spriteOptions.attributes
-      = {VertexBuffer::PositionKind, "options", "inverts", "cellInfo", VertexBuffer::ColorKind};
+      = {VertexBuffer::PositionKind, "options", "offset", "inverts", "cellInfo",
+         VertexBuffer::ColorKind};
     spriteOptions.uniformsNames
       = {"view", "projection", "textureInfos", "alphaTest", "vFogInfos", "vFogColor"};
     spriteOptions.samplers = {"diffuseSampler"};
     spriteOptions.defines  = "#define FOG";
 
-    _effectFog = _scene->getEngine()->createEffect("sprites", spriteOptions, _scene->getEngine());
+    _effectFog = engine->createEffect("sprites", spriteOptions, engine);
   }
 
   if (_fromPacked) {
@@ -163,41 +209,45 @@ void SpriteManager::_makePacked(const std::string& /*imgUrl*/, const std::string
   // TODO Implement
 }
 
-void SpriteManager::_appendSpriteVertex(size_t index, Sprite& sprite, int offsetX, int offsetY,
-                                        const ISize& baseSize)
+bool SpriteManager::_appendSpriteVertex(size_t index, const Sprite& sprite, int offsetX,
+                                        int offsetY, const ISize& baseSize)
 {
-  size_t arrayOffset = index * 18;
+  std::array<float, 18> vertex{};
+  size_t arrayOffset = 0;
 
-  auto offsetXVal = static_cast<float>(offsetX);
-  auto offsetYVal = static_cast<float>(offsetY);
+  // Positions
+  vertex[arrayOffset++] = sprite.position.x;
+  vertex[arrayOffset++] = sprite.position.y;
+  vertex[arrayOffset++] = sprite.position.z;
+  vertex[arrayOffset++] = sprite.angle;
+  // Options
+  vertex[arrayOffset++] = static_cast<float>(sprite.width);
+  vertex[arrayOffset++] = static_cast<float>(sprite.height);
+  // Offsets, shared by the instances when instancing is used
+  if (!_useInstancing) {
+    auto offsetXVal = static_cast<float>(offsetX);
+    auto offsetYVal = static_cast<float>(offsetY);
+
+    if (offsetX == 0) {
+      offsetXVal = _epsilon;
+    }
+    else if (offsetX == 1) {
+      offsetXVal = 1.f - _epsilon;
+    }
 
-  if (offsetX == 0) {
-    offsetXVal = _epsilon;
-  }
-  else if (offsetX == 1) {
-    offsetXVal = 1.f - _epsilon;
-  }
+    if (offsetY == 0) {
+      offsetYVal = _epsilon;
+    }
+    else if (offsetY == 1) {
+      offsetYVal = 1.f - _epsilon;
+    }
 
-  if (offsetY == 0) {
-    offsetYVal = _epsilon;
-  }
-  else if (offsetY == 1) {
-    offsetYVal = 1.f - _epsilon;
+    vertex[arrayOffset++] = offsetXVal;
+    vertex[arrayOffset++] = offsetYVal;
   }
-
-  // Positions
-  _vertexData[arrayOffset + 0] = sprite.position.x;
-  _vertexData[arrayOffset + 1] = sprite.position.y;
-  _vertexData[arrayOffset + 2] = sprite.position.z;
-  _vertexData[arrayOffset + 3] = sprite.angle;
-  // Options
-  _vertexData[arrayOffset + 4] = static_cast<float>(sprite.width);
-  _vertexData[arrayOffset + 5] = static_cast<float>(sprite.height);
-  _vertexData[arrayOffset + 6] = offsetXVal;
-  _vertexData[arrayOffset + 7] = offsetYVal;
   // Inverts
-  _vertexData[arrayOffset + 8] = sprite.invertU ? 1.f : 0.f;
-  _vertexData[arrayOffset + 9] = sprite.invertV ? 1.f : 0.f;
+  vertex[arrayOffset++] = sprite.invertU ? 1.f : 0.f;
+  vertex[arrayOffset++] = sprite.invertV ? 1.f : 0.f;
   // CellIfo
   if (_packedAndReady) {
     // TODO implement
@@ -205,18 +255,78 @@ void SpriteManager::_appendSpriteVertex(size_t index, Sprite& sprite, int offset
   else {
     auto rowSize = baseSize.width / cellWidth;
     auto offset  = (rowSize == 0) ? 0 : sprite.cellIndex / rowSize;
-    _vertexData[arrayOffset + 10]
-      = static_cast<float>((sprite.cellIndex - offset * rowSize) * cellWidth / baseSize.width);
-
-    _vertexData[arrayOffset + 11] = static_cast<float>(offset * cellHeight / baseSize.height);
-    _vertexData[arrayOffset + 12] = static_cast<float>(cellWidth / baseSize.width);
-    _vertexData[arrayOffset + 13] = static_cast<float>(cellHeight / baseSize.height);
+    // Divided as floats, the cells being smaller than the texture
+    const auto textureWidth  = static_cast<float>(baseSize.width);
+    const auto textureHeight = static_cast<float>(baseSize.height);
+    vertex[arrayOffset + 0]
+      = static_cast<float>((sprite.cellIndex - offset * rowSize) * cellWidth) / textureWidth;
+
+    vertex[arrayOffset + 1] = static_cast<float>(offset * cellHeight) / textureHeight;
+    vertex[arrayOffset + 2] = static_cast<float>(cellWidth) / textureWidth;
+    vertex[arrayOffset + 3] = static_cast<float>(cellHeight) / textureHeight;
   }
+  arrayOffset += 4;
   // Color
-  _vertexData[arrayOffset + 14] = sprite.color->r;
-  _vertexData[arrayOffset + 15] = sprite.color->g;
-  _vertexData[arrayOffset + 16] = sprite.color->b;
-  _vertexData[arrayOffset + 17] = sprite.color->a;
+  vertex[arrayOffset++] = sprite.color->r;
+  vertex[arrayOffset++] = sprite.color->g;
+  vertex[arrayOffset++] = sprite.color->b;
+  vertex[arrayOffset++] = sprite.color->a;
+
+  // Only the changed vertices are uploaded
+  auto data = _vertexData.begin() + static_cast<std::ptrdiff_t>(index * _vertexBufferSize);
+  if (std::equal(vertex.begin(), vertex.begin() + arrayOffset, data)) {
+    return false;
+  }
+  std::copy(vertex.begin(), vertex.begin() + arrayOffset, data);
+
+  return true;
+}
+
+std::pair<size_t, size_t> SpriteManager::_appendSprites(size_t begin, size_t end,
+                                                        const ISize& baseSize)
+{
+  static constexpr std::array<std::pair<int, int>, 4> corners{{{0, 0}, {1, 0}, {1, 1}, {0, 1}}};
+
+  auto first = end, last = begin;
+  for (auto index = begin; index < end; ++index) {
+    const auto& sprite = *_visibleSprites[index];
+    auto changed       = false;
+    if (_useInstancing) {
+      changed = _appendSpriteVertex(index, sprite, 0, 0, baseSize);
+    }
+    else {
+      for (size_t corner = 0; corner < corners.size(); ++corner) {
+        changed = _appendSpriteVertex(index * 4 + corner, sprite, corners[corner].first,
+                                      corners[corner].second, baseSize)
+                  || changed;
+      }
+    }
+    if (changed) {
+      first = std::min(first, index);
+      last  = index + 1;
+    }
+  }
+
+  return first < last ? std::make_pair(first, last) : std::make_pair(size_t(0), size_t(0));
+}
+
+void SpriteManager::_uploadSprites(size_t first, size_t last)
+{
+  const auto spriteSize = _vertexBufferSize * (_useInstancing ? 1 : 4);
+  const auto begin      = _vertexData.begin() + static_cast<std::ptrdiff_t>(first * spriteSize);
+  const auto end        = _vertexData.begin() + static_cast<std::ptrdiff_t>(last * spriteSize);
+  _buffer->updateDirectly(Float32Array(begin, end), first * spriteSize);
+}
+
+void SpriteManager::_drawSprites(size_t spriteCount)
+{
+  auto engine = _scene->getEngine();
+  if (_useInstancing) {
+    engine->drawArraysType(Material::TriangleFanDrawMode, 0, 4, static_cast<int>(spriteCount));
+  }
+  else {
+    engine->drawElementsType(Material::TriangleFillMode, 0, static_cast<int>(spriteCount * 6));
+  }
 }
 
 std::optional<PickingInfo>
@@ -370,31 +480,62 @@ void SpriteManager::render()
 
   // Sprites
   auto deltaTime = engine->getDeltaTime();
-  auto max       = std::min(_capacity, sprites.size());
 
-  auto offset   = 0u;
-  auto noSprite = true;
+  // Animations run first as a sprite is disposed when its animation ends if requested
+  for (size_t index = 0; index < std::min(_capacity, sprites.size());) {
+    const auto sprite = sprites[index];
+    if (sprite && sprite->isVisible) {
+      sprite->_animate(deltaTime);
+    }
+    if (index < sprites.size() && sprites[index] == sprite) {
+      ++index;
+    }
+  }
+
+  _visibleSprites.clear();
+  const auto max = std::min(_capacity, sprites.size());
   for (size_t index = 0; index < max; index++) {
     const auto& sprite = sprites[index];
-
-    if (!sprite || !sprite->isVisible) {
-      continue;
+    if (sprite && sprite->isVisible) {
+      _visibleSprites.emplace_back(sprite.get());
     }
-
-    noSprite = false;
-    sprite->_animate(deltaTime);
-
-    _appendSpriteVertex(offset++, *sprite, 0, 0, baseSize);
-    _appendSpriteVertex(offset++, *sprite, 1, 0, baseSize);
-    _appendSpriteVertex(offset++, *sprite, 1, 1, baseSize);
-    _appendSpriteVertex(offset++, *sprite, 0, 1, baseSize);
   }
 
-  if (noSprite) {
+  if (_visibleSprites.empty()) {
     return;
   }
 
-  _buffer->update(_vertexData);
+  // Vertex data, written in parallel chunks which report the sprites that changed. The chunks are
+  // iterated here as a pool without worker threads processes the whole range at once.
+  const auto spriteCount = _visibleSprites.size();
+  const auto chunkCount  = (spriteCount + SpriteChunkSize - 1) / SpriteChunkSize;
+  _dirtyRanges.assign(chunkCount, {0, 0});
+  ThreadPool::Default().parallelFor(0, chunkCount, 1, [&](size_t begin, size_t end) {
+    for (auto chunk = begin; chunk < end; ++chunk) {
+      const auto first    = chunk * SpriteChunkSize;
+      _dirtyRanges[chunk] = _appendSprites(first, std::min(first + SpriteChunkSize, spriteCount),
+                                           baseSize);
+    }
+  });
+
+  // Upload of the changed sprites, the ranges less than a chunk apart being merged
+  size_t first = 0, last = 0;
+  for (const auto& range : _dirtyRanges) {
+    if (range.first == range.second) {
+      continue;
+    }
+    if (first < last && range.first > last + SpriteChunkSize) {
+      _uploadSprites(first, last);
+      first = last = 0;
+    }
+    if (first == last) {
+      first = range.first;
+    }
+    last = range.second;
+  }
+  if (first < last) {
+    _uploadSprites(first, last);
+  }
 
   // Render
   auto effect = _effectBase;
@@ -424,13 +565,17 @@ void SpriteManager::render()
   engine->setDepthFunctionToLessOrEqual();
   effect->setBool("alphaTest", true);
   engine->setColorWrite(false);
-  engine->drawElementsType(Material::TriangleFillMode, 0, static_cast<int>((offset / 4.f) * 6));
+  _drawSprites(spriteCount);
   engine->setColorWrite(true);
   effect->setBool("alphaTest", false);
 
   engine->setAlphaMode(Constants::ALPHA_COMBINE);
-  engine->drawElementsType(Material::TriangleFillMode, 0, static_cast<int>((offset / 4.f) * 6));
+  _drawSprites(spriteCount);
   engine->setAlphaMode(Constants::ALPHA_DISABLE);
+
+  if (_useInstancing) {
+    engine->unbindInstanceAttributes();
+  }
 }
 
 void SpriteManager::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
@@ -440,6 +585,11 @@ void SpriteManager::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndText
     _buffer = nullptr;
   }
 
+  if (_spriteBuffer) {
+    _spriteBuffer->dispose();
+    _spriteBuffer = nullptr;
+  }
+
   if (_indexBuffer) {
     _scene->getEngine()->_releaseBuffer(_indexBuffer);
     _indexBuffer = nullptr;
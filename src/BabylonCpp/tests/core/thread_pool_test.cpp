@@ -0,0 +1,72 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <stdexcept>
+
+#include <babylon/core/thread_pool.h>
+
+TEST(TestThreadPool, parallelFor)
+{
+  using namespace BABYLON;
+
+  for (const size_t threadCount : {0, 1, 4}) {
+    ThreadPool threadPool(threadCount);
+    EXPECT_EQ(threadPool.concurrency(), threadCount + 1);
+
+    // Every element is processed exactly once, in chunks of the requested size
+    std::vector<int> counts(10001, 0);
+    std::atomic<size_t> chunkCount{0};
+    threadPool.parallelFor(0, counts.size(), 100, [&](size_t begin, size_t end) {
+      EXPECT_TRUE(threadCount == 0 || begin % 100 == 0);
+      for (auto i = begin; i < end; ++i) {
+        ++counts[i];
+      }
+      ++chunkCount;
+    });
+    EXPECT_THAT(counts, ::testing::Each(1));
+    EXPECT_EQ(chunkCount, threadCount == 0 ? 1u : 101u);
+
+    // Nested calls
+    std::atomic<size_t> total{0};
+    threadPool.parallelFor(0, 8, 1, [&](size_t begin, size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        threadPool.parallelFor(0, 100, 10, [&](size_t b, size_t e) { total += e - b; });
+      }
+    });
+    EXPECT_EQ(total, 800u);
+  }
+}
+
+TEST(TestThreadPool, exceptions)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(2);
+  EXPECT_THROW(threadPool.parallelFor(0, 100, 1,
+                                      [](size_t begin, size_t) {
+                                        if (begin == 42) {
+                                          throw std::runtime_error("error");
+                                        }
+                                      }),
+               std::runtime_error);
+
+  auto future = threadPool.submit([]() { throw std::runtime_error("error"); });
+  EXPECT_THROW(future.get(), std::runtime_error);
+}
+
+TEST(TestThreadPool, submit)
+{
+  using namespace BABYLON;
+
+  ThreadPool threadPool(2);
+  std::atomic<int> sum{0};
+  std::vector<std::future<void>> futures;
+  for (int i = 1; i <= 10; ++i) {
+    futures.emplace_back(threadPool.submit([&sum, i]() { sum += i; }));
+  }
+  for (auto& future : futures) {
+    future.get();
+  }
+  EXPECT_EQ(sum, 55);
+}
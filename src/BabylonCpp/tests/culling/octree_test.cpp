@@ -0,0 +1,215 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/culling/octrees/octree.h>
+#include <babylon/culling/octrees/octree_block.h>
+#include <babylon/culling/ray.h>
+#include <babylon/maths/plane.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+/**
+ * @brief Octree of points, the entries being addresses in an array of positions that are never
+ * dereferenced as meshes.
+ */
+struct PointOctree {
+  using Entry = BABYLON::AbstractMesh*;
+
+  PointOctree(size_t pointCount, size_t maxBlockCapacity, size_t maxDepth)
+      : positions(pointCount)
+      , octree{[this](Entry& entry, BABYLON::OctreeBlock<Entry>& block) {
+                 const auto& position = positionOf(entry);
+                 const auto& min = block.minPoint();
+                 const auto& max = block.maxPoint();
+                 if (position.x >= min.x && position.x <= max.x && position.y >= min.y
+                     && position.y <= max.y && position.z >= min.z && position.z <= max.z) {
+                   block.entries.emplace_back(entry);
+                 }
+               },
+               maxBlockCapacity, maxDepth}
+  {
+    std::mt19937 generator(42);
+    std::uniform_real_distribution<float> distribution(-10.f, 10.f);
+    for (auto& position : positions) {
+      position = BABYLON::Vector3(distribution(generator), distribution(generator),
+                                  distribution(generator));
+      entries.emplace_back(reinterpret_cast<Entry>(&position));
+    }
+    octree.update(BABYLON::Vector3(-10.f, -10.f, -10.f), BABYLON::Vector3(10.f, 10.f, 10.f),
+                  entries);
+  }
+
+  const BABYLON::Vector3& positionOf(Entry entry) const
+  {
+    return *reinterpret_cast<const BABYLON::Vector3*>(entry);
+  }
+
+  std::vector<BABYLON::Vector3> positions;
+  std::vector<Entry> entries;
+  BABYLON::Octree<Entry> octree;
+}; // end of struct PointOctree
+
+std::array<BABYLON::Plane, 6> CreateFrustumPlanes()
+{
+  using namespace BABYLON;
+
+  // Box from (-4, -3, -2) to (5, 6, 7) with one corner cut off, the normals pointing inside
+  return {{Plane(1.f, 0.f, 0.f, 4.f), Plane(-1.f, 0.f, 0.f, 5.f), Plane(0.f, 1.f, 0.f, 3.f),
+           Plane(0.f, -1.f, 0.f, 6.f), Plane(0.f, 0.f, 1.f, 2.f),
+           Plane(-0.57735f, -0.57735f, -0.57735f, 4.f)}};
+}
+
+// Selection of the recursive traversal of the blocks
+template <typename Query>
+std::vector<BABYLON::AbstractMesh*> RecursiveSelection(PointOctree& points, const Query& query)
+{
+  std::vector<BABYLON::AbstractMesh*> selection;
+  for (auto& block : points.octree.blocks) {
+    query(block, selection);
+  }
+  return selection;
+}
+
+} // end of anonymous namespace
+
+TEST(TestOctree, SelectMatchesRecursiveTraversal)
+{
+  using namespace BABYLON;
+
+  // The larger octree is traversed in parallel when several threads are available
+  for (const auto pointCount : {500u, 20000u}) {
+    PointOctree points(pointCount, 16, 4);
+    const auto planes = CreateFrustumPlanes();
+
+    const auto expected = RecursiveSelection(points, [&planes](auto& block, auto& selection) {
+      block.select(planes, selection, true);
+    });
+    EXPECT_EQ(points.octree.select(planes, true), expected);
+
+    // Every point inside the frustum is selected
+    const auto& selection = points.octree.select(planes, false);
+    EXPECT_TRUE(std::is_sorted(selection.begin(), selection.end()));
+    for (const auto entry : points.entries) {
+      const auto& position = points.positionOf(entry);
+      const auto inside = std::all_of(planes.begin(), planes.end(), [&position](const Plane& p) {
+        return p.dotCoordinate(position) >= 0.f;
+      });
+      if (inside) {
+        EXPECT_TRUE(std::binary_search(selection.begin(), selection.end(), entry));
+      }
+    }
+  }
+}
+
+TEST(TestOctree, IntersectsMatchesRecursiveTraversal)
+{
+  using namespace BABYLON;
+
+  PointOctree points(2000, 8, 3);
+  const Vector3 center(1.f, -2.f, 3.f);
+  const auto radius = 4.5f;
+
+  const auto expected = RecursiveSelection(points, [&](auto& block, auto& selection) {
+    block.intersects(center, radius, selection, true);
+  });
+  EXPECT_EQ(points.octree.intersects(center, radius, true), expected);
+  EXPECT_LT(expected.size(), points.entries.size());
+
+  const auto& selection = points.octree.intersects(center, radius, false);
+  for (const auto entry : points.entries) {
+    if (Vector3::Distance(points.positionOf(entry), center) <= radius) {
+      EXPECT_TRUE(std::binary_search(selection.begin(), selection.end(), entry));
+    }
+  }
+}
+
+TEST(TestOctree, IntersectsRayMatchesRecursiveTraversal)
+{
+  using namespace BABYLON;
+
+  PointOctree points(2000, 8, 3);
+  // Oblique ray, and a ray parallel to two axes
+  for (const auto& ray : {Ray(Vector3(-12.f, -11.f, -9.f), Vector3(1.f, 0.9f, 0.7f).normalize()),
+                          Ray(Vector3(2.5f, -3.5f, -20.f), Vector3(0.f, 0.f, 1.f))}) {
+    const auto expected = RecursiveSelection(
+      points, [&ray](auto& block, auto& selection) { block.intersectsRay(ray, selection); });
+    EXPECT_FALSE(expected.empty());
+    EXPECT_LT(expected.size(), points.entries.size());
+    EXPECT_EQ(points.octree.intersectsRay(ray), expected);
+  }
+}
+
+TEST(TestOctree, QueriesFollowContentChanges)
+{
+  using namespace BABYLON;
+
+  PointOctree points(200, 8, 2);
+  PointOctree others(50, 8, 2);
+  const auto planes = CreateFrustumPlanes();
+
+  // Octrees do not share their blocks
+  EXPECT_EQ(others.octree.select(planes).size(),
+            RecursiveSelection(others, [&planes](auto& block, auto& selection) {
+              block.select(planes, selection, true);
+            }).size());
+
+  auto selected = points.octree.select(planes, false);
+  ASSERT_FALSE(selected.empty());
+  auto removed = selected.front();
+  points.octree.removeMesh(removed);
+  const auto& afterRemoval = points.octree.select(planes, false);
+  EXPECT_FALSE(std::binary_search(afterRemoval.begin(), afterRemoval.end(), removed));
+  EXPECT_EQ(afterRemoval.size() + 1, selected.size());
+
+  points.octree.addMesh(removed);
+  EXPECT_EQ(points.octree.select(planes, false), selected);
+
+  // Dynamic content is always selected
+  auto dynamicEntry = others.entries.front();
+  points.octree.dynamicContent.emplace_back(dynamicEntry);
+  const auto& withDynamicContent = points.octree.select(planes, false);
+  EXPECT_EQ(withDynamicContent.size(), selected.size() + 1);
+  EXPECT_TRUE(
+    std::binary_search(withDynamicContent.begin(), withDynamicContent.end(), dynamicEntry));
+}
+
+TEST(TestOctree, EntryOverlappingBlocksIsSelectedOnce)
+{
+  using namespace BABYLON;
+
+  // A point on the boundary between root blocks is stored in each of them
+  PointOctree points(500, 8, 3);
+  const auto overlapping = points.entries.front();
+  points.positions.front() = Vector3(0.f, 0.5f, 0.5f);
+  points.octree.update(Vector3(-10.f, -10.f, -10.f), Vector3(10.f, 10.f, 10.f), points.entries);
+  const auto countOf = [overlapping](const std::vector<AbstractMesh*>& selection) {
+    return std::count(selection.begin(), selection.end(), overlapping);
+  };
+
+  const auto planes = CreateFrustumPlanes();
+  EXPECT_GE(countOf(points.octree.select(planes, true)), 2);
+  const auto& selected = points.octree.select(planes, false);
+  EXPECT_EQ(countOf(selected), 1);
+  EXPECT_EQ(selected, RecursiveSelection(points, [&planes](auto& block, auto& selection) {
+              block.select(planes, selection, false);
+            }));
+
+  const Vector3 center(0.f, 0.f, 0.f);
+  EXPECT_GE(countOf(points.octree.intersects(center, 2.f, true)), 2);
+  const auto& intersected = points.octree.intersects(center, 2.f, false);
+  EXPECT_EQ(countOf(intersected), 1);
+  EXPECT_EQ(intersected, RecursiveSelection(points, [&center](auto& block, auto& selection) {
+              block.intersects(center, 2.f, selection, false);
+            }));
+
+  // Picking and collisions never get duplicates
+  const Ray ray(Vector3(-20.f, 0.5f, 0.5f), Vector3(1.f, 0.f, 0.f));
+  const auto& picked = points.octree.intersectsRay(ray);
+  EXPECT_EQ(countOf(picked), 1);
+  EXPECT_EQ(picked, RecursiveSelection(points, [&ray](auto& block, auto& selection) {
+              block.intersectsRay(ray, selection);
+            }));
+}
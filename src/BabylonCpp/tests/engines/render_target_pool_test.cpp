@@ -0,0 +1,150 @@
+#include <gtest/gtest.h>
+
+#include <algorithm>
+
+#include <babylon/engines/constants.h>
+#include <babylon/engines/render_target_pool.h>
+#include <babylon/materials/textures/internal_texture.h>
+
+namespace {
+
+/**
+ * @brief Render target pool creating textures without engine, and recording the disposed ones.
+ */
+struct TestPool {
+  TestPool()
+      : pool{[this](const BABYLON::ISize& size, const BABYLON::IRenderTargetOptions& /*options*/,
+                    unsigned int samples) {
+               auto texture = BABYLON::InternalTexture::New(
+                 nullptr, BABYLON::InternalTextureSource::RenderTarget, true);
+               texture->width   = size.width;
+               texture->height  = size.height;
+               texture->samples = samples;
+               ++createdCount;
+               return texture;
+             },
+             [this](const BABYLON::InternalTexturePtr& texture) {
+               disposedTextures.emplace_back(texture);
+             }}
+  {
+  }
+
+  size_t createdCount = 0;
+  std::vector<BABYLON::InternalTexturePtr> disposedTextures;
+  BABYLON::RenderTargetPool pool;
+}; // end of struct TestPool
+
+} // end of anonymous namespace
+
+TEST(TestRenderTargetPool, ReuseReleasedTextures)
+{
+  using namespace BABYLON;
+
+  TestPool test;
+  auto& pool = test.pool;
+  IRenderTargetOptions options;
+  options.type = Constants::TEXTURETYPE_HALF_FLOAT;
+
+  // Overlapping lifetimes
+  const auto first  = pool.acquire(ISize(64, 32), options);
+  const auto second = pool.acquire(ISize(64, 32), options);
+  EXPECT_NE(first, second);
+  EXPECT_EQ(pool.textureCount(), 2u);
+
+  // Disjoint lifetimes
+  pool.release(first);
+  EXPECT_EQ(pool.acquire(ISize(64, 32), options), first);
+  pool.release(first);
+  pool.release(second);
+  const auto third = pool.acquire(ISize(64, 32), options);
+  EXPECT_TRUE(third == first || third == second);
+  EXPECT_EQ(test.createdCount, 2u);
+  EXPECT_TRUE(pool.owns(third));
+  EXPECT_FALSE(pool.owns(InternalTexture::New(nullptr, InternalTextureSource::RenderTarget, true)));
+}
+
+TEST(TestRenderTargetPool, MatchSizeFormatAndSamples)
+{
+  using namespace BABYLON;
+
+  TestPool test;
+  auto& pool = test.pool;
+  IRenderTargetOptions options;
+  IRenderTargetOptions floatOptions;
+  floatOptions.type = Constants::TEXTURETYPE_FLOAT;
+
+  const auto texture = pool.acquire(ISize(16, 16), options);
+  pool.release(texture);
+  EXPECT_NE(pool.acquire(ISize(16, 8), options), texture);
+  EXPECT_NE(pool.acquire(ISize(16, 16), floatOptions), texture);
+  EXPECT_NE(pool.acquire(ISize(16, 16), options, 4), texture);
+  EXPECT_EQ(test.createdCount, 4u);
+
+  // The default options of the engine are resolved
+  IRenderTargetOptions explicitOptions;
+  explicitOptions.generateMipMaps     = false;
+  explicitOptions.generateDepthBuffer = true;
+  explicitOptions.type                = Constants::TEXTURETYPE_UNSIGNED_INT;
+  explicitOptions.format              = Constants::TEXTUREFORMAT_RGBA;
+  explicitOptions.samplingMode        = Constants::TEXTURE_TRILINEAR_SAMPLINGMODE;
+  EXPECT_EQ(pool.acquire(ISize(16, 16), explicitOptions), texture);
+}
+
+TEST(TestRenderTargetPool, DisposeUnusedTextures)
+{
+  using namespace BABYLON;
+
+  TestPool test;
+  auto& pool           = test.pool;
+  pool.maxUnusedFrames = 2;
+  IRenderTargetOptions options;
+  options.generateDepthBuffer = false;
+
+  const auto used   = pool.acquire(ISize(8, 8), options);
+  const auto unused = pool.acquire(ISize(4, 4), options);
+  pool.release(unused);
+  EXPECT_EQ(pool.memory(), 8u * 8u * 4u + 4u * 4u * 4u);
+
+  pool.endFrame();
+  pool.endFrame();
+  EXPECT_TRUE(test.disposedTextures.empty());
+  EXPECT_EQ(pool.lastFrameMemory(), pool.memory());
+
+  // Textures still acquired are kept
+  pool.endFrame();
+  ASSERT_EQ(test.disposedTextures.size(), 1u);
+  EXPECT_EQ(test.disposedTextures.front(), unused);
+  EXPECT_EQ(pool.textureCount(), 1u);
+  EXPECT_EQ(pool.memory(), 8u * 8u * 4u);
+  EXPECT_EQ(pool.peakMemory(), 8u * 8u * 4u + 4u * 4u * 4u);
+
+  pool.clear();
+  EXPECT_EQ(test.disposedTextures.size(), 2u);
+  EXPECT_EQ(test.disposedTextures.back(), used);
+  EXPECT_EQ(pool.memory(), 0u);
+}
+
+TEST(TestRenderTargetPool, EstimateMemory)
+{
+  using namespace BABYLON;
+
+  IRenderTargetOptions options;
+  options.generateDepthBuffer = false;
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), options, 1), 64u);
+
+  options.type = Constants::TEXTURETYPE_HALF_FLOAT;
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), options, 1), 128u);
+
+  options.format = Constants::TEXTUREFORMAT_RED;
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), options, 1), 32u);
+
+  // Depth buffer, multisampled color and depth buffers
+  IRenderTargetOptions defaultOptions;
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), defaultOptions, 1), 128u);
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), defaultOptions, 4), 64u + 256u + 256u);
+
+  // Mip maps
+  defaultOptions.generateMipMaps     = true;
+  defaultOptions.generateDepthBuffer = false;
+  EXPECT_EQ(RenderTargetPool::EstimateMemory(ISize(4, 4), defaultOptions, 1), 64u + 21u);
+}
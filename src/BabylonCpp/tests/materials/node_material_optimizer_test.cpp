@@ -0,0 +1,299 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/animations/animation_value.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/materials/node/blocks/add_block.h>
+#include <babylon/materials/node/blocks/fragment/fragment_output_block.h>
+#include <babylon/materials/node/blocks/input/input_block.h>
+#include <babylon/materials/node/blocks/multiply_block.h>
+#include <babylon/materials/node/blocks/transform_block.h>
+#include <babylon/materials/node/blocks/vertex/vertex_output_block.h>
+#include <babylon/materials/node/enums/node_material_system_values.h>
+#include <babylon/materials/node/node_material.h>
+#include <babylon/materials/node/node_material_connection_point.h>
+#include <babylon/materials/node/optimizers/node_material_optimizer.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/sub_mesh.h>
+
+namespace {
+
+/**
+ * @brief Graph transforming the position in the vertex shader and computing the color of the
+ * fragment shader with small math expressions.
+ */
+struct Graph {
+  Graph()
+  {
+    using namespace BABYLON;
+
+    auto position = InputBlock::New("position");
+    position->setAsAttribute("position");
+    auto world = InputBlock::New("world");
+    world->setAsSystemValue(NodeMaterialSystemValues::World);
+    auto worldPosition = TransformBlock::New("worldPosition");
+    position->connectTo(worldPosition);
+    world->connectTo(worldPosition);
+    auto viewProjection = InputBlock::New("viewProjection");
+    viewProjection->setAsSystemValue(NodeMaterialSystemValues::ViewProjection);
+    auto clipPosition = TransformBlock::New("clipPosition");
+    worldPosition->connectTo(clipPosition);
+    viewProjection->connectTo(clipPosition);
+    vertexOutput = VertexOutputBlock::New("vertexOutput");
+    clipPosition->connectTo(vertexOutput);
+
+    fragmentOutput = FragmentOutputBlock::New("fragmentOutput");
+  }
+
+  static BABYLON::InputBlockPtr Color(const std::string& name, const BABYLON::Color3& color,
+                                      bool isConstant)
+  {
+    auto input        = BABYLON::InputBlock::New(name);
+    input->value      = std::make_shared<BABYLON::AnimationValue>(color);
+    input->isConstant = isConstant;
+    return input;
+  }
+
+  template <typename Block>
+  static std::shared_ptr<Block> Binary(const std::string& name,
+                                       const BABYLON::NodeMaterialBlockPtr& left,
+                                       const BABYLON::NodeMaterialBlockPtr& right)
+  {
+    auto block = Block::New(name);
+    left->connectTo(block);
+    right->connectTo(block);
+    return block;
+  }
+
+  // Block feeding the color of the fragment
+  BABYLON::NodeMaterialBlockPtr fragmentSource() const
+  {
+    return fragmentOutput->rgb()->connectedPoint()->ownerBlock();
+  }
+
+  void optimize() const
+  {
+    BABYLON::NodeMaterialOptimizer().optimize({vertexOutput}, {fragmentOutput});
+  }
+
+  BABYLON::NodeMaterialPtr createMaterial(const std::string& name, BABYLON::Scene* scene) const
+  {
+    auto material = BABYLON::NodeMaterial::New(name, scene);
+    material->addOutputNode(vertexOutput);
+    material->addOutputNode(fragmentOutput);
+    return material;
+  }
+
+  BABYLON::VertexOutputBlockPtr vertexOutput;
+  BABYLON::FragmentOutputBlockPtr fragmentOutput;
+}; // end of struct Graph
+
+BABYLON::Color3 ColorValue(const BABYLON::NodeMaterialBlockPtr& block)
+{
+  const auto inputBlock = std::static_pointer_cast<BABYLON::InputBlock>(block);
+  return inputBlock->value()->get<BABYLON::Color3>();
+}
+
+} // end of anonymous namespace
+
+TEST(TestNodeMaterialOptimizer, ConstantFolding)
+{
+  using namespace BABYLON;
+
+  Graph graph;
+  auto a   = Graph::Color("a", Color3(0.25f, 0.5f, 0.125f), true);
+  auto b   = Graph::Color("b", Color3(0.5f, 0.25f, 0.125f), true);
+  auto add = Graph::Binary<AddBlock>("add", a, b);
+  auto c   = Graph::Color("c", Color3(2.f, 2.f, 4.f), true);
+  Graph::Binary<MultiplyBlock>("multiply", add, c)->connectTo(graph.fragmentOutput);
+
+  graph.optimize();
+
+  // (a + b) * c is folded into a single constant
+  const auto source = graph.fragmentSource();
+  ASSERT_TRUE(source->isInput());
+  EXPECT_TRUE(std::static_pointer_cast<InputBlock>(source)->isConstant);
+  const auto color = ColorValue(source);
+  EXPECT_FLOAT_EQ(color.r, 1.5f);
+  EXPECT_FLOAT_EQ(color.g, 1.5f);
+  EXPECT_FLOAT_EQ(color.b, 1.f);
+
+  // The folded blocks are disconnected from the graph
+  EXPECT_TRUE(add->output()->endpoints().empty());
+}
+
+TEST(TestNodeMaterialOptimizer, IdentityBypass)
+{
+  using namespace BABYLON;
+
+  Graph graph;
+  auto uniform  = Graph::Color("uniform", Color3(0.2f, 0.4f, 0.6f), false);
+  auto zero     = Graph::Color("zero", Color3(0.f, 0.f, 0.f), true);
+  auto one      = Graph::Color("one", Color3(1.f, 1.f, 1.f), true);
+  auto add      = Graph::Binary<AddBlock>("add", uniform, zero);
+  auto multiply = Graph::Binary<MultiplyBlock>("multiply", one, add);
+  multiply->connectTo(graph.fragmentOutput);
+
+  graph.optimize();
+
+  // (uniform + 0) * 1 is the uniform itself, which only feeds the fragment output anymore
+  EXPECT_EQ(graph.fragmentSource(), uniform);
+  ASSERT_EQ(uniform->output()->endpoints().size(), 1u);
+  EXPECT_EQ(uniform->output()->endpoints()[0], graph.fragmentOutput->rgb());
+}
+
+TEST(TestNodeMaterialOptimizer, MultiplyByZero)
+{
+  using namespace BABYLON;
+
+  Graph graph;
+  auto uniform = Graph::Color("uniform", Color3(0.2f, 0.4f, 0.6f), false);
+  auto zero    = Graph::Color("zero", Color3(0.f, 0.f, 0.f), true);
+  Graph::Binary<MultiplyBlock>("multiply", uniform, zero)->connectTo(graph.fragmentOutput);
+
+  graph.optimize();
+
+  // uniform * 0 is a zero constant, the uniform being no longer used
+  const auto source = graph.fragmentSource();
+  ASSERT_TRUE(source->isInput());
+  EXPECT_TRUE(std::static_pointer_cast<InputBlock>(source)->isConstant);
+  const auto color = ColorValue(source);
+  EXPECT_FLOAT_EQ(color.r, 0.f);
+  EXPECT_FLOAT_EQ(color.g, 0.f);
+  EXPECT_FLOAT_EQ(color.b, 0.f);
+  EXPECT_TRUE(uniform->output()->endpoints().empty());
+}
+
+TEST(TestNodeMaterialOptimizer, InputAndExpressionMerging)
+{
+  using namespace BABYLON;
+
+  Graph graph;
+  auto uniform = Graph::Color("uniform", Color3(0.2f, 0.4f, 0.6f), false);
+  auto offset1 = Graph::Color("offset1", Color3(0.1f, 0.2f, 0.3f), true);
+  auto offset2 = Graph::Color("offset2", Color3(0.1f, 0.2f, 0.3f), true);
+  auto add1    = Graph::Binary<AddBlock>("add1", uniform, offset1);
+  auto add2    = Graph::Binary<AddBlock>("add2", offset2, uniform);
+  auto product = Graph::Binary<MultiplyBlock>("product", add1, add2);
+  product->connectTo(graph.fragmentOutput);
+
+  graph.optimize();
+
+  // The equal constants are merged, then the two sums of the same operands
+  EXPECT_EQ(graph.fragmentSource(), product);
+  const auto left  = product->left()->connectedPoint();
+  const auto right = product->right()->connectedPoint();
+  EXPECT_EQ(left, right);
+  EXPECT_EQ(left, add1->output());
+  EXPECT_TRUE(offset2->output()->endpoints().empty());
+  EXPECT_TRUE(add2->output()->endpoints().empty());
+
+  // Uniforms are not merged, as they can be modified independently
+  Graph otherGraph;
+  auto uniform1 = Graph::Color("uniform1", Color3(0.2f, 0.4f, 0.6f), false);
+  auto uniform2 = Graph::Color("uniform2", Color3(0.2f, 0.4f, 0.6f), false);
+  auto sum      = Graph::Binary<AddBlock>("sum", uniform1, uniform2);
+  sum->connectTo(otherGraph.fragmentOutput);
+  otherGraph.optimize();
+  EXPECT_EQ(sum->left()->connectedPoint(), uniform1->output());
+  EXPECT_EQ(sum->right()->connectedPoint(), uniform2->output());
+}
+
+TEST(TestNodeMaterialOptimizer, DeadBlocksAreDisconnected)
+{
+  using namespace BABYLON;
+
+  Graph graph;
+  auto uniform  = Graph::Color("uniform", Color3(0.2f, 0.4f, 0.6f), false);
+  auto one      = Graph::Color("one", Color3(1.f, 1.f, 1.f), true);
+  auto multiply = Graph::Binary<MultiplyBlock>("multiply", uniform, one);
+  multiply->connectTo(graph.fragmentOutput);
+
+  graph.optimize();
+
+  // The bypassed block is neither an endpoint of its inputs nor connected to the output
+  EXPECT_EQ(graph.fragmentSource(), uniform);
+  for (const auto& endpoint : uniform->output()->endpoints()) {
+    EXPECT_NE(endpoint->ownerBlock(), multiply);
+  }
+  EXPECT_TRUE(one->output()->endpoints().empty());
+  EXPECT_TRUE(multiply->output()->endpoints().empty());
+}
+
+TEST(TestNodeMaterialOptimizer, OptimizedShadersKeepTheirMeaning)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // (a + b) * c, optimized or not
+  const auto createMaterial = [&scene](const std::string& name, bool optimize) {
+    Graph graph;
+    auto a   = Graph::Color("a", Color3(0.25f, 0.5f, 0.125f), true);
+    auto b   = Graph::Color("b", Color3(0.5f, 0.25f, 0.125f), true);
+    auto add = Graph::Binary<AddBlock>("add", a, b);
+    auto c   = Graph::Color("c", Color3(0.5f, 0.5f, 0.5f), true);
+    Graph::Binary<MultiplyBlock>("multiply", add, c)->connectTo(graph.fragmentOutput);
+    auto material = graph.createMaterial(name, scene.get());
+    if (optimize) {
+      material->registerOptimizer(std::make_shared<NodeMaterialOptimizer>());
+    }
+    material->build();
+    return material;
+  };
+
+  // Main function of the vertex or the fragment shader
+  const auto mainFunction = [](const std::string& shaders, const std::string& shader) {
+    const auto start = shaders.find("void main(void)", shaders.find("// " + shader + " shader"));
+    return shaders.substr(start, shaders.find('}', start) - start);
+  };
+
+  // The constant (0.375, 0.375, 0.125) replaces the operations computing it
+  const auto reference = createMaterial("reference", false)->compiledShaders();
+  const auto optimized = createMaterial("optimized", true)->compiledShaders();
+  EXPECT_NE(mainFunction(reference, "Fragment").find(" + "), std::string::npos);
+  EXPECT_NE(mainFunction(reference, "Fragment").find(" * "), std::string::npos);
+  EXPECT_EQ(mainFunction(optimized, "Fragment").find(" + "), std::string::npos);
+  EXPECT_EQ(mainFunction(optimized, "Fragment").find(" * "), std::string::npos);
+  EXPECT_NE(optimized.find("vec3(0.375000, 0.375000, 0.125000)"), std::string::npos);
+
+  // The vertex shader computes the same position
+  EXPECT_EQ(mainFunction(optimized, "Vertex"), mainFunction(reference, "Vertex"));
+}
+
+TEST(TestNodeMaterialOptimizer, IdenticalMaterialsShareTheirEffect)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  const auto createMaterial = [&scene](const std::string& name, const Color3& color) {
+    Graph graph;
+    Graph::Color("color", color, true)->connectTo(graph.fragmentOutput);
+    return graph.createMaterial(name, scene.get());
+  };
+  const auto effectName = [&scene](const NodeMaterialPtr& material, const std::string& name) {
+    BoxOptions options;
+    auto box      = MeshBuilder::CreateBox(name, options, scene.get());
+    box->material = material;
+    material->build();
+    const auto& subMesh = box->subMeshes[0];
+    material->isReadyForSubMesh(box.get(), subMesh.get());
+    const auto effect = subMesh->effect();
+    return effect ? std::get<std::unordered_map<std::string, std::string>>(effect->name)["vertex"] :
+                    "";
+  };
+
+  const auto name1 = effectName(createMaterial("material1", Color3(1.f, 0.f, 0.f)), "box1");
+  const auto name2 = effectName(createMaterial("material2", Color3(1.f, 0.f, 0.f)), "box2");
+  const auto name3 = effectName(createMaterial("material3", Color3(0.f, 1.f, 0.f)), "box3");
+  EXPECT_EQ(name1.rfind("nodeMaterial", 0), 0u);
+  EXPECT_EQ(name1, name2);
+  EXPECT_NE(name1, name3);
+}
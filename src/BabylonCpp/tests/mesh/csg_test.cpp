@@ -0,0 +1,161 @@
+#include <gtest/gtest.h>
+
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/csg/csg.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+/**
+ * @brief Creates the vertex data of an axis aligned box, the faces oriented outwards.
+ */
+std::unique_ptr<BABYLON::VertexData> CreateBox(const BABYLON::Vector3& min,
+                                               const BABYLON::Vector3& max)
+{
+  using namespace BABYLON;
+
+  auto vertexData = std::make_unique<VertexData>();
+  const auto corner = [&min, &max](unsigned int index) {
+    return Vector3(index & 1 ? max.x : min.x, index & 2 ? max.y : min.y,
+                   index & 4 ? max.z : min.z);
+  };
+  // Corners of each face and its normal axis
+  const std::array<std::array<unsigned int, 4>, 6> faces{{{{0, 2, 6, 4}},
+                                                          {{1, 3, 7, 5}},
+                                                          {{0, 1, 5, 4}},
+                                                          {{2, 3, 7, 6}},
+                                                          {{0, 1, 3, 2}},
+                                                          {{4, 5, 7, 6}}}};
+  for (size_t face = 0; face < faces.size(); ++face) {
+    const auto sign = face % 2 == 0 ? -1.f : 1.f;
+    const Vector3 normal(face / 2 == 0 ? sign : 0.f, face / 2 == 1 ? sign : 0.f,
+                         face / 2 == 2 ? sign : 0.f);
+    const auto first = static_cast<uint32_t>(vertexData->positions.size() / 3);
+    for (const auto index : faces[face]) {
+      const auto position = corner(index);
+      vertexData->positions.insert(vertexData->positions.end(),
+                                   {position.x, position.y, position.z});
+      vertexData->normals.insert(vertexData->normals.end(), {normal.x, normal.y, normal.z});
+      vertexData->uvs.insert(vertexData->uvs.end(), {0.f, 0.f});
+    }
+    // Front faces wind clockwise when seen from outside
+    const auto a = corner(faces[face][0]), b = corner(faces[face][1]),
+               c = corner(faces[face][2]);
+    const auto ordered = Vector3::Dot(Vector3::Cross(c.subtract(a), b.subtract(a)), normal) > 0.f;
+    for (const auto triangle : {std::array<uint32_t, 3>{{0, 1, 2}}, {{0, 2, 3}}}) {
+      vertexData->indices.insert(vertexData->indices.end(),
+                                 {first + triangle[0], first + triangle[ordered ? 1 : 2],
+                                  first + triangle[ordered ? 2 : 1]});
+    }
+  }
+
+  return vertexData;
+}
+
+/**
+ * @brief Returns the volume enclosed by the triangles, positive when they are oriented outwards.
+ */
+float Volume(const BABYLON::VertexData& vertexData)
+{
+  using namespace BABYLON;
+
+  const auto& positions = vertexData.positions;
+  const auto& indices   = vertexData.indices;
+  double volume         = 0.0;
+  for (size_t i = 0; i + 2 < indices.size(); i += 3) {
+    const auto a = Vector3::FromArray(positions, indices[i] * 3);
+    const auto b = Vector3::FromArray(positions, indices[i + 1] * 3);
+    const auto c = Vector3::FromArray(positions, indices[i + 2] * 3);
+    // Clockwise front faces
+    volume -= Vector3::Dot(a, Vector3::Cross(b, c)) / 6.0;
+  }
+  return static_cast<float>(volume);
+}
+
+BABYLON::CSG::CSGPtr CreateBoxCSG(const BABYLON::Vector3& min, const BABYLON::Vector3& max)
+{
+  return BABYLON::CSG::CSG::FromVertexData(*CreateBox(min, max));
+}
+
+} // end of anonymous namespace
+
+TEST(TestCSG, FromVertexDataKeepsVolume)
+{
+  using namespace BABYLON;
+
+  const auto box = CreateBoxCSG(Vector3(0.f, 0.f, 0.f), Vector3(1.f, 2.f, 3.f));
+  EXPECT_NEAR(Volume(*box->toVertexData()), 6.f, 1e-4f);
+  EXPECT_NEAR(Volume(*box->inverse()->toVertexData()), -6.f, 1e-4f);
+}
+
+TEST(TestCSG, OperationsOnOverlappingBoxes)
+{
+  using namespace BABYLON;
+
+  // The boxes overlap on a corner, no face being coplanar
+  const Vector3 min(0.f, 0.f, 0.f), max(1.f, 1.f, 1.f);
+  const Vector3 offset(0.5f, 0.5f, 0.5f);
+  const auto a = CreateBoxCSG(min, max);
+  const auto b = CreateBoxCSG(min.add(offset), max.add(offset));
+
+  EXPECT_NEAR(Volume(*a->_union(b).toVertexData()), 1.875f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->subtract(b).toVertexData()), 0.875f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->intersect(b).toVertexData()), 0.125f, 1e-4f);
+}
+
+TEST(TestCSG, OperationsOnBoxesWithCoplanarFaces)
+{
+  using namespace BABYLON;
+
+  // The boxes share four face planes
+  const Vector3 min(0.f, 0.f, 0.f), max(1.f, 1.f, 1.f);
+  const Vector3 offset(0.5f, 0.f, 0.f);
+  const auto a = CreateBoxCSG(min, max);
+  const auto b = CreateBoxCSG(min.add(offset), max.add(offset));
+
+  EXPECT_NEAR(Volume(*a->_union(b).toVertexData()), 1.5f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->subtract(b).toVertexData()), 0.5f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->intersect(b).toVertexData()), 0.5f, 1e-4f);
+
+  // Identical boxes
+  const auto c = CreateBoxCSG(min, max);
+  EXPECT_NEAR(Volume(*a->_union(c).toVertexData()), 1.f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->subtract(c).toVertexData()), 0.f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->intersect(c).toVertexData()), 1.f, 1e-4f);
+}
+
+TEST(TestCSG, OperationsOnTouchingAndDisjointBoxes)
+{
+  using namespace BABYLON;
+
+  const auto a = CreateBoxCSG(Vector3(0.f, 0.f, 0.f), Vector3(1.f, 1.f, 1.f));
+  const auto touching = CreateBoxCSG(Vector3(1.f, 0.f, 0.f), Vector3(2.f, 1.f, 1.f));
+  const auto disjoint = CreateBoxCSG(Vector3(3.f, 0.f, 0.f), Vector3(4.f, 1.f, 1.f));
+
+  const auto merged = a->_union(touching).toVertexData();
+  EXPECT_NEAR(Volume(*merged), 2.f, 1e-4f);
+  // The shared face is removed: 5 faces of each box remain, split along the shared plane at most
+  EXPECT_LE(merged->indices.size() / 3, 20u);
+  EXPECT_NEAR(Volume(*a->subtract(touching).toVertexData()), 1.f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->intersect(touching).toVertexData()), 0.f, 1e-4f);
+
+  EXPECT_NEAR(Volume(*a->_union(disjoint).toVertexData()), 2.f, 1e-4f);
+  EXPECT_NEAR(Volume(*a->subtract(disjoint).toVertexData()), 1.f, 1e-4f);
+  EXPECT_TRUE(a->intersect(disjoint).toVertexData()->indices.empty());
+}
+
+TEST(TestCSG, InPlaceOperationsMatchCopies)
+{
+  using namespace BABYLON;
+
+  const Vector3 offset(0.25f, 0.5f, 0.75f);
+  const auto b = CreateBoxCSG(offset, Vector3(1.f, 1.f, 1.f).add(offset));
+
+  auto a = CreateBoxCSG(Vector3(0.f, 0.f, 0.f), Vector3(1.f, 1.f, 1.f));
+  const auto expected = a->subtract(b).toVertexData();
+  a->subtractInPlace(b);
+  const auto actual = a->toVertexData();
+  EXPECT_EQ(actual->positions, expected->positions);
+  EXPECT_EQ(actual->indices, expected->indices);
+  EXPECT_NEAR(Volume(*actual), 1.f - 0.75f * 0.5f * 0.25f, 1e-4f);
+}
@@ -30,3 +30,55 @@ TEST(TestGeometry, TestGetVerticesData_Vec3FloatColor)
   auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
   EXPECT_THAT(result, ::testing::ContainerEq(data));
 }
+
+TEST(TestGeometry, TestGetVerticesDataView_TightlyPacked)
+{
+  using namespace BABYLON;
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  Float32Array data{0.f, 1.f, 2.f, 3.f, 4.f, 5.f, 6.f, 7.f, 8.f};
+  auto buffer       = std::make_unique<Buffer>(subject.get(), data, false);
+  auto vertexBuffer = std::make_shared<VertexBuffer>(
+    subject.get(), buffer.get(), VertexBuffer::PositionKind, false, std::nullopt,
+    std::nullopt, std::nullopt, std::nullopt, 3);
+
+  auto geometry = Geometry::New("geometry1", scene.get());
+  geometry->setVerticesBuffer(vertexBuffer);
+  IndicesArray indices{0u, 1u, 2u};
+  geometry->setIndices(indices, 3);
+
+  auto view = geometry->getVerticesDataView(VertexBuffer::PositionKind);
+  EXPECT_EQ(view.size(), data.size());
+  EXPECT_THAT(view.toArray(), ::testing::ContainerEq(data));
+  // The view points at the vertex buffer storage
+  EXPECT_EQ(view.data(), vertexBuffer->getData().data());
+
+  auto indicesView = geometry->getIndicesView();
+  EXPECT_THAT(indicesView.toArray(), ::testing::ContainerEq(indices));
+}
+
+TEST(TestGeometry, TestGetVerticesDataView_Interleaved)
+{
+  using namespace BABYLON;
+  // vec3 float color interleaved with an unused float, no view available
+  auto subject = createSubject();
+  auto scene   = Scene::New(subject.get());
+  Float32Array data{0.4f, 0.4f, 0.4f, 0.f, 0.6f, 0.6f, 0.6f, 0.f,
+                    0.8f, 0.8f, 0.8f, 0.f, 1.f,  1.f,  1.f,  0.f};
+  auto buffer       = std::make_unique<Buffer>(subject.get(), data, false, 4);
+  auto vertexBuffer = std::make_shared<VertexBuffer>(
+    subject.get(), buffer.get(), VertexBuffer::ColorKind, false, std::nullopt,
+    4, std::nullopt, 0, 3);
+
+  auto geometry = Geometry::New("geometry1", scene.get());
+  geometry->setVerticesBuffer(vertexBuffer);
+  IndicesArray indices{0u, 1u, 2u, 3u};
+  geometry->setIndices(indices, 4);
+
+  auto view = geometry->getVerticesDataView(VertexBuffer::ColorKind);
+  EXPECT_TRUE(view.empty());
+  auto result = geometry->getVerticesData(VertexBuffer::ColorKind);
+  Float32Array expected{0.4f, 0.4f, 0.4f, 0.6f, 0.6f, 0.6f,
+                        0.8f, 0.8f, 0.8f, 1.f,  1.f,  1.f};
+  EXPECT_THAT(result, ::testing::ContainerEq(expected));
+}
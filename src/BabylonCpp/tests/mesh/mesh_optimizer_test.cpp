@@ -0,0 +1,159 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <random>
+
+#include <babylon/meshes/mesh_optimizer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+/**
+ * @brief Creates a regular grid of quads whose triangles are shuffled.
+ */
+std::unique_ptr<BABYLON::VertexData> CreateShuffledGrid(unsigned int subdivisions)
+{
+  using namespace BABYLON;
+
+  auto vertexData = std::make_unique<VertexData>();
+  for (unsigned int row = 0; row <= subdivisions; ++row) {
+    for (unsigned int col = 0; col <= subdivisions; ++col) {
+      vertexData->positions.insert(vertexData->positions.end(),
+                                   {static_cast<float>(col), 0.f, static_cast<float>(row)});
+      vertexData->normals.insert(vertexData->normals.end(), {0.f, 1.f, 0.f});
+    }
+  }
+
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (unsigned int row = 0; row < subdivisions; ++row) {
+    for (unsigned int col = 0; col < subdivisions; ++col) {
+      const auto topLeft = row * (subdivisions + 1) + col;
+      const auto topRight = topLeft + 1, bottomLeft = topLeft + subdivisions + 1;
+      const auto bottomRight = bottomLeft + 1;
+      triangles.push_back({bottomRight, bottomLeft, topLeft});
+      triangles.push_back({topRight, bottomRight, topLeft});
+    }
+  }
+  std::mt19937 generator(42);
+  std::shuffle(triangles.begin(), triangles.end(), generator);
+  for (const auto& triangle : triangles) {
+    vertexData->indices.insert(vertexData->indices.end(), triangle.begin(), triangle.end());
+  }
+
+  return vertexData;
+}
+
+// Returns the triangles with their first vertex rotated to the smallest index, sorted
+std::vector<std::array<uint32_t, 3>> CanonicalTriangles(const BABYLON::IndicesArray& indices,
+                                                        const BABYLON::Float32Array& positions)
+{
+  // Use the positions so that the comparison is independent of the vertex order
+  const auto key = [&positions](uint32_t index) {
+    return static_cast<uint32_t>(positions[index * 3] * 1000.f + positions[index * 3 + 2]);
+  };
+  std::vector<std::array<uint32_t, 3>> triangles;
+  for (size_t i = 0; i < indices.size(); i += 3) {
+    std::array<uint32_t, 3> triangle{key(indices[i]), key(indices[i + 1]), key(indices[i + 2])};
+    std::rotate(triangle.begin(), std::min_element(triangle.begin(), triangle.end()),
+                triangle.end());
+    triangles.emplace_back(triangle);
+  }
+  std::sort(triangles.begin(), triangles.end());
+  return triangles;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshOptimizer, ComputeACMR)
+{
+  using namespace BABYLON;
+
+  // Two triangles sharing an edge: 4 misses for 2 triangles
+  const IndicesArray indices{0, 1, 2, 2, 1, 3};
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(indices, 4), 2.f);
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeATVR(indices, 4), 1.f);
+
+  // With a cache of 3 vertices, vertex 0 is evicted before being reused
+  const IndicesArray fan{0, 1, 2, 0, 2, 3, 0, 3, 4};
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(fan, 5, 16), 5.f / 3.f);
+  EXPECT_FLOAT_EQ(MeshOptimizer::ComputeACMR(fan, 5, 3), 6.f / 3.f);
+}
+
+TEST(TestMeshOptimizer, GenerateVertexRemap)
+{
+  using namespace BABYLON;
+
+  // Vertices 0 and 2 are identical, vertex 3 only differs by its normal
+  const Float32Array positions{0.f, 0.f, 0.f, 1.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f, 0.f};
+  const Float32Array normals{0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 0.f, 1.f, 0.f, 1.f, 0.f, 0.f};
+  Uint32Array remap;
+  const auto uniqueVertexCount
+    = MeshOptimizer::GenerateVertexRemap({&positions, &normals}, 4, remap);
+  EXPECT_EQ(uniqueVertexCount, 3u);
+  EXPECT_THAT(remap, ::testing::ElementsAre(0u, 1u, 0u, 2u));
+
+  IndicesArray indices{3, 2, 1};
+  const auto usedVertexCount = MeshOptimizer::GenerateVertexFetchRemap(indices, 4, remap);
+  EXPECT_EQ(usedVertexCount, 3u);
+  EXPECT_THAT(remap, ::testing::ElementsAre(MeshOptimizer::InvalidIndex, 2u, 1u, 0u));
+}
+
+TEST(TestMeshOptimizer, OptimizeVertexCache)
+{
+  using namespace BABYLON;
+
+  const auto grid          = CreateShuffledGrid(32);
+  const auto vertexCount   = grid->positions.size() / 3;
+  const auto acmrShuffled  = MeshOptimizer::ComputeACMR(grid->indices, vertexCount);
+  const auto expectedFaces = CanonicalTriangles(grid->indices, grid->positions);
+
+  const auto forsyth = MeshOptimizer::OptimizeVertexCacheForsyth(grid->indices, vertexCount);
+  const auto tipsify = MeshOptimizer::OptimizeVertexCacheTipsify(grid->indices, vertexCount, 16);
+  const auto acmrForsyth = MeshOptimizer::ComputeACMR(forsyth, vertexCount);
+  const auto acmrTipsify = MeshOptimizer::ComputeACMR(tipsify, vertexCount);
+
+  // Same triangles with the same winding, in a cache friendly order
+  EXPECT_EQ(CanonicalTriangles(forsyth, grid->positions), expectedFaces);
+  EXPECT_EQ(CanonicalTriangles(tipsify, grid->positions), expectedFaces);
+  EXPECT_GT(acmrShuffled, 2.f);
+  EXPECT_LT(acmrForsyth, 1.f);
+  EXPECT_LT(acmrTipsify, 1.f);
+
+  const auto overdraw = MeshOptimizer::OptimizeOverdraw(forsyth, grid->positions, 1.05f, 16);
+  EXPECT_EQ(CanonicalTriangles(overdraw, grid->positions), expectedFaces);
+  EXPECT_LE(MeshOptimizer::ComputeACMR(overdraw, vertexCount), acmrForsyth * 1.05f + 0.05f);
+}
+
+TEST(TestMeshOptimizer, OptimizeVertexData)
+{
+  using namespace BABYLON;
+
+  // Unwelded grid: each triangle has its own vertices
+  const auto grid = CreateShuffledGrid(16);
+  VertexData unwelded;
+  for (const auto index : grid->indices) {
+    unwelded.positions.insert(unwelded.positions.end(), grid->positions.begin() + index * 3,
+                              grid->positions.begin() + index * 3 + 3);
+    unwelded.normals.insert(unwelded.normals.end(), grid->normals.begin() + index * 3,
+                            grid->normals.begin() + index * 3 + 3);
+    unwelded.indices.emplace_back(static_cast<uint32_t>(unwelded.indices.size()));
+  }
+  const auto expectedFaces = CanonicalTriangles(unwelded.indices, unwelded.positions);
+
+  const auto statistics = MeshOptimizer::OptimizeVertexData(unwelded);
+  EXPECT_EQ(statistics.verticesBefore, grid->indices.size());
+  EXPECT_EQ(statistics.verticesAfter, grid->positions.size() / 3);
+  EXPECT_EQ(unwelded.positions.size(), grid->positions.size());
+  EXPECT_EQ(unwelded.normals.size(), grid->normals.size());
+  EXPECT_LT(statistics.acmrAfter, statistics.acmrBefore);
+  EXPECT_LT(statistics.acmrAfter, 1.f);
+  EXPECT_EQ(CanonicalTriangles(unwelded.indices, unwelded.positions), expectedFaces);
+
+  // Vertices are ordered by first use
+  uint32_t nextVertex = 0;
+  for (const auto index : unwelded.indices) {
+    EXPECT_LE(index, nextVertex);
+    nextVertex = std::max(nextVertex, index + 1);
+  }
+}
@@ -0,0 +1,185 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include <babylon/meshes/compression/meshopt_compression.h>
+
+namespace {
+
+using namespace BABYLON;
+
+uint8_t Zigzag8(uint8_t value)
+{
+  return static_cast<uint8_t>((value << 1) ^ (static_cast<int8_t>(value) >> 7));
+}
+
+// Reference encoder of the vertex codec, picking for each group of 16 bytes the smallest of the
+// 0, 2, 4 and 8 bits encodings
+ArrayBuffer EncodeVertices(const ArrayBuffer& vertices, size_t vertexSize)
+{
+  const auto vertexCount = vertices.size() / vertexSize;
+  const auto blockSize   = std::min<size_t>((8192 / vertexSize) & ~size_t(15), 256);
+
+  ArrayBuffer result{0xa0};
+  ArrayBuffer lastVertex(vertices.begin(), vertices.begin() + vertexSize);
+  for (size_t first = 0; first < vertexCount; first += blockSize) {
+    const auto count        = std::min(blockSize, vertexCount - first);
+    const auto countAligned = (count + 15) & ~size_t(15);
+    for (size_t k = 0; k < vertexSize; ++k) {
+      ArrayBuffer deltas(countAligned, 0);
+      auto previous = lastVertex[k];
+      for (size_t i = 0; i < count; ++i) {
+        const auto value = vertices[(first + i) * vertexSize + k];
+        deltas[i]        = Zigzag8(static_cast<uint8_t>(value - previous));
+        previous         = value;
+      }
+
+      const auto headerOffset = result.size();
+      result.resize(result.size() + (countAligned / 16 + 3) / 4, 0);
+      for (size_t group = 0; group < countAligned / 16; ++group) {
+        const auto begin = deltas.begin() + static_cast<std::ptrdiff_t>(group * 16);
+        ArrayBuffer best(begin, begin + 16);
+        unsigned int bestBitsLog2 = 3;
+        for (unsigned int bitsLog2 = 0; bitsLog2 < 3; ++bitsLog2) {
+          const auto bits   = bitsLog2 == 0 ? 0u : (1u << bitsLog2);
+          const auto escape = (1u << bits) - 1;
+          ArrayBuffer packed(16 * bits / 8, 0), escapes;
+          for (size_t i = 0; i < 16; ++i) {
+            const auto delta = static_cast<unsigned int>(begin[static_cast<std::ptrdiff_t>(i)]);
+            if (bits == 0) {
+              if (delta != 0) {
+                escapes.resize(17);
+              }
+              continue;
+            }
+            const auto code = delta >= escape ? escape : delta;
+            packed[i * bits / 8] |= static_cast<uint8_t>(code << (8 - bits - (i * bits) % 8));
+            if (code == escape) {
+              escapes.emplace_back(static_cast<uint8_t>(delta));
+            }
+          }
+          packed.insert(packed.end(), escapes.begin(), escapes.end());
+          if (packed.size() < best.size()) {
+            best         = packed;
+            bestBitsLog2 = bitsLog2;
+          }
+        }
+        const auto shift = (group % 4) * 2;
+        result[headerOffset + group / 4] |= static_cast<uint8_t>(bestBitsLog2 << shift);
+        result.insert(result.end(), best.begin(), best.end());
+      }
+    }
+    const auto last = static_cast<std::ptrdiff_t>((first + count - 1) * vertexSize);
+    lastVertex.assign(vertices.begin() + last, vertices.begin() + last + vertexSize);
+  }
+
+  // Tail padded to 32 bytes, ending with the first vertex
+  result.resize(result.size() + std::max<size_t>(32, vertexSize) - vertexSize, 0);
+  result.insert(result.end(), vertices.begin(), vertices.begin() + vertexSize);
+  return result;
+}
+
+} // end of anonymous namespace
+
+TEST(TestMeshoptCompression, VertexBuffer)
+{
+  // 300 vertices of 12 bytes: constant, slowly and quickly varying bytes use all the group modes,
+  // and two blocks are needed
+  const size_t vertexSize = 12, vertexCount = 300;
+  ArrayBuffer vertices(vertexSize * vertexCount);
+  for (size_t i = 0; i < vertexCount; ++i) {
+    for (size_t k = 0; k < vertexSize; ++k) {
+      const auto value             = k < 4 ? 7 : k < 8 ? i / 3 : i * 37 + k;
+      vertices[i * vertexSize + k] = static_cast<uint8_t>(value);
+    }
+  }
+  const auto encoded = EncodeVertices(vertices, vertexSize);
+  EXPECT_LT(encoded.size(), vertices.size());
+
+  const auto decoded = MeshoptCompression::DecodeGltfBuffer(encoded.data(), encoded.size(),
+                                                            vertexCount, vertexSize, "ATTRIBUTES");
+  EXPECT_EQ(decoded, vertices);
+
+  // Truncated data
+  EXPECT_THROW(MeshoptCompression::DecodeGltfBuffer(encoded.data(), encoded.size() - 1,
+                                                    vertexCount, vertexSize, "ATTRIBUTES"),
+               std::runtime_error);
+}
+
+TEST(TestMeshoptCompression, IndexBuffer)
+{
+  // Triangle (0, 1, 2) from the code aux table, then (2, 1, 3) reusing the edge (2, 1) with a new
+  // vertex and (2, 3, 5) reusing the edge (2, 3) with a free vertex, encoded as a delta
+  const ArrayBuffer encoded{0xe1, 0xf0, 0x10, 0x0f, 0x0a, 0x00, 0x76, 0x87, 0x56, 0x67, 0x78,
+                            0xa9, 0x86, 0x65, 0x89, 0x68, 0x98, 0x01, 0x69, 0x00, 0x00};
+  const auto decoded
+    = MeshoptCompression::DecodeGltfBuffer(encoded.data(), encoded.size(), 9, 4, "TRIANGLES");
+  ASSERT_EQ(decoded.size(), 9u * 4u);
+  std::vector<uint32_t> indices(9);
+  std::memcpy(indices.data(), decoded.data(), decoded.size());
+  EXPECT_EQ(indices, (std::vector<uint32_t>{0, 1, 2, 2, 1, 3, 2, 3, 5}));
+
+  const auto shortDecoded
+    = MeshoptCompression::DecodeGltfBuffer(encoded.data(), encoded.size(), 9, 2, "TRIANGLES");
+  std::vector<uint16_t> shortIndices(9);
+  std::memcpy(shortIndices.data(), shortDecoded.data(), shortDecoded.size());
+  EXPECT_EQ(shortIndices, (std::vector<uint16_t>{0, 1, 2, 2, 1, 3, 2, 3, 5}));
+
+  // Bad header
+  auto corrupted = encoded;
+  corrupted[0]   = 0xa0;
+  EXPECT_THROW(
+    MeshoptCompression::DecodeGltfBuffer(corrupted.data(), corrupted.size(), 9, 4, "TRIANGLES"),
+    std::runtime_error);
+}
+
+TEST(TestMeshoptCompression, IndexSequence)
+{
+  // Deltas to the last index of baseline 0: +5, +1, -3, +200
+  const ArrayBuffer encoded{0xd1, 20, 4, 10, 0xa0, 0x06, 0, 0, 0, 0};
+  const auto decoded
+    = MeshoptCompression::DecodeGltfBuffer(encoded.data(), encoded.size(), 4, 4, "INDICES");
+  std::vector<uint32_t> indices(4);
+  std::memcpy(indices.data(), decoded.data(), decoded.size());
+  EXPECT_EQ(indices, (std::vector<uint32_t>{5, 6, 3, 203}));
+}
+
+TEST(TestMeshoptCompression, Filters)
+{
+  // Octahedral normals, z storing 1 at the scale of x and y
+  const std::vector<int16_t> octahedral{0, 0, 32767, 0, 16383, -16384, 32767, 0};
+  ArrayBuffer data(octahedral.size() * 2);
+  std::memcpy(data.data(), octahedral.data(), data.size());
+  MeshoptCompression::DecodeFilterOct(data.data(), 2, 8);
+  std::vector<int16_t> normals(8);
+  std::memcpy(normals.data(), data.data(), data.size());
+  EXPECT_EQ(normals[0], 0);
+  EXPECT_EQ(normals[2], 32767);
+  EXPECT_NEAR(normals[4] / 32767.f, 1.f / std::sqrt(2.f), 1e-3f);
+  EXPECT_NEAR(normals[5] / 32767.f, -1.f / std::sqrt(2.f), 1e-3f);
+  EXPECT_EQ(normals[6], 0);
+
+  // Quaternion (0.5, 0.5, 0.5, 0.5), the largest component being w (index 3)
+  const auto component = static_cast<int16_t>(std::round(0.5f * std::sqrt(2.f) * 32767.f));
+  const std::vector<int16_t> quaternion{component, component, component, (32767 & ~3) | 3};
+  data.resize(8);
+  std::memcpy(data.data(), quaternion.data(), data.size());
+  MeshoptCompression::DecodeFilterQuat(data.data(), 1, 8);
+  std::vector<int16_t> rotation(4);
+  std::memcpy(rotation.data(), data.data(), data.size());
+  for (const auto value : rotation) {
+    EXPECT_NEAR(value / 32767.f, 0.5f, 1e-3f);
+  }
+
+  // Exponential: 3 * 2^-1 and -1 * 2^-2
+  const std::vector<uint32_t> exponential{(0xffu << 24) | 3u, (0xfeu << 24) | 0xffffffu};
+  data.resize(8);
+  std::memcpy(data.data(), exponential.data(), data.size());
+  MeshoptCompression::DecodeFilterExp(data.data(), 2, 4);
+  std::vector<float> values(2);
+  std::memcpy(values.data(), data.data(), data.size());
+  EXPECT_FLOAT_EQ(values[0], 1.5f);
+  EXPECT_FLOAT_EQ(values[1], -0.25f);
+}
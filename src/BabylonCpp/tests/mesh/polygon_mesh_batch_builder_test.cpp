@@ -0,0 +1,371 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <random>
+
+#include "../test_utils.h"
+
+#include <babylon/engines/scene.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/polygonmesh/polygon_mesh_batch_builder.h>
+#include <babylon/meshes/polygonmesh/polygon_mesh_builder.h>
+#include <babylon/meshes/sub_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_data.h>
+
+namespace {
+
+using Contour = std::vector<BABYLON::Vector2>;
+
+Contour Rectangle(float x, float y, float width, float height)
+{
+  using namespace BABYLON;
+  return {Vector2(x, y), Vector2(x + width, y), Vector2(x + width, y + height),
+          Vector2(x, y + height)};
+}
+
+// Concave L-shaped footprint
+Contour LShape(float x, float y, float size)
+{
+  using namespace BABYLON;
+  return {Vector2(x, y),
+          Vector2(x + size, y),
+          Vector2(x + size, y + size / 2.f),
+          Vector2(x + size / 2.f, y + size / 2.f),
+          Vector2(x + size / 2.f, y + size),
+          Vector2(x, y + size)};
+}
+
+Contour RegularPolygon(float x, float y, float radius, unsigned int sides)
+{
+  Contour contour;
+  for (unsigned int i = 0; i < sides; ++i) {
+    const auto angle = 2.f * 3.14159265f * static_cast<float>(i) / static_cast<float>(sides);
+    contour.emplace_back(x + radius * std::cos(angle), y + radius * std::sin(angle));
+  }
+  return contour;
+}
+
+float ContourArea(const Contour& contour)
+{
+  float area = 0.f;
+  for (size_t i = 0; i < contour.size(); ++i) {
+    const auto& a = contour[i];
+    const auto& b = contour[(i + 1) % contour.size()];
+    area += a.x * b.y - b.x * a.y;
+  }
+  return std::abs(area) / 2.f;
+}
+
+// Area covered by the "indexCount" first indices of the range, in the xz plane
+float TrianglesArea(const BABYLON::VertexData& vertexData, size_t indexStart, size_t indexCount)
+{
+  const auto& positions = vertexData.positions;
+  const auto& indices   = vertexData.indices;
+  float area            = 0.f;
+  for (size_t i = indexStart; i < indexStart + indexCount; i += 3) {
+    const auto a = 3 * indices[i], b = 3 * indices[i + 1], c = 3 * indices[i + 2];
+    area += std::abs((positions[b] - positions[a]) * (positions[c + 2] - positions[a + 2])
+                     - (positions[c] - positions[a]) * (positions[b + 2] - positions[a + 2]))
+            / 2.f;
+  }
+  return area;
+}
+
+/**
+ * @brief Expects the geometry of a polygon in the shared buffers to be the one PolygonMeshBuilder
+ * builds for it.
+ */
+void ExpectSameGeometry(const BABYLON::VertexData& batch,
+                        const BABYLON::PolygonMeshBatchRange& range,
+                        const BABYLON::VertexData& expected)
+{
+  ASSERT_EQ(range.verticesCount, expected.positions.size() / 3);
+  ASSERT_EQ(range.indexCount, expected.indices.size());
+  for (size_t i = 0; i < expected.positions.size(); ++i) {
+    EXPECT_NEAR(batch.positions[3 * range.verticesStart + i], expected.positions[i], 1e-5f);
+    EXPECT_NEAR(batch.normals[3 * range.verticesStart + i], expected.normals[i], 1e-5f);
+  }
+  for (size_t i = 0; i < expected.uvs.size(); ++i) {
+    EXPECT_NEAR(batch.uvs[2 * range.verticesStart + i], expected.uvs[i], 1e-5f);
+  }
+  for (size_t i = 0; i < expected.indices.size(); ++i) {
+    EXPECT_EQ(batch.indices[range.indexStart + i], expected.indices[i] + range.verticesStart);
+  }
+}
+
+std::unique_ptr<BABYLON::VertexData> BuildReference(const Contour& contour,
+                                                    const std::vector<Contour>& holes, float depth,
+                                                    BABYLON::Scene* scene)
+{
+  BABYLON::PolygonMeshBuilder builder("reference", contour, scene);
+  for (const auto& hole : holes) {
+    builder.addHole(hole);
+  }
+  return builder.buildVertexData(depth);
+}
+
+// The ranges follow each other in the buffers, in the order the polygons were added
+void ExpectContiguousRanges(const std::vector<BABYLON::PolygonMeshBatchRange>& ranges,
+                            const BABYLON::VertexData& vertexData)
+{
+  size_t verticesStart = 0, indexStart = 0;
+  for (const auto& range : ranges) {
+    EXPECT_EQ(range.verticesStart, verticesStart);
+    EXPECT_EQ(range.indexStart, indexStart);
+    verticesStart += range.verticesCount;
+    indexStart += range.indexCount;
+  }
+  EXPECT_EQ(vertexData.positions.size(), 3 * verticesStart);
+  EXPECT_EQ(vertexData.normals.size(), 3 * verticesStart);
+  EXPECT_EQ(vertexData.uvs.size(), 2 * verticesStart);
+  EXPECT_EQ(vertexData.indices.size(), indexStart);
+}
+
+} // end of anonymous namespace
+
+TEST(TestPolygonMeshBatchBuilder, FlatPolygonsMatchPolygonMeshBuilder)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  const std::vector<Contour> contours{Rectangle(0.f, 0.f, 4.f, 2.f), LShape(10.f, -5.f, 6.f),
+                                      RegularPolygon(-20.f, 3.f, 2.5f, 8)};
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  for (size_t i = 0; i < contours.size(); ++i) {
+    EXPECT_EQ(batchBuilder.addPolygon(contours[i]), i);
+  }
+  EXPECT_EQ(batchBuilder.polygonCount(), contours.size());
+
+  const auto vertexData = batchBuilder.buildVertexData();
+  const auto& ranges    = batchBuilder.ranges();
+  ASSERT_EQ(ranges.size(), contours.size());
+  ExpectContiguousRanges(ranges, *vertexData);
+  for (size_t i = 0; i < contours.size(); ++i) {
+    ExpectSameGeometry(*vertexData, ranges[i], *BuildReference(contours[i], {}, 0.f, scene.get()));
+    // The cap covers the polygon with n - 2 triangles
+    EXPECT_EQ(ranges[i].indexCount, 3 * (contours[i].size() - 2));
+    EXPECT_NEAR(TrianglesArea(*vertexData, ranges[i].indexStart, ranges[i].indexCount),
+                ContourArea(contours[i]), 1e-3f);
+  }
+}
+
+TEST(TestPolygonMeshBatchBuilder, PolygonsWithHolesMatchPolygonMeshBuilder)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  const auto contour = Rectangle(0.f, 0.f, 10.f, 10.f);
+  const std::vector<Contour> holes{Rectangle(1.f, 1.f, 2.f, 2.f), Rectangle(6.f, 5.f, 2.f, 3.f)};
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  batchBuilder.addPolygon(LShape(20.f, 0.f, 4.f));
+  batchBuilder.addPolygon(contour, holes);
+
+  // Same polygon from interleaved coordinates, each ring closed by a copy of its first point
+  Float32Array coordinates;
+  Uint32Array holeIndices;
+  for (const auto* ring : {&contour, &holes[0], &holes[1]}) {
+    if (ring != &contour) {
+      holeIndices.emplace_back(static_cast<uint32_t>(coordinates.size() / 2));
+    }
+    for (const auto& point : *ring) {
+      coordinates.insert(coordinates.end(), {point.x, point.y});
+    }
+    coordinates.insert(coordinates.end(), {ring->front().x, ring->front().y});
+  }
+  batchBuilder.addPolygon(coordinates, holeIndices);
+
+  const auto vertexData = batchBuilder.buildVertexData();
+  const auto& ranges    = batchBuilder.ranges();
+  ASSERT_EQ(ranges.size(), 3ull);
+  ExpectContiguousRanges(ranges, *vertexData);
+
+  const auto expected = BuildReference(contour, holes, 0.f, scene.get());
+  for (size_t i = 1; i < 3; ++i) {
+    ExpectSameGeometry(*vertexData, ranges[i], *expected);
+    // n + 2h - 2 triangles covering the polygon without its holes
+    EXPECT_EQ(ranges[i].indexCount, 3u * (12u + 2u * 2u - 2u));
+    EXPECT_NEAR(TrianglesArea(*vertexData, ranges[i].indexStart, ranges[i].indexCount),
+                ContourArea(contour) - ContourArea(holes[0]) - ContourArea(holes[1]), 1e-3f);
+  }
+}
+
+TEST(TestPolygonMeshBatchBuilder, ExtrudedPolygonsMatchPolygonMeshBuilder)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  struct Footprint {
+    Contour contour;
+    std::vector<Contour> holes;
+    float depth;
+  };
+  const std::vector<Footprint> footprints{
+    {Rectangle(0.f, 0.f, 4.f, 2.f), {}, 3.f},
+    {LShape(10.f, -5.f, 6.f), {}, 0.f},
+    {Rectangle(-10.f, -10.f, 8.f, 8.f), {Rectangle(-8.f, -8.f, 2.f, 2.f)}, 12.5f},
+    {RegularPolygon(-20.f, 3.f, 2.5f, 7), {}, 0.5f}};
+
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  for (const auto& footprint : footprints) {
+    batchBuilder.addPolygon(footprint.contour, footprint.holes, footprint.depth);
+  }
+
+  const auto vertexData = batchBuilder.buildVertexData();
+  const auto& ranges    = batchBuilder.ranges();
+  ASSERT_EQ(ranges.size(), footprints.size());
+  ExpectContiguousRanges(ranges, *vertexData);
+  for (size_t i = 0; i < footprints.size(); ++i) {
+    const auto& footprint = footprints[i];
+    ExpectSameGeometry(
+      *vertexData, ranges[i],
+      *BuildReference(footprint.contour, footprint.holes, footprint.depth, scene.get()));
+  }
+
+  // Top and bottom caps and 4 vertices per side
+  EXPECT_EQ(ranges[0].verticesCount, 4u * 6u);
+  EXPECT_EQ(ranges[1].verticesCount, 6u);
+  EXPECT_EQ(ranges[2].verticesCount, 8u * 6u);
+}
+
+TEST(TestPolygonMeshBatchBuilder, DegeneratePolygonsGetEmptyCaps)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  batchBuilder.addPolygon(Rectangle(0.f, 0.f, 1.f, 1.f));
+  // Collinear points
+  batchBuilder.addPolygon({Vector2(0.f, 0.f), Vector2(1.f, 0.f), Vector2(2.f, 0.f)});
+  // Single edge, closed
+  batchBuilder.addPolygon(Float32Array{5.f, 5.f, 6.f, 6.f, 5.f, 5.f});
+  // Empty hole
+  batchBuilder.addPolygon(Rectangle(3.f, 3.f, 2.f, 2.f), {Contour{}});
+  batchBuilder.addPolygon(LShape(10.f, 10.f, 2.f));
+
+  const auto vertexData = batchBuilder.buildVertexData();
+  const auto& ranges    = batchBuilder.ranges();
+  ASSERT_EQ(ranges.size(), 5ull);
+  ExpectContiguousRanges(ranges, *vertexData);
+
+  EXPECT_EQ(ranges[1].verticesCount, 3u);
+  EXPECT_EQ(ranges[1].indexCount, 0u);
+  EXPECT_EQ(ranges[2].verticesCount, 2u);
+  EXPECT_EQ(ranges[2].indexCount, 0u);
+  for (const auto uv : vertexData->uvs) {
+    EXPECT_TRUE(std::isfinite(uv));
+  }
+
+  // The polygons around the degenerate ones are not affected
+  ExpectSameGeometry(*vertexData, ranges[0],
+                     *BuildReference(Rectangle(0.f, 0.f, 1.f, 1.f), {}, 0.f, scene.get()));
+  ExpectSameGeometry(*vertexData, ranges[3],
+                     *BuildReference(Rectangle(3.f, 3.f, 2.f, 2.f), {}, 0.f, scene.get()));
+  ExpectSameGeometry(*vertexData, ranges[4],
+                     *BuildReference(LShape(10.f, 10.f, 2.f), {}, 0.f, scene.get()));
+}
+
+TEST(TestPolygonMeshBatchBuilder, ManyPolygonsMatchPolygonMeshBuilder)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  // Enough polygons to be triangulated by several parallel chunks
+  std::mt19937 generator(42);
+  std::uniform_real_distribution<float> position(-500.f, 500.f);
+  std::uniform_real_distribution<float> size(1.f, 20.f);
+  std::uniform_int_distribution<unsigned int> sides(3, 12);
+  struct Footprint {
+    Contour contour;
+    float depth;
+  };
+  std::vector<Footprint> footprints;
+  for (size_t i = 0; i < 500; ++i) {
+    const auto x = position(generator), y = position(generator), s = size(generator);
+    auto contour = (i % 3 == 0) ? LShape(x, y, s) :
+                   (i % 3 == 1) ? RegularPolygon(x, y, s, sides(generator)) :
+                                  Rectangle(x, y, s, size(generator));
+    footprints.push_back({std::move(contour), (i % 2 == 0) ? size(generator) : 0.f});
+  }
+
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  batchBuilder.reserve(footprints.size(), footprints.size() * 12);
+  for (const auto& footprint : footprints) {
+    batchBuilder.addPolygon(footprint.contour, {}, footprint.depth);
+  }
+
+  const auto vertexData = batchBuilder.buildVertexData();
+  const auto& ranges    = batchBuilder.ranges();
+  ASSERT_EQ(ranges.size(), footprints.size());
+  ExpectContiguousRanges(ranges, *vertexData);
+  for (size_t i = 0; i < footprints.size(); ++i) {
+    ExpectSameGeometry(
+      *vertexData, ranges[i],
+      *BuildReference(footprints[i].contour, {}, footprints[i].depth, scene.get()));
+  }
+
+  batchBuilder.clear();
+  EXPECT_EQ(batchBuilder.polygonCount(), 0ull);
+  EXPECT_TRUE(batchBuilder.ranges().empty());
+}
+
+TEST(TestPolygonMeshBatchBuilder, BuildCreatesSubMeshesAndPolygonIds)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  PolygonMeshBatchBuilder batchBuilder("batch", scene.get());
+  batchBuilder.addPolygon(Rectangle(0.f, 0.f, 4.f, 2.f), {}, 2.f);
+  batchBuilder.addPolygon(LShape(10.f, -5.f, 6.f));
+  batchBuilder.addPolygon(Rectangle(-10.f, -10.f, 8.f, 8.f), {Rectangle(-8.f, -8.f, 2.f, 2.f)},
+                          4.f);
+
+  const auto expected = batchBuilder.buildVertexData();
+  const auto ranges   = batchBuilder.ranges();
+  const auto mesh     = batchBuilder.build(false, true, true);
+  ASSERT_TRUE(mesh);
+  EXPECT_EQ(mesh->name, "batch");
+  EXPECT_EQ(mesh->getTotalVertices(), expected->positions.size() / 3);
+  EXPECT_EQ(mesh->getVerticesData(VertexBuffer::PositionKind), expected->positions);
+  EXPECT_EQ(mesh->getVerticesData(VertexBuffer::NormalKind), expected->normals);
+  EXPECT_EQ(mesh->getVerticesData(VertexBuffer::UVKind), expected->uvs);
+  EXPECT_EQ(mesh->getIndices(), expected->indices);
+
+  // A submesh per polygon, at its range in the buffers
+  ASSERT_EQ(mesh->subMeshes.size(), ranges.size());
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    const auto& subMesh = mesh->subMeshes[i];
+    EXPECT_EQ(subMesh->verticesStart, ranges[i].verticesStart);
+    EXPECT_EQ(subMesh->verticesCount, ranges[i].verticesCount);
+    EXPECT_EQ(subMesh->indexStart, ranges[i].indexStart);
+    EXPECT_EQ(subMesh->indexCount, ranges[i].indexCount);
+  }
+
+  // The index of the polygon of each vertex
+  ASSERT_TRUE(mesh->isVerticesDataPresent(PolygonMeshBatchBuilder::PolygonIdKind));
+  const auto polygonIds = mesh->getVerticesData(PolygonMeshBatchBuilder::PolygonIdKind);
+  ASSERT_EQ(polygonIds.size(), expected->positions.size() / 3);
+  for (size_t i = 0; i < ranges.size(); ++i) {
+    for (size_t v = 0; v < ranges[i].verticesCount; ++v) {
+      EXPECT_EQ(polygonIds[ranges[i].verticesStart + v], static_cast<float>(i));
+    }
+  }
+
+  // Without submeshes nor polygon ids
+  const auto plainMesh = batchBuilder.build();
+  EXPECT_EQ(plainMesh->subMeshes.size(), 1ull);
+  EXPECT_FALSE(plainMesh->isVerticesDataPresent(PolygonMeshBatchBuilder::PolygonIdKind));
+}
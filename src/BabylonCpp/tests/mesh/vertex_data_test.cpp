@@ -1,10 +1,67 @@
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <cmath>
+#include <random>
+
 #include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/facet_parameters.h>
 #include <babylon/meshes/geometry.h>
 #include <babylon/meshes/vertex_data.h>
 
+namespace {
+
+// Wavy grid of (subdivisions + 1)^2 vertices
+void CreateWavyGrid(unsigned int subdivisions, BABYLON::Float32Array& positions,
+                    BABYLON::IndicesArray& indices)
+{
+  for (unsigned int row = 0; row <= subdivisions; ++row) {
+    for (unsigned int col = 0; col <= subdivisions; ++col) {
+      positions.insert(positions.end(), {static_cast<float>(col), std::sin(col * 0.3f + row * 0.2f),
+                                         static_cast<float>(row)});
+    }
+  }
+  for (unsigned int row = 0; row < subdivisions; ++row) {
+    for (unsigned int col = 0; col < subdivisions; ++col) {
+      const auto topLeft    = row * (subdivisions + 1) + col;
+      const auto bottomLeft = topLeft + subdivisions + 1;
+      indices.insert(indices.end(), {bottomLeft + 1, bottomLeft, topLeft, //
+                                     topLeft + 1, bottomLeft + 1, topLeft});
+    }
+  }
+}
+
+// Sequential accumulation of the face normals, in facet order
+BABYLON::Float32Array SequentialNormals(const BABYLON::Float32Array& positions,
+                                        const BABYLON::IndicesArray& indices)
+{
+  using namespace BABYLON;
+  Float32Array normals(positions.size(), 0.f);
+  for (size_t face = 0; face < indices.size() / 3; ++face) {
+    const auto v1 = indices[face * 3], v2 = indices[face * 3 + 1], v3 = indices[face * 3 + 2];
+    const Vector3 p1(positions[v1 * 3], positions[v1 * 3 + 1], positions[v1 * 3 + 2]);
+    const Vector3 p2(positions[v2 * 3], positions[v2 * 3 + 1], positions[v2 * 3 + 2]);
+    const Vector3 p3(positions[v3 * 3], positions[v3 * 3 + 1], positions[v3 * 3 + 2]);
+    const auto normal = Vector3::Cross(p1.subtract(p2), p3.subtract(p2)).normalize();
+    for (const auto vertex : {v1, v2, v3}) {
+      normals[vertex * 3] += normal.x;
+      normals[vertex * 3 + 1] += normal.y;
+      normals[vertex * 3 + 2] += normal.z;
+    }
+  }
+  for (size_t i = 0; i < normals.size(); i += 3) {
+    const auto length = std::sqrt(normals[i] * normals[i] + normals[i + 1] * normals[i + 1]
+                                  + normals[i + 2] * normals[i + 2]);
+    normals[i] /= length;
+    normals[i + 1] /= length;
+    normals[i + 2] /= length;
+  }
+  return normals;
+}
+
+} // end of anonymous namespace
+
 TEST(TestVertexData, CreateBox)
 {
   using namespace BABYLON;
@@ -291,3 +348,77 @@ TEST(TestVertexData, CreateTiledGround)
   EXPECT_THAT(tiledGround->normals, ::testing::ContainerEq(expectedNormals));
   EXPECT_THAT(tiledGround->uvs, ::testing::ContainerEq(expectedUVs));
 }
+
+TEST(TestVertexData, ComputeNormals)
+{
+  using namespace BABYLON;
+  // Create test data: a wavy grid large enough to be processed in several parallel chunks
+  Float32Array positions;
+  IndicesArray indices;
+  CreateWavyGrid(100, positions, indices);
+  // Set expected results: sequential accumulation of the face normals
+  const auto faceCount       = indices.size() / 3;
+  const auto expectedNormals = SequentialNormals(positions, indices);
+  std::vector<Vector3> expectedFacetNormals(faceCount);
+  for (size_t face = 0; face < faceCount; ++face) {
+    const auto v1 = indices[face * 3], v2 = indices[face * 3 + 1], v3 = indices[face * 3 + 2];
+    const Vector3 p1(positions[v1 * 3], positions[v1 * 3 + 1], positions[v1 * 3 + 2]);
+    const Vector3 p2(positions[v2 * 3], positions[v2 * 3 + 1], positions[v2 * 3 + 2]);
+    const Vector3 p3(positions[v3 * 3], positions[v3 * 3 + 1], positions[v3 * 3 + 2]);
+    expectedFacetNormals[face] = Vector3::Cross(p1.subtract(p2), p3.subtract(p2)).normalize();
+  }
+  // Perform computation
+  Float32Array normals(positions.size());
+  FacetParameters facetParameters;
+  facetParameters.facetNormals.resize(faceCount);
+  facetParameters.facetPositions.resize(faceCount);
+  VertexData::ComputeNormals(positions, indices, normals, &facetParameters);
+  // Compare results
+  ASSERT_EQ(normals.size(), expectedNormals.size());
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(normals[i], expectedNormals[i], 1e-5f);
+  }
+  for (size_t face = 0; face < faceCount; ++face) {
+    EXPECT_NEAR(facetParameters.facetNormals[face].x, expectedFacetNormals[face].x, 1e-5f);
+    EXPECT_NEAR(facetParameters.facetNormals[face].y, expectedFacetNormals[face].y, 1e-5f);
+    EXPECT_NEAR(facetParameters.facetNormals[face].z, expectedFacetNormals[face].z, 1e-5f);
+  }
+  const auto v0 = indices[0], v1 = indices[1], v2 = indices[2];
+  EXPECT_NEAR(facetParameters.facetPositions[0].x,
+              (positions[v0 * 3] + positions[v1 * 3] + positions[v2 * 3]) / 3.f, 1e-5f);
+  // Computation without facet data gives the same normals
+  Float32Array normalsOnly(positions.size());
+  VertexData::ComputeNormals(positions, indices, normalsOnly);
+  EXPECT_THAT(normalsOnly, ::testing::ContainerEq(normals));
+}
+
+TEST(TestVertexData, ComputeNormalsShuffledFaces)
+{
+  using namespace BABYLON;
+  // Create test data: a grid with more vertices than several parallel vertex ranges, whose faces
+  // are shuffled so that every facet chunk references vertices of every range
+  Float32Array positions;
+  IndicesArray indices;
+  CreateWavyGrid(300, positions, indices);
+  std::vector<size_t> faces(indices.size() / 3);
+  for (size_t face = 0; face < faces.size(); ++face) {
+    faces[face] = face;
+  }
+  std::shuffle(faces.begin(), faces.end(), std::mt19937(42));
+  IndicesArray shuffledIndices;
+  shuffledIndices.reserve(indices.size());
+  for (const auto face : faces) {
+    shuffledIndices.insert(shuffledIndices.end(), indices.begin() + static_cast<long>(face * 3),
+                           indices.begin() + static_cast<long>(face * 3 + 3));
+  }
+  // Set expected results
+  const auto expectedNormals = SequentialNormals(positions, shuffledIndices);
+  // Perform computation
+  Float32Array normals;
+  VertexData::ComputeNormals(positions, shuffledIndices, normals);
+  // Compare results
+  ASSERT_EQ(normals.size(), expectedNormals.size());
+  for (size_t i = 0; i < normals.size(); ++i) {
+    EXPECT_NEAR(normals[i], expectedNormals[i], 1e-5f);
+  }
+}
@@ -0,0 +1,207 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <cstring>
+
+#include "../test_utils.h"
+
+#include <babylon/bones/skeleton.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/multi_material.h>
+#include <babylon/materials/node/node_material.h>
+#include <babylon/materials/standard_material.h>
+#include <babylon/maths/matrix.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/builders/mesh_builder_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/mesh_builder.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/meshes/vertex_quantization.h>
+#include <babylon/morph/morph_target_manager.h>
+
+TEST(TestVertexQuantization, HalfFloat)
+{
+  using namespace BABYLON;
+
+  EXPECT_EQ(VertexQuantization::ToHalfFloat(0.f), 0x0000);
+  EXPECT_EQ(VertexQuantization::ToHalfFloat(1.f), 0x3c00);
+  EXPECT_EQ(VertexQuantization::ToHalfFloat(-2.f), 0xc000);
+  EXPECT_EQ(VertexQuantization::ToHalfFloat(65504.f), 0x7bff);
+  EXPECT_EQ(VertexQuantization::ToHalfFloat(1e6f), 0x7c00);
+
+  for (const auto value : {0.f, 1.f, -2.5f, 0.333f, 0.999f, 1.5f, 1e-5f, 65504.f}) {
+    const auto decoded = VertexQuantization::FromHalfFloat(VertexQuantization::ToHalfFloat(value));
+    EXPECT_NEAR(decoded, value, std::max(std::abs(value) * 1e-3f, 6e-8f));
+  }
+}
+
+TEST(TestVertexQuantization, Octahedral)
+{
+  using namespace BABYLON;
+
+  const std::vector<Vector3> vectors{
+    Vector3(0.f, 0.f, 1.f),    Vector3(0.f, 0.f, -1.f),   Vector3(1.f, 0.f, 0.f),
+    Vector3(0.f, -1.f, 0.f),   Vector3(0.3f, -0.5f, 0.8f), Vector3(-0.6f, 0.2f, -0.7f),
+    Vector3(0.5f, 0.5f, -0.5f)};
+
+  Float32Array normals;
+  for (const auto& vector : vectors) {
+    const auto normal = vector.normalizeToNew();
+    normals.insert(normals.end(), {normal.x, normal.y, normal.z});
+  }
+
+  // Float roundtrip
+  std::array<float, 3> decoded{};
+  for (size_t index = 0; index < vectors.size(); ++index) {
+    float u = 0.f, v = 0.f;
+    VertexQuantization::OctahedralEncode(normals[index * 3], normals[index * 3 + 1],
+                                         normals[index * 3 + 2], u, v);
+    VertexQuantization::OctahedralDecode(u, v, decoded.data());
+    for (size_t component = 0; component < 3; ++component) {
+      EXPECT_NEAR(decoded[component], normals[index * 3 + component], 1e-5f);
+    }
+  }
+
+  // 16-bit signed normalized roundtrip
+  const auto encoded = VertexQuantization::EncodeOctahedral(normals, 3);
+  EXPECT_EQ(encoded.size() * sizeof(float), vectors.size() * VertexQuantization::NormalByteStride);
+  Int16Array values(vectors.size() * 2);
+  std::memcpy(values.data(), encoded.data(), values.size() * sizeof(int16_t));
+  for (size_t index = 0; index < vectors.size(); ++index) {
+    VertexQuantization::OctahedralDecode(values[index * 2] / 32767.f,
+                                         values[index * 2 + 1] / 32767.f, decoded.data());
+    for (size_t component = 0; component < 3; ++component) {
+      EXPECT_NEAR(decoded[component], normals[index * 3 + component], 1e-3f);
+    }
+  }
+}
+
+TEST(TestVertexQuantization, QuantizePositions)
+{
+  using namespace BABYLON;
+
+  const Float32Array positions{-1.f, 2.f, 0.5f, 3.f, -4.f, 0.f, 0.25f, 0.75f, 10.f};
+  const auto vertexCount = positions.size() / 3;
+
+  Matrix dequantizationMatrix;
+  const auto encoded = VertexQuantization::QuantizePositions(positions, dequantizationMatrix);
+  EXPECT_EQ(encoded.size() * sizeof(float),
+            vertexCount * VertexQuantization::PositionByteStride);
+
+  Uint16Array values(vertexCount * 4);
+  std::memcpy(values.data(), encoded.data(), values.size() * sizeof(uint16_t));
+  // Extent is 10 (z axis), the error is bounded by half a quantization step
+  const auto tolerance = 10.f / 65535.f;
+  for (size_t vertex = 0; vertex < vertexCount; ++vertex) {
+    Vector3 position;
+    Vector3::TransformCoordinatesFromFloatsToRef(values[vertex * 4] / 65535.f,
+                                                 values[vertex * 4 + 1] / 65535.f,
+                                                 values[vertex * 4 + 2] / 65535.f,
+                                                 dequantizationMatrix, position);
+    EXPECT_NEAR(position.x, positions[vertex * 3], tolerance);
+    EXPECT_NEAR(position.y, positions[vertex * 3 + 1], tolerance);
+    EXPECT_NEAR(position.z, positions[vertex * 3 + 2], tolerance);
+  }
+}
+
+TEST(TestVertexQuantization, OctahedralNormalsNeedDecodingMaterialsAndNoMorphTargets)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  VertexQuantizationOptions options;
+  options.positions = false;
+  options.uvs       = false;
+
+  const auto createBox = [&scene](const std::string& name, const MaterialPtr& material) {
+    BoxOptions boxOptions;
+    auto box      = MeshBuilder::CreateBox(name, boxOptions, scene.get());
+    box->material = material;
+    return box;
+  };
+  const auto isOctahedral = [](const MeshPtr& mesh) {
+    return mesh->getVertexBuffer(VertexBuffer::NormalKind)->octahedralEncoded;
+  };
+
+  // Standard materials decode the octahedral normals, node materials do not
+  auto standardMaterial = StandardMaterial::New("standard", scene.get());
+  auto nodeMaterial     = NodeMaterial::New("node", scene.get());
+  EXPECT_TRUE(standardMaterial->supportsOctahedralVertexData());
+  EXPECT_FALSE(nodeMaterial->supportsOctahedralVertexData());
+
+  auto standardBox = createBox("standardBox", standardMaterial);
+  standardBox->quantizeVertexData(options);
+  EXPECT_TRUE(isOctahedral(standardBox));
+
+  auto nodeBox = createBox("nodeBox", nodeMaterial);
+  nodeBox->quantizeVertexData(options);
+  EXPECT_FALSE(isOctahedral(nodeBox));
+
+  // Multi materials decode them when all their sub materials do
+  auto multiMaterial          = MultiMaterial::New("multi", scene.get());
+  multiMaterial->subMaterials = {standardMaterial};
+  EXPECT_TRUE(multiMaterial->supportsOctahedralVertexData());
+  multiMaterial->subMaterials = {standardMaterial, nodeMaterial};
+  EXPECT_FALSE(multiMaterial->supportsOctahedralVertexData());
+  auto multiBox = createBox("multiBox", multiMaterial);
+  multiBox->quantizeVertexData(options);
+  EXPECT_FALSE(isOctahedral(multiBox));
+
+  // Morph targets are applied on the actual normals
+  auto morphedBox                = createBox("morphedBox", standardMaterial);
+  morphedBox->morphTargetManager = MorphTargetManager::New(scene.get());
+  morphedBox->quantizeVertexData(options);
+  EXPECT_FALSE(isOctahedral(morphedBox));
+
+  // All the meshes sharing the geometry render the encoded normals
+  auto sharedBox  = createBox("sharedBox", standardMaterial);
+  auto clone      = sharedBox->clone("clone");
+  clone->material = nodeMaterial;
+  sharedBox->quantizeVertexData(options);
+  EXPECT_FALSE(isOctahedral(sharedBox));
+}
+
+TEST(TestVertexQuantization, PositionsOfSkinnedOrMorphedGeometriesAreKept)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+
+  VertexQuantizationOptions options;
+  options.normals  = false;
+  options.tangents = false;
+  options.uvs      = false;
+
+  const auto createBox = [&scene](const std::string& name) {
+    BoxOptions boxOptions;
+    return MeshBuilder::CreateBox(name, boxOptions, scene.get());
+  };
+  const auto isQuantized = [](const MeshPtr& mesh) {
+    const auto vertexBuffer = mesh->getVertexBuffer(VertexBuffer::PositionKind);
+    return vertexBuffer->type == VertexBuffer::UNSIGNED_SHORT
+           && vertexBuffer->dequantizationMatrix != nullptr;
+  };
+
+  auto box = createBox("box");
+  box->quantizeVertexData(options);
+  EXPECT_TRUE(isQuantized(box));
+
+  // Bones and morph targets of any mesh sharing the geometry move the actual positions
+  auto skinnedBox        = createBox("skinnedBox");
+  auto skinnedClone      = skinnedBox->clone("skinnedClone");
+  skinnedClone->skeleton = Skeleton::New("skeleton", "skeleton", scene.get());
+  skinnedBox->quantizeVertexData(options);
+  EXPECT_FALSE(isQuantized(skinnedBox));
+  EXPECT_FALSE(isQuantized(skinnedClone));
+
+  auto morphedBox                  = createBox("morphedBox");
+  auto morphedClone                = morphedBox->clone("morphedClone");
+  morphedClone->morphTargetManager = MorphTargetManager::New(scene.get());
+  morphedBox->quantizeVertexData(options);
+  EXPECT_FALSE(isQuantized(morphedBox));
+  EXPECT_FALSE(isQuantized(morphedClone));
+}
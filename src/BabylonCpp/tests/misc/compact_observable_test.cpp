@@ -0,0 +1,114 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <babylon/misc/compact_observable.h>
+
+TEST(TestCompactObservable, NotifyObserversInOrder)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  EXPECT_FALSE(observable.hasObservers());
+  EXPECT_TRUE(observable.notifyObservers());
+
+  std::vector<int> calls;
+  observable.add([&calls](int* value, EventState&) { calls.emplace_back(*value); });
+  observable.add([&calls](int* value, EventState&) { calls.emplace_back(*value * 10); });
+  observable.add([&calls](int* value, EventState&) { calls.emplace_back(-*value); }, -1, true);
+  EXPECT_EQ(observable.observerCount(), 3u);
+
+  int value = 2;
+  EXPECT_TRUE(observable.notifyObservers(&value));
+  EXPECT_THAT(calls, ::testing::ElementsAre(-2, 2, 20));
+}
+
+TEST(TestCompactObservable, MaskAndSkipNextObservers)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  std::vector<int> calls;
+  observable.add([&calls](int*, EventState&) { calls.emplace_back(1); }, 0x01);
+  observable.add([&calls](int*, EventState&) { calls.emplace_back(2); }, 0x02);
+  observable.add(
+    [&calls](int*, EventState& state) {
+      calls.emplace_back(3);
+      state.skipNextObservers = true;
+    },
+    0x03);
+  observable.add([&calls](int*, EventState&) { calls.emplace_back(4); });
+
+  EXPECT_TRUE(observable.hasSpecificMask(0x02));
+  EXPECT_FALSE(observable.notifyObservers(nullptr, 0x02));
+  EXPECT_THAT(calls, ::testing::ElementsAre(2, 3));
+}
+
+TEST(TestCompactObservable, RemoveObservers)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  std::vector<int> calls;
+  const auto first  = observable.add([&calls](int*, EventState&) { calls.emplace_back(1); });
+  const auto second = observable.add([&calls](int*, EventState&) { calls.emplace_back(2); });
+  observable.addOnce([&calls](int*, EventState&) { calls.emplace_back(3); });
+  EXPECT_NE(first, second);
+
+  EXPECT_TRUE(observable.remove(first));
+  EXPECT_FALSE(observable.remove(first));
+  EXPECT_FALSE(observable.remove(CompactObserverHandle{}));
+  observable.notifyObservers();
+  observable.notifyObservers();
+  EXPECT_THAT(calls, ::testing::ElementsAre(2, 3, 2));
+  EXPECT_EQ(observable.observerCount(), 1u);
+
+  observable.clear();
+  EXPECT_FALSE(observable.hasObservers());
+  EXPECT_FALSE(observable.remove(second));
+}
+
+TEST(TestCompactObservable, ModifyObserversWhileNotifying)
+{
+  using namespace BABYLON;
+
+  CompactObservable<int> observable;
+  std::vector<int> calls;
+  CompactObserverHandle second;
+  observable.add([&](int*, EventState&) {
+    calls.emplace_back(1);
+    if (calls.size() == 1) {
+      // Removed observers are skipped, added ones are called from the next notification
+      observable.remove(second);
+      observable.add([&calls](int*, EventState&) { calls.emplace_back(3); });
+      observable.add([&calls](int*, EventState&) { calls.emplace_back(0); }, -1, true);
+    }
+  });
+  second = observable.add([&calls](int*, EventState&) { calls.emplace_back(2); });
+
+  observable.notifyObservers();
+  EXPECT_THAT(calls, ::testing::ElementsAre(1));
+  EXPECT_EQ(observable.observerCount(), 3u);
+
+  observable.notifyObservers();
+  EXPECT_THAT(calls, ::testing::ElementsAre(1, 0, 1, 3));
+}
+
+TEST(TestCompactObservable, InlineFunctionOwnsCallable)
+{
+  using namespace BABYLON;
+
+  auto counter = std::make_shared<int>(0);
+  {
+    InlineFunction<int(int)> function([counter](int value) { return *counter += value; });
+    EXPECT_EQ(counter.use_count(), 2);
+
+    auto moved = std::move(function);
+    EXPECT_FALSE(function);
+    EXPECT_EQ(moved(3), 3);
+    EXPECT_EQ(moved(4), 7);
+    EXPECT_EQ(counter.use_count(), 2);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
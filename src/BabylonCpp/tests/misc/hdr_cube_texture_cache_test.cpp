@@ -0,0 +1,63 @@
+#include <gtest/gtest.h>
+
+#include <babylon/core/array_buffer_view.h>
+#include <babylon/core/filesystem.h>
+#include <babylon/maths/spherical_polynomial.h>
+#include <babylon/misc/highdynamicrange/hdr_cube_texture_cache.h>
+
+TEST(TestHDRCubeTextureCache, ComputeKey)
+{
+  using namespace BABYLON;
+
+  const ArrayBuffer source{1, 2, 3, 4};
+  const auto key = HDRCubeTextureCache::ComputeKey(source, 128, false, true, true);
+
+  EXPECT_EQ(key.sourceHash,
+            HDRCubeTextureCache::ComputeKey(source, 128, false, true, true).sourceHash);
+  EXPECT_NE(key.sourceHash,
+            HDRCubeTextureCache::ComputeKey({1, 2, 3, 5}, 128, false, true, true).sourceHash);
+  EXPECT_NE(key.toFileName(),
+            HDRCubeTextureCache::ComputeKey(source, 256, false, true, true).toFileName());
+  EXPECT_NE(key.toFileName(),
+            HDRCubeTextureCache::ComputeKey(source, 128, true, true, true).toFileName());
+}
+
+TEST(TestHDRCubeTextureCache, SaveAndLoad)
+{
+  using namespace BABYLON;
+
+  const auto previousDirectory        = HDRCubeTextureCache::CacheDirectory;
+  HDRCubeTextureCache::CacheDirectory = Filesystem::joinPath(
+    Filesystem::getcwd(), std::string("hdr_cube_texture_cache_test"));
+
+  const auto key = HDRCubeTextureCache::ComputeKey({42, 43, 44}, 2, false, true, true);
+
+  std::vector<ArrayBufferView> faces;
+  for (unsigned int j = 0; j < 6; ++j) {
+    faces.emplace_back(Float32Array(2 * 2 * 3, static_cast<float>(j)));
+  }
+  auto polynomial = std::make_shared<SphericalPolynomial>();
+  polynomial->x   = Vector3(1.f, 2.f, 3.f);
+  polynomial->xy  = Vector3(4.f, 5.f, 6.f);
+
+  ASSERT_TRUE(HDRCubeTextureCache::Save(key, faces, polynomial));
+
+  std::vector<ArrayBufferView> loadedFaces;
+  SphericalPolynomialPtr loadedPolynomial = nullptr;
+  ASSERT_TRUE(HDRCubeTextureCache::Load(key, loadedFaces, loadedPolynomial));
+  ASSERT_EQ(loadedFaces.size(), 6ull);
+  for (unsigned int j = 0; j < 6; ++j) {
+    EXPECT_EQ(loadedFaces[j].uint8Array(), faces[j].uint8Array());
+  }
+  ASSERT_TRUE(loadedPolynomial != nullptr);
+  EXPECT_TRUE(loadedPolynomial->x.equals(polynomial->x));
+  EXPECT_TRUE(loadedPolynomial->xy.equals(polynomial->xy));
+
+  // A different source must not hit the entry
+  const auto otherKey = HDRCubeTextureCache::ComputeKey({42, 43, 45}, 2, false, true, true);
+  EXPECT_FALSE(HDRCubeTextureCache::Load(otherKey, loadedFaces, loadedPolynomial));
+
+  Filesystem::removeFile(
+    Filesystem::joinPath(HDRCubeTextureCache::CacheDirectory, key.toFileName()));
+  HDRCubeTextureCache::CacheDirectory = previousDirectory;
+}
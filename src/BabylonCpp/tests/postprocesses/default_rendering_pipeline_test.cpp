@@ -0,0 +1,62 @@
+#include <gtest/gtest.h>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/engine.h>
+#include <babylon/engines/render_target_pool.h>
+#include <babylon/engines/scene.h>
+#include <babylon/postprocesses/chromatic_aberration_post_process.h>
+#include <babylon/postprocesses/fxaa_post_process.h>
+#include <babylon/postprocesses/grain_post_process.h>
+#include <babylon/postprocesses/renderpipeline/pipelines/default_rendering_pipeline.h>
+#include <babylon/postprocesses/sharpen_post_process.h>
+
+TEST(TestDefaultRenderingPipeline, TransientTexturesReusePoolTextures)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->activeCamera = camera;
+
+  auto pipeline = DefaultRenderingPipeline::New("default", true, scene.get(),
+                                                std::unordered_map<std::string, CameraPtr>{
+                                                  {"camera", camera}});
+  pipeline->sharpenEnabled             = true;
+  pipeline->grainEnabled               = true;
+  pipeline->chromaticAberrationEnabled = true;
+  pipeline->fxaaEnabled                = true;
+  const std::vector<PostProcessPtr> postProcesses{pipeline->imageProcessing, pipeline->sharpen,
+                                                  pipeline->grain, pipeline->chromaticAberration,
+                                                  pipeline->fxaa};
+  for (const auto& postProcess : postProcesses) {
+    ASSERT_NE(postProcess, nullptr);
+    EXPECT_TRUE(postProcess->transientTextures);
+  }
+
+  auto& renderTargetPool = engine->getRenderTargetPool();
+  scene->render();
+  const auto textureCount = renderTargetPool.textureCount();
+  for (int frame = 0; frame < 3; ++frame) {
+    scene->render();
+  }
+
+  // The input textures are given back once read, and taken again by the following post processes
+  EXPECT_GT(textureCount, 0u);
+  EXPECT_LT(textureCount, postProcesses.size());
+  EXPECT_EQ(renderTargetPool.textureCount(), textureCount);
+  for (const auto& postProcess : postProcesses) {
+    EXPECT_TRUE(postProcess->_textures.empty());
+  }
+
+  // Outside of their rendering, the stages have no input texture to read or bind
+  for (const auto& postProcess : postProcesses) {
+    EXPECT_EQ(postProcess->inputTexture(), nullptr);
+    engine->setTextureFromPostProcess(0, postProcess);
+  }
+  engine->setTextureFromPostProcess(0, nullptr);
+
+  pipeline->dispose();
+}
@@ -0,0 +1,159 @@
+#include <gtest/gtest.h>
+
+#include <babylon/postprocesses/post_process_fusion.h>
+
+namespace {
+
+const char* BlackAndWhiteShader = R"(
+precision highp float;
+// Samplers
+varying vec2 vUV;
+uniform sampler2D textureSampler;
+uniform float degree;
+
+void main(void)
+{
+    vec3 color = texture2D(textureSampler, vUV).rgb;
+    float luminance = dot(color, vec3(0.3, 0.59, 0.11));
+    vec3 blackAndWhite = vec3(luminance, luminance, luminance);
+    gl_FragColor = vec4(color - ((color - blackAndWhite) * degree), 1.0);
+}
+)";
+
+// Grain shader, with its helper functions expanded
+const char* GrainShader = R"(
+precision highp float;
+#define PI 3.1415926535897932384626433832795
+float getLuminance(vec3 color)
+{
+    return clamp(dot(color, vec3(0.2126, 0.7152, 0.0722)), 0., 1.);
+}
+uniform sampler2D textureSampler;
+uniform float intensity;
+varying vec2 vUV;
+
+void main(void)
+{
+    gl_FragColor = texture2D(textureSampler, vUV);
+    float lum = getLuminance(gl_FragColor.rgb);
+    gl_FragColor.rgb += intensity * (cos(-PI + (lum * PI * 2.)) + 1.) / 2.;
+}
+)";
+
+// Shader reading the neighbours of the pixel
+const char* SharpenShader = R"(
+varying vec2 vUV;
+uniform sampler2D textureSampler;
+uniform vec2 screenSize;
+
+void main(void)
+{
+    vec2 onePixel = vec2(1.0, 1.0) / screenSize;
+    vec4 color = texture2D(textureSampler, vUV);
+    gl_FragColor = color * 5.0 - texture2D(textureSampler, vUV + onePixel * vec2(0, -1)) * 4.0;
+}
+)";
+
+// Shader declaring the same helper function as the grain shader
+const char* LuminanceShader = R"(
+#define PI 3.1415926535897932384626433832795
+float getLuminance(vec3 color)
+{
+    return clamp(dot(color, vec3(0.2126, 0.7152, 0.0722)), 0., 1.);
+}
+varying vec2 vUV;
+uniform sampler2D textureSampler;
+uniform float threshold;
+
+void main(void)
+{
+    vec4 color = texture2D( textureSampler , vUV );
+    gl_FragColor = vec4(color.rgb * step(threshold, getLuminance(color.rgb)), color.a);
+}
+)";
+
+size_t Count(const std::string& code, const std::string& pattern)
+{
+  size_t count = 0;
+  for (auto position = code.find(pattern); position != std::string::npos;
+       position      = code.find(pattern, position + pattern.size())) {
+    ++count;
+  }
+  return count;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPostProcessFusion, IsPerPixel)
+{
+  using namespace BABYLON;
+
+  EXPECT_TRUE(PostProcessFusion::IsPerPixel(BlackAndWhiteShader));
+  EXPECT_TRUE(PostProcessFusion::IsPerPixel(GrainShader));
+  EXPECT_TRUE(PostProcessFusion::IsPerPixel(LuminanceShader));
+  EXPECT_FALSE(PostProcessFusion::IsPerPixel(SharpenShader));
+}
+
+TEST(TestPostProcessFusion, FusePerPixelShaders)
+{
+  using namespace BABYLON;
+
+  const auto fused
+    = PostProcessFusion::FuseFragmentShaders({BlackAndWhiteShader, GrainShader, LuminanceShader});
+  ASSERT_FALSE(fused.empty());
+
+  // The input texture is only read by the first stage, the other ones reading the running color
+  EXPECT_EQ(Count(fused, "uniform sampler2D textureSampler;"), 1u);
+  EXPECT_EQ(Count(fused, "varying vec2 vUV;"), 1u);
+  EXPECT_EQ(Count(fused, "texture2D(textureSampler, vUV)"), 1u);
+  EXPECT_EQ(Count(fused, "fusedColor = fusedInput;"), 1u);
+  EXPECT_EQ(Count(fused, "vec4 color = fusedInput;"), 1u);
+  EXPECT_EQ(Count(fused, "gl_FragColor"), 1u);
+
+  // Uniforms keep their names, so that the post processes can set them on the fused effect
+  EXPECT_EQ(Count(fused, "uniform float degree;"), 1u);
+  EXPECT_EQ(Count(fused, "uniform float intensity;"), 1u);
+  EXPECT_EQ(Count(fused, "uniform float threshold;"), 1u);
+
+  // Functions are renamed per stage, macros are scoped to their stage, member accesses are left
+  // untouched
+  EXPECT_EQ(Count(fused, "float fusedStage1_getLuminance(vec3 color)"), 1u);
+  EXPECT_EQ(Count(fused, "float fusedStage2_getLuminance(vec3 color)"), 1u);
+  EXPECT_EQ(Count(fused, "#define PI"), 2u);
+  EXPECT_EQ(Count(fused, "#undef PI"), 2u);
+  EXPECT_EQ(Count(fused, "fusedStage1_getLuminance(fusedColor.rgb)"), 1u);
+  EXPECT_EQ(Count(fused, "precision"), 0u);
+
+  // The stages run in order
+  const auto first  = fused.find("    fusedStage0_main();");
+  const auto second = fused.find("    fusedInput = fusedColor;\n    fusedStage1_main();");
+  const auto third  = fused.find("    fusedInput = fusedColor;\n    fusedStage2_main();");
+  ASSERT_NE(first, std::string::npos);
+  ASSERT_NE(second, std::string::npos);
+  ASSERT_NE(third, std::string::npos);
+  EXPECT_LT(first, second);
+  EXPECT_LT(second, third);
+  EXPECT_NE(fused.find("    gl_FragColor = fusedColor;\n}", third), std::string::npos);
+}
+
+TEST(TestPostProcessFusion, KeepBarriers)
+{
+  using namespace BABYLON;
+
+  // A convolution can start a fused pass, as it still reads the input texture
+  EXPECT_FALSE(PostProcessFusion::FuseFragmentShaders({SharpenShader, GrainShader}).empty());
+  // but not follow another post process
+  EXPECT_TRUE(PostProcessFusion::FuseFragmentShaders({GrainShader, SharpenShader}).empty());
+
+  // Post processes setting the same uniform cannot share an effect
+  EXPECT_TRUE(PostProcessFusion::FuseFragmentShaders({GrainShader, GrainShader}).empty());
+
+  // Multiple render targets
+  const std::string multipleOutputs
+    = "varying vec2 vUV;\nuniform sampler2D textureSampler;\n"
+      "void main(void)\n{\n    gl_FragData[0] = texture2D(textureSampler, vUV);\n}\n";
+  EXPECT_TRUE(PostProcessFusion::FuseFragmentShaders({GrainShader, multipleOutputs}).empty());
+
+  // Single shader
+  EXPECT_TRUE(PostProcessFusion::FuseFragmentShaders({GrainShader}).empty());
+}
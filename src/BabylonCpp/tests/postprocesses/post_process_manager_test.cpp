@@ -0,0 +1,86 @@
+#include <gtest/gtest.h>
+
+#include <unordered_map>
+
+#include "../test_utils.h"
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/effect.h>
+#include <babylon/postprocesses/black_and_white_post_process.h>
+#include <babylon/postprocesses/image_processing_post_process.h>
+#include <babylon/postprocesses/pass_post_process.h>
+#include <babylon/postprocesses/post_process_manager.h>
+
+namespace {
+
+/**
+ * @brief Effect each post process was last rendered with.
+ */
+struct RenderedEffects {
+  void observe(const BABYLON::PostProcessPtr& postProcess)
+  {
+    postProcess->onBeforeRenderObservable.add(
+      [this, target = postProcess.get()](BABYLON::Effect* effect, BABYLON::EventState& /*es*/) {
+        effects[target] = effect;
+      });
+  }
+
+  std::unordered_map<BABYLON::PostProcess*, BABYLON::Effect*> effects;
+}; // end of struct RenderedEffects
+
+} // end of anonymous namespace
+
+TEST(TestPostProcessManager, FusedGroupAndFallback)
+{
+  using namespace BABYLON;
+
+  auto engine = createSubject();
+  auto scene  = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(0.f, 0.f, -10.f), scene.get());
+  scene->activeCamera = camera;
+  scene->postProcessManager->fusionEnabled = true;
+
+  // The pass post process is not fused, the two following ones are
+  auto pass            = PassPostProcess::New("pass", 1.f, camera);
+  auto blackAndWhite   = BlackAndWhitePostProcess::New("blackAndWhite", 1.f, camera);
+  auto imageProcessing = ImageProcessingPostProcess::New("imageProcessing", 1.f, camera);
+  imageProcessing->vignetteEnabled = true;
+  RenderedEffects rendered;
+  for (const auto& postProcess : {PostProcessPtr(pass), PostProcessPtr(blackAndWhite),
+                                  PostProcessPtr(imageProcessing)}) {
+    rendered.observe(postProcess);
+  }
+  size_t activateCount    = 0;
+  size_t sizeChangedCount = 0;
+  imageProcessing->onActivateObservable.add(
+    [&activateCount](Camera* /*camera*/, EventState& /*es*/) { ++activateCount; });
+  imageProcessing->onSizeChangedObservable.add(
+    [&sizeChangedCount](PostProcess* /*postProcess*/, EventState& /*es*/) { ++sizeChangedCount; });
+
+  // Groups whose fused effect is compiling fall back to one pass per post process
+  for (int frame = 0; frame < 4; ++frame) {
+    scene->render();
+  }
+  EXPECT_EQ(rendered.effects[pass.get()], pass->getEffect().get());
+  auto fusedEffect = rendered.effects[blackAndWhite.get()];
+  ASSERT_NE(fusedEffect, nullptr);
+  EXPECT_NE(fusedEffect, blackAndWhite->getEffect().get());
+  EXPECT_EQ(rendered.effects[imageProcessing.get()], fusedEffect);
+
+  // The fused stage gets the size of the pass, for its vignette aspect ratio
+  EXPECT_EQ(imageProcessing->width, blackAndWhite->width);
+  EXPECT_EQ(imageProcessing->height, blackAndWhite->height);
+  EXPECT_FLOAT_EQ(imageProcessing->aspectRatio(), blackAndWhite->aspectRatio());
+  EXPECT_EQ(activateCount, 4u);
+  EXPECT_EQ(sizeChangedCount, 1u);
+
+  // Without fusion, each post process is rendered with its own effect
+  imageProcessing->allowFusion = false;
+  activateCount                = 0;
+  scene->render();
+  EXPECT_EQ(rendered.effects[blackAndWhite.get()], blackAndWhite->getEffect().get());
+  EXPECT_EQ(rendered.effects[imageProcessing.get()], imageProcessing->getEffect().get());
+  EXPECT_EQ(activateCount, 1u);
+  EXPECT_EQ(sizeChangedCount, 1u);
+}
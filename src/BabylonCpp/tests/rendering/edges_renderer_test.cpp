@@ -0,0 +1,95 @@
+#include <gtest/gtest.h>
+
+#include <babylon/rendering/edges_renderer.h>
+
+namespace {
+
+/**
+ * @brief Creates a regular grid of quads on the XZ plane, each quad having its own four vertices
+ * when unwelded.
+ */
+void CreateGrid(unsigned int subdivisions, bool unwelded, BABYLON::Float32Array& positions,
+                BABYLON::IndicesArray& indices)
+{
+  const auto vertexIndex = [subdivisions](unsigned int row, unsigned int col) {
+    return row * (subdivisions + 1) + col;
+  };
+  if (!unwelded) {
+    for (unsigned int row = 0; row <= subdivisions; ++row) {
+      for (unsigned int col = 0; col <= subdivisions; ++col) {
+        positions.insert(positions.end(), {static_cast<float>(col), 0.f, static_cast<float>(row)});
+      }
+    }
+  }
+  for (unsigned int row = 0; row < subdivisions; ++row) {
+    for (unsigned int col = 0; col < subdivisions; ++col) {
+      std::array<uint32_t, 4> quad{{vertexIndex(row, col), vertexIndex(row, col + 1),
+                                    vertexIndex(row + 1, col + 1), vertexIndex(row + 1, col)}};
+      if (unwelded) {
+        const auto first = static_cast<uint32_t>(positions.size() / 3);
+        for (const auto [dx, dz] : {std::pair{0u, 0u}, {1u, 0u}, {1u, 1u}, {0u, 1u}}) {
+          positions.insert(positions.end(),
+                           {static_cast<float>(col + dx), 0.f, static_cast<float>(row + dz)});
+        }
+        quad = {{first, first + 1, first + 2, first + 3}};
+      }
+      indices.insert(indices.end(), {quad[0], quad[1], quad[2], quad[0], quad[2], quad[3]});
+    }
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestEdgesRenderer, ComputeFaceAdjacenciesFromIndices)
+{
+  using namespace BABYLON;
+
+  Float32Array positions;
+  IndicesArray indices;
+  CreateGrid(1, false, positions, indices);
+
+  const auto adjacencies = EdgesRenderer::ComputeFaceAdjacencies(positions, indices, false);
+  ASSERT_EQ(adjacencies.size(), 2u);
+  // The faces only share the diagonal, which is the p2p0 edge of the first face and the p0p1 edge
+  // of the second one
+  EXPECT_EQ(adjacencies[0], (std::array<int, 3>{{-1, -1, 1}}));
+  EXPECT_EQ(adjacencies[1], (std::array<int, 3>{{0, -1, -1}}));
+}
+
+TEST(TestEdgesRenderer, ComputeFaceAdjacenciesWeldsVertices)
+{
+  using namespace BABYLON;
+
+  constexpr unsigned int subdivisions = 8;
+  Float32Array positions;
+  IndicesArray indices;
+  CreateGrid(subdivisions, true, positions, indices);
+  // Move the vertices by less than the welding distance
+  for (size_t i = 0; i < positions.size(); i += 3) {
+    positions[i] += (i % 2 == 0 ? 0.4f : -0.4f) * Math::Epsilon;
+  }
+
+  // Without welding, only the diagonals of the quads are shared
+  const auto unwelded = EdgesRenderer::ComputeFaceAdjacencies(positions, indices, false);
+  for (size_t face = 0; face < unwelded.size(); ++face) {
+    EXPECT_EQ(unwelded[face][face % 2 == 0 ? 2 : 0], static_cast<int>(face ^ 1));
+  }
+
+  // With welding, only the edges on the border of the grid are not shared
+  const auto welded = EdgesRenderer::ComputeFaceAdjacencies(positions, indices, true);
+  size_t borderEdgeCount = 0;
+  for (size_t face = 0; face < welded.size(); ++face) {
+    for (size_t edge = 0; edge < 3; ++edge) {
+      const auto other = welded[face][edge];
+      if (other == -1) {
+        ++borderEdgeCount;
+        continue;
+      }
+      // Adjacencies are symmetric
+      const auto& otherAdjacencies = welded[static_cast<size_t>(other)];
+      EXPECT_NE(std::find(otherAdjacencies.begin(), otherAdjacencies.end(), face),
+                otherAdjacencies.end());
+    }
+  }
+  EXPECT_EQ(borderEdgeCount, 4u * subdivisions);
+}
@@ -0,0 +1,245 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/engine_capabilities.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/materials/material.h>
+#include <babylon/sprites/sprite.h>
+#include <babylon/sprites/sprite_manager.h>
+
+namespace {
+
+/**
+ * @brief Null engine recording the vertex buffer updates and the draw calls.
+ */
+class RecordingEngine : public BABYLON::NullEngine {
+
+public:
+  struct Update {
+    int byteOffset;
+    size_t floatCount;
+  }; // end of struct Update
+
+  struct Draw {
+    bool indexed;
+    unsigned int fillMode;
+    int count;
+    int instancesCount;
+  }; // end of struct Draw
+
+  static std::unique_ptr<RecordingEngine> New(bool instancedArrays)
+  {
+    BABYLON::NullEngineOptions options;
+    options.renderHeight          = 256;
+    options.renderWidth           = 256;
+    options.textureSize           = 256;
+    options.deterministicLockstep = false;
+    options.lockstepMaxSteps      = 1;
+    std::unique_ptr<RecordingEngine> engine(new RecordingEngine(options));
+    engine->getCaps().instancedArrays = instancedArrays;
+    return engine;
+  }
+
+  void updateDynamicVertexBuffer(const BABYLON::WebGLDataBufferPtr& vertexBuffer,
+                                 const BABYLON::Float32Array& data, int byteOffset = -1,
+                                 int byteLength = -1) override
+  {
+    updates.push_back({byteOffset, data.size()});
+    NullEngine::updateDynamicVertexBuffer(vertexBuffer, data, byteOffset, byteLength);
+  }
+
+  void drawElementsType(unsigned int fillMode, int indexStart, int indexCount,
+                        int instancesCount = 0) override
+  {
+    draws.push_back({true, fillMode, indexCount, instancesCount});
+    NullEngine::drawElementsType(fillMode, indexStart, indexCount, instancesCount);
+  }
+
+  void drawArraysType(unsigned int fillMode, int verticesStart, int verticesCount,
+                      int instancesCount = 0) override
+  {
+    draws.push_back({false, fillMode, verticesCount, instancesCount});
+    NullEngine::drawArraysType(fillMode, verticesStart, verticesCount, instancesCount);
+  }
+
+  void clearRecords()
+  {
+    updates.clear();
+    draws.clear();
+  }
+
+  std::vector<Update> updates;
+  std::vector<Draw> draws;
+
+protected:
+  explicit RecordingEngine(const BABYLON::NullEngineOptions& options) : NullEngine(options)
+  {
+  }
+
+}; // end of class RecordingEngine
+
+// Sprite manager of 64 x 64 cells, whose texture the null engine creates without loading it
+BABYLON::SpriteManagerPtr CreateSpriteManager(unsigned int capacity, BABYLON::Scene* scene)
+{
+  return BABYLON::SpriteManager::New("sprites", "sprites.png", capacity, BABYLON::ISize{64, 64},
+                                     scene);
+}
+
+std::vector<BABYLON::SpritePtr> CreateSprites(const BABYLON::SpriteManagerPtr& spriteManager,
+                                              size_t count)
+{
+  std::vector<BABYLON::SpritePtr> sprites;
+  for (size_t i = 0; i < count; ++i) {
+    auto sprite = BABYLON::Sprite::New("sprite" + std::to_string(i), spriteManager);
+    sprite->position.set(static_cast<float>(i % 100), static_cast<float>(i / 100), 0.f);
+    sprites.emplace_back(sprite);
+  }
+  return sprites;
+}
+
+// Floats of a sprite in the vertex buffer, 16 per instance or 18 per corner
+constexpr size_t InstancedSpriteSize = 16;
+constexpr size_t IndexedSpriteSize   = 18 * 4;
+
+} // end of anonymous namespace
+
+TEST(TestSpriteManager, OnlyChangedSpritesAreUploaded)
+{
+  using namespace BABYLON;
+
+  auto engine        = RecordingEngine::New(false);
+  auto scene         = Scene::New(engine.get());
+  auto spriteManager = CreateSpriteManager(10000, scene.get());
+  const auto sprites = CreateSprites(spriteManager, 10000);
+  const auto bytesOf = [](size_t sprite) {
+    return static_cast<int>(sprite * IndexedSpriteSize * sizeof(float));
+  };
+  const auto render = [&]() {
+    engine->clearRecords();
+    spriteManager->render();
+  };
+
+  // All the sprites are uploaded the first time, as a single range
+  render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, 0);
+  EXPECT_EQ(engine->updates[0].floatCount, 10000 * IndexedSpriteSize);
+
+  // Nothing changed
+  render();
+  EXPECT_TRUE(engine->updates.empty());
+  EXPECT_FALSE(engine->draws.empty());
+
+  // A single sprite
+  sprites[5000]->position.x += 1.f;
+  render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, bytesOf(5000));
+  EXPECT_EQ(engine->updates[0].floatCount, IndexedSpriteSize);
+
+  // Sprites of the same chunk, uploaded with the sprites between them
+  sprites[100]->color->r = 0.5f;
+  sprites[200]->angle    = 1.f;
+  render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, bytesOf(100));
+  EXPECT_EQ(engine->updates[0].floatCount, 101 * IndexedSpriteSize);
+
+  // Ranges of neighbouring chunks less than a chunk apart are merged
+  sprites[2040]->cellIndex = 1;
+  sprites[2050]->invertU   = true;
+  render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, bytesOf(2040));
+  EXPECT_EQ(engine->updates[0].floatCount, 11 * IndexedSpriteSize);
+
+  // Distant sprites are uploaded separately
+  sprites[10]->width    = 2;
+  sprites[9000]->height = 3;
+  render();
+  ASSERT_EQ(engine->updates.size(), 2ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, bytesOf(10));
+  EXPECT_EQ(engine->updates[0].floatCount, IndexedSpriteSize);
+  EXPECT_EQ(engine->updates[1].byteOffset, bytesOf(9000));
+  EXPECT_EQ(engine->updates[1].floatCount, IndexedSpriteSize);
+
+  // Hiding a sprite moves the following visible sprites in the buffer
+  sprites[9990]->isVisible = false;
+  render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, bytesOf(9990));
+  EXPECT_EQ(engine->updates[0].floatCount, 9 * IndexedSpriteSize);
+  ASSERT_FALSE(engine->draws.empty());
+  EXPECT_EQ(engine->draws.back().count, 9999 * 6);
+
+  spriteManager->dispose();
+}
+
+TEST(TestSpriteManager, IndexedLayout)
+{
+  using namespace BABYLON;
+
+  auto engine        = RecordingEngine::New(false);
+  auto scene         = Scene::New(engine.get());
+  auto spriteManager = CreateSpriteManager(100, scene.get());
+  const auto sprites = CreateSprites(spriteManager, 50);
+
+  spriteManager->render();
+
+  // 4 corners of 18 floats per sprite, drawn as indexed triangles in the alpha test and the alpha
+  // blended passes
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].floatCount, 50 * IndexedSpriteSize);
+  ASSERT_EQ(engine->draws.size(), 2ull);
+  for (const auto& draw : engine->draws) {
+    EXPECT_TRUE(draw.indexed);
+    EXPECT_EQ(draw.fillMode, Material::TriangleFillMode);
+    EXPECT_EQ(draw.count, 50 * 6);
+    EXPECT_EQ(draw.instancesCount, 0);
+  }
+
+  engine->clearRecords();
+  sprites[20]->position.y = 10.f;
+  spriteManager->render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset,
+            static_cast<int>(20 * IndexedSpriteSize * sizeof(float)));
+  EXPECT_EQ(engine->updates[0].floatCount, IndexedSpriteSize);
+
+  spriteManager->dispose();
+}
+
+TEST(TestSpriteManager, InstancedLayout)
+{
+  using namespace BABYLON;
+
+  auto engine        = RecordingEngine::New(true);
+  auto scene         = Scene::New(engine.get());
+  auto spriteManager = CreateSpriteManager(100, scene.get());
+  const auto sprites = CreateSprites(spriteManager, 50);
+
+  spriteManager->render();
+
+  // A record of 16 floats per sprite, drawn as a triangle fan over the 4 shared corner offsets
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset, 0);
+  EXPECT_EQ(engine->updates[0].floatCount, 50 * InstancedSpriteSize);
+  ASSERT_EQ(engine->draws.size(), 2ull);
+  for (const auto& draw : engine->draws) {
+    EXPECT_FALSE(draw.indexed);
+    EXPECT_EQ(draw.fillMode, Material::TriangleFanDrawMode);
+    EXPECT_EQ(draw.count, 4);
+    EXPECT_EQ(draw.instancesCount, 50);
+  }
+
+  engine->clearRecords();
+  sprites[20]->position.y = 10.f;
+  sprites[21]->color->a   = 0.5f;
+  spriteManager->render();
+  ASSERT_EQ(engine->updates.size(), 1ull);
+  EXPECT_EQ(engine->updates[0].byteOffset,
+            static_cast<int>(20 * InstancedSpriteSize * sizeof(float)));
+  EXPECT_EQ(engine->updates[0].floatCount, 2 * InstancedSpriteSize);
+
+  spriteManager->dispose();
+}
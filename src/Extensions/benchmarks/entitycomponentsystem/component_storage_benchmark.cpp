@@ -0,0 +1,105 @@
+#include <benchmark/benchmark.h>
+
+#include <babylon/extensions/entitycomponentsystem/system.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+namespace {
+
+using namespace BABYLON::Extensions::ECS;
+
+struct PositionComponent : Component {
+  float x = 0.f, y = 0.f, z = 0.f;
+};
+
+struct VelocityComponent : Component {
+  float x = 0.f, y = 0.f, z = 0.f;
+};
+
+struct MovementSystem : System<Requires<PositionComponent, VelocityComponent>> {
+};
+
+void CreateEntities(World& world, std::size_t entityCount)
+{
+  for (std::size_t i = 0; i < entityCount; ++i) {
+    auto entity = world.createEntity();
+    entity.addComponent<PositionComponent>();
+    auto& velocity = entity.addComponent<VelocityComponent>();
+    velocity.x     = static_cast<float>(i % 7);
+    velocity.y     = 1.f;
+    entity.activate();
+  }
+}
+
+void Move(VelocityComponent& velocity, PositionComponent& position)
+{
+  position.x += velocity.x;
+  position.y += velocity.y;
+  position.z += velocity.z;
+}
+
+void ECSCreateEntities(benchmark::State& state)
+{
+  const auto entityCount = static_cast<std::size_t>(state.range(0));
+  for (auto _ : state) {
+    World world;
+    MovementSystem movementSystem;
+    world.addSystem(movementSystem);
+    CreateEntities(world, entityCount);
+    world.refresh();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(ECSCreateEntities)->Arg(50000)->Unit(benchmark::kMillisecond);
+
+// Iterates the entities of a world holding position and velocity components
+template <typename Iteration>
+void ECSIterate(benchmark::State& state, const Iteration& iteration)
+{
+  World world;
+  MovementSystem movementSystem;
+  world.addSystem(movementSystem);
+  CreateEntities(world, static_cast<std::size_t>(state.range(0)));
+  world.refresh();
+  for (auto _ : state) {
+    iteration(world, movementSystem);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Entity list of the system, one component lookup per entity and component type
+void ECSSystemEntities(benchmark::State& state)
+{
+  ECSIterate(state, [](World& /*world*/, MovementSystem& movementSystem) {
+    for (const auto& entity : movementSystem.getEntities()) {
+      Move(entity.getComponent<VelocityComponent>(), entity.getComponent<PositionComponent>());
+    }
+  });
+}
+BENCHMARK(ECSSystemEntities)->Arg(50000)->Unit(benchmark::kMicrosecond);
+
+// Linear iteration of the velocities, the positions being looked up
+void ECSWorldForEach(benchmark::State& state)
+{
+  ECSIterate(state, [](World& world, MovementSystem& /*movementSystem*/) {
+    world.forEach<VelocityComponent, PositionComponent>(
+      [](Entity& /*entity*/, VelocityComponent& velocity, PositionComponent& position) {
+        Move(velocity, position);
+      });
+  });
+}
+BENCHMARK(ECSWorldForEach)->Arg(50000)->Unit(benchmark::kMicrosecond);
+
+// Same iteration split in chunks processed by the default thread pool
+void ECSWorldParallelForEach(benchmark::State& state)
+{
+  ECSIterate(state, [](World& world, MovementSystem& /*movementSystem*/) {
+    world.parallelForEach<VelocityComponent, PositionComponent>(
+      [](Entity& /*entity*/, VelocityComponent& velocity, PositionComponent& position) {
+        Move(velocity, position);
+      });
+  });
+}
+BENCHMARK(ECSWorldParallelForEach)->Arg(50000)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
@@ -0,0 +1,120 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/crowd_flow_field.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+using namespace BABYLON::Extensions::RVO2;
+
+// Simulation steps of a crowd whose agents cross a circle, each one heading to the antipodal point,
+// the iterations being limited to the first steps of the crossing
+void RVO2Step(benchmark::State& state, BABYLON::ThreadPool& threadPool)
+{
+  const auto agentCount = static_cast<std::size_t>(state.range(0));
+  RVOSimulator simulator(0.25f, 15.f, 10, 10.f, 10.f, 1.5f, 2.f);
+  simulator.setThreadPool(&threadPool);
+
+  const float radius = 0.5f * static_cast<float>(agentCount);
+  std::vector<Vector2> goals;
+  goals.reserve(agentCount);
+  for (std::size_t i = 0; i < agentCount; ++i) {
+    const float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(agentCount);
+    const Vector2 position(radius * std::cos(angle), radius * std::sin(angle));
+    simulator.addAgent(position);
+    goals.emplace_back(-position);
+  }
+
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < agentCount; ++i) {
+      const auto toGoal = goals[i] - simulator.getAgentPosition(i);
+      simulator.setAgentPrefVelocity(i, absSq(toGoal) > 1.f ? normalize(toGoal) : toGoal);
+    }
+    simulator.doStep();
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void RVO2StepSequential(benchmark::State& state)
+{
+  BABYLON::ThreadPool sequentialPool(0);
+  RVO2Step(state, sequentialPool);
+}
+BENCHMARK(RVO2StepSequential)
+  ->RangeMultiplier(4)
+  ->Range(1000, 64000)
+  ->Iterations(20)
+  ->Unit(benchmark::kMicrosecond);
+
+void RVO2StepParallel(benchmark::State& state)
+{
+  RVO2Step(state, BABYLON::ThreadPool::Default());
+}
+BENCHMARK(RVO2StepParallel)
+  ->RangeMultiplier(4)
+  ->Range(1000, 64000)
+  ->Iterations(20)
+  ->Unit(benchmark::kMicrosecond);
+
+// Maze of walls with an opening alternatively at the top and at the bottom
+void AddMazeObstacles(RVOSimulator& simulator)
+{
+  for (float x = -80.f; x <= 80.f; x += 40.f) {
+    const float y = (static_cast<int>(x) / 40) % 2 == 0 ? 20.f : -20.f;
+    simulator.addObstacle({Vector2(x + 2.f, y + 60.f), Vector2(x, y + 60.f), Vector2(x, y - 60.f),
+                           Vector2(x + 2.f, y - 60.f)});
+  }
+  simulator.processObstacles();
+}
+
+constexpr float FlowFieldSize = 200.f;
+
+void FlowFieldCompute(benchmark::State& state)
+{
+  RVOSimulator simulator;
+  AddMazeObstacles(simulator);
+  CrowdFlowField flowField(Vector2(-FlowFieldSize / 2, -FlowFieldSize / 2),
+                           Vector2(FlowFieldSize / 2, FlowFieldSize / 2), 1.f);
+  for (auto _ : state) {
+    flowField.compute(simulator, Vector2(95.f, 0.f), 0.5f);
+  }
+  state.SetItemsProcessed(state.iterations()
+                          * static_cast<int64_t>(flowField.width() * flowField.height()));
+}
+BENCHMARK(FlowFieldCompute)->Unit(benchmark::kMillisecond);
+
+// Direction of 64000 agents spread on the left side of the maze
+void FlowFieldSampling(benchmark::State& state)
+{
+  constexpr std::size_t agentCount = 64000;
+
+  RVOSimulator simulator;
+  AddMazeObstacles(simulator);
+  CrowdFlowField flowField(Vector2(-FlowFieldSize / 2, -FlowFieldSize / 2),
+                           Vector2(FlowFieldSize / 2, FlowFieldSize / 2), 1.f);
+  flowField.compute(simulator, Vector2(95.f, 0.f), 0.5f);
+
+  std::vector<Vector2> positions(agentCount);
+  for (std::size_t i = 0; i < agentCount; ++i) {
+    positions[i] = Vector2(-95.f + static_cast<float>(i % 20),
+                           -90.f + 180.f * static_cast<float>(i / 20) / (agentCount / 20));
+  }
+  std::size_t reachable = 0;
+  for (auto _ : state) {
+    reachable = 0;
+    Vector2 direction;
+    for (const auto& position : positions) {
+      reachable += flowField.getDirection(position, direction) ? 1 : 0;
+    }
+    benchmark::DoNotOptimize(reachable);
+  }
+  state.counters["reachable"] = static_cast<double>(reachable);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(agentCount));
+}
+BENCHMARK(FlowFieldSampling)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
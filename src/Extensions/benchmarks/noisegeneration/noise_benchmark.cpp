@@ -0,0 +1,173 @@
+#include <benchmark/benchmark.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+namespace {
+
+using namespace BABYLON;
+using namespace BABYLON::Extensions;
+
+// Noise of height maps and point sets: one scalar call per point, the batch functions on the
+// calling thread only and the batch functions with the default thread pool
+
+constexpr std::size_t GridSize   = 1024;
+constexpr std::size_t PointCount = 500000;
+
+void SetGridItemsProcessed(benchmark::State& state)
+{
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(GridSize * GridSize));
+}
+
+// 4 octaves Perlin noise
+constexpr int PerlinOctaves = 4;
+constexpr double PerlinStep = 1.0 / 64.0;
+
+void PerlinNoiseScalar(benchmark::State& state)
+{
+  PerlinNoiseOctave perlinNoise(PerlinOctaves, 42);
+  Float64Array values(GridSize * GridSize);
+  for (auto _ : state) {
+    for (std::size_t j = 0; j < GridSize; ++j) {
+      for (std::size_t i = 0; i < GridSize; ++i) {
+        values[j * GridSize + i] = perlinNoise.noise(static_cast<double>(i) * PerlinStep,
+                                                     static_cast<double>(j) * PerlinStep, 0.5);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  SetGridItemsProcessed(state);
+}
+BENCHMARK(PerlinNoiseScalar)->Unit(benchmark::kMillisecond);
+
+void PerlinNoiseGrid(benchmark::State& state, ThreadPool& threadPool)
+{
+  PerlinNoiseOctave perlinNoise(PerlinOctaves, 42);
+  Float64Array values;
+  for (auto _ : state) {
+    perlinNoise.noiseGrid(values, 0.0, 0.0, 0.5, PerlinStep, PerlinStep, GridSize, GridSize,
+                          threadPool);
+    benchmark::ClobberMemory();
+  }
+  SetGridItemsProcessed(state);
+}
+
+void PerlinNoiseGridSequential(benchmark::State& state)
+{
+  ThreadPool sequentialPool(0);
+  PerlinNoiseGrid(state, sequentialPool);
+}
+BENCHMARK(PerlinNoiseGridSequential)->Unit(benchmark::kMillisecond);
+
+void PerlinNoiseGridParallel(benchmark::State& state)
+{
+  PerlinNoiseGrid(state, ThreadPool::Default());
+}
+BENCHMARK(PerlinNoiseGridParallel)->Unit(benchmark::kMillisecond);
+
+// 6 octaves 2D simplex fBm
+constexpr uint8_t SimplexGridOctaves = 6;
+const Vector2 SimplexGridStep(1.f / 64.f, 1.f / 64.f);
+
+void SimplexFBmScalar(benchmark::State& state)
+{
+  SimplexNoise simplexNoise;
+  Float32Array values(GridSize * GridSize);
+  for (auto _ : state) {
+    for (std::size_t j = 0; j < GridSize; ++j) {
+      for (std::size_t i = 0; i < GridSize; ++i) {
+        const Vector2 point(static_cast<float>(i) * SimplexGridStep.x,
+                            static_cast<float>(j) * SimplexGridStep.y);
+        values[j * GridSize + i] = simplexNoise.fBm(point, SimplexGridOctaves);
+      }
+    }
+    benchmark::ClobberMemory();
+  }
+  SetGridItemsProcessed(state);
+}
+BENCHMARK(SimplexFBmScalar)->Unit(benchmark::kMillisecond);
+
+void SimplexFBmGrid(benchmark::State& state, ThreadPool& threadPool)
+{
+  SimplexNoise simplexNoise;
+  const Vector2 origin(0.f, 0.f);
+  Float32Array values;
+  for (auto _ : state) {
+    simplexNoise.fBmGrid(values, origin, SimplexGridStep, GridSize, GridSize, SimplexGridOctaves,
+                         2.f, 0.5f, threadPool);
+    benchmark::ClobberMemory();
+  }
+  SetGridItemsProcessed(state);
+}
+
+void SimplexFBmGridSequential(benchmark::State& state)
+{
+  ThreadPool sequentialPool(0);
+  SimplexFBmGrid(state, sequentialPool);
+}
+BENCHMARK(SimplexFBmGridSequential)->Unit(benchmark::kMillisecond);
+
+void SimplexFBmGridParallel(benchmark::State& state)
+{
+  SimplexFBmGrid(state, ThreadPool::Default());
+}
+BENCHMARK(SimplexFBmGridParallel)->Unit(benchmark::kMillisecond);
+
+// 4 octaves 3D simplex ridged multi-fractal
+constexpr uint8_t SimplexPointsOctaves = 4;
+
+std::vector<Vector3> CreatePoints()
+{
+  std::vector<Vector3> points;
+  points.reserve(PointCount);
+  for (std::size_t i = 0; i < PointCount; ++i) {
+    const auto t = static_cast<float>(i);
+    points.emplace_back(0.013f * t, 7.f - 0.007f * t, 0.0031f * t);
+  }
+  return points;
+}
+
+void SimplexRidgedMFScalar(benchmark::State& state)
+{
+  SimplexNoise simplexNoise;
+  const auto points = CreatePoints();
+  Float32Array values(PointCount);
+  for (auto _ : state) {
+    for (std::size_t i = 0; i < PointCount; ++i) {
+      values[i] = simplexNoise.ridgedMF(points[i], 1.f, SimplexPointsOctaves);
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(PointCount));
+}
+BENCHMARK(SimplexRidgedMFScalar)->Unit(benchmark::kMillisecond);
+
+void SimplexRidgedMFPoints(benchmark::State& state, ThreadPool& threadPool)
+{
+  SimplexNoise simplexNoise;
+  const auto points = CreatePoints();
+  Float32Array values;
+  for (auto _ : state) {
+    simplexNoise.ridgedMF(points, values, 1.f, SimplexPointsOctaves, 2.f, 0.5f, threadPool);
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(PointCount));
+}
+
+void SimplexRidgedMFPointsSequential(benchmark::State& state)
+{
+  ThreadPool sequentialPool(0);
+  SimplexRidgedMFPoints(state, sequentialPool);
+}
+BENCHMARK(SimplexRidgedMFPointsSequential)->Unit(benchmark::kMillisecond);
+
+void SimplexRidgedMFPointsParallel(benchmark::State& state)
+{
+  SimplexRidgedMFPoints(state, ThreadPool::Default());
+}
+BENCHMARK(SimplexRidgedMFPointsParallel)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
@@ -0,0 +1,203 @@
+#include <benchmark/benchmark.h>
+
+#include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/pathfinding/jump_point_search.h>
+#include <babylon/extensions/pathfinding/rectangular_maze.h>
+
+namespace {
+
+using namespace BABYLON::Extensions;
+
+using L = RectangularMaze::Location;
+
+// Random number in [0, count)
+std::size_t Random(BABYLON::Math::PCG& pcg, std::size_t count)
+{
+  return BABYLON::Math::distribution(pcg, std::size_t(0), count - 1);
+}
+
+// Reference A*, allocating a node map and a priority queue per query
+std::vector<std::size_t> AStarSearchReference(const RectangularMaze& maze, const Cell& start,
+                                              const Cell& goal)
+{
+  std::vector<std::size_t> path;
+  PriorityQueue<std::size_t, double> frontier;
+  frontier.put(start.id, 0);
+
+  std::unordered_map<std::size_t, AStarNode<std::size_t>> aStarNodes(maze.size());
+  aStarNodes[start.id]
+    = AStarNode<std::size_t>{start.id, 0.0, maze.heuristicCostEstimate(start, goal), true};
+
+  while (!frontier.empty()) {
+    auto current = frontier.get();
+    if (current == goal.id) {
+      while (aStarNodes[current].cameFrom != start.id) {
+        path.emplace_back(current);
+        current = aStarNodes[current].cameFrom;
+      }
+      path.emplace_back(current);
+      path.emplace_back(start.id);
+      break;
+    }
+
+    for (auto&& next : maze.neighbors(current)) {
+      const auto tentative_gScore = aStarNodes[current].gScore + maze.cost(current, next);
+      if (!aStarNodes.count(next.id)) {
+        aStarNodes[next.id] = AStarNode<std::size_t>{0, 0.0, 0.0, false};
+      }
+      auto& neighbor = aStarNodes[next.id];
+      if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
+        neighbor.visited  = true;
+        neighbor.cameFrom = current;
+        neighbor.gScore   = tentative_gScore;
+        neighbor.fScore   = tentative_gScore + maze.heuristicCostEstimate(next, goal);
+        frontier.put(next.id, neighbor.fScore);
+      }
+    }
+  }
+  return path;
+}
+
+/**
+ * @brief 200 x 200 maze with 300 random path queries.
+ */
+struct MazeQueries {
+  static constexpr std::size_t Size       = 200;
+  static constexpr std::size_t QueryCount = 300;
+
+  MazeQueries() : maze(Size, Size)
+  {
+    BABYLON::Math::PCG pcg;
+    maze.generateMaze();
+    maze.initCells();
+    for (std::size_t i = 0; i < QueryCount; ++i) {
+      queries.emplace_back(L{Random(pcg, Size), Random(pcg, Size)},
+                           L{Random(pcg, Size), Random(pcg, Size)});
+    }
+  }
+
+  RectangularMaze maze;
+  std::vector<std::pair<L, L>> queries;
+}; // end of struct MazeQueries
+
+// Maze queries, the length of the found paths being reported as the "cells" counter
+template <typename Query>
+void MazePathFinding(benchmark::State& state, const Query& query)
+{
+  MazeQueries mazeQueries;
+  std::size_t length = 0;
+  for (auto _ : state) {
+    length = query(mazeQueries);
+    benchmark::DoNotOptimize(length);
+  }
+  state.counters["cells"] = static_cast<double>(length);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(MazeQueries::QueryCount));
+}
+
+// A* with a node map per query
+void MazeAStarReference(benchmark::State& state)
+{
+  MazePathFinding(state, [](MazeQueries& mazeQueries) {
+    auto& maze         = mazeQueries.maze;
+    std::size_t length = 0;
+    for (const auto& [start, goal] : mazeQueries.queries) {
+      length += AStarSearchReference(maze, maze.cell(maze.cellId(start)),
+                                     maze.cell(maze.cellId(goal)))
+                  .size();
+    }
+    return length;
+  });
+}
+BENCHMARK(MazeAStarReference)->Unit(benchmark::kMillisecond);
+
+// A* with a search context
+void MazeAStar(benchmark::State& state)
+{
+  MazePathFinding(state, [](MazeQueries& mazeQueries) {
+    auto& maze         = mazeQueries.maze;
+    std::size_t length = 0;
+    for (const auto& [start, goal] : mazeQueries.queries) {
+      length
+        += AStarSearch(maze, maze.cell(maze.cellId(start)), maze.cell(maze.cellId(goal))).size();
+    }
+    return length;
+  });
+}
+BENCHMARK(MazeAStar)->Unit(benchmark::kMillisecond);
+
+// Batched queries, processed by the default thread pool
+void MazeFindPaths(benchmark::State& state)
+{
+  MazePathFinding(state, [](MazeQueries& mazeQueries) {
+    std::size_t length = 0;
+    for (const auto& path : mazeQueries.maze.findPaths(mazeQueries.queries)) {
+      length += path.size();
+    }
+    return length;
+  });
+}
+BENCHMARK(MazeFindPaths)->Unit(benchmark::kMillisecond);
+
+/**
+ * @brief 512 x 512 grid with 25% of blocked cells and 200 random path queries between walkable
+ * cells.
+ */
+struct GridQueries {
+  static constexpr std::size_t Size       = 512;
+  static constexpr std::size_t QueryCount = 200;
+
+  GridQueries() : grid(Size, Size)
+  {
+    BABYLON::Math::PCG pcg;
+    for (std::size_t y = 0; y < Size; ++y) {
+      for (std::size_t x = 0; x < Size; ++x) {
+        grid.setWalkable(x, y, Random(pcg, 4) != 0);
+      }
+    }
+    while (queries.size() < QueryCount) {
+      const auto start = Random(pcg, grid.size());
+      const auto goal  = Random(pcg, grid.size());
+      if (grid._walkable[start] && grid._walkable[goal]) {
+        queries.emplace_back(start, goal);
+      }
+    }
+  }
+
+  GridMap grid;
+  std::vector<std::pair<std::size_t, std::size_t>> queries;
+}; // end of struct GridQueries
+
+template <typename Query>
+void GridPathFinding(benchmark::State& state, const Query& query)
+{
+  GridQueries gridQueries;
+  std::size_t length = 0;
+  for (auto _ : state) {
+    length = 0;
+    for (const auto& [start, goal] : gridQueries.queries) {
+      length += query(gridQueries.grid, start, goal);
+    }
+    benchmark::DoNotOptimize(length);
+  }
+  state.counters["cells"] = static_cast<double>(length);
+  state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(GridQueries::QueryCount));
+}
+
+void GridAStar(benchmark::State& state)
+{
+  GridPathFinding(state, [](GridMap& grid, std::size_t start, std::size_t goal) {
+    return AStarSearch(grid, grid(start), grid(goal)).size();
+  });
+}
+BENCHMARK(GridAStar)->Unit(benchmark::kMillisecond);
+
+void GridJumpPointSearch(benchmark::State& state)
+{
+  GridPathFinding(state, [](GridMap& grid, std::size_t start, std::size_t goal) {
+    return JumpPointSearch(grid, start, goal).size();
+  });
+}
+BENCHMARK(GridJumpPointSearch)->Unit(benchmark::kMillisecond);
+
+} // end of anonymous namespace
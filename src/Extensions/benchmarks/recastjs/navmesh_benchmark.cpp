@@ -0,0 +1,152 @@
+#include <benchmark/benchmark.h>
+
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/recastjs/recastjs.h>
+
+#include "Recast.h"
+
+namespace {
+
+using BABYLON::Extensions::Vec3;
+
+// NavMesh alone is ambiguous with the global forward declaration of recastjs.h
+using RecastNavMesh = BABYLON::Extensions::NavMesh;
+
+/**
+ * @brief Hilly terrain of 250 x 250 quads and the configuration of its navigation mesh.
+ */
+struct Terrain {
+  static constexpr int Size = 250;
+
+  Terrain()
+  {
+    for (int z = 0; z <= Size; ++z) {
+      for (int x = 0; x <= Size; ++x) {
+        const auto fx = static_cast<float>(x);
+        const auto fz = static_cast<float>(z);
+        positions.insert(positions.end(),
+                         {fx, 2.f * std::sin(fx * 0.1f) * std::cos(fz * 0.07f), fz});
+      }
+    }
+    for (int z = 0; z < Size; ++z) {
+      for (int x = 0; x < Size; ++x) {
+        const int i = z * (Size + 1) + x;
+        indices.insert(indices.end(),
+                       {i + 1, i + Size + 1, i, i + Size + 2, i + Size + 1, i + 1});
+      }
+    }
+
+    config.cs                     = 0.3f;
+    config.ch                     = 0.2f;
+    config.tileSize               = 64;
+    config.walkableSlopeAngle     = 35.f;
+    config.walkableHeight         = 1;
+    config.walkableClimb          = 1;
+    config.walkableRadius         = 1;
+    config.maxEdgeLen             = 12;
+    config.maxSimplificationError = 1.3f;
+    config.minRegionArea          = 8;
+    config.mergeRegionArea        = 20;
+    config.maxVertsPerPoly        = 6;
+    config.detailSampleDist       = 6.f;
+    config.detailSampleMaxError   = 1.f;
+  }
+
+  int positionCount() const
+  {
+    return static_cast<int>(positions.size() / 3);
+  }
+
+  int indexCount() const
+  {
+    return static_cast<int>(indices.size());
+  }
+
+  std::vector<float> positions;
+  std::vector<int> indices;
+  rcConfig config{};
+}; // end of struct Terrain
+
+void SetTrianglesProcessed(benchmark::State& state, const Terrain& terrain)
+{
+  state.SetItemsProcessed(state.iterations() * terrain.indexCount() / 3);
+}
+
+void NavMeshBuild(benchmark::State& state)
+{
+  Terrain terrain;
+  RecastNavMesh navMesh;
+  for (auto _ : state) {
+    navMesh.build(terrain.positions.data(), terrain.positionCount(), terrain.indices.data(),
+                  terrain.indexCount(), terrain.config);
+  }
+  SetTrianglesProcessed(state, terrain);
+  navMesh.destroy();
+}
+BENCHMARK(NavMeshBuild)->Unit(benchmark::kMillisecond);
+
+void NavMeshBuildTiled(benchmark::State& state, BABYLON::ThreadPool& threadPool)
+{
+  Terrain terrain;
+  RecastNavMesh navMesh;
+  for (auto _ : state) {
+    navMesh.buildTiled(terrain.positions.data(), terrain.positionCount(), terrain.indices.data(),
+                       terrain.indexCount(), terrain.config, threadPool);
+  }
+  SetTrianglesProcessed(state, terrain);
+  navMesh.destroy();
+}
+
+void NavMeshBuildTiledSequential(benchmark::State& state)
+{
+  BABYLON::ThreadPool sequentialPool(0);
+  NavMeshBuildTiled(state, sequentialPool);
+}
+BENCHMARK(NavMeshBuildTiledSequential)->Unit(benchmark::kMillisecond);
+
+void NavMeshBuildTiledParallel(benchmark::State& state)
+{
+  NavMeshBuildTiled(state, BABYLON::ThreadPool::Default());
+}
+BENCHMARK(NavMeshBuildTiledParallel)->Unit(benchmark::kMillisecond);
+
+// Load of the serialized tiles, whose size is reported as the "bytes" counter
+void NavMeshLoad(benchmark::State& state)
+{
+  Terrain terrain;
+  RecastNavMesh navMesh;
+  navMesh.buildTiled(terrain.positions.data(), terrain.positionCount(), terrain.indices.data(),
+                     terrain.indexCount(), terrain.config, BABYLON::ThreadPool::Default());
+  const auto data = navMesh.getNavmeshData();
+  RecastNavMesh loadedNavMesh;
+  for (auto _ : state) {
+    loadedNavMesh.buildFromNavmeshData(data);
+  }
+  state.counters["bytes"] = static_cast<double>(data.size());
+  navMesh.destroy();
+  loadedNavMesh.destroy();
+}
+BENCHMARK(NavMeshLoad)->Unit(benchmark::kMillisecond);
+
+// Update of the tiles touched by an obstacle, added and removed in turn
+void NavMeshObstacleUpdate(benchmark::State& state)
+{
+  Terrain terrain;
+  RecastNavMesh navMesh;
+  navMesh.buildTiled(terrain.positions.data(), terrain.positionCount(), terrain.indices.data(),
+                     terrain.indexCount(), terrain.config, BABYLON::ThreadPool::Default());
+  for (auto _ : state) {
+    auto obstacle = navMesh.addCylinderObstacle(Vec3(125.f, -3.f, 125.f), 2.f, 6.f);
+    navMesh.update();
+    state.PauseTiming();
+    navMesh.removeObstacle(obstacle);
+    navMesh.update();
+    state.ResumeTiming();
+  }
+  navMesh.destroy();
+}
+BENCHMARK(NavMeshObstacleUpdate)->Unit(benchmark::kMicrosecond);
+
+} // end of anonymous namespace
@@ -4,6 +4,7 @@
 #include <functional>
 
 #include <babylon/babylon_api.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_lod.h>
 #include <babylon/maths/color3.h>
 #include <babylon/maths/color4.h>
 #include <babylon/maths/vector2.h>
@@ -418,6 +419,12 @@ public:
   [[nodiscard]] bool precomputeNormalsFromMap() const;
   void setPrecomputeNormalsFromMap(bool val);
 
+  /**
+   * @brief Number of vertices rebuilt from the maps by the last terrain update, the vertices still
+   * sampling the same map cells after the terrain moved being copied.
+   */
+  [[nodiscard]] size_t rebuiltVertexCount() const;
+
   // User custom functions.
   // These following can be overwritten bu the user to fit his needs.
 
@@ -428,7 +435,7 @@ public:
    * - i : the vertex index on the terrain x axis
    * - j : the vertex index on the terrain x axis
    * This function is called only if the property useCustomVertexFunction is set
-   * to true.
+   * to true, on the calling thread, and then all the vertices are rebuilt on each update.
    */
   virtual void updateVertex(DynamicTerrainVertex& vertex, unsigned int i, unsigned j);
 
@@ -460,6 +467,18 @@ private:
    */
   void _updateTerrain();
 
+  /**
+   * @brief Rebuilds the ribbon vertex (i, j) from the maps.
+   */
+  void _buildVertex(unsigned int i, unsigned int j, DynamicTerrainVertex& vertex);
+
+  /**
+   * @brief Copies the height, normal, color and uv of the ribbon vertex sampling the same map cell
+   * before the terrain moved into the ribbon vertex (i, j), whose local x and z are those of its
+   * own LOD steps.
+   */
+  void _copyVertex(unsigned int i, unsigned int j, size_t sourceInd);
+
   template <typename T>
   T _mod(T a, T b)
   {
@@ -470,6 +489,8 @@ public:
   std::string name;
 
 private:
+  // number of ribbon rows updated by each task of the thread pool
+  static constexpr size_t TERRAIN_CHUNK_ROWS = 16;
   // terrain number of subdivisions per axis
   unsigned int _terrainSub;
   // data of the map
@@ -549,6 +570,19 @@ private:
   bool _colormap;
   // current vertex object passed to the user custom function
   DynamicTerrainVertex _vertex;
+  // LOD of the ribbon vertices along the x and z axes at the last update
+  DynamicTerrainAxisLOD _lodX;
+  DynamicTerrainAxisLOD _lodZ;
+  // map cells flought over since the last ribbon update on the x and z axes
+  int64_t _subShiftX;
+  int64_t _subShiftZ;
+  // vertex data of the ribbon before the last update
+  Float32Array _previousPositions;
+  Float32Array _previousNormals;
+  Float32Array _previousColors;
+  Float32Array _previousUVs;
+  // number of vertices rebuilt by the last update
+  size_t _rebuiltVertexCount;
   // map cell average x size
   float _averageSubSizeX;
   // map cell average z size
@@ -0,0 +1,49 @@
+#ifndef BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_DYNAMIC_TERRAIN_LOD_H
+#define BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_DYNAMIC_TERRAIN_LOD_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+/**
+ * @brief LOD of the terrain vertices along one axis: the LOD factor of each vertex and its offset,
+ * in map cells, from the first vertex.
+ *
+ * The LOD limits define rings of increasing LOD towards the terrain borders. The vertices of a
+ * row (or column) all share the same offset, so the terrain stays a single crack-free ribbon
+ * whatever the LOD of its rings.
+ */
+struct BABYLON_SHARED_EXPORT DynamicTerrainAxisLOD {
+  // LOD factor of each vertex
+  Uint32Array lods;
+  // offset of each vertex in map cells from the first vertex
+  Uint32Array steps;
+
+  /**
+   * @brief Computes the LOD factors and offsets of the terrainSub + 1 vertices of an axis.
+   * @param terrainSub the terrain number of subdivisions
+   * @param LODValue the LOD factor of the terrain center
+   * @param LODLimits the LOD limits, sorted in the descending order
+   */
+  void compute(unsigned int terrainSub, unsigned int LODValue, const Uint32Array& LODLimits);
+
+  /**
+   * @brief Computes, for each vertex, the index of the vertex which sampled the same map cell
+   * before the terrain moved by shift map cells along the axis, -1 if there is none.
+   */
+  void computeSources(int64_t shift, std::vector<int64_t>& sources) const;
+
+  bool operator==(const DynamicTerrainAxisLOD& other) const;
+  bool operator!=(const DynamicTerrainAxisLOD& other) const;
+
+}; // end of struct DynamicTerrainAxisLOD
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_DYNAMIC_TERRAIN_DYNAMIC_TERRAIN_LOD_H
@@ -67,6 +67,50 @@ public:
   /// \return All the entities that are within the System
   [[nodiscard]] const std::vector<Entity>& getEntities() const;
 
+  /// Updates the system, called by World::update()
+  virtual void update()
+  {
+  }
+
+  /// \return The component types read by the system
+  [[nodiscard]] const ComponentTypeList& getReadComponents() const;
+
+  /// \return The component types written by the system
+  [[nodiscard]] const ComponentTypeList& getWriteComponents() const;
+
+  /// \return true if the system must not run concurrently with any other
+  /// system, which is the case until the system declares the components it
+  /// accesses
+  [[nodiscard]] bool isExclusive() const;
+
+  /// Determines if two systems can not be updated concurrently: one of them is
+  /// exclusive or writes components accessed by the other one
+  /// \param other The other system
+  /// \return true if the systems must be updated one after the other
+  [[nodiscard]] bool conflictsWith(const BaseSystem& other) const;
+
+protected:
+  /// Declares components read by the system during update()
+  template <class... Ts>
+  void reads()
+  {
+    m_reads |= types(TypeList<Ts...>{});
+    m_exclusive = false;
+  }
+
+  /// Declares components written by the system during update()
+  template <class... Ts>
+  void writes()
+  {
+    m_writes |= types(TypeList<Ts...>{});
+    m_exclusive = false;
+  }
+
+  /// Sets whether or not the system must run alone, for instance because it
+  /// accesses data shared with other systems outside of the components
+  /// \param exclusive true to never update the system concurrently
+  void setExclusive(bool exclusive);
+
 private:
   /// Initializes the system, when a world is successfully attached to it.
   virtual void initialize()
@@ -109,6 +153,13 @@ private:
   /// The Entities that are attached to this system
   std::vector<Entity> m_entities;
 
+  /// The components read and written by the system
+  ComponentTypeList m_reads;
+  ComponentTypeList m_writes;
+
+  /// Whether the system must be updated alone
+  bool m_exclusive;
+
   friend World;
 
 }; // end of class BaseSystem
@@ -0,0 +1,231 @@
+#ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
+#define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
+
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+#include <babylon/extensions/entitycomponentsystem/component.h>
+
+namespace BABYLON {
+namespace Extensions {
+namespace ECS {
+namespace detail {
+
+/// \brief Type erased interface of the storage of one component type
+///
+/// The storage is a sparse set: the components are packed in a dense array,
+/// the dense index of the component of an entity being found through a sparse
+/// array indexed by the index of the entity ID.
+class BABYLON_SHARED_EXPORT BaseComponentPool {
+
+public:
+  /// Value of the sparse array for entities without component
+  static constexpr std::size_t INVALID_INDEX = std::numeric_limits<std::size_t>::max();
+
+  BaseComponentPool()          = default;
+  virtual ~BaseComponentPool() = default;
+
+  BaseComponentPool(const BaseComponentPool&) = delete;
+  BaseComponentPool& operator=(const BaseComponentPool&) = delete;
+
+  /// \param entityIndex The index of the entity ID
+  /// \return true if the entity has a component in this pool
+  [[nodiscard]] bool has(std::size_t entityIndex) const
+  {
+    return entityIndex < m_sparse.size() && m_sparse[entityIndex] != INVALID_INDEX;
+  }
+
+  /// \return The amount of components stored in the pool
+  [[nodiscard]] std::size_t size() const
+  {
+    return m_entityIndices.size();
+  }
+
+  /// \return The entity index of each component, in storage order
+  [[nodiscard]] const std::vector<std::size_t>& getEntityIndices() const
+  {
+    return m_entityIndices;
+  }
+
+  /// \param entityIndex The index of the entity ID
+  /// \return The component of the entity, nullptr if the entity has none
+  virtual Component* get(std::size_t entityIndex) = 0;
+
+  /// Destroys the component of an entity, the last component of the pool
+  /// being moved in its place
+  /// \param entityIndex The index of the entity ID
+  virtual void remove(std::size_t entityIndex) = 0;
+
+  /// Destroys all the components
+  virtual void clear() = 0;
+
+protected:
+  /// The dense index of the component of each entity, indexed by entity index
+  std::vector<std::size_t> m_sparse;
+
+  /// The entity index of each component, indexed by dense index
+  std::vector<std::size_t> m_entityIndices;
+
+}; // end of class BaseComponentPool
+
+/// Function creating the pool of a component type
+using ComponentPoolFactory = std::unique_ptr<BaseComponentPool> (*)();
+
+/// \brief Contiguous storage of the components of type T
+///
+/// The components are constructed in place in fixed size chunks, so that
+/// adding components never moves the existing ones, while iterating over the
+/// pool is linear in memory.
+///
+/// \note Removing a component moves the last component of the pool in its
+/// place, which invalidates references to that last component.
+template <class T>
+class ComponentPool : public BaseComponentPool {
+
+public:
+  /// Number of components per chunk, about 16 KB of components
+  static constexpr std::size_t CHUNK_SIZE = std::max<std::size_t>(16384 / sizeof(T), 1);
+
+  ComponentPool() = default;
+  ~ComponentPool() override
+  {
+    clear();
+  }
+
+  /// \return A new empty pool of components of type T
+  static std::unique_ptr<BaseComponentPool> Create()
+  {
+    return std::make_unique<ComponentPool<T>>();
+  }
+
+  /// Constructs the component of an entity, replacing its current component
+  /// \param entityIndex The index of the entity ID
+  /// \param args The arguments for the constructor of the component
+  /// \return The new component
+  template <class... Args>
+  T& emplace(std::size_t entityIndex, Args&&... args)
+  {
+    if (has(entityIndex)) {
+      T component{std::forward<Args>(args)...};
+      auto* current = &at(m_sparse[entityIndex]);
+      current->~T();
+      return *new (current) T(std::move(component));
+    }
+
+    const auto denseIndex = m_entityIndices.size();
+    if (denseIndex == m_chunks.size() * CHUNK_SIZE) {
+      m_chunks.emplace_back(std::unique_ptr<Chunk>(new Chunk));
+    }
+    auto* component = new (slot(denseIndex)) T{std::forward<Args>(args)...};
+
+    if (entityIndex >= m_sparse.size()) {
+      m_sparse.resize(entityIndex + 1, INVALID_INDEX);
+    }
+    m_sparse[entityIndex] = denseIndex;
+    m_entityIndices.emplace_back(entityIndex);
+    return *component;
+  }
+
+  /// \param denseIndex The index of the component in the pool
+  /// \return The component stored at this index
+  T& at(std::size_t denseIndex)
+  {
+    return *std::launder(reinterpret_cast<T*>(slot(denseIndex)));
+  }
+
+  /// \param entityIndex The index of the entity ID
+  /// \return The component of the entity, nullptr if the entity has none
+  T* find(std::size_t entityIndex)
+  {
+    return has(entityIndex) ? &at(m_sparse[entityIndex]) : nullptr;
+  }
+
+  Component* get(std::size_t entityIndex) override
+  {
+    return find(entityIndex);
+  }
+
+  void remove(std::size_t entityIndex) override
+  {
+    if (!has(entityIndex)) {
+      return;
+    }
+
+    const auto denseIndex = m_sparse[entityIndex];
+    const auto lastIndex  = m_entityIndices.size() - 1;
+    if (denseIndex != lastIndex) {
+      auto& last = at(lastIndex);
+      at(denseIndex).~T();
+      new (slot(denseIndex)) T(std::move(last));
+      m_entityIndices[denseIndex]           = m_entityIndices[lastIndex];
+      m_sparse[m_entityIndices[denseIndex]] = denseIndex;
+    }
+    at(lastIndex).~T();
+    m_entityIndices.pop_back();
+    m_sparse[entityIndex] = INVALID_INDEX;
+
+    // Keep one spare chunk to avoid reallocations when adding and removing
+    // components around a chunk boundary
+    if (m_chunks.size() > (m_entityIndices.size() + 2 * CHUNK_SIZE - 1) / CHUNK_SIZE) {
+      m_chunks.pop_back();
+    }
+  }
+
+  void clear() override
+  {
+    for (std::size_t i = 0; i < m_entityIndices.size(); ++i) {
+      at(i).~T();
+    }
+    m_entityIndices.clear();
+    m_sparse.clear();
+    m_chunks.clear();
+  }
+
+  /// Calls function(entityIndex, component) for the [begin, end) components
+  /// of the pool, chunk by chunk
+  /// \param begin The dense index of the first component
+  /// \param end The dense index after the last component
+  /// \param function The function to call
+  template <class Function>
+  void forEach(std::size_t begin, std::size_t end, Function&& function)
+  {
+    end = std::min(end, m_entityIndices.size());
+    while (begin < end) {
+      auto* components     = std::launder(reinterpret_cast<T*>(slot(begin)));
+      const auto chunkEnd  = std::min(end, (begin / CHUNK_SIZE + 1) * CHUNK_SIZE);
+      const auto* entities = m_entityIndices.data();
+      for (auto i = begin; i < chunkEnd; ++i, ++components) {
+        function(entities[i], *components);
+      }
+      begin = chunkEnd;
+    }
+  }
+
+private:
+  struct Chunk {
+    std::aligned_storage_t<sizeof(T), alignof(T)> components[CHUNK_SIZE];
+  };
+
+  void* slot(std::size_t denseIndex)
+  {
+    return &m_chunks[denseIndex / CHUNK_SIZE]->components[denseIndex % CHUNK_SIZE];
+  }
+
+  /// The chunks holding the components, in storage order
+  std::vector<std::unique_ptr<Chunk>> m_chunks;
+
+}; // end of class ComponentPool
+
+} // end of namespace detail
+} // end of namespace ECS
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_COMPONENT_POOL_H
@@ -29,12 +29,13 @@
 #ifndef BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ENTITY_COMPONENT_STORAGE_H
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_DETAIL_ENTITY_COMPONENT_STORAGE_H
 
-#include <array>
 #include <memory>
+#include <vector>
 
 #include <babylon/babylon_api.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_pool.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -49,7 +50,8 @@ namespace detail {
 /// \brief A class to store components for entities within a world
 ///
 ///
-/// Used to store the components
+/// Used to store the components. Each component type is stored in its own
+/// pool, in which the components are packed contiguously.
 ///
 ///
 /// \author Miguel Martin
@@ -63,7 +65,25 @@ public:
   EntityComponentStorage& operator=(const EntityComponentStorage&) = delete;
   EntityComponentStorage& operator=(EntityComponentStorage&&) = delete;
 
-  void addComponent(Entity& entity, Component* component, TypeId componentTypeId);
+  /// Returns the pool of a component type, creating it if needed
+  /// \param componentTypeId The type of the components stored in the pool
+  /// \param factory The function creating the pool
+  BaseComponentPool& getComponentPool(TypeId componentTypeId, ComponentPoolFactory factory);
+
+  /// \return The pool of a component type, nullptr if no such component was
+  /// ever added
+  [[nodiscard]] BaseComponentPool* getComponentPool(TypeId componentTypeId) const;
+
+  /// \return The pool of the components of type T, nullptr if no such
+  /// component was ever added
+  template <class T>
+  [[nodiscard]] ComponentPool<T>* getComponentPool() const
+  {
+    return static_cast<ComponentPool<T>*>(getComponentPool(ComponentTypeId<T>()));
+  }
+
+  /// Marks a component, constructed in its pool, as added to an entity
+  void onComponentAdded(const Entity& entity, TypeId componentTypeId);
 
   void removeComponent(Entity& entity, TypeId componentTypeId);
 
@@ -82,40 +102,14 @@ public:
   void clear();
 
 private:
-  typedef std::array<std::unique_ptr<Component>, MAX_AMOUNT_OF_COMPONENTS> ImplComponentArray;
-
-  /// \brief A data structure to describe the components
-  /// within an entity
-  ///
-  /// \author Miguel Martin
-  struct EntityComponents {
-    EntityComponents() = default;
-
-    // bug in clang? won't work w/o this
-    // http://stackoverflow.com/questions/8560994/stdmake-shared-stdunique-ptr-and-move-constructors
-    // I think it's due to ComponentTypeList (may have to update boost)
-    EntityComponents(EntityComponents&& e)
-        : components(std::move(e.components)), componentTypeList(std::move(e.componentTypeList))
-    {
-    }
-
-    /// The components of an entity. The
-    /// index of this array is the same as the TypeId
-    /// of the component.
-    ImplComponentArray components;
-
-    /// A list of component types, which resembles
-    /// what components an entity has
-    ComponentTypeList componentTypeList;
-  };
-
-  /// All the components for every entity, which has
-  /// an entity. The indices of this array is the same
-  /// as the index component of an entity's ID.
-  std::vector<EntityComponents> m_componentEntries;
-
-  ImplComponentArray& getComponentsImpl(const Entity& e);
-  [[nodiscard]] const ImplComponentArray& getComponentsImpl(const Entity& e) const;
+  /// The pool of each component type. The index of this array is the same
+  /// as the TypeId of the component.
+  std::vector<std::unique_ptr<BaseComponentPool>> m_componentPools;
+
+  /// A list of component types for every entity, which resembles what
+  /// components an entity has. The indices of this array is the same as the
+  /// index component of an entity's ID.
+  std::vector<ComponentTypeList> m_componentTypeLists;
 
 }; // end of class EntityComponentStorage
 
@@ -40,6 +40,7 @@
 #include <babylon/babylon_api.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/class_type_id.h>
+#include <babylon/extensions/entitycomponentsystem/detail/component_pool.h>
 #include <babylon/extensions/entitycomponentsystem/detail/component_type_list.h>
 
 #include <babylon/extensions/entitycomponentsystem/component.h>
@@ -166,6 +167,8 @@ public:
   /// Adds a component to the Entity
   /// \tparam The type of component you wish to add
   /// \param args The arguments for the constructor of the component
+  /// \note The component is stored with the other components of type T, the
+  /// returned reference stays valid until a component of type T is removed
   template <typename T, typename... Args>
   T& addComponent(Args&&... args);
 
@@ -206,7 +209,9 @@ public:
 private:
   // wrappers to add components
   // so I may call them from templated public interfaces
-  void addComponent(Component* component, detail::TypeId componentTypeId);
+  detail::BaseComponentPool& getComponentPool(detail::TypeId componentTypeId,
+                                              detail::ComponentPoolFactory factory);
+  void onComponentAdded(detail::TypeId componentTypeId);
   void removeComponent(detail::TypeId componentTypeId);
   [[nodiscard]] Component& getComponent(detail::TypeId componentTypeId) const;
   [[nodiscard]] bool hasComponent(detail::TypeId componentTypeId) const;
@@ -225,10 +230,12 @@ template <typename T, typename... Args>
 T& Entity::addComponent(Args&&... args)
 {
   static_assert(std::is_base_of<Component, T>(), "T is not a component, cannot add T to entity");
-  // TODO: align components by type
-  auto component = new T{std::forward<Args>(args)...};
-  addComponent(component, ComponentTypeId<T>());
-  return *component;
+  const auto componentTypeId = ComponentTypeId<T>();
+  auto& pool                 = static_cast<detail::ComponentPool<T>&>(
+    getComponentPool(componentTypeId, &detail::ComponentPool<T>::Create));
+  auto& component = pool.emplace(m_id.index, std::forward<Args>(args)...);
+  onComponentAdded(componentTypeId);
+  return component;
 }
 
 template <typename T>
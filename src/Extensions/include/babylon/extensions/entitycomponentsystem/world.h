@@ -27,12 +27,14 @@
 #define BABYLON_EXTENSIONS_ENTITY_COMPONENT_SYSTEM_WORLD_H
 
 #include <memory>
+#include <tuple>
 #include <type_traits>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/thread_pool.h>
 
 #include <babylon/extensions/entitycomponentsystem/detail/entity_component_storage.h>
 #include <babylon/extensions/entitycomponentsystem/detail/entity_id_pool.h>
@@ -104,6 +106,17 @@ public:
   /// Removes all the systems from the world
   void removeAllSystems();
 
+  /// Updates all the systems. Systems whose component accesses do not conflict
+  /// are updated concurrently, conflicting systems being updated in the order
+  /// they were added to the world.
+  /// \param threadPool The pool running the systems
+  /// \see BaseSystem::conflictsWith
+  void update(ThreadPool& threadPool = ThreadPool::Default());
+
+  /// \return The systems grouped in the successive steps of update(), the
+  /// systems of a step being updated concurrently
+  const std::vector<std::vector<detail::BaseSystem*>>& getSystemSchedule();
+
   /// Creates an Entity
   /// \return A new entity for which you can use.
   Entity createEntity();
@@ -179,10 +192,50 @@ public:
   /// to the world
   Entity getEntity(std::size_t index);
 
+  /// Calls function(entity, component, otherComponents...) for every activated
+  /// entity having components of all the given types. The components of type T
+  /// are iterated linearly in their storage, the other ones being looked up.
+  /// \tparam T The type of component to iterate, preferably the rarest one
+  /// \tparam Ts The other types of component the entities must have
+  /// \param function The function to call
+  /// \note Components of type T must not be added or removed by the function
+  template <class T, class... Ts, class Function>
+  void forEach(Function&& function);
+
+  /// Same as forEach(function), restricted to the [begin, end) range of the
+  /// components of type T. Disjoint ranges can be processed concurrently.
+  /// \param begin The index of the first component of type T to iterate
+  /// \param end The index after the last component of type T to iterate
+  /// \param function The function to call
+  template <class T, class... Ts, class Function>
+  void forEach(std::size_t begin, std::size_t end, Function&& function);
+
+  /// \return The amount of components of type T in the world, including the
+  /// components of deactivated entities
+  template <class T>
+  [[nodiscard]] std::size_t getComponentCount() const;
+
+  /// Same as forEach(function), the components of type T being split in chunks
+  /// processed concurrently. The function must only modify the components it
+  /// is given.
+  /// \param function The function to call
+  /// \param grainSize The amount of components per chunk
+  /// \param threadPool The pool processing the chunks
+  template <class T, class... Ts, class Function>
+  void parallelForEach(Function&& function, std::size_t grainSize = 1024,
+                       ThreadPool& threadPool = ThreadPool::Default());
+
 private:
   /// Systems attached with the world.
   SystemArray m_systems;
 
+  /// Systems in the order they were added to the world
+  std::vector<detail::BaseSystem*> m_systemOrder;
+
+  /// The steps of update(), rebuilt when systems are added or removed
+  std::vector<std::vector<detail::BaseSystem*>> m_systemSchedule;
+  bool m_systemScheduleDirty = true;
+
   /// A pool storage of the IDs for the entities within the world
   detail::EntityIdPool m_entityIdPool;
 
@@ -315,6 +368,53 @@ template <class TSystem>
   return system.m_world == this && doesSystemExist<TSystem>();
 }
 
+template <class T, class... Ts, class Function>
+void World::forEach(Function&& function)
+{
+  forEach<T, Ts...>(0, getComponentCount<T>(), std::forward<Function>(function));
+}
+
+template <class T, class... Ts, class Function>
+void World::forEach(std::size_t begin, std::size_t end, Function&& function)
+{
+  const auto& storage              = m_entityAttributes.componentStorage;
+  auto pool                        = storage.getComponentPool<T>();
+  [[maybe_unused]] auto otherPools = std::make_tuple(storage.getComponentPool<Ts>()...);
+  if (!pool || (... || !std::get<detail::ComponentPool<Ts>*>(otherPools))) {
+    return;
+  }
+
+  const auto& attributes = m_entityAttributes.attributes;
+  pool->forEach(begin, end, [&](std::size_t entityIndex, T& component) {
+    if (!attributes[entityIndex].activated) {
+      return;
+    }
+    [[maybe_unused]] auto otherComponents
+      = std::make_tuple(std::get<detail::ComponentPool<Ts>*>(otherPools)->find(entityIndex)...);
+    if ((... || !std::get<Ts*>(otherComponents))) {
+      return;
+    }
+    Entity entity{*this, m_entityIdPool.get(entityIndex)};
+    function(entity, component, *std::get<Ts*>(otherComponents)...);
+  });
+}
+
+template <class T, class... Ts, class Function>
+void World::parallelForEach(Function&& function, std::size_t grainSize, ThreadPool& threadPool)
+{
+  threadPool.parallelFor(0, getComponentCount<T>(), grainSize,
+                         [this, &function](std::size_t begin, std::size_t end) {
+                           forEach<T, Ts...>(begin, end, function);
+                         });
+}
+
+template <class T>
+std::size_t World::getComponentCount() const
+{
+  auto pool = m_entityAttributes.componentStorage.getComponentPool<T>();
+  return pool ? pool->size() : 0;
+}
+
 } // end of namespace ECS
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -1,6 +1,8 @@
 #ifndef BABYLON_EXTENSIONS_NAVIGATION_CROWD_AGENT_H
 #define BABYLON_EXTENSIONS_NAVIGATION_CROWD_AGENT_H
 
+#include <memory>
+
 #include <babylon/babylon_api.h>
 #include <babylon/extensions/entitycomponentsystem/component.h>
 #include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
@@ -10,6 +12,7 @@
 namespace BABYLON {
 namespace Extensions {
 
+class CrowdFlowField;
 struct CrowdRoadmapVertex;
 
 namespace RVO2 {
@@ -37,7 +40,13 @@ public:
   [[nodiscard]] bool hasRoadMap() const;
   std::vector<CrowdRoadmapVertex>& roadmap();
   [[nodiscard]] const std::vector<CrowdRoadmapVertex>& roadmap() const;
+  [[nodiscard]] const std::shared_ptr<std::vector<CrowdRoadmapVertex>>& sharedRoadMap() const;
+  /* Shares a roadmap with other agents, copied on the next added waypoint. */
+  void setRoadMap(const std::shared_ptr<std::vector<CrowdRoadmapVertex>>& roadmap);
   void addWayPoint(const BABYLON::Vector2& wayPoint);
+  [[nodiscard]] bool hasFlowField() const;
+  [[nodiscard]] const CrowdFlowField& flowField() const;
+  void setFlowField(const std::shared_ptr<const CrowdFlowField>& flowField);
   void setAgentMaxNeighbors(size_t neighborsMax);
   void setAgentNeighborDist(float neighborDist);
   void setAgentTimeHorizon(float timeHorizon);
@@ -50,8 +59,10 @@ private:
   size_t _id;
   RVO2::Vector2 _goal;
   RVO2::RVOSimulator* _sim;
-  // Holds the roadmap
-  std::vector<CrowdRoadmapVertex> _roadmap;
+  // Holds the roadmap, possibly shared with other agents
+  std::shared_ptr<std::vector<CrowdRoadmapVertex>> _roadmap;
+  // The flow field leading to the goal, shared by the agents heading to the same goal
+  std::shared_ptr<const CrowdFlowField> _flowField;
 
 }; // end of class CrowdAgent
 
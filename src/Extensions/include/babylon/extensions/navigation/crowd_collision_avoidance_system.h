@@ -19,7 +19,7 @@ public:
   CrowdCollisionAvoidanceSystem(RVO2::RVOSimulator* sim);
   ~CrowdCollisionAvoidanceSystem() override; // = default
 
-  void update();
+  void update() override;
 
 private:
   /**
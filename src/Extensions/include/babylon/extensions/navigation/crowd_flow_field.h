@@ -0,0 +1,84 @@
+#ifndef BABYLON_EXTENSIONS_NAVIGATION_CROWD_FLOW_FIELD_H
+#define BABYLON_EXTENSIONS_NAVIGATION_CROWD_FLOW_FIELD_H
+
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+#include <babylon/extensions/navigation/rvo2/vector2.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace RVO2 {
+class RVOSimulator;
+} // namespace RVO2
+
+/**
+ * @brief Grid of directions leading to a goal around the obstacles of a simulation.
+ *
+ * The field is computed once per goal, so that any number of agents heading to the same goal only
+ * sample the cell they are in instead of searching a path each.
+ */
+class BABYLON_SHARED_EXPORT CrowdFlowField {
+
+public:
+  /**
+   * @brief Creates a flow field covering the [min, max] rectangle.
+   * @param min defines the minimum corner of the grid
+   * @param max defines the maximum corner of the grid
+   * @param cellSize defines the size of the square cells of the grid
+   */
+  CrowdFlowField(const RVO2::Vector2& min, const RVO2::Vector2& max, float cellSize);
+  ~CrowdFlowField(); // = default
+
+  /**
+   * @brief Computes the distance to the goal and the direction to follow in each cell of the
+   * grid, moving from cell to cell only when the obstacles of the simulator do not block the way
+   * of an agent of the given radius.
+   * @param sim defines the simulator whose (processed) obstacles are avoided
+   * @param goal defines the goal of the agents
+   * @param agentRadius defines the radius of the agents
+   * @return false if the goal is outside of the grid
+   */
+  bool compute(const RVO2::RVOSimulator& sim, const RVO2::Vector2& goal, float agentRadius);
+
+  /**
+   * @brief Returns the unit direction to follow from a position, zero in the cell of the goal.
+   * @param position defines the position of the agent
+   * @param direction defines the direction to follow
+   * @return false if the position is outside of the grid or the goal cannot be reached from it
+   */
+  bool getDirection(const RVO2::Vector2& position, RVO2::Vector2& direction) const;
+
+  /**
+   * @brief Returns the length of the path from the center of the cell of a position to the goal,
+   * infinity if the goal cannot be reached.
+   */
+  [[nodiscard]] float getDistanceToGoal(const RVO2::Vector2& position) const;
+
+  [[nodiscard]] const RVO2::Vector2& goal() const;
+  [[nodiscard]] size_t width() const;
+  [[nodiscard]] size_t height() const;
+
+private:
+  [[nodiscard]] bool cellIndex(const RVO2::Vector2& position, size_t& index) const;
+  [[nodiscard]] RVO2::Vector2 cellCenter(size_t x, size_t y) const;
+
+private:
+  RVO2::Vector2 _min;
+  float _cellSize;
+  size_t _width;
+  size_t _height;
+  RVO2::Vector2 _goal;
+  // Distance to the goal of each cell center, row by row
+  std::vector<float> _distances;
+  // Unit direction to follow from each cell, row by row
+  std::vector<RVO2::Vector2> _directions;
+
+}; // end of class CrowdFlowField
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NAVIGATION_CROWD_FLOW_FIELD_H
@@ -15,7 +15,7 @@ struct BABYLON_SHARED_EXPORT CrowdMeshUpdaterSystem
   CrowdMeshUpdaterSystem();
   ~CrowdMeshUpdaterSystem() override; // = default
 
-  void update();
+  void update() override;
 
 }; // end of struct CrowdMeshUpdaterSystem
 
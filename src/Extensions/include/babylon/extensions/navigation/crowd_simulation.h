@@ -45,8 +45,14 @@ public:
 
   /* Add a roadmap vertex. */
   void addWayPoint(const BABYLON::Vector2& waypoint);
+  /* Computes the roadmaps, shared by the agents with the same goal, radius and waypoints. */
   void computeRoadMap();
 
+  /* Flow field mode: the agents follow a grid of directions computed once per goal. */
+  void setFlowFieldGrid(const Vector2& min, const Vector2& max, float cellSize);
+  /* Computes the flow field of each goal, after the obstacles are processed. */
+  void computeFlowFields();
+
   /* Set the simulation precision. */
   void setPrecision(unsigned int precision);
 
@@ -67,6 +73,10 @@ private:
   CrowdMeshUpdaterSystem _crowdMeshUpdaterSystem;
   // The crowd agents
   std::vector<ECS::Entity> _agents;
+  // The area covered by the flow fields and their cell size, 0 when disabled
+  Vector2 _flowFieldMin;
+  Vector2 _flowFieldMax;
+  float _flowFieldCellSize;
 
 }; // end of class CrowdSimulation
 
@@ -71,9 +71,11 @@ private:
    * \brief      Inserts an agent neighbor into the set of neighbors of
    *             this agent.
    * \param      agent           A pointer to the agent to be inserted.
+   * \param      distSq          The squared distance between the agents,
+   *                             less than rangeSq.
    * \param      rangeSq         The squared range around this agent.
    */
-  void insertAgentNeighbor(const Agent* agent, float& rangeSq);
+  void insertAgentNeighbor(const Agent* agent, float distSq, float& rangeSq);
 
   /**
    * \brief      Inserts a static obstacle neighbor into the set of neighbors
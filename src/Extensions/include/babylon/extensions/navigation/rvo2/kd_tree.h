@@ -41,6 +41,9 @@
 #include <babylon/extensions/navigation/rvo2/definitions.h>
 
 namespace BABYLON {
+
+class ThreadPool;
+
 namespace Extensions {
 namespace RVO2 {
 
@@ -131,10 +134,15 @@ private:
 
   /**
    * \brief      Builds an agent <i>k</i>d-tree.
+   * \param      threadPool      The thread pool building the large subtrees
+   *                             in parallel.
+   * \note       The agents are partitioned starting from their order in the
+   *             previous tree, which is nearly sorted when the agents moved
+   *             little since the previous step.
    */
-  void buildAgentTree();
+  void buildAgentTree(ThreadPool& threadPool);
 
-  void buildAgentTreeRecursive(size_t begin, size_t end, size_t node);
+  void buildAgentTreeRecursive(size_t begin, size_t end, size_t node, ThreadPool* threadPool);
 
   /**
    * \brief      Builds an obstacle <i>k</i>d-tree.
@@ -188,12 +196,19 @@ private:
                                 const ObstacleTreeNode* node) const;
 
   std::vector<Agent*> agents_;
+  /* Positions of the agents in tree order, scanned by the partitioning and the
+   * neighbor queries without dereferencing the agents. */
+  std::vector<float> agentPositionsX_;
+  std::vector<float> agentPositionsY_;
   std::vector<AgentTreeNode> agentTree_;
   ObstacleTreeNode* obstacleTree_;
   RVOSimulator* sim_;
 
   static const size_t MAX_LEAF_SIZE = 10;
 
+  /* Minimum number of agents of a subtree built as a separate task. */
+  static const size_t PARALLEL_BUILD_SIZE = 4096;
+
   friend class Agent;
   friend class RVOSimulator;
 
@@ -45,6 +45,9 @@
 #include <babylon/extensions/navigation/rvo2/vector2.h>
 
 namespace BABYLON {
+
+class ThreadPool;
+
 namespace Extensions {
 namespace RVO2 {
 
@@ -210,6 +213,9 @@ public:
    * \brief      Lets the simulator perform a simulation step and updates the
    *             two-dimensional position and two-dimensional velocity of
    *             each agent.
+   * \note       The agents are processed in parallel by the thread pool of
+   *             the simulator, the result being independent of the number of
+   *             threads.
    */
   void doStep();
 
@@ -416,6 +422,13 @@ public:
    */
   [[nodiscard]] float getTimeStep() const;
 
+  /**
+   * \brief      Returns the thread pool running the simulation steps.
+   * \return     The thread pool of the simulator, the default thread pool of
+   *             the engine unless another one was set.
+   */
+  [[nodiscard]] ThreadPool& getThreadPool() const;
+
   /**
    * \brief      Processes the obstacles that have been added so that they
    *             are accounted for in the simulation.
@@ -576,14 +589,25 @@ public:
    */
   void setTimeStep(float timeStep);
 
+  /**
+   * \brief      Sets the thread pool running the simulation steps.
+   * \param      threadPool      The thread pool to use, or nullptr to use
+   *                             the default thread pool of the engine.
+   */
+  void setThreadPool(ThreadPool* threadPool);
+
 private:
   std::vector<Agent*> agents_;
   Agent* defaultAgent_;
   float globalTime_{0.0f};
   KdTree* kdTree_;
   std::vector<Obstacle*> obstacles_;
+  ThreadPool* threadPool_{nullptr};
   float timeStep_{0.0f};
 
+  /* Number of agents per task of a simulation step. */
+  static const size_t AGENT_GRAIN_SIZE = 64;
+
   friend class Agent;
   friend class KdTree;
   friend class Obstacle;
@@ -0,0 +1,110 @@
+#ifndef BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
+#define BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+
+#include <babylon/babylon_api.h>
+#include <babylon/core/thread_pool.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace detail {
+
+// Number of points evaluated together by the batch noise kernels. The kernels run each step of the
+// noise on all the lanes before moving to the next one, in loops the compiler turns into SIMD code
+constexpr std::size_t NoiseLanes = 8;
+
+// Number of points of a point array processed by a task of the batch noise functions
+constexpr std::size_t NoisePointsGrain = 1024;
+
+// Octave stacking done by the batch noise kernels, one octave being a plain noise
+template <typename T>
+struct NoiseOctaves {
+  int octaves   = 1;
+  T amplitude   = 1;
+  T lacunarity  = 2;
+  T gain        = 0.5;
+  bool ridged   = false;
+  T ridgeOffset = 1;
+}; // end of struct NoiseOctaves
+
+// Sums the octaves of the noise at NoiseLanes points, kernel(coordinates, values) evaluating one
+// octave. Fractal brownian motion sums noise * amplitude, ridged multi-fractal sums
+// ridge * amplitude * previous ridge, ridge being (ridgeOffset - |noise|)^2.
+template <typename T, std::size_t D, typename Kernel>
+void StackNoiseOctaves(const Kernel& kernel, const NoiseOctaves<T>& octaves,
+                       const T (&coordinates)[D][NoiseLanes], T (&values)[NoiseLanes])
+{
+  T sum[NoiseLanes];
+  T previous[NoiseLanes];
+  T scaled[D][NoiseLanes];
+  T octave[NoiseLanes];
+  std::fill_n(sum, NoiseLanes, T(0));
+  std::fill_n(previous, NoiseLanes, T(1));
+
+  T frequency = 1;
+  T amplitude = octaves.amplitude;
+  for (int i = 0; i < octaves.octaves; ++i) {
+    for (std::size_t d = 0; d < D; ++d) {
+      for (std::size_t lane = 0; lane < NoiseLanes; ++lane) {
+        scaled[d][lane] = coordinates[d][lane] * frequency;
+      }
+    }
+    kernel(scaled, octave);
+    if (octaves.ridged) {
+      for (std::size_t lane = 0; lane < NoiseLanes; ++lane) {
+        auto ridge = octaves.ridgeOffset - std::abs(octave[lane]);
+        ridge *= ridge;
+        sum[lane] += ridge * amplitude * previous[lane];
+        previous[lane] = ridge;
+      }
+    }
+    else {
+      for (std::size_t lane = 0; lane < NoiseLanes; ++lane) {
+        sum[lane] += octave[lane] * amplitude;
+      }
+    }
+    frequency *= octaves.lacunarity;
+    amplitude *= octaves.gain;
+  }
+  std::copy_n(sum, NoiseLanes, values);
+}
+
+// Fills result[i] for i in [0, count) with the octave stack at the points given by
+// point(i, lane, coordinates), which writes the coordinates of point i in coordinates[d][lane].
+// Chunks of grainSize points are processed in parallel, the last lanes of a chunk repeating its
+// last point.
+template <typename T, std::size_t D, typename Point, typename Kernel>
+void FillNoise(T* result, std::size_t count, std::size_t grainSize, const Point& point,
+               const Kernel& kernel, const NoiseOctaves<T>& octaves, ThreadPool& threadPool)
+{
+  threadPool.parallelFor(0, count, grainSize, [&](std::size_t begin, std::size_t end) {
+    T coordinates[D][NoiseLanes];
+    T values[NoiseLanes];
+    for (auto first = begin; first < end; first += NoiseLanes) {
+      const auto laneCount = std::min(NoiseLanes, end - first);
+      for (std::size_t lane = 0; lane < NoiseLanes; ++lane) {
+        point(first + std::min(lane, laneCount - 1), lane, coordinates);
+      }
+      StackNoiseOctaves(kernel, octaves, coordinates, values);
+      std::copy_n(values, laneCount, result + first);
+    }
+  });
+}
+
+// Number of grid cells processed by a task of the batch noise functions, whole rows of at least
+// NoisePointsGrain cells
+inline std::size_t NoiseRowsGrain(std::size_t width)
+{
+  return width == 0 ? 1 : width * std::max<std::size_t>(1, NoisePointsGrain / width);
+}
+
+} // end of namespace detail
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_NOISE_GENERATION_NOISE_LANES_H
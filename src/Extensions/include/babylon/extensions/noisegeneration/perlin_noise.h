@@ -5,6 +5,7 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/babylon_common.h>
+#include <babylon/core/thread_pool.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -73,6 +74,37 @@ public:
    */
   [[nodiscard]] double noise(double x, double y, double z) const;
 
+  /**
+   * @brief Fills a grid with 3D Perlin noise values, row after row: the value of the cell (i, j)
+   * is the noise at (x + i * stepX, y + j * stepY, z). Several points are evaluated at once and the
+   * rows are split among the threads of the pool.
+   * @param result Values of the width * height cells, resized if needed.
+   * @param x X value of the first cell.
+   * @param y Y value of the first cell.
+   * @param z Z value of the grid.
+   * @param stepX X distance between two columns.
+   * @param stepY Y distance between two rows.
+   * @param width Number of columns.
+   * @param height Number of rows.
+   * @param octaves Number of octaves summed, the frequency doubling and the amplitude halving at
+   * each octave as in PerlinNoiseOctave.
+   * @param threadPool Thread pool sharing the rows.
+   */
+  void noiseGrid(Float64Array& result, double x, double y, double z, double stepX, double stepY,
+                 size_t width, size_t height, int octaves = 1,
+                 ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills an array with the 3D Perlin noise values at a set of points, several points being
+   * evaluated at once by the threads of the pool.
+   * @param points X, y and z values of the points, one after the other.
+   * @param result Values at the points, resized if needed.
+   * @param octaves Number of octaves summed, as in PerlinNoiseOctave.
+   * @param threadPool Thread pool sharing the points.
+   */
+  void noise(const Float64Array& points, Float64Array& result, int octaves = 1,
+             ThreadPool& threadPool = ThreadPool::Default()) const;
+
 private:
   // The permutation vector
   std::array<int, 512> p;
@@ -96,6 +128,19 @@ public:
 
   [[nodiscard]] double noise(double x, double y, double z) const;
 
+  void noiseGrid(Float64Array& result, double x, double y, double z, double stepX, double stepY,
+                 size_t width, size_t height,
+                 ThreadPool& threadPool = ThreadPool::Default()) const
+  {
+    _perlinNoise.noiseGrid(result, x, y, z, stepX, stepY, width, height, _octaves, threadPool);
+  }
+
+  void noise(const Float64Array& points, Float64Array& result,
+             ThreadPool& threadPool = ThreadPool::Default()) const
+  {
+    _perlinNoise.noise(points, result, _octaves, threadPool);
+  }
+
 private:
   PerlinNoise _perlinNoise;
   int _octaves;
@@ -6,6 +6,8 @@
 #include <functional>
 
 #include <babylon/babylon_api.h>
+#include <babylon/babylon_common.h>
+#include <babylon/core/thread_pool.h>
 
 namespace BABYLON {
 
@@ -363,6 +365,54 @@ public:
    */
   float iqfBm(const Vector3& v, uint8_t octaves = 4, float lacunarity = 2.0f, float gain = 0.5f);
 
+  // ---------------------------------------------------------------------------
+  // Batch evaluation: the grids are filled row after row, the value of the cell (i, j) being the
+  // value at origin + (i * step.x, j * step.y). Several points are evaluated at once, the octaves
+  // being summed for all of them in the same kernel, and the rows or the points are split among
+  // the threads of the pool. The values match the ones of the single point functions.
+
+  /**
+   * @brief Fills a width * height grid with 2D simplex noise values.
+   */
+  void noiseGrid(Float32Array& result, const Vector2& origin, const Vector2& step, size_t width,
+                 size_t height, ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills a width * height grid with 2D simplex noise fractal brownian motion sums.
+   */
+  void fBmGrid(Float32Array& result, const Vector2& origin, const Vector2& step, size_t width,
+               size_t height, uint8_t octaves = 4, float lacunarity = 2.0f, float gain = 0.5f,
+               ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills a width * height grid with 2D simplex ridged multi-fractal noise sums.
+   */
+  void ridgedMFGrid(Float32Array& result, const Vector2& origin, const Vector2& step, size_t width,
+                    size_t height, float ridgeOffset = 1.0f, uint8_t octaves = 4,
+                    float lacunarity = 2.0f, float gain = 0.5f,
+                    ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills result with the 3D simplex noise values at the given points.
+   */
+  void noise(const std::vector<Vector3>& points, Float32Array& result,
+             ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills result with the 3D simplex noise fractal brownian motion sums at the given
+   * points.
+   */
+  void fBm(const std::vector<Vector3>& points, Float32Array& result, uint8_t octaves = 4,
+           float lacunarity = 2.0f, float gain = 0.5f,
+           ThreadPool& threadPool = ThreadPool::Default()) const;
+
+  /**
+   * @brief Fills result with the 3D simplex ridged multi-fractal noise sums at the given points.
+   */
+  void ridgedMF(const std::vector<Vector3>& points, Float32Array& result, float ridgeOffset = 1.0f,
+                uint8_t octaves = 4, float lacunarity = 2.0f, float gain = 0.5f,
+                ThreadPool& threadPool = ThreadPool::Default()) const;
+
   // ---------------------------------------------------------------------------
 
   /**
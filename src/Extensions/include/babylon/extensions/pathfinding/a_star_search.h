@@ -2,11 +2,16 @@
 #define BABYLON_EXTENSIONS_PATH_FINDING_A_STAR_SEARCH_H
 
 #include <algorithm>
+#include <cstdint>
+#include <functional>
 #include <queue>
+#include <type_traits>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
 #include <babylon/babylon_api.h>
+#include <babylon/core/thread_pool.h>
 
 namespace BABYLON {
 namespace Extensions {
@@ -47,57 +52,280 @@ struct AStarNode {
   bool visited;
 }; // end of struct
 
+/**
+ * @brief Reusable storage of the A* searches over graphs whose nodes are numbered from 0 to
+ * size() - 1.
+ *
+ * The nodes are stored in dense arrays sized once for the graph, a generation counter telling
+ * which nodes belong to the current search, so that starting a new search neither allocates nor
+ * clears memory. A context is used by one search at a time.
+ */
+template <typename NodeId>
+class AStarSearchContext {
+
+public:
+  using QueueEntry = std::pair<double, NodeId>;
+
+  /**
+   * @brief Starts a new search.
+   * @param nodeCount defines the number of nodes of the graph
+   */
+  void reset(std::size_t nodeCount)
+  {
+    if (_generations.size() < nodeCount) {
+      _nodes.resize(nodeCount);
+      _generations.resize(nodeCount, 0);
+    }
+    _openList.clear();
+    if (++_generation == 0) {
+      // Wrapped around, forget the generations of the previous searches
+      std::fill(_generations.begin(), _generations.end(), 0);
+      _generation = 1;
+    }
+  }
+
+  /**
+   * @brief Returns whether or not a node has been reached by the current search.
+   */
+  [[nodiscard]] bool contains(NodeId id) const
+  {
+    return _generations[static_cast<std::size_t>(id)] == _generation;
+  }
+
+  /**
+   * @brief Returns the search state of a node, initialized when first reached by the search.
+   */
+  AStarNode<NodeId>& operator[](NodeId id)
+  {
+    const auto index = static_cast<std::size_t>(id);
+    if (_generations[index] != _generation) {
+      _generations[index] = _generation;
+      _nodes[index]       = AStarNode<NodeId>{0, 0.0, 0.0, false};
+    }
+    return _nodes[index];
+  }
+
+  [[nodiscard]] bool empty() const
+  {
+    return _openList.empty();
+  }
+
+  /**
+   * @brief Adds a node to the open list.
+   */
+  void push(NodeId id, double priority)
+  {
+    _openList.emplace_back(priority, id);
+    std::push_heap(_openList.begin(), _openList.end(), std::greater<QueueEntry>());
+  }
+
+  /**
+   * @brief Removes the entry of the open list with the lowest priority.
+   */
+  QueueEntry pop()
+  {
+    std::pop_heap(_openList.begin(), _openList.end(), std::greater<QueueEntry>());
+    const auto entry = _openList.back();
+    _openList.pop_back();
+    return entry;
+  }
+
+private:
+  std::vector<AStarNode<NodeId>> _nodes;
+  std::vector<uint32_t> _generations;
+  uint32_t _generation = 0;
+  // Binary heap of (fScore, node id)
+  std::vector<QueueEntry> _openList;
+
+}; // end of class AStarSearchContext
+
+namespace detail {
+
+template <typename Graph, typename = void>
+struct HasForEachNeighbor : std::false_type {
+};
+
+template <typename Graph>
+using ForEachNeighborCall = decltype(std::declval<const Graph&>().forEachNeighbor(
+  std::declval<typename Graph::NodeId>(), std::declval<void (*)(const typename Graph::Node&)>()));
+
+template <typename Graph>
+struct HasForEachNeighbor<Graph, std::void_t<ForEachNeighborCall<Graph>>> : std::true_type {
+};
+
+// Calls function(node) for each neighbor of a node, without building the vector of neighbors when
+// the graph can iterate over them
+template <typename Graph, typename Function>
+void ForEachNeighbor(Graph& graph, typename Graph::NodeId id, Function&& function)
+{
+  if constexpr (HasForEachNeighbor<std::remove_const_t<Graph>>::value) {
+    graph.forEachNeighbor(id, function);
+  }
+  else {
+    for (auto&& next : graph.neighbors(id)) {
+      function(next);
+    }
+  }
+}
+
+// The search context of the calling thread
+template <typename NodeId>
+AStarSearchContext<NodeId>& ThreadSearchContext()
+{
+  thread_local AStarSearchContext<NodeId> context;
+  return context;
+}
+
+} // end of namespace detail
+
+/**
+ * @brief Finds the shortest path between two nodes of a graph whose nodes are numbered from 0 to
+ * size() - 1, reusing the storage of a search context.
+ * @return the ids of the nodes of the path, from start to goal, empty if there is no path
+ */
 template <typename Graph>
-std::vector<typename Graph::NodeId> AStarSearch(Graph& graph, typename Graph::Node& start,
-                                                typename Graph::Node& goal)
+std::vector<typename Graph::NodeId> AStarSearch(Graph& graph, const typename Graph::Node& start,
+                                                const typename Graph::Node& goal,
+                                                AStarSearchContext<typename Graph::NodeId>& context)
 {
   using NodeId = typename Graph::NodeId;
   std::vector<NodeId> path;
-  PriorityQueue<NodeId, double> frontier;
-  frontier.put(start.id, 0);
+  context.reset(graph.size());
 
-  std::unordered_map<NodeId, AStarNode<NodeId>> aStarNodes(graph.size());
-  aStarNodes[start.id] = AStarNode<NodeId>{
+  auto& startNode = context[start.id];
+  startNode       = AStarNode<NodeId>{
     start.id,                                 // cameFrom
     0.0,                                      // gScore
     graph.heuristicCostEstimate(start, goal), // fScore
     true                                      // visited
   };
+  context.push(start.id, startNode.fScore);
 
-  while (!frontier.empty()) {
-    // The node in frontier having the lowest fScore
-    auto current = frontier.get();
+  while (!context.empty()) {
+    // The node in the open list having the lowest fScore
+    const auto [fScore, current] = context.pop();
+    auto& currentNode            = context[current];
+    if (fScore > currentNode.fScore) {
+      // Already expanded with a lower score
+      continue;
+    }
 
     if (current == goal.id) {
-      while (aStarNodes[current].cameFrom != start.id) {
-        path.emplace_back(current);
-        current = aStarNodes[current].cameFrom;
+      auto node = current;
+      while (context[node].cameFrom != start.id) {
+        path.emplace_back(node);
+        node = context[node].cameFrom;
       }
-      path.emplace_back(current);
+      path.emplace_back(node);
       path.emplace_back(start.id);
       std::reverse(path.begin(), path.end());
       break;
     }
 
-    for (auto&& next : graph.neighbors(current)) {
+    const auto gScore = currentNode.gScore;
+    detail::ForEachNeighbor(graph, current, [&](const typename Graph::Node& next) {
       // The distance from start to a neighbor
-      const auto tentative_gScore = aStarNodes[current].gScore + graph.cost(current, next);
-      if (!aStarNodes.count(next.id)) {
-        aStarNodes[next.id] = AStarNode<NodeId>{0, 0.0, 0.0, false};
-      }
-      auto& neighbor = aStarNodes[next.id];
+      const auto tentative_gScore = gScore + graph.cost(current, next);
+      auto& neighbor              = context[next.id];
       if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
         neighbor.visited  = true;
         neighbor.cameFrom = current;
         neighbor.gScore   = tentative_gScore;
         neighbor.fScore   = tentative_gScore + graph.heuristicCostEstimate(next, goal);
-        frontier.put(next.id, neighbor.fScore);
+        context.push(next.id, neighbor.fScore);
       }
-    }
+    });
   }
   return path;
 }
 
+/**
+ * @brief Finds the shortest path between two nodes of a graph.
+ *
+ * Graphs with integral node ids are expected to number their nodes from 0 to size() - 1, their
+ * searches reusing the search context of the calling thread.
+ * @return the ids of the nodes of the path, from start to goal, empty if there is no path
+ */
+template <typename Graph>
+std::vector<typename Graph::NodeId> AStarSearch(Graph& graph, const typename Graph::Node& start,
+                                                const typename Graph::Node& goal)
+{
+  using NodeId = typename Graph::NodeId;
+  if constexpr (std::is_integral_v<NodeId>) {
+    return AStarSearch(graph, start, goal, detail::ThreadSearchContext<NodeId>());
+  }
+  else {
+    std::vector<NodeId> path;
+    PriorityQueue<NodeId, double> frontier;
+    frontier.put(start.id, 0);
+
+    std::unordered_map<NodeId, AStarNode<NodeId>> aStarNodes(graph.size());
+    aStarNodes[start.id] = AStarNode<NodeId>{
+      start.id,                                 // cameFrom
+      0.0,                                      // gScore
+      graph.heuristicCostEstimate(start, goal), // fScore
+      true                                      // visited
+    };
+
+    while (!frontier.empty()) {
+      // The node in frontier having the lowest fScore
+      auto current = frontier.get();
+
+      if (current == goal.id) {
+        while (aStarNodes[current].cameFrom != start.id) {
+          path.emplace_back(current);
+          current = aStarNodes[current].cameFrom;
+        }
+        path.emplace_back(current);
+        path.emplace_back(start.id);
+        std::reverse(path.begin(), path.end());
+        break;
+      }
+
+      for (auto&& next : graph.neighbors(current)) {
+        // The distance from start to a neighbor
+        const auto tentative_gScore = aStarNodes[current].gScore + graph.cost(current, next);
+        if (!aStarNodes.count(next.id)) {
+          aStarNodes[next.id] = AStarNode<NodeId>{0, 0.0, 0.0, false};
+        }
+        auto& neighbor = aStarNodes[next.id];
+        if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
+          neighbor.visited  = true;
+          neighbor.cameFrom = current;
+          neighbor.gScore   = tentative_gScore;
+          neighbor.fScore   = tentative_gScore + graph.heuristicCostEstimate(next, goal);
+          frontier.put(next.id, neighbor.fScore);
+        }
+      }
+    }
+    return path;
+  }
+}
+
+/**
+ * @brief Finds the shortest paths of many (start, goal) queries, the queries being split between
+ * the threads of a thread pool. The graph must be safe to read from several threads, and its nodes
+ * numbered from 0 to size() - 1 and accessible through graph(id).
+ * @return the path of each query, in query order
+ */
+template <typename Graph>
+std::vector<std::vector<typename Graph::NodeId>>
+AStarSearchBatch(const Graph& graph,
+                 const std::vector<std::pair<typename Graph::NodeId, typename Graph::NodeId>>&
+                   queries,
+                 ThreadPool& threadPool = ThreadPool::Default())
+{
+  using NodeId = typename Graph::NodeId;
+  std::vector<std::vector<NodeId>> paths(queries.size());
+  threadPool.parallelFor(0, queries.size(), 16, [&](std::size_t begin, std::size_t end) {
+    auto& context = detail::ThreadSearchContext<NodeId>();
+    for (auto i = begin; i < end; ++i) {
+      paths[i] = AStarSearch(graph, graph(queries[i].first), graph(queries[i].second), context);
+    }
+  });
+  return paths;
+}
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
 
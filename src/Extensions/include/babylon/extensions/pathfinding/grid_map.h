@@ -0,0 +1,129 @@
+#ifndef BABYLON_EXTENSIONS_PATH_FINDING_GRID_MAP_H
+#define BABYLON_EXTENSIONS_PATH_FINDING_GRID_MAP_H
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include <babylon/babylon_api.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+struct GridNode {
+  std::size_t id = 0;
+}; // end of struct GridNode
+
+/**
+ * @brief Uniform cost grid of walkable and blocked cells, where agents move to the 8 neighboring
+ * cells, diagonally only when both adjacent cells are walkable.
+ *
+ * The grid can be searched with AStarSearch and, faster, with JumpPointSearch.
+ */
+struct GridMap {
+  using Node   = GridNode;
+  using NodeId = std::size_t;
+  std::size_t _width;
+  std::size_t _height;
+  std::vector<uint8_t> _walkable;
+
+  GridMap(std::size_t width, std::size_t height)
+      : _width{width}, _height{height}, _walkable(width * height, 1)
+  {
+  }
+
+  ~GridMap() = default;
+
+  [[nodiscard]] std::size_t size() const
+  {
+    return _walkable.size();
+  }
+
+  [[nodiscard]] std::size_t width() const
+  {
+    return _width;
+  }
+
+  [[nodiscard]] std::size_t height() const
+  {
+    return _height;
+  }
+
+  [[nodiscard]] NodeId id(std::size_t x, std::size_t y) const
+  {
+    return y * _width + x;
+  }
+
+  [[nodiscard]] int64_t x(NodeId id) const
+  {
+    return static_cast<int64_t>(id % _width);
+  }
+
+  [[nodiscard]] int64_t y(NodeId id) const
+  {
+    return static_cast<int64_t>(id / _width);
+  }
+
+  Node operator()(NodeId id) const
+  {
+    return Node{id};
+  }
+
+  // Cells outside of the grid are blocked
+  [[nodiscard]] bool isWalkable(int64_t x, int64_t y) const
+  {
+    return x >= 0 && y >= 0 && x < static_cast<int64_t>(_width)
+           && y < static_cast<int64_t>(_height)
+           && _walkable[static_cast<std::size_t>(y) * _width + static_cast<std::size_t>(x)] != 0;
+  }
+
+  void setWalkable(std::size_t x, std::size_t y, bool walkable)
+  {
+    _walkable[id(x, y)] = walkable ? 1 : 0;
+  }
+
+  template <typename Function>
+  void forEachNeighbor(NodeId nodeId, Function&& function) const
+  {
+    const auto cx = x(nodeId);
+    const auto cy = y(nodeId);
+    for (int64_t dy = -1; dy <= 1; ++dy) {
+      for (int64_t dx = -1; dx <= 1; ++dx) {
+        if ((dx == 0 && dy == 0) || !isWalkable(cx + dx, cy + dy)) {
+          continue;
+        }
+        // No corner cutting
+        if (dx != 0 && dy != 0 && (!isWalkable(cx + dx, cy) || !isWalkable(cx, cy + dy))) {
+          continue;
+        }
+        function(Node{static_cast<NodeId>((cy + dy) * static_cast<int64_t>(_width) + cx + dx)});
+      }
+    }
+  }
+
+  [[nodiscard]] std::vector<Node> neighbors(NodeId nodeId) const
+  {
+    std::vector<Node> neighborsNodes;
+    forEachNeighbor(nodeId, [&](const Node& neighbor) { neighborsNodes.emplace_back(neighbor); });
+    return neighborsNodes;
+  }
+
+  [[nodiscard]] double cost(const NodeId& nodeId, const Node& neighbor) const
+  {
+    return (x(nodeId) != x(neighbor.id) && y(nodeId) != y(neighbor.id)) ? std::sqrt(2.0) : 1.0;
+  }
+
+  // Octile distance
+  [[nodiscard]] double heuristicCostEstimate(const Node& node1, const Node& node2) const
+  {
+    const auto diffX = static_cast<double>(std::abs(x(node1.id) - x(node2.id)));
+    const auto diffY = static_cast<double>(std::abs(y(node1.id) - y(node2.id)));
+    return diffX + diffY + (std::sqrt(2.0) - 2.0) * std::min(diffX, diffY);
+  }
+
+}; // end of struct GridMap
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_PATH_FINDING_GRID_MAP_H
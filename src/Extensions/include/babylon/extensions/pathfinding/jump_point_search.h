@@ -0,0 +1,191 @@
+#ifndef BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
+#define BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/extensions/pathfinding/a_star_search.h>
+#include <babylon/extensions/pathfinding/grid_map.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace detail {
+
+// Moves from (x, y) in the (dx, dy) direction until finding a jump point: the goal, a cell with a
+// forced neighbor, or for diagonal moves a cell from which a straight move finds a jump point.
+// Returns false when reaching a blocked cell first.
+inline bool Jump(const GridMap& grid, int64_t x, int64_t y, int64_t dx, int64_t dy,
+                 GridMap::NodeId goal, GridMap::NodeId& jumpPoint)
+{
+  const auto goalX = grid.x(goal);
+  const auto goalY = grid.y(goal);
+  while (true) {
+    // Diagonal moves need both adjacent cells to be walkable
+    if (dx != 0 && dy != 0 && (!grid.isWalkable(x + dx, y) || !grid.isWalkable(x, y + dy))) {
+      return false;
+    }
+
+    x += dx;
+    y += dy;
+    if (!grid.isWalkable(x, y)) {
+      return false;
+    }
+
+    if (x == goalX && y == goalY) {
+      jumpPoint = goal;
+      return true;
+    }
+
+    if (dx != 0 && dy != 0) {
+      GridMap::NodeId straightJumpPoint = 0;
+      if (Jump(grid, x, y, dx, 0, goal, straightJumpPoint)
+          || Jump(grid, x, y, 0, dy, goal, straightJumpPoint)) {
+        jumpPoint = grid.id(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+        return true;
+      }
+    }
+    else if (dx != 0) {
+      if ((grid.isWalkable(x, y - 1) && !grid.isWalkable(x - dx, y - 1))
+          || (grid.isWalkable(x, y + 1) && !grid.isWalkable(x - dx, y + 1))) {
+        jumpPoint = grid.id(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+        return true;
+      }
+    }
+    else {
+      if ((grid.isWalkable(x - 1, y) && !grid.isWalkable(x - 1, y - dy))
+          || (grid.isWalkable(x + 1, y) && !grid.isWalkable(x + 1, y - dy))) {
+        jumpPoint = grid.id(static_cast<std::size_t>(x), static_cast<std::size_t>(y));
+        return true;
+      }
+    }
+  }
+}
+
+// Calls function(dx, dy) for the directions worth exploring from a cell reached in the
+// (parentDx, parentDy) direction, all the directions for the start cell
+template <typename Function>
+void ForEachJumpDirection(const GridMap& grid, int64_t x, int64_t y, int64_t parentDx,
+                          int64_t parentDy, Function&& function)
+{
+  if (parentDx == 0 && parentDy == 0) {
+    for (int64_t dy = -1; dy <= 1; ++dy) {
+      for (int64_t dx = -1; dx <= 1; ++dx) {
+        if (dx != 0 || dy != 0) {
+          function(dx, dy);
+        }
+      }
+    }
+  }
+  else if (parentDx != 0 && parentDy != 0) {
+    function(parentDx, 0);
+    function(0, parentDy);
+    function(parentDx, parentDy);
+  }
+  else if (parentDx != 0) {
+    function(parentDx, 0);
+    for (const int64_t side : {int64_t{-1}, int64_t{1}}) {
+      if (grid.isWalkable(x, y + side)) {
+        function(0, side);
+        function(parentDx, side);
+      }
+    }
+  }
+  else {
+    function(0, parentDy);
+    for (const int64_t side : {int64_t{-1}, int64_t{1}}) {
+      if (grid.isWalkable(x + side, y)) {
+        function(side, 0);
+        function(side, parentDy);
+      }
+    }
+  }
+}
+
+} // end of namespace detail
+
+/**
+ * @brief Finds the shortest path between two cells of a uniform cost grid with jump point search:
+ * A* only expanding the cells where the optimal paths may turn, the straight and diagonal runs in
+ * between being skipped.
+ * @return the ids of the cells of the path, from start to goal, empty if there is no path
+ */
+inline std::vector<GridMap::NodeId> JumpPointSearch(const GridMap& grid, GridMap::NodeId start,
+                                                    GridMap::NodeId goal,
+                                                    AStarSearchContext<GridMap::NodeId>& context)
+{
+  using NodeId = GridMap::NodeId;
+  std::vector<NodeId> path;
+  if (!grid.isWalkable(grid.x(start), grid.y(start))
+      || !grid.isWalkable(grid.x(goal), grid.y(goal))) {
+    return path;
+  }
+
+  context.reset(grid.size());
+  auto& startNode = context[start];
+  startNode = AStarNode<NodeId>{start, 0.0, grid.heuristicCostEstimate({start}, {goal}), true};
+  context.push(start, startNode.fScore);
+
+  while (!context.empty()) {
+    const auto [fScore, current] = context.pop();
+    auto& currentNode            = context[current];
+    if (fScore > currentNode.fScore) {
+      // Already expanded with a lower score
+      continue;
+    }
+
+    if (current == goal) {
+      // Expand the jump points in the cells of the runs between them
+      auto node = current;
+      path.emplace_back(node);
+      while (node != start) {
+        const auto parent = context[node].cameFrom;
+        const auto dx     = (grid.x(parent) > grid.x(node)) - (grid.x(parent) < grid.x(node));
+        const auto dy     = (grid.y(parent) > grid.y(node)) - (grid.y(parent) < grid.y(node));
+        while (node != parent) {
+          node = grid.id(static_cast<std::size_t>(grid.x(node) + dx),
+                         static_cast<std::size_t>(grid.y(node) + dy));
+          path.emplace_back(node);
+        }
+      }
+      std::reverse(path.begin(), path.end());
+      break;
+    }
+
+    const auto x      = grid.x(current);
+    const auto y      = grid.y(current);
+    const auto parent = currentNode.cameFrom;
+    const auto gScore = currentNode.gScore;
+    const int64_t parentDx = (x > grid.x(parent)) - (x < grid.x(parent));
+    const int64_t parentDy = (y > grid.y(parent)) - (y < grid.y(parent));
+    detail::ForEachJumpDirection(grid, x, y, parentDx, parentDy, [&](int64_t dx, int64_t dy) {
+      NodeId jumpPoint = 0;
+      if (!detail::Jump(grid, x, y, dx, dy, goal, jumpPoint)) {
+        return;
+      }
+      const auto tentative_gScore = gScore + grid.heuristicCostEstimate({current}, {jumpPoint});
+      auto& neighbor              = context[jumpPoint];
+      if (!neighbor.visited || tentative_gScore < neighbor.gScore) {
+        neighbor.visited  = true;
+        neighbor.cameFrom = current;
+        neighbor.gScore   = tentative_gScore;
+        neighbor.fScore   = tentative_gScore + grid.heuristicCostEstimate({jumpPoint}, {goal});
+        context.push(jumpPoint, neighbor.fScore);
+      }
+    });
+  }
+  return path;
+}
+
+/**
+ * @brief Finds the shortest path between two cells of a uniform cost grid with jump point search,
+ * reusing the search context of the calling thread.
+ */
+inline std::vector<GridMap::NodeId> JumpPointSearch(const GridMap& grid, GridMap::NodeId start,
+                                                    GridMap::NodeId goal)
+{
+  return JumpPointSearch(grid, start, goal, detail::ThreadSearchContext<GridMap::NodeId>());
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_EXTENSIONS_PATH_FINDING_JUMP_POINT_SEARCH_H
@@ -46,12 +46,12 @@ struct Cell {
   double cost    = 0.0;
 }; // end of struct Cell
 
-bool operator==(const Cell& lhs, const Cell& rhs)
+inline bool operator==(const Cell& lhs, const Cell& rhs)
 {
   return lhs.id == rhs.id;
 }
 
-bool operator!=(const Cell& lhs, const Cell& rhs)
+inline bool operator!=(const Cell& lhs, const Cell& rhs)
 {
   return lhs.id != rhs.id;
 }
@@ -124,32 +124,37 @@ struct RectangularMaze {
     return cellId(location) < _cells.size();
   }
 
-  [[nodiscard]] std::vector<Cell> neighbors(const std::size_t _cellId) const
+  template <typename Function>
+  void forEachNeighbor(const std::size_t _cellId, Function&& function) const
   {
-    std::vector<Cell> neighborsNodes;
     std::size_t row, col;
     std::tie(row, col) = location(_cellId);
 
     // Can go up
     if (row != 0 && cell(row - 1, col).downOpen) {
-      neighborsNodes.emplace_back(cell(row - 1, col));
+      function(cell(row - 1, col));
     }
 
     // Can go left
     if (col != 0 && cell(row, col - 1).rightOpen) {
-      neighborsNodes.emplace_back(cell(row, col - 1));
+      function(cell(row, col - 1));
     }
 
     // Can go right
     if (col < _columns - 1 && cell(row, col + 1).leftOpen) {
-      neighborsNodes.emplace_back(cell(row, col + 1));
+      function(cell(row, col + 1));
     }
 
     // Can go down
     if (row < _rows - 1 && cell(row + 1, col).upOpen) {
-      neighborsNodes.emplace_back(cell(row + 1, col));
+      function(cell(row + 1, col));
     }
+  }
 
+  [[nodiscard]] std::vector<Cell> neighbors(const std::size_t _cellId) const
+  {
+    std::vector<Cell> neighborsNodes;
+    forEachNeighbor(_cellId, [&](const Cell& neighbor) { neighborsNodes.emplace_back(neighbor); });
     return neighborsNodes;
   }
 
@@ -264,7 +269,7 @@ struct RectangularMaze {
       if (!check.empty()) { // If there is a valid cell to move to.
         // Mark the walls between cells as open if we move
         history.emplace(Location{r, c});
-        const auto moveDirection = check[Math::distribution(pcg, std::size_t(0), check.size())];
+        const auto moveDirection = check[Math::distribution(pcg, std::size_t(0), check.size() - 1)];
         switch (moveDirection) {
           case 'L':
             cell(r, c).leftOpen = true;
@@ -301,16 +306,21 @@ struct RectangularMaze {
     cell(_rows - 1, _columns - 1).rightOpen = true;
   }
 
-  std::vector<Location> findPath(const Location& start, const Location& goal)
+  void initCells()
   {
-    // Result
-    std::vector<Location> result;
-    // Init cells
     std::size_t cellIdCtr = 0;
     for (auto& cell : _cells) {
       cell.visited = false;
       cell.id      = cellIdCtr++;
     }
+  }
+
+  std::vector<Location> findPath(const Location& start, const Location& goal)
+  {
+    // Result
+    std::vector<Location> result;
+    // Init cells
+    initCells();
     // Map locations to cell ids
     const std::size_t startCellId = isValid(start) ? cellId(start) : 0;
     const std::size_t goalCellId  = isValid(goal) ? cellId(goal) : _cells.size() - 1;
@@ -324,6 +334,34 @@ struct RectangularMaze {
     return result;
   }
 
+  // Finds the paths of many (start, goal) queries in parallel
+  std::vector<std::vector<Location>>
+  findPaths(const std::vector<std::pair<Location, Location>>& queries,
+            ThreadPool& threadPool = ThreadPool::Default())
+  {
+    // Init cells
+    initCells();
+    // Map locations to cell ids
+    std::vector<std::pair<NodeId, NodeId>> cellQueries;
+    cellQueries.reserve(queries.size());
+    for (const auto& [start, goal] : queries) {
+      cellQueries.emplace_back(isValid(start) ? cellId(start) : 0,
+                               isValid(goal) ? cellId(goal) : _cells.size() - 1);
+    }
+    // Find paths in maze
+    const auto paths = AStarSearchBatch(static_cast<const RectangularMaze&>(*this), cellQueries,
+                                        threadPool);
+    // Convert to paths of locations
+    std::vector<std::vector<Location>> results(paths.size());
+    for (std::size_t i = 0; i < paths.size(); ++i) {
+      results[i].reserve(paths[i].size());
+      for (auto& cellId : paths[i]) {
+        results[i].emplace_back(location(cellId));
+      }
+    }
+    return results;
+  }
+
   std::vector<Location> findPath()
   {
     return findPath(location(0), location(_cells.size() - 1));
@@ -332,8 +370,8 @@ struct RectangularMaze {
 }; // end of struct RectangularMaze
 
 // For debugging
-std::basic_iostream<char>::basic_ostream& operator<<(std::basic_iostream<char>::basic_ostream& out,
-                                                     const RectangularMaze& maze)
+inline std::basic_iostream<char>::basic_ostream&
+operator<<(std::basic_iostream<char>::basic_ostream& out, const RectangularMaze& maze)
 {
   const auto numRows = maze._rows;
   const auto numCols = maze._columns;
@@ -1,10 +1,15 @@
 #pragma once
 #include <recastnavigation/Detour/Include/DetourNavMesh.h>
 #include <recastnavigation/DetourCrowd/Include/DetourCrowd.h>
+#include <recastnavigation/DetourTileCache/Include/DetourTileCache.h>
 
 #include <algorithm>
+#include <cstdint>
+#include <future>
 #include <vector>
 
+#include <babylon/core/thread_pool.h>
+
 class dtNavMeshQuery;
 class dtNavMesh;
 class MeshLoader;
@@ -12,6 +17,9 @@ class NavMesh;
 struct rcPolyMesh;
 struct rcPolyMeshDetail;
 struct rcConfig;
+struct dtTileCacheAlloc;
+struct dtTileCacheCompressor;
+struct dtTileCacheMeshProcess;
 
 namespace BABYLON {
 namespace Extensions {
@@ -90,6 +98,12 @@ struct NavPath {
 };
 
 class NavMesh {
+public:
+  /**
+   * Maximum number of temporary obstacles of a tiled navigation mesh
+   */
+  static constexpr int MAX_OBSTACLES = 128;
+
 public:
   NavMesh()
       : m_navQuery(nullptr)
@@ -97,6 +111,10 @@ public:
       , m_pmesh(nullptr)
       , m_dmesh(nullptr)
       , m_navData(nullptr)
+      , m_tileCache(nullptr)
+      , m_tileCacheAlloc(nullptr)
+      , m_tileCacheCompressor(nullptr)
+      , m_tileCacheMeshProcess(nullptr)
       , m_defaultQueryExtent(1.f)
   {
   }
@@ -104,6 +122,75 @@ public:
   void build(const float* positions, const int positionCount, const int* indices,
              const int indexCount, const rcConfig& config);
 
+  /**
+   * @brief Builds a navigation mesh made of tiles of config.tileSize cells, rasterizing the tiles
+   * on the threads of the pool. The tiles are kept in a tile cache so that temporary obstacles
+   * only rebuild the tiles they touch.
+   * @param positions the vertex positions (x, y, z)
+   * @param positionCount the number of vertices
+   * @param indices the triangle indices
+   * @param indexCount the number of indices
+   * @param config the build configuration, with a tileSize greater than 0
+   * @param threadPool the thread pool rasterizing the tiles
+   * @returns whether the navigation mesh was built
+   */
+  bool buildTiled(const float* positions, const int positionCount, const int* indices,
+                  const int indexCount, const rcConfig& config,
+                  ThreadPool& threadPool = ThreadPool::Default());
+
+  /**
+   * @brief Builds a tiled navigation mesh without blocking the calling thread. The navigation mesh
+   * must not be used before the returned future is ready.
+   * @returns a future becoming ready with the result of buildTiled once the build is done
+   */
+  std::future<bool> buildTiledAsync(std::vector<float> positions, std::vector<int> indices,
+                                    const rcConfig& config,
+                                    ThreadPool& threadPool = ThreadPool::Default());
+
+  /**
+   * @brief Adds a cylinder obstacle to a tiled navigation mesh, carved at the next update. An
+   * obstacle touches at most DT_MAX_TOUCHED_TILES tiles.
+   * @param position the bottom center of the cylinder
+   * @param radius the cylinder radius
+   * @param height the cylinder height
+   * @returns the obstacle reference, 0 if the obstacle could not be added
+   */
+  dtObstacleRef addCylinderObstacle(const Vec3& position, float radius, float height);
+
+  /**
+   * @brief Adds a box obstacle, rotated around the y axis, to a tiled navigation mesh, carved at
+   * the next update.
+   * @param position the center of the box
+   * @param extent the half extents of the box
+   * @param angle the rotation around the y axis in radians
+   * @returns the obstacle reference, 0 if the obstacle could not be added
+   */
+  dtObstacleRef addBoxObstacle(const Vec3& position, const Vec3& extent, float angle);
+
+  /**
+   * @brief Removes an obstacle at the next update.
+   */
+  void removeObstacle(dtObstacleRef obstacle);
+
+  /**
+   * @brief Rebuilds the tiles touched by the obstacles added or removed since the last update.
+   */
+  void update();
+
+  /**
+   * @brief Serializes the tiles of the navigation mesh, the compressed tile cache layers for a
+   * tiled navigation mesh. Temporary obstacles are not serialized.
+   * @returns the serialized navigation mesh, empty if there is none
+   */
+  std::vector<uint8_t> getNavmeshData() const;
+
+  /**
+   * @brief Loads a navigation mesh serialized with getNavmeshData, without rasterizing the
+   * geometry again.
+   * @returns whether the navigation mesh was loaded
+   */
+  bool buildFromNavmeshData(const std::vector<uint8_t>& data);
+
   DebugNavMesh getDebugNavMesh();
   Vec3 getClosestPoint(const Vec3& position);
   Vec3 getRandomPointAround(const Vec3& position, float maxRadius);
@@ -128,8 +215,14 @@ protected:
   rcPolyMesh* m_pmesh;
   rcPolyMeshDetail* m_dmesh;
   unsigned char* m_navData;
+  dtTileCache* m_tileCache;
+  dtTileCacheAlloc* m_tileCacheAlloc;
+  dtTileCacheCompressor* m_tileCacheCompressor;
+  dtTileCacheMeshProcess* m_tileCacheMeshProcess;
   Vec3 m_defaultQueryExtent;
 
+  bool initTileCache(const dtTileCacheParams& cacheParams, const dtNavMeshParams& meshParams);
+  bool initNavMeshQuery();
   void navMeshPoly(DebugNavMesh& debugNavMesh, const dtNavMesh& mesh, dtPolyRef ref);
   void navMeshPolysWithFlags(DebugNavMesh& debugNavMesh, const dtNavMesh& mesh,
                              const unsigned short polyFlags);
@@ -3,8 +3,11 @@
 
 #include <babylon/babylon_api.h>
 #include <babylon/misc/observer.h>
+#include <babylon/navigation/iagent_parameters.h>
 #include <babylon/navigation/icrowd.h>
 
+class dtNavMesh;
+
 namespace BABYLON {
 namespace Extensions {
 
@@ -99,6 +102,14 @@ public:
    */
   void dispose() override;
 
+  /**
+   * @brief Hidden
+   * Recreates the detour crowd on a new navigation mesh. The agents are added again at their
+   * current position, with their parameters and index; their destination is lost.
+   * @param navMesh the new detour navigation mesh
+   */
+  void _rebuild(dtNavMesh* navMesh);
+
 public:
   /**
    * Recast/detour plugin
@@ -126,6 +137,17 @@ private:
    */
   Scene* _scene;
 
+  /**
+   * Maximum agent count and radius the detour crowd is created with
+   */
+  size_t _maxAgents;
+  float _maxAgentRadius;
+
+  /**
+   * Parameters of each agent, to add them again when the crowd is rebuilt
+   */
+  std::vector<IAgentParameters> _agentParameters;
+
   /**
    * Observer for crowd updates
    */
@@ -8,6 +8,8 @@
 namespace BABYLON {
 namespace Extensions {
 
+class RecastJSCrowd;
+
 /**
  * @brief RecastJS navigation plugin.
  */
@@ -87,6 +89,43 @@ public:
    */
   Vector3 getDefaultQueryExtent() const override;
 
+  /**
+   * @brief Creates a cylinder obstacle and add it to the navigation, the navigation mesh must be
+   * tiled.
+   * @param position world position
+   * @param radius cylinder radius
+   * @param height cylinder height
+   * @returns the obstacle freshly created, 0 if it could not be added
+   */
+  dtObstacleRef addCylinderObstacle(const Vector3& position, float radius, float height);
+
+  /**
+   * @brief Creates a box obstacle and add it to the navigation, the navigation mesh must be tiled.
+   * @param position world position
+   * @param extent box size
+   * @param angle angle in radians of the box orientation on Y axis
+   * @returns the obstacle freshly created, 0 if it could not be added
+   */
+  dtObstacleRef addBoxObstacle(const Vector3& position, const Vector3& extent, float angle);
+
+  /**
+   * @brief Removes an obstacle created with addCylinderObstacle or addBoxObstacle.
+   * @param obstacle obstacle to remove from the navigation
+   */
+  void removeObstacle(dtObstacleRef obstacle);
+
+  /**
+   * @brief Gets the navigation mesh serialized, to be loaded with buildFromNavmeshData.
+   * @returns the serialized navigation mesh
+   */
+  std::vector<uint8_t> getNavmeshData() const;
+
+  /**
+   * @brief Creates a navigation mesh from serialized data, without computing it again.
+   * @param data the serialized navigation mesh
+   */
+  void buildFromNavmeshData(const std::vector<uint8_t>& data);
+
   /**
    * @brief Disposes
    */
@@ -104,6 +143,20 @@ public:
    */
   std::unique_ptr<NavMesh> navMesh;
 
+private:
+  /**
+   * @brief Replaces the navigation mesh, rebuilding the crowds created on the previous one which
+   * would otherwise keep a dangling detour navigation mesh.
+   * @param newNavMesh the new navigation mesh
+   */
+  void _setNavMesh(std::unique_ptr<NavMesh>&& newNavMesh);
+
+private:
+  /**
+   * The crowds created by this plugin
+   */
+  std::vector<std::weak_ptr<RecastJSCrowd>> _crowds;
+
 }; // end of class RecastJSPlugin
 
 } // end of namespace Extensions
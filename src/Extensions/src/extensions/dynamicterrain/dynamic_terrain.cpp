@@ -3,6 +3,7 @@
 #include <babylon/babylon_stl_util.h>
 #include <babylon/cameras/camera.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/engines/scene.h>
 #include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
 #include <babylon/meshes/builders/mesh_builder_options.h>
@@ -59,6 +60,9 @@ DynamicTerrain::DynamicTerrain(const std::string& iName, DynamicTerrainOptions&
                                    1,                          // vertex LOD value on Z axis
                                    Vector3::Zero(),            // vertex World position
                                    0}}
+    , _subShiftX{0}
+    , _subShiftZ{0}
+    , _rebuiltVertexCount{0}
     , _averageSubSizeX{0.f}
     , _averageSubSizeZ{0.f}
     , _terrainSizeX{0.f}
@@ -219,24 +223,20 @@ DynamicTerrain& DynamicTerrain::update(bool force)
     _signX     = (_deltaX > 0.f) ? -1 : 1;
     _mapFlgtNb = static_cast<unsigned>(std::abs(_deltaX / _mapShiftX));
     _terrain->position().x += _mapShiftX * _signX * _mapFlgtNb;
-    if (_signX == 1) {
-      _deltaSubX += (_subToleranceX * _LODValue * _mapFlgtNb);
-    }
-    else if (_signZ == -1) {
-      _deltaSubX -= (_subToleranceX * _LODValue * _mapFlgtNb);
-    }
+    const auto subShift = static_cast<int64_t>(_signX) * _subToleranceX * _LODValue * _mapFlgtNb;
+    _deltaSubX
+      = static_cast<unsigned>(_mod<int64_t>(_deltaSubX + subShift, static_cast<int64_t>(_mapSubX)));
+    _subShiftX += subShift;
     _needsUpdate = true;
   }
   if (std::abs(_deltaZ) > _mapShiftZ) {
     _signZ     = (_deltaZ > 0.f) ? -1 : 1;
     _mapFlgtNb = static_cast<unsigned>(std::abs(_deltaZ / _mapShiftZ));
     _terrain->position().z += _mapShiftZ * _signZ * _mapFlgtNb;
-    if (_signZ == 1) {
-      _deltaSubZ += (_subToleranceZ * _LODValue * _mapFlgtNb);
-    }
-    else if (_signZ == -1) {
-      _deltaSubZ -= (_subToleranceZ * _LODValue * _mapFlgtNb);
-    }
+    const auto subShift = static_cast<int64_t>(_signZ) * _subToleranceZ * _LODValue * _mapFlgtNb;
+    _deltaSubZ
+      = static_cast<unsigned>(_mod<int64_t>(_deltaSubZ + subShift, static_cast<int64_t>(_mapSubZ)));
+    _subShiftZ += subShift;
     _needsUpdate = true;
   }
   if (_needsUpdate || _updateLOD || _updateForced) {
@@ -257,171 +257,93 @@ DynamicTerrain& DynamicTerrain::update(bool force)
 
 void DynamicTerrain::_updateTerrain()
 {
-  unsigned int stepJ        = 0;
-  unsigned int stepI        = 0;
-  unsigned int LODLimitDown = 0;
-  unsigned int LODLimitUp   = 0;
-  unsigned int LODValue     = _LODValue;
-  unsigned int lodI         = LODValue;
-  unsigned int lodJ         = LODValue;
-  unsigned int l            = 0;
-  unsigned int index        = 0;  // current vertex index in the map data array
-  unsigned int posIndex     = 0;  // current position index in the map data array
-  unsigned int colIndex     = 0;  // current index in the map color array
-  unsigned int uvIndex      = 0;  // current index in the map uv array
-  unsigned int terIndex     = 0;  // current vertex index in the terrain map array
-                                  // when used as a data map
-  unsigned int ribbonInd     = 0; // current ribbon vertex index
-  unsigned int ribbonPosInd  = 0; // current ribbon position index (same than normal index)
-  unsigned int ribbonUVInd   = 0; // current ribbon UV index
-  unsigned int ribbonColInd  = 0; // current ribbon color index
-  unsigned int ribbonPosInd1 = 0;
-  unsigned int ribbonPosInd2 = 0;
-  unsigned int ribbonPosInd3 = 0;
-  // note : all the indexes are explicitly set as integers for the js optimizer
-  // (store them all in the stack)
-
   if (_updateLOD || _updateForced) {
     updateTerrainSize();
   }
+
+  DynamicTerrainAxisLOD lodX;
+  DynamicTerrainAxisLOD lodZ;
+  lodX.compute(_terrainSub, _LODValue, _LODLimits);
+  lodZ.compute(_terrainSub, _LODValue, _LODLimits);
+
+  // The vertices still sampling the same map cells after the terrain moved are copied, when the
+  // vertex LODs did not change. The map shifts are modulo the map size, so they only match the
+  // terrain array shifts when the map size is a multiple of the terrain size. The user custom
+  // function may change any vertex, so it rebuilds all of them.
+  const bool terrainIndices = !_datamap || !_uvmap;
+  const bool sameMapIndices
+    = !terrainIndices || (_mapSubX % _terrainIdx == 0 && _mapSubZ % _terrainIdx == 0);
+  const bool copyVertices = !_updateForced && !_useCustomVertexFunction && sameMapIndices
+                            && !_previousPositions.empty() && lodX == _lodX && lodZ == _lodZ;
+  std::vector<int64_t> sourcesX;
+  std::vector<int64_t> sourcesZ;
+  if (copyVertices) {
+    lodX.computeSources(_subShiftX, sourcesX);
+    lodZ.computeSources(_subShiftZ, sourcesZ);
+    std::swap(_positions, _previousPositions);
+    std::swap(_normals, _previousNormals);
+    std::swap(_colors, _previousColors);
+    std::swap(_uvs, _previousUVs);
+  }
+  _lodX      = std::move(lodX);
+  _lodZ      = std::move(lodZ);
+  _subShiftX = 0;
+  _subShiftZ = 0;
+
+  // Rows of vertices rebuilt in parallel, each chunk of rows computing its own bounding box
+  const size_t chunkCount = (_terrainIdx + TERRAIN_CHUNK_ROWS - 1) / TERRAIN_CHUNK_ROWS;
+  std::vector<Vector3> chunkMins(chunkCount);
+  std::vector<Vector3> chunkMaxs(chunkCount);
+  std::vector<size_t> chunkRebuiltCounts(chunkCount, 0);
+  const auto updateRows = [&](size_t begin, size_t end) {
+    const size_t chunk = begin / TERRAIN_CHUNK_ROWS;
+    Vector3 bbMin(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
+                  std::numeric_limits<float>::max());
+    Vector3 bbMax(std::numeric_limits<float>::lowest(), std::numeric_limits<float>::lowest(),
+                  std::numeric_limits<float>::lowest());
+    DynamicTerrainVertex vertex = _vertex;
+    size_t rebuiltCount         = 0;
+    for (auto j = static_cast<unsigned int>(begin); j < end; ++j) {
+      for (unsigned int i = 0; i <= _terrainSub; ++i) {
+        const size_t ribbonInd = j * _terrainIdx + i;
+        if (copyVertices && sourcesX[i] >= 0 && sourcesZ[j] >= 0) {
+          _copyVertex(i, j, static_cast<size_t>(sourcesZ[j]) * _terrainIdx
+                              + static_cast<size_t>(sourcesX[i]));
+        }
+        else {
+          _buildVertex(i, j, vertex);
+          ++rebuiltCount;
+        }
+        // bbox internal update
+        const float* position = &_positions[3 * ribbonInd];
+        bbMin.minimizeInPlaceFromFloats(position[0], position[1], position[2]);
+        bbMax.maximizeInPlaceFromFloats(position[0], position[1], position[2]);
+      }
+    }
+    chunkMins[chunk]          = bbMin;
+    chunkMaxs[chunk]          = bbMax;
+    chunkRebuiltCounts[chunk] = rebuiltCount;
+  };
+  if (_useCustomVertexFunction) {
+    // The user custom function may not be thread-safe
+    for (size_t begin = 0; begin < _terrainIdx; begin += TERRAIN_CHUNK_ROWS) {
+      updateRows(begin, std::min<size_t>(begin + TERRAIN_CHUNK_ROWS, _terrainIdx));
+    }
+  }
+  else {
+    ThreadPool::Default().parallelFor(0, _terrainIdx, TERRAIN_CHUNK_ROWS, updateRows);
+  }
+
   Vector3::FromFloatsToRef(std::numeric_limits<float>::max(), std::numeric_limits<float>::max(),
                            std::numeric_limits<float>::max(), _bbMin);
   Vector3::FromFloatsToRef(std::numeric_limits<float>::lowest(),
                            std::numeric_limits<float>::lowest(),
                            std::numeric_limits<float>::lowest(), _bbMax);
-
-  for (unsigned int j = 0; j <= _terrainSub; ++j) {
-    // LOD Z
-    LODValue = _LODValue;
-    for (l = 0; l < _LODLimits.size(); ++l) {
-      LODLimitDown = _LODLimits[l];
-      LODLimitUp   = _terrainSub - LODLimitDown - 1;
-      if (j < LODLimitDown || j > LODLimitUp) {
-        LODValue = l + 1 + _LODValue;
-      }
-      lodJ = LODValue;
-    }
-
-    for (unsigned int i = 0; i <= _terrainSub; ++i) {
-      // LOD X
-      LODValue = _LODValue;
-      for (l = 0; l < _LODLimits.size(); ++l) {
-        LODLimitDown = _LODLimits[l];
-        LODLimitUp   = _terrainSub - LODLimitDown - 1;
-        if (i < LODLimitDown || i > LODLimitUp) {
-          LODValue = l + 1 + _LODValue;
-        }
-        lodI = LODValue;
-      }
-
-      // map current index
-      index    = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX + _mod(_deltaSubX + stepI, _mapSubX);
-      terIndex = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx
-                 + _mod(_deltaSubX + stepI, _terrainIdx);
-
-      // related index in the array of positions (data map)
-      if (_datamap) {
-        posIndex = 3 * index;
-      }
-      else {
-        posIndex = 3 * terIndex;
-      }
-      // related index in the UV map
-      if (_uvmap) {
-        uvIndex = 2 * index;
-      }
-      else {
-        uvIndex = 2 * terIndex;
-      }
-      // related index in the color map
-      if (_colormap) {
-        colIndex = 3 * index;
-      }
-      else {
-        colIndex = 3 * terIndex;
-      }
-      // ribbon indexes
-      ribbonPosInd  = 3 * ribbonInd;
-      ribbonColInd  = 4 * ribbonInd;
-      ribbonUVInd   = 2 * ribbonInd;
-      ribbonPosInd1 = ribbonPosInd;
-      ribbonPosInd2 = ribbonPosInd + 1;
-      ribbonPosInd3 = ribbonPosInd + 2;
-      ribbonInd += 1;
-
-      // geometry
-      _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
-      _positions[ribbonPosInd2] = _mapData[posIndex + 1];
-      _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
-
-      if (!_computeNormals) {
-        _normals[ribbonPosInd1] = _mapNormals[posIndex];
-        _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
-        _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
-      }
-
-      // bbox internal update
-      if (_positions[ribbonPosInd1] < _bbMin.x) {
-        _bbMin.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd1] > _bbMax.x) {
-        _bbMax.x = _positions[ribbonPosInd1];
-      }
-      if (_positions[ribbonPosInd2] < _bbMin.y) {
-        _bbMin.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd2] > _bbMax.y) {
-        _bbMax.y = _positions[ribbonPosInd2];
-      }
-      if (_positions[ribbonPosInd3] < _bbMin.z) {
-        _bbMin.z = _positions[ribbonPosInd3];
-      }
-      if (_positions[ribbonPosInd3] > _bbMax.z) {
-        _bbMax.z = _positions[ribbonPosInd3];
-      }
-      // color
-      if (_colormap) {
-        _colors[ribbonColInd]     = _mapColors[colIndex];
-        _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
-        _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
-      }
-      // uv : the array _mapUVs is always populated
-      _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
-      _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
-
-      // call to user custom function with the current updated vertex object
-      if (_useCustomVertexFunction) {
-        _vertex.position.copyFromFloats(_positions[ribbonPosInd1], _positions[ribbonPosInd2],
-                                        _positions[ribbonPosInd3]);
-        _vertex.worldPosition.x = _mapData[posIndex];
-        _vertex.worldPosition.y = _vertex.position.y;
-        _vertex.worldPosition.z = _mapData[posIndex + 2];
-        _vertex.lodX            = lodI;
-        _vertex.lodZ            = lodJ;
-        _vertex.color.r         = _colors[ribbonColInd];
-        _vertex.color.g         = _colors[ribbonColInd + 1];
-        _vertex.color.b         = _colors[ribbonColInd + 2];
-        _vertex.color.a         = _colors[ribbonColInd + 3];
-        _vertex.uvs.x           = _uvs[ribbonUVInd];
-        _vertex.uvs.y           = _uvs[ribbonUVInd + 1];
-        _vertex.mapIndex        = index;
-        updateVertex(_vertex, i,
-                     j); // the user can modify the array values here
-        _colors[ribbonColInd]     = _vertex.color.r;
-        _colors[ribbonColInd + 1] = _vertex.color.g;
-        _colors[ribbonColInd + 2] = _vertex.color.b;
-        _colors[ribbonColInd + 3] = _vertex.color.a;
-        _uvs[ribbonUVInd]         = _vertex.uvs.x;
-        _uvs[ribbonUVInd + 1]     = _vertex.uvs.y;
-        _positions[ribbonPosInd1] = _vertex.position.x;
-        _positions[ribbonPosInd2] = _vertex.position.y;
-        _positions[ribbonPosInd3] = _vertex.position.z;
-      }
-
-      stepI += lodI;
-    }
-    stepI = 0;
-    stepJ += lodJ;
+  _rebuiltVertexCount = 0;
+  for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+    _bbMin.minimizeInPlace(chunkMins[chunk]);
+    _bbMax.maximizeInPlace(chunkMaxs[chunk]);
+    _rebuiltVertexCount += chunkRebuiltCounts[chunk];
   }
 
   // ribbon update
@@ -434,6 +356,106 @@ void DynamicTerrain::_updateTerrain()
   _terrain->updateVerticesData(VertexBuffer::ColorKind, _colors, false, false);
   _terrain->_boundingInfo = std::make_unique<BoundingInfo>(_bbMin, _bbMax);
   _terrain->_boundingInfo->update(_terrain->_worldMatrix);
+
+  // Second buffer of vertex data swapped with the ribbon data when copying the vertices. The
+  // vertices copied or rebuilt overwrite all of its data but the colors set by the custom
+  // function, so it is reset when the custom function is used.
+  if (_useCustomVertexFunction) {
+    _previousPositions.clear();
+  }
+  else if (_previousPositions.empty()) {
+    _previousPositions = _positions;
+    _previousNormals   = _normals;
+    _previousColors    = _colors;
+    _previousUVs       = _uvs;
+  }
+}
+
+void DynamicTerrain::_buildVertex(unsigned int i, unsigned int j, DynamicTerrainVertex& vertex)
+{
+  const unsigned int stepI = _lodX.steps[i];
+  const unsigned int stepJ = _lodZ.steps[j];
+
+  // map current index
+  const unsigned int index
+    = _mod(_deltaSubZ + stepJ, _mapSubZ) * _mapSubX + _mod(_deltaSubX + stepI, _mapSubX);
+  // current vertex index in the terrain map array when used as a data map
+  const unsigned int terIndex
+    = _mod(_deltaSubZ + stepJ, _terrainIdx) * _terrainIdx + _mod(_deltaSubX + stepI, _terrainIdx);
+
+  // related index in the array of positions (data map)
+  const unsigned int posIndex = _datamap ? 3 * index : 3 * terIndex;
+  // related index in the UV map
+  const unsigned int uvIndex = _uvmap ? 2 * index : 2 * terIndex;
+  // related index in the color map
+  const unsigned int colIndex = _colormap ? 3 * index : 3 * terIndex;
+  // ribbon indexes
+  const unsigned int ribbonInd     = j * _terrainIdx + i;
+  const unsigned int ribbonPosInd1 = 3 * ribbonInd;
+  const unsigned int ribbonPosInd2 = ribbonPosInd1 + 1;
+  const unsigned int ribbonPosInd3 = ribbonPosInd1 + 2;
+  const unsigned int ribbonColInd  = 4 * ribbonInd;
+  const unsigned int ribbonUVInd   = 2 * ribbonInd;
+
+  // geometry
+  _positions[ribbonPosInd1] = _averageSubSizeX * stepI;
+  _positions[ribbonPosInd2] = _mapData[posIndex + 1];
+  _positions[ribbonPosInd3] = _averageSubSizeZ * stepJ;
+
+  if (!_computeNormals) {
+    _normals[ribbonPosInd1] = _mapNormals[posIndex];
+    _normals[ribbonPosInd2] = _mapNormals[posIndex + 1];
+    _normals[ribbonPosInd3] = _mapNormals[posIndex + 2];
+  }
+
+  // color
+  if (_colormap) {
+    _colors[ribbonColInd]     = _mapColors[colIndex];
+    _colors[ribbonColInd + 1] = _mapColors[colIndex + 1];
+    _colors[ribbonColInd + 2] = _mapColors[colIndex + 2];
+  }
+  // uv : the array _mapUVs is always populated
+  _uvs[ribbonUVInd]     = _mapUVs[uvIndex];
+  _uvs[ribbonUVInd + 1] = _mapUVs[uvIndex + 1];
+
+  // call to user custom function with the current updated vertex object
+  if (_useCustomVertexFunction) {
+    vertex.position.copyFromFloats(_positions[ribbonPosInd1], _positions[ribbonPosInd2],
+                                   _positions[ribbonPosInd3]);
+    vertex.worldPosition.x = _mapData[posIndex];
+    vertex.worldPosition.y = vertex.position.y;
+    vertex.worldPosition.z = _mapData[posIndex + 2];
+    vertex.lodX            = _lodX.lods[i];
+    vertex.lodZ            = _lodZ.lods[j];
+    vertex.color.r         = _colors[ribbonColInd];
+    vertex.color.g         = _colors[ribbonColInd + 1];
+    vertex.color.b         = _colors[ribbonColInd + 2];
+    vertex.color.a         = _colors[ribbonColInd + 3];
+    vertex.uvs.x           = _uvs[ribbonUVInd];
+    vertex.uvs.y           = _uvs[ribbonUVInd + 1];
+    vertex.mapIndex        = index;
+    updateVertex(vertex, i, j); // the user can modify the array values here
+    _colors[ribbonColInd]     = vertex.color.r;
+    _colors[ribbonColInd + 1] = vertex.color.g;
+    _colors[ribbonColInd + 2] = vertex.color.b;
+    _colors[ribbonColInd + 3] = vertex.color.a;
+    _uvs[ribbonUVInd]         = vertex.uvs.x;
+    _uvs[ribbonUVInd + 1]     = vertex.uvs.y;
+    _positions[ribbonPosInd1] = vertex.position.x;
+    _positions[ribbonPosInd2] = vertex.position.y;
+    _positions[ribbonPosInd3] = vertex.position.z;
+  }
+}
+
+void DynamicTerrain::_copyVertex(unsigned int i, unsigned int j, size_t sourceInd)
+{
+  const size_t ribbonInd        = j * _terrainIdx + i;
+  _positions[3 * ribbonInd]     = _averageSubSizeX * _lodX.steps[i];
+  _positions[3 * ribbonInd + 1] = _previousPositions[3 * sourceInd + 1];
+  _positions[3 * ribbonInd + 2] = _averageSubSizeZ * _lodZ.steps[j];
+  std::copy_n(&_previousNormals[3 * sourceInd], 3, &_normals[3 * ribbonInd]);
+  std::copy_n(&_previousColors[4 * sourceInd], 4, &_colors[4 * ribbonInd]);
+  std::copy_n(&_previousUVs[2 * sourceInd], 2, &_uvs[2 * ribbonInd]);
 }
 
 DynamicTerrain& DynamicTerrain::updateTerrainSize()
@@ -551,6 +573,11 @@ void DynamicTerrain::ComputeNormalsFromMapToRef(const Float32Array& mapData, uns
   auto tmp2Normal = Vector3::Zero();
   unsigned int l  = mapSubX * (mapSubZ - 1);
   for (unsigned int i = 0; i < l; i++) {
+    // The cells of the last column would wrap to the next rows, past the end of the map for the
+    // last one: their vertices are on the seams, processed below
+    if ((i + 1) % mapSubX == 0) {
+      continue;
+    }
     stl_util::concat(mapIndices, {i + 1, i + mapSubX, i});
     stl_util::concat(mapIndices, {i + mapSubX, i + 1, i + mapSubX + 1});
   }
@@ -930,6 +957,11 @@ void DynamicTerrain::setPrecomputeNormalsFromMap(bool val)
   _precomputeNormalsFromMap = val;
 }
 
+size_t DynamicTerrain::rebuiltVertexCount() const
+{
+  return _rebuiltVertexCount;
+}
+
 void DynamicTerrain::updateVertex(DynamicTerrainVertex& /*vertex*/, unsigned int /*i*/,
                                   unsigned /*j*/)
 {
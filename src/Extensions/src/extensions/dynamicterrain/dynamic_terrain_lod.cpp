@@ -0,0 +1,57 @@
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_lod.h>
+
+#include <algorithm>
+
+namespace BABYLON {
+namespace Extensions {
+
+void DynamicTerrainAxisLOD::compute(unsigned int terrainSub, unsigned int LODValue,
+                                    const Uint32Array& LODLimits)
+{
+  lods.resize(terrainSub + 1);
+  steps.resize(terrainSub + 1);
+  unsigned int step = 0;
+  for (unsigned int i = 0; i <= terrainSub; ++i) {
+    // the outermost ring containing the vertex gives its LOD
+    unsigned int lod = LODValue;
+    for (unsigned int l = 0; l < LODLimits.size(); ++l) {
+      const unsigned int LODLimitDown = LODLimits[l];
+      const unsigned int LODLimitUp   = terrainSub - LODLimitDown - 1;
+      if (i < LODLimitDown || i > LODLimitUp) {
+        lod = l + 1 + LODValue;
+      }
+    }
+    lods[i]  = lod;
+    steps[i] = step;
+    step += lod;
+  }
+}
+
+void DynamicTerrainAxisLOD::computeSources(int64_t shift, std::vector<int64_t>& sources) const
+{
+  sources.resize(steps.size());
+  for (size_t i = 0; i < steps.size(); ++i) {
+    const auto step = static_cast<int64_t>(steps[i]) + shift;
+    sources[i]      = -1;
+    if (step < 0) {
+      continue;
+    }
+    const auto it = std::lower_bound(steps.begin(), steps.end(), static_cast<uint32_t>(step));
+    if (it != steps.end() && *it == static_cast<uint32_t>(step)) {
+      sources[i] = it - steps.begin();
+    }
+  }
+}
+
+bool DynamicTerrainAxisLOD::operator==(const DynamicTerrainAxisLOD& other) const
+{
+  return lods == other.lods && steps == other.steps;
+}
+
+bool DynamicTerrainAxisLOD::operator!=(const DynamicTerrainAxisLOD& other) const
+{
+  return !(operator==(other));
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -10,7 +10,7 @@ namespace ECS {
 namespace detail {
 
 BaseSystem::BaseSystem(const Filter& filter)
-    : m_world(nullptr), m_filter(filter)
+    : m_world(nullptr), m_filter(filter), m_exclusive(true)
 {
 }
 
@@ -32,6 +32,35 @@ const std::vector<Entity>& BaseSystem::getEntities() const
   return m_entities;
 }
 
+const ComponentTypeList& BaseSystem::getReadComponents() const
+{
+  return m_reads;
+}
+
+const ComponentTypeList& BaseSystem::getWriteComponents() const
+{
+  return m_writes;
+}
+
+bool BaseSystem::isExclusive() const
+{
+  return m_exclusive;
+}
+
+bool BaseSystem::conflictsWith(const BaseSystem& other) const
+{
+  if (m_exclusive || other.m_exclusive)
+    return true;
+
+  return (m_writes & (other.m_reads | other.m_writes)).any()
+         || (other.m_writes & m_reads).any();
+}
+
+void BaseSystem::setExclusive(bool exclusive)
+{
+  m_exclusive = exclusive;
+}
+
 void BaseSystem::add(Entity& entity)
 {
   m_entities.push_back(entity);
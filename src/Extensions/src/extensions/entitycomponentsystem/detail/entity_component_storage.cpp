@@ -9,21 +9,35 @@ namespace ECS {
 namespace detail {
 
 EntityComponentStorage::EntityComponentStorage(std::size_t entityAmount)
-    : m_componentEntries(entityAmount)
+    : m_componentTypeLists(entityAmount)
 {
 }
 
-void EntityComponentStorage::addComponent(Entity& entity, Component* component,
-                                          TypeId componentTypeId)
+BaseComponentPool& EntityComponentStorage::getComponentPool(TypeId componentTypeId,
+                                                            ComponentPoolFactory factory)
+{
+  ANAX_ASSERT(componentTypeId < MAX_AMOUNT_OF_COMPONENTS, "too many component types");
+
+  util::EnsureCapacity(m_componentPools, componentTypeId);
+  auto& pool = m_componentPools[componentTypeId];
+  if (!pool) {
+    pool = factory();
+  }
+  return *pool;
+}
+
+BaseComponentPool* EntityComponentStorage::getComponentPool(TypeId componentTypeId) const
+{
+  return componentTypeId < m_componentPools.size() ? m_componentPools[componentTypeId].get() :
+                                                     nullptr;
+}
+
+void EntityComponentStorage::onComponentAdded(const Entity& entity, TypeId componentTypeId)
 {
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot have components added to it");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset(component);
-  componentDataForEntity.componentTypeList[componentTypeId] = true;
+  m_componentTypeLists[entity.getId().index][componentTypeId] = true;
 }
 
 void EntityComponentStorage::removeComponent(Entity& entity,
@@ -31,21 +45,24 @@ void EntityComponentStorage::removeComponent(Entity& entity,
 {
   ANAX_ASSERT(entity.isValid(), "invalid entity cannot remove components");
 
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  componentDataForEntity.components[componentTypeId].reset();
-  componentDataForEntity.componentTypeList[componentTypeId] = false;
+  auto index = entity.getId().index;
+  if (auto pool = getComponentPool(componentTypeId)) {
+    pool->remove(index);
+  }
+  m_componentTypeLists[index][componentTypeId] = false;
 }
 
 void EntityComponentStorage::removeAllComponents(Entity& entity)
 {
-  auto index                   = entity.getId().index;
-  auto& componentDataForEntity = m_componentEntries[index];
-
-  for (auto& c : componentDataForEntity.components)
-    c.reset();
-  componentDataForEntity.componentTypeList.reset();
+  auto index              = entity.getId().index;
+  auto& componentTypeList = m_componentTypeLists[index];
+
+  for (TypeId typeId = 0; typeId < m_componentPools.size(); ++typeId) {
+    if (componentTypeList[typeId]) {
+      m_componentPools[typeId]->remove(index);
+    }
+  }
+  componentTypeList.reset();
 }
 
 Component& EntityComponentStorage::getComponent(const Entity& entity,
@@ -54,7 +71,7 @@ Component& EntityComponentStorage::getComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid() && hasComponent(entity, componentTypeId),
               "Entity is not valid or does not contain component");
 
-  return *getComponentsImpl(entity)[componentTypeId];
+  return *m_componentPools[componentTypeId]->get(entity.getId().index);
 }
 
 ComponentTypeList
@@ -63,7 +80,7 @@ EntityComponentStorage::getComponentTypeList(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve the component list");
 
-  return m_componentEntries[entity.getId().index].componentTypeList;
+  return m_componentTypeLists[entity.getId().index];
 }
 
 ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
@@ -71,13 +88,13 @@ ComponentArray EntityComponentStorage::getComponents(const Entity& entity) const
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot retrieve components, as it has none");
 
-  auto& componentsToConvert = getComponentsImpl(entity);
+  auto index = entity.getId().index;
 
   ComponentArray temp;
-  temp.reserve(componentsToConvert.size());
+  temp.reserve(m_componentPools.size());
 
-  for (auto& i : componentsToConvert)
-    temp.emplace_back(i.get());
+  for (auto& pool : m_componentPools)
+    temp.emplace_back(pool ? pool->get(index) : nullptr);
 
   return temp;
 }
@@ -88,32 +105,20 @@ bool EntityComponentStorage::hasComponent(const Entity& entity,
   ANAX_ASSERT(entity.isValid(),
               "invalid entity cannot check if it has components");
 
-  auto& components = getComponentsImpl(entity);
+  auto pool = getComponentPool(componentTypeId);
 
-  return components.size() > componentTypeId
-         && components[componentTypeId] != nullptr;
+  return pool != nullptr && pool->has(entity.getId().index);
 }
 
 void EntityComponentStorage::resize(std::size_t entityAmount)
 {
-  m_componentEntries.resize(entityAmount);
+  m_componentTypeLists.resize(entityAmount);
 }
 
 void EntityComponentStorage::clear()
 {
-  m_componentEntries.clear();
-}
-
-EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e)
-{
-  return m_componentEntries[e.getId().index].components;
-}
-
-const EntityComponentStorage::ImplComponentArray&
-EntityComponentStorage::getComponentsImpl(const Entity& e) const
-{
-  return m_componentEntries[e.getId().index].components;
+  m_componentPools.clear();
+  m_componentTypeLists.clear();
 }
 
 } // end of namespace detail
@@ -77,10 +77,16 @@ bool Entity::operator==(const Entity& entity) const
   return m_id == entity.m_id && entity.m_world == m_world;
 }
 
-void Entity::addComponent(Component* component, detail::TypeId componentTypeId)
+detail::BaseComponentPool& Entity::getComponentPool(detail::TypeId componentTypeId,
+                                                    detail::ComponentPoolFactory factory)
 {
-  getWorld().m_entityAttributes.componentStorage.addComponent(*this, component,
-                                                              componentTypeId);
+  return getWorld().m_entityAttributes.componentStorage.getComponentPool(componentTypeId,
+                                                                         factory);
+}
+
+void Entity::onComponentAdded(detail::TypeId componentTypeId)
+{
+  getWorld().m_entityAttributes.componentStorage.onComponentAdded(*this, componentTypeId);
 }
 
 void Entity::removeComponent(detail::TypeId componentTypeId)
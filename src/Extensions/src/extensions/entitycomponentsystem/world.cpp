@@ -28,6 +28,48 @@ World::World(std::size_t entityPoolSize)
 void World::removeAllSystems()
 {
   m_systems.clear();
+  m_systemOrder.clear();
+  m_systemScheduleDirty = true;
+}
+
+void World::update(ThreadPool& threadPool)
+{
+  for (const auto& step : getSystemSchedule()) {
+    if (step.size() == 1) {
+      step.front()->update();
+      continue;
+    }
+    threadPool.parallelFor(0, step.size(), 1, [&step](std::size_t begin, std::size_t end) {
+      for (auto i = begin; i < end; ++i) {
+        step[i]->update();
+      }
+    });
+  }
+}
+
+const std::vector<std::vector<detail::BaseSystem*>>& World::getSystemSchedule()
+{
+  if (!m_systemScheduleDirty)
+    return m_systemSchedule;
+
+  // each system runs in the step following the last system it conflicts with
+  // among the ones added before it
+  m_systemSchedule.clear();
+  std::vector<std::size_t> systemSteps(m_systemOrder.size());
+  for (std::size_t i = 0; i < m_systemOrder.size(); ++i) {
+    std::size_t step = 0;
+    for (std::size_t j = 0; j < i; ++j) {
+      if (m_systemOrder[i]->conflictsWith(*m_systemOrder[j])) {
+        step = std::max(step, systemSteps[j] + 1);
+      }
+    }
+    systemSteps[i] = step;
+    util::EnsureCapacity(m_systemSchedule, step);
+    m_systemSchedule[step].emplace_back(m_systemOrder[i]);
+  }
+
+  m_systemScheduleDirty = false;
+  return m_systemSchedule;
 }
 
 Entity World::createEntity()
@@ -214,6 +256,8 @@ void World::addSystem(detail::BaseSystem& system, detail::TypeId systemTypeId)
               "System of this type is already contained within the world");
 
   m_systems[systemTypeId].reset(&system);
+  m_systemOrder.emplace_back(&system);
+  m_systemScheduleDirty = true;
 
   system.m_world = this;
   system.initialize();
@@ -222,6 +266,10 @@ void World::addSystem(detail::BaseSystem& system, detail::TypeId systemTypeId)
 void World::removeSystem(detail::TypeId systemTypeId)
 {
   ANAX_ASSERT(doesSystemExist(systemTypeId), "System does not exist in world");
+  auto system = m_systems[systemTypeId].get();
+  m_systemOrder.erase(std::remove(m_systemOrder.begin(), m_systemOrder.end(), system),
+                      m_systemOrder.end());
+  m_systemScheduleDirty = true;
   m_systems.erase(systemTypeId);
 }
 
@@ -1,5 +1,6 @@
 #include <babylon/extensions/navigation/crowd_agent.h>
 
+#include <babylon/extensions/navigation/crowd_flow_field.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
 namespace BABYLON {
@@ -7,7 +8,9 @@ namespace Extensions {
 
 CrowdAgent::CrowdAgent(RVO2::RVOSimulator* sim,
                        const BABYLON::Vector2& position)
-    : _goal{RVO2::Vector2(0.f, 0.f)}, _sim{sim}
+    : _goal{RVO2::Vector2(0.f, 0.f)}
+    , _sim{sim}
+    , _roadmap{std::make_shared<std::vector<CrowdRoadmapVertex>>()}
 {
   _id = _sim->addAgent(RVO2::Vector2(position.x, position.y));
 }
@@ -61,32 +64,62 @@ void CrowdAgent::setAgentPrefVelocity(const RVO2::Vector2& goalVector)
 
 bool CrowdAgent::hasRoadMap() const
 {
-  return _roadmap.size() > 1;
+  return _roadmap->size() > 1;
 }
 
 std::vector<CrowdRoadmapVertex>& CrowdAgent::roadmap()
 {
-  return _roadmap;
+  return *_roadmap;
 }
 
 const std::vector<CrowdRoadmapVertex>& CrowdAgent::roadmap() const
+{
+  return *_roadmap;
+}
+
+const std::shared_ptr<std::vector<CrowdRoadmapVertex>>& CrowdAgent::sharedRoadMap() const
 {
   return _roadmap;
 }
 
+void CrowdAgent::setRoadMap(const std::shared_ptr<std::vector<CrowdRoadmapVertex>>& roadmap)
+{
+  _roadmap = roadmap;
+}
+
 void CrowdAgent::addWayPoint(const BABYLON::Vector2& wayPoint)
 {
-  if (_roadmap.empty()) {
+  if (_roadmap.use_count() > 1) {
+    // Stop sharing the roadmap of other agents
+    _roadmap = std::make_shared<std::vector<CrowdRoadmapVertex>>(*_roadmap);
+  }
+
+  if (_roadmap->empty()) {
     // Add the goal positions of the agent
     CrowdRoadmapVertex p;
     p.position = _goal;
-    _roadmap.emplace_back(p);
+    _roadmap->emplace_back(p);
   }
 
   // Add waypoint to the roadmap vertices
   CrowdRoadmapVertex p;
   p.position = RVO2::Vector2(wayPoint.x, wayPoint.y);
-  _roadmap.emplace_back(p);
+  _roadmap->emplace_back(p);
+}
+
+bool CrowdAgent::hasFlowField() const
+{
+  return _flowField != nullptr;
+}
+
+const CrowdFlowField& CrowdAgent::flowField() const
+{
+  return *_flowField;
+}
+
+void CrowdAgent::setFlowField(const std::shared_ptr<const CrowdFlowField>& flowField)
+{
+  _flowField = flowField;
 }
 
 void CrowdAgent::setAgentMaxNeighbors(size_t neighborsMax)
@@ -1,5 +1,7 @@
 #include <babylon/extensions/navigation/crowd_collision_avoidance_system.h>
 
+#include <babylon/extensions/entitycomponentsystem/world.h>
+#include <babylon/extensions/navigation/crowd_flow_field.h>
 #include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
@@ -10,6 +12,8 @@ CrowdCollisionAvoidanceSystem::CrowdCollisionAvoidanceSystem(
   RVO2::RVOSimulator* sim)
     : _sim{sim}
 {
+  // The simulator state is accessed through the agents
+  writes<CrowdAgent>();
 }
 
 CrowdCollisionAvoidanceSystem::~CrowdCollisionAvoidanceSystem() = default;
@@ -26,10 +30,14 @@ void CrowdCollisionAvoidanceSystem::update()
 
 void CrowdCollisionAvoidanceSystem::setPreferredVelocities()
 {
-  const auto& entities = getEntities();
-  for (auto& entity : entities) {
-    auto agent = entity.getComponent<CrowdAgent>();
-    if (!agent.hasRoadMap()) {
+  getWorld().forEach<CrowdAgent>([this](ECS::Entity& /*entity*/, CrowdAgent& agent) {
+    RVO2::Vector2 direction;
+    if (agent.hasFlowField() && agent.flowField().getDirection(agent.position(), direction)
+        && RVO2::absSq(direction) > 0.f) {
+      // Follow the flow field of the goal until reaching the cell of the goal
+      agent.setAgentPrefVelocity(direction);
+    }
+    else if (!agent.hasRoadMap()) {
       // Set the preferred velocity to be a vector of unit magnitude (speed) in
       // the direction of the goal
       auto goalVector = agent.goal() - agent.position();
@@ -91,7 +99,7 @@ void CrowdCollisionAvoidanceSystem::setPreferredVelocities()
         agent.getAgentPrefVelocity()
         + dist * RVO2::Vector2(std::cos(angle), std::sin(angle)));
     }
-  }
+  });
 }
 
 } // end of namespace Extensions
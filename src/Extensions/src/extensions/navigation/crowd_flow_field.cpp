@@ -0,0 +1,172 @@
+#include <babylon/extensions/navigation/crowd_flow_field.h>
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <queue>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace BABYLON {
+namespace Extensions {
+
+namespace {
+
+constexpr float INFINITE_DISTANCE = std::numeric_limits<float>::infinity();
+
+// Offsets of the 8 neighbors of a cell, the opposite of neighbor k being k ^ 1
+constexpr int NEIGHBOR_OFFSETS[8][2]
+  = {{1, 0}, {-1, 0}, {0, 1}, {0, -1}, {1, 1}, {-1, -1}, {1, -1}, {-1, 1}};
+
+} // end of anonymous namespace
+
+CrowdFlowField::CrowdFlowField(const RVO2::Vector2& min, const RVO2::Vector2& max,
+                               float cellSize)
+    : _min{min}
+    , _cellSize{cellSize}
+    , _width{std::max<size_t>(1, static_cast<size_t>(std::ceil((max.x() - min.x()) / cellSize)))}
+    , _height{std::max<size_t>(1, static_cast<size_t>(std::ceil((max.y() - min.y()) / cellSize)))}
+    , _distances(_width * _height, INFINITE_DISTANCE)
+    , _directions(_width * _height)
+{
+}
+
+CrowdFlowField::~CrowdFlowField() = default;
+
+bool CrowdFlowField::compute(const RVO2::RVOSimulator& sim, const RVO2::Vector2& goal,
+                             float agentRadius)
+{
+  _goal = goal;
+  std::fill(_distances.begin(), _distances.end(), INFINITE_DISTANCE);
+  std::fill(_directions.begin(), _directions.end(), RVO2::Vector2());
+
+  size_t goalCell = 0;
+  if (!cellIndex(goal, goalCell)) {
+    return false;
+  }
+
+  // Moves from each cell to its neighbors not blocked by an obstacle, one bit per neighbor. The
+  // visibility queries are independent, and directional as obstacles are one-sided.
+  std::vector<uint8_t> moves(_distances.size(), 0);
+  sim.getThreadPool().parallelFor(0, _height, 1, [&](size_t begin, size_t end) {
+    for (size_t y = begin; y < end; ++y) {
+      for (size_t x = 0; x < _width; ++x) {
+        const auto center = cellCenter(x, y);
+        auto& cellMoves   = moves[y * _width + x];
+        for (unsigned int k = 0; k < 8; ++k) {
+          const auto nx = static_cast<int64_t>(x) + NEIGHBOR_OFFSETS[k][0];
+          const auto ny = static_cast<int64_t>(y) + NEIGHBOR_OFFSETS[k][1];
+          if (nx < 0 || ny < 0 || nx >= static_cast<int64_t>(_width)
+              || ny >= static_cast<int64_t>(_height)) {
+            continue;
+          }
+          const auto neighborCenter
+            = cellCenter(static_cast<size_t>(nx), static_cast<size_t>(ny));
+          if (sim.queryVisibility(center, neighborCenter, agentRadius)) {
+            cellMoves = static_cast<uint8_t>(cellMoves | (1u << k));
+          }
+        }
+      }
+    }
+  });
+
+  // Dijkstra's algorithm from the goal, following the moves backwards
+  using QueueEntry = std::pair<float, size_t>;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+  const auto goalCenter = cellCenter(goalCell % _width, goalCell / _width);
+  _distances[goalCell]  = RVO2::abs(goal - goalCenter);
+  queue.emplace(_distances[goalCell], goalCell);
+
+  while (!queue.empty()) {
+    const auto [distance, cell] = queue.top();
+    queue.pop();
+    if (distance > _distances[cell]) {
+      // Outdated entry
+      continue;
+    }
+
+    const auto x = static_cast<int64_t>(cell % _width);
+    const auto y = static_cast<int64_t>(cell / _width);
+    for (unsigned int k = 0; k < 8; ++k) {
+      const auto nx = x + NEIGHBOR_OFFSETS[k][0];
+      const auto ny = y + NEIGHBOR_OFFSETS[k][1];
+      if (nx < 0 || ny < 0 || nx >= static_cast<int64_t>(_width)
+          || ny >= static_cast<int64_t>(_height)) {
+        continue;
+      }
+
+      // Move from the neighbor back to this cell
+      const auto neighbor = static_cast<size_t>(ny) * _width + static_cast<size_t>(nx);
+      if ((moves[neighbor] & (1u << (k ^ 1))) == 0) {
+        continue;
+      }
+
+      const float step = (k < 4 ? 1.f : std::sqrt(2.f)) * _cellSize;
+      if (distance + step < _distances[neighbor]) {
+        _distances[neighbor] = distance + step;
+        _directions[neighbor]
+          = RVO2::normalize(RVO2::Vector2(static_cast<float>(-NEIGHBOR_OFFSETS[k][0]),
+                                          static_cast<float>(-NEIGHBOR_OFFSETS[k][1])));
+        queue.emplace(_distances[neighbor], neighbor);
+      }
+    }
+  }
+
+  return true;
+}
+
+bool CrowdFlowField::getDirection(const RVO2::Vector2& position, RVO2::Vector2& direction) const
+{
+  size_t index = 0;
+  if (!cellIndex(position, index) || _distances[index] == INFINITE_DISTANCE) {
+    return false;
+  }
+
+  direction = _directions[index];
+  return true;
+}
+
+float CrowdFlowField::getDistanceToGoal(const RVO2::Vector2& position) const
+{
+  size_t index = 0;
+  return cellIndex(position, index) ? _distances[index] : INFINITE_DISTANCE;
+}
+
+const RVO2::Vector2& CrowdFlowField::goal() const
+{
+  return _goal;
+}
+
+size_t CrowdFlowField::width() const
+{
+  return _width;
+}
+
+size_t CrowdFlowField::height() const
+{
+  return _height;
+}
+
+bool CrowdFlowField::cellIndex(const RVO2::Vector2& position, size_t& index) const
+{
+  const float x = std::floor((position.x() - _min.x()) / _cellSize);
+  const float y = std::floor((position.y() - _min.y()) / _cellSize);
+  if (x < 0.f || y < 0.f || x >= static_cast<float>(_width) || y >= static_cast<float>(_height)) {
+    return false;
+  }
+
+  index = static_cast<size_t>(y) * _width + static_cast<size_t>(x);
+  return true;
+}
+
+RVO2::Vector2 CrowdFlowField::cellCenter(size_t x, size_t y) const
+{
+  return RVO2::Vector2(_min.x() + (static_cast<float>(x) + 0.5f) * _cellSize,
+                       _min.y() + (static_cast<float>(y) + 0.5f) * _cellSize);
+}
+
+} // end of namespace Extensions
+} // end of namespace BABYLON
@@ -1,24 +1,28 @@
 #include <babylon/extensions/navigation/crowd_mesh_updater_system.h>
 
+#include <babylon/extensions/entitycomponentsystem/world.h>
 #include <babylon/meshes/abstract_mesh.h>
 
 namespace BABYLON {
 namespace Extensions {
 
-CrowdMeshUpdaterSystem::CrowdMeshUpdaterSystem() = default;
+CrowdMeshUpdaterSystem::CrowdMeshUpdaterSystem()
+{
+  reads<CrowdAgent>();
+  writes<CrowdMesh>();
+}
 
 CrowdMeshUpdaterSystem::~CrowdMeshUpdaterSystem() = default;
 
 void CrowdMeshUpdaterSystem::update()
 {
-  auto entities = getEntities();
-  for (auto& entity : entities) {
-    auto crowdAgent              = entity.getComponent<CrowdAgent>();
-    auto crowdMesh               = entity.getComponent<CrowdMesh>();
-    const auto& position         = crowdAgent.position();
-    crowdMesh.mesh->position().x = position.x();
-    crowdMesh.mesh->position().z = position.y();
-  }
+  // Each agent moves its own mesh, the agents are processed in parallel
+  getWorld().parallelForEach<CrowdMesh, CrowdAgent>(
+    [](ECS::Entity& /*entity*/, CrowdMesh& crowdMesh, CrowdAgent& crowdAgent) {
+      const auto& position         = crowdAgent.position();
+      crowdMesh.mesh->position().x = position.x();
+      crowdMesh.mesh->position().z = position.y();
+    });
 }
 
 } // end of namespace Extensions
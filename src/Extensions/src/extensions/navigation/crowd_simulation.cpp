@@ -1,7 +1,13 @@
 #include <babylon/extensions/navigation/crowd_simulation.h>
 
+#include <functional>
+#include <map>
+#include <queue>
+
+#include <babylon/core/thread_pool.h>
 #include <babylon/culling/bounding_box.h>
 #include <babylon/culling/bounding_info.h>
+#include <babylon/extensions/navigation/crowd_flow_field.h>
 #include <babylon/extensions/navigation/crowd_roadmap_vertex.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 #include <babylon/meshes/abstract_mesh.h>
@@ -9,10 +15,71 @@
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+bool HaveSameVertices(const std::vector<CrowdRoadmapVertex>& roadmap1,
+                      const std::vector<CrowdRoadmapVertex>& roadmap2)
+{
+  return std::equal(roadmap1.begin(), roadmap1.end(), roadmap2.begin(), roadmap2.end(),
+                    [](const CrowdRoadmapVertex& vertex1, const CrowdRoadmapVertex& vertex2) {
+                      return vertex1.position == vertex2.position;
+                    });
+}
+
+// Connects the roadmap vertices visible from each other and computes the distance of each vertex
+// to the goal (the first vertex)
+void ComputeRoadMap(const RVO2::RVOSimulator& simulator, std::vector<CrowdRoadmapVertex>& roadmap,
+                    float agentRadius)
+{
+  // Connect the roadmap vertices by edges if mutually visible, each vertex being processed
+  // independently.
+  simulator.getThreadPool().parallelFor(0, roadmap.size(), 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      roadmap[i].neighbors.clear();
+      for (size_t j = 0; j < roadmap.size(); ++j) {
+        if (simulator.queryVisibility(roadmap[i].position, roadmap[j].position, agentRadius)) {
+          roadmap[i].neighbors.push_back(static_cast<uint32_t>(j));
+        }
+      }
+
+      // Initialize the distance to the goal vertex at infinity (9e9f).
+      roadmap[i].distToGoal.assign(1, 9e9f);
+    }
+  });
+
+  // Compute the distance to the goal for all vertices using Dijkstra's algorithm, with a binary
+  // heap where improved vertices are inserted again and outdated entries skipped.
+  using QueueEntry = std::pair<float, uint32_t>;
+  std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+
+  roadmap[0].distToGoal[0] = 0.0f;
+  queue.emplace(0.0f, 0);
+
+  while (!queue.empty()) {
+    const auto [distance, u] = queue.top();
+    queue.pop();
+    if (distance > roadmap[u].distToGoal[0]) {
+      continue;
+    }
+
+    for (const auto v : roadmap[u].neighbors) {
+      const float dist_uv = RVO2::abs(roadmap[v].position - roadmap[u].position);
+
+      if (roadmap[v].distToGoal[0] > distance + dist_uv) {
+        roadmap[v].distToGoal[0] = distance + dist_uv;
+        queue.emplace(roadmap[v].distToGoal[0], v);
+      }
+    }
+  }
+}
+
+} // end of anonymous namespace
+
 CrowdSimulation::CrowdSimulation()
     : _simulator{std::make_unique<RVO2::RVOSimulator>()}
     , _crowdCollisionAvoidanceSystem{
         CrowdCollisionAvoidanceSystem(_simulator.get())}
+    , _flowFieldCellSize{0.f}
 {
   initializeWorld();
   _simulator->setAgentDefaults(15.0f, 10, 5.0f, 5.0f, 2.0f, 2.0f);
@@ -119,64 +186,76 @@ void CrowdSimulation::addWayPoint(const BABYLON::Vector2& waypoint)
 
 void CrowdSimulation::computeRoadMap()
 {
+  // The roadmaps computed so far, with the agent radius they were computed for
+  std::vector<std::pair<float, std::shared_ptr<std::vector<CrowdRoadmapVertex>>>> roadmaps;
+
   for (auto& agent : _agents) {
+    auto& crowdAgent = agent.getComponent<CrowdAgent>();
+
     // Check if there is a roadmap configured
-    if (!agent.getComponent<CrowdAgent>().hasRoadMap()) {
+    if (!crowdAgent.hasRoadMap()) {
       continue;
     }
 
-    // Get the agent properties
-    auto& roadmap    = agent.getComponent<CrowdAgent>().roadmap();
-    auto agentRadius = agent.getComponent<CrowdAgent>().radius();
+    // Share the roadmap of an agent with the same properties
+    const auto agentRadius = crowdAgent.radius();
+    auto it = std::find_if(roadmaps.begin(), roadmaps.end(), [&](const auto& roadmap) {
+      return roadmap.first == agentRadius
+             && HaveSameVertices(*roadmap.second, crowdAgent.roadmap());
+    });
+    if (it != roadmaps.end()) {
+      crowdAgent.setRoadMap(it->second);
+      continue;
+    }
 
-    // Connect the roadmap vertices by edges if mutually visible.
-    for (size_t i = 0; i < roadmap.size(); ++i) {
-      for (size_t j = 0; j < roadmap.size(); ++j) {
-        if (_simulator->queryVisibility(roadmap[i].position,
-                                        roadmap[j].position, agentRadius)) {
-          roadmap[i].neighbors.push_back(static_cast<uint32_t>(j));
-        }
-      }
+    if (crowdAgent.sharedRoadMap().use_count() > 1) {
+      // Shared by a previous call, possibly with agents of another radius
+      crowdAgent.setRoadMap(
+        std::make_shared<std::vector<CrowdRoadmapVertex>>(crowdAgent.roadmap()));
+    }
+    ComputeRoadMap(*_simulator, crowdAgent.roadmap(), agentRadius);
+    roadmaps.emplace_back(agentRadius, crowdAgent.sharedRoadMap());
+  }
+}
 
-      // Initialize the distance to each of the four goal vertices at infinity
-      // (9e9f).
-      roadmap[i].distToGoal.resize(1, 9e9f);
+void CrowdSimulation::setFlowFieldGrid(const Vector2& min, const Vector2& max, float cellSize)
+{
+  _flowFieldMin      = min;
+  _flowFieldMax      = max;
+  _flowFieldCellSize = cellSize;
+}
+
+void CrowdSimulation::computeFlowFields()
+{
+  if (_flowFieldCellSize <= 0.f) {
+    return;
+  }
+
+  // Group the agents by goal
+  std::map<std::pair<float, float>, std::vector<CrowdAgent*>> agentsByGoal;
+  for (auto& agent : _agents) {
+    auto& crowdAgent = agent.getComponent<CrowdAgent>();
+    const auto& goal = crowdAgent.goal();
+    agentsByGoal[std::make_pair(goal.x(), goal.y())].emplace_back(&crowdAgent);
+  }
+
+  // One field per goal, for the largest agent heading to it
+  for (const auto& [goal, agents] : agentsByGoal) {
+    float agentRadius = 0.f;
+    for (const auto* agent : agents) {
+      agentRadius = std::max(agentRadius, agent->radius());
     }
 
-    // Compute the distance to each of the agent's goals (the first vertex)
-    // for all vertices using Dijkstra's algorithm.
-    const unsigned int i = 0;
-    {
-      std::multimap<float, unsigned int> Q;
-      std::vector<std::multimap<float, unsigned int>::iterator> posInQ(
-        roadmap.size(), Q.end());
-
-      roadmap[i].distToGoal[i] = 0.0f;
-      posInQ[i]                = Q.insert(std::make_pair(0.0f, i));
-
-      while (!Q.empty()) {
-        const auto u = Q.begin()->second;
-        Q.erase(Q.begin());
-        posInQ[u] = Q.end();
-
-        for (size_t j = 0; j < roadmap[u].neighbors.size(); ++j) {
-          const auto v = roadmap[u].neighbors[j];
-          const float dist_uv
-            = RVO2::abs(roadmap[v].position - roadmap[u].position);
-
-          if (roadmap[v].distToGoal[i] > roadmap[u].distToGoal[i] + dist_uv) {
-            roadmap[v].distToGoal[i] = roadmap[u].distToGoal[i] + dist_uv;
-
-            if (posInQ[v] == Q.end()) {
-              posInQ[v] = Q.insert(std::make_pair(roadmap[v].distToGoal[i], v));
-            }
-            else {
-              Q.erase(posInQ[v]);
-              posInQ[v] = Q.insert(std::make_pair(roadmap[v].distToGoal[i], v));
-            }
-          }
-        }
-      }
+    auto flowField = std::make_shared<CrowdFlowField>(
+      RVO2::Vector2(_flowFieldMin.x, _flowFieldMin.y),
+      RVO2::Vector2(_flowFieldMax.x, _flowFieldMax.y), _flowFieldCellSize);
+    if (!flowField->compute(*_simulator, RVO2::Vector2(goal.first, goal.second), agentRadius)) {
+      // Goal outside of the grid
+      flowField = nullptr;
+    }
+
+    for (auto* agent : agents) {
+      agent->setFlowField(flowField);
     }
   }
 }
@@ -237,8 +316,7 @@ void CrowdSimulation::update()
 {
   _world.refresh();
   // if (isRunning()) {
-  _crowdCollisionAvoidanceSystem.update();
-  _crowdMeshUpdaterSystem.update();
+  _world.update();
   //}
 }
 
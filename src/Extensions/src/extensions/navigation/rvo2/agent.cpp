@@ -436,29 +436,23 @@ void Agent::computeNewVelocity()
   }
 }
 
-void Agent::insertAgentNeighbor(const Agent* agent, float& rangeSq)
+void Agent::insertAgentNeighbor(const Agent* agent, float distSq, float& rangeSq)
 {
-  if (this != agent) {
-    const float distSq = absSq(position_ - agent->position_);
-
-    if (distSq < rangeSq) {
-      if (agentNeighbors_.size() < maxNeighbors_) {
-        agentNeighbors_.push_back(std::make_pair(distSq, agent));
-      }
+  if (agentNeighbors_.size() < maxNeighbors_) {
+    agentNeighbors_.push_back(std::make_pair(distSq, agent));
+  }
 
-      size_t i = agentNeighbors_.size() - 1;
+  size_t i = agentNeighbors_.size() - 1;
 
-      while (i != 0 && distSq < agentNeighbors_[i - 1].first) {
-        agentNeighbors_[i] = agentNeighbors_[i - 1];
-        --i;
-      }
+  while (i != 0 && distSq < agentNeighbors_[i - 1].first) {
+    agentNeighbors_[i] = agentNeighbors_[i - 1];
+    --i;
+  }
 
-      agentNeighbors_[i] = std::make_pair(distSq, agent);
+  agentNeighbors_[i] = std::make_pair(distSq, agent);
 
-      if (agentNeighbors_.size() == maxNeighbors_) {
-        rangeSq = agentNeighbors_.back().first;
-      }
-    }
+  if (agentNeighbors_.size() == maxNeighbors_) {
+    rangeSq = agentNeighbors_.back().first;
   }
 }
 
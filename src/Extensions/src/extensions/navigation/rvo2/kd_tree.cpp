@@ -32,6 +32,7 @@
 
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 
+#include <babylon/core/thread_pool.h>
 #include <babylon/extensions/navigation/rvo2/agent.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
@@ -49,7 +50,7 @@ KdTree::~KdTree()
   deleteObstacleTree(obstacleTree_);
 }
 
-void KdTree::buildAgentTree()
+void KdTree::buildAgentTree(ThreadPool& threadPool)
 {
   if (agents_.size() < sim_->agents_.size()) {
     for (size_t i = agents_.size(); i < sim_->agents_.size(); ++i) {
@@ -57,59 +58,66 @@ void KdTree::buildAgentTree()
     }
 
     agentTree_.resize(2 * agents_.size() - 1);
+    agentPositionsX_.resize(agents_.size());
+    agentPositionsY_.resize(agents_.size());
   }
 
   if (!agents_.empty()) {
-    buildAgentTreeRecursive(0, agents_.size(), 0);
+    for (size_t i = 0; i < agents_.size(); ++i) {
+      agentPositionsX_[i] = agents_[i]->position_.x();
+      agentPositionsY_[i] = agents_[i]->position_.y();
+    }
+
+    buildAgentTreeRecursive(0, agents_.size(), 0, &threadPool);
   }
 }
 
-void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
+void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node,
+                                     ThreadPool* threadPool)
 {
-  agentTree_[node].begin = begin;
-  agentTree_[node].end   = end;
-  agentTree_[node].minX = agentTree_[node].maxX = agents_[begin]->position_.x();
-  agentTree_[node].minY = agentTree_[node].maxY = agents_[begin]->position_.y();
+  auto& treeNode  = agentTree_[node];
+  const float* xs = agentPositionsX_.data();
+  const float* ys = agentPositionsY_.data();
+
+  float minX = xs[begin], maxX = xs[begin];
+  float minY = ys[begin], maxY = ys[begin];
 
   for (size_t i = begin + 1; i < end; ++i) {
-    agentTree_[node].maxX
-      = std::max(agentTree_[node].maxX, agents_[i]->position_.x());
-    agentTree_[node].minX
-      = std::min(agentTree_[node].minX, agents_[i]->position_.x());
-    agentTree_[node].maxY
-      = std::max(agentTree_[node].maxY, agents_[i]->position_.y());
-    agentTree_[node].minY
-      = std::min(agentTree_[node].minY, agents_[i]->position_.y());
+    maxX = std::max(maxX, xs[i]);
+    minX = std::min(minX, xs[i]);
+    maxY = std::max(maxY, ys[i]);
+    minY = std::min(minY, ys[i]);
   }
 
+  treeNode.begin = begin;
+  treeNode.end   = end;
+  treeNode.minX  = minX;
+  treeNode.maxX  = maxX;
+  treeNode.minY  = minY;
+  treeNode.maxY  = maxY;
+
   if (end - begin > MAX_LEAF_SIZE) {
     /* No leaf node. */
-    const bool isVertical = (agentTree_[node].maxX - agentTree_[node].minX
-                             > agentTree_[node].maxY - agentTree_[node].minY);
-    const float splitValue
-      = (isVertical ? 0.5f * (agentTree_[node].maxX + agentTree_[node].minX) :
-                      0.5f * (agentTree_[node].maxY + agentTree_[node].minY));
+    const bool isVertical = (maxX - minX > maxY - minY);
+    const float splitValue = (isVertical ? 0.5f * (maxX + minX) : 0.5f * (maxY + minY));
+    const float* keys      = isVertical ? xs : ys;
 
     size_t left  = begin;
     size_t right = end;
 
     while (left < right) {
-      while (left < right
-             && (isVertical ? agents_[left]->position_.x() :
-                              agents_[left]->position_.y())
-                  < splitValue) {
+      while (left < right && keys[left] < splitValue) {
         ++left;
       }
 
-      while (right > left
-             && (isVertical ? agents_[right - 1]->position_.x() :
-                              agents_[right - 1]->position_.y())
-                  >= splitValue) {
+      while (right > left && keys[right - 1] >= splitValue) {
         --right;
       }
 
       if (left < right) {
         std::swap(agents_[left], agents_[right - 1]);
+        std::swap(agentPositionsX_[left], agentPositionsX_[right - 1]);
+        std::swap(agentPositionsY_[left], agentPositionsY_[right - 1]);
         ++left;
         --right;
       }
@@ -120,11 +128,23 @@ void KdTree::buildAgentTreeRecursive(size_t begin, size_t end, size_t node)
       ++right;
     }
 
-    agentTree_[node].left  = node + 1;
-    agentTree_[node].right = node + 2 * (left - begin);
+    treeNode.left  = node + 1;
+    treeNode.right = node + 2 * (left - begin);
 
-    buildAgentTreeRecursive(begin, left, agentTree_[node].left);
-    buildAgentTreeRecursive(left, end, agentTree_[node].right);
+    /* The subtrees cover disjoint agent ranges and tree nodes. */
+    if (threadPool != nullptr && std::min(left - begin, end - left) >= PARALLEL_BUILD_SIZE) {
+      const size_t bounds[] = {begin, left, end};
+      const size_t nodes[]  = {treeNode.left, treeNode.right};
+      threadPool->parallelFor(0, 2, 1, [&](size_t first, size_t last) {
+        for (size_t i = first; i < last; ++i) {
+          buildAgentTreeRecursive(bounds[i], bounds[i + 1], nodes[i], threadPool);
+        }
+      });
+    }
+    else {
+      buildAgentTreeRecursive(begin, left, treeNode.left, nullptr);
+      buildAgentTreeRecursive(left, end, treeNode.right, nullptr);
+    }
   }
 }
 
@@ -299,8 +319,15 @@ void KdTree::queryAgentTreeRecursive(Agent* agent, float& rangeSq,
                                      size_t node) const
 {
   if (agentTree_[node].end - agentTree_[node].begin <= MAX_LEAF_SIZE) {
+    const float x = agent->position_.x();
+    const float y = agent->position_.y();
+
     for (size_t i = agentTree_[node].begin; i < agentTree_[node].end; ++i) {
-      agent->insertAgentNeighbor(agents_[i], rangeSq);
+      const float distSq = sqr(x - agentPositionsX_[i]) + sqr(y - agentPositionsY_[i]);
+
+      if (distSq < rangeSq && agents_[i] != agent) {
+        agent->insertAgentNeighbor(agents_[i], distSq, rangeSq);
+      }
     }
   }
   else {
@@ -32,14 +32,11 @@
 
 #include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
 
+#include <babylon/core/thread_pool.h>
 #include <babylon/extensions/navigation/rvo2/agent.h>
 #include <babylon/extensions/navigation/rvo2/kd_tree.h>
 #include <babylon/extensions/navigation/rvo2/obstacle.h>
 
-#ifdef _OPENMP
-#include <omp.h>
-#endif
-
 namespace BABYLON {
 namespace Extensions {
 namespace RVO2 {
@@ -175,22 +172,23 @@ size_t RVOSimulator::addObstacle(const std::vector<Vector2>& vertices)
 
 void RVOSimulator::doStep()
 {
-  kdTree_->buildAgentTree();
+  auto& threadPool = getThreadPool();
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (auto& agent : agents_) {
-    agent->computeNeighbors();
-    agent->computeNewVelocity();
-  }
+  kdTree_->buildAgentTree(threadPool);
 
-#ifdef _OPENMP
-#pragma omp parallel for
-#endif
-  for (auto& agent : agents_) {
-    agent->update();
-  }
+  /* Each agent only writes its own neighbors and new velocity. */
+  threadPool.parallelFor(0, agents_.size(), AGENT_GRAIN_SIZE, [this](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      agents_[i]->computeNeighbors();
+      agents_[i]->computeNewVelocity();
+    }
+  });
+
+  threadPool.parallelFor(0, agents_.size(), AGENT_GRAIN_SIZE, [this](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      agents_[i]->update();
+    }
+  });
 
   globalTime_ += timeStep_;
 }
@@ -307,6 +305,11 @@ float RVOSimulator::getTimeStep() const
   return timeStep_;
 }
 
+ThreadPool& RVOSimulator::getThreadPool() const
+{
+  return threadPool_ != nullptr ? *threadPool_ : ThreadPool::Default();
+}
+
 void RVOSimulator::processObstacles()
 {
   kdTree_->buildObstacleTree();
@@ -388,6 +391,11 @@ void RVOSimulator::setTimeStep(float timeStep)
   timeStep_ = timeStep;
 }
 
+void RVOSimulator::setThreadPool(ThreadPool* threadPool)
+{
+  threadPool_ = threadPool;
+}
+
 } // end of namespace RVO2
 } // end of namespace Extensions
 } // end of namespace BABYLON
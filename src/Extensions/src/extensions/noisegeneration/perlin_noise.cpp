@@ -4,9 +4,92 @@
 #include <numeric>
 #include <random>
 
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
+
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+using detail::NoiseLanes;
+
+// PerlinNoise::noise(x, y, z) at NoiseLanes points, each step running on all the lanes
+struct PerlinNoiseLanes {
+  const std::array<int, 512>& p;
+
+  void operator()(const double (&coordinates)[3][NoiseLanes], double (&values)[NoiseLanes]) const;
+}; // end of struct PerlinNoiseLanes
+
+void PerlinNoiseLanes::operator()(const double (&coordinates)[3][NoiseLanes],
+                                  double (&values)[NoiseLanes]) const
+{
+  int32_t X[NoiseLanes], Y[NoiseLanes], Z[NoiseLanes];
+  double x[NoiseLanes], y[NoiseLanes], z[NoiseLanes];
+  double u[NoiseLanes], v[NoiseLanes], w[NoiseLanes];
+  for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+    const auto fx = std::floor(coordinates[0][lane]);
+    const auto fy = std::floor(coordinates[1][lane]);
+    const auto fz = std::floor(coordinates[2][lane]);
+    X[lane]       = static_cast<int32_t>(fx) & 255;
+    Y[lane]       = static_cast<int32_t>(fy) & 255;
+    Z[lane]       = static_cast<int32_t>(fz) & 255;
+    x[lane]       = coordinates[0][lane] - fx;
+    y[lane]       = coordinates[1][lane] - fy;
+    z[lane]       = coordinates[2][lane] - fz;
+    u[lane]       = fade(x[lane]);
+    v[lane]       = fade(y[lane]);
+    w[lane]       = fade(z[lane]);
+  }
+
+  // Hash coordinates of the 8 cube corners, the only scalar step
+  int hashes[8][NoiseLanes];
+  for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+    const auto A  = p[static_cast<unsigned>(X[lane])] + Y[lane];
+    const auto AA = p[static_cast<unsigned>(A)] + Z[lane];
+    const auto AB = p[static_cast<unsigned>(A + 1)] + Z[lane];
+    const auto B  = p[static_cast<unsigned>(X[lane] + 1)] + Y[lane];
+    const auto BA = p[static_cast<unsigned>(B)] + Z[lane];
+    const auto BB = p[static_cast<unsigned>(B + 1)] + Z[lane];
+
+    hashes[0][lane] = p[static_cast<unsigned>(AA)];
+    hashes[1][lane] = p[static_cast<unsigned>(BA)];
+    hashes[2][lane] = p[static_cast<unsigned>(AB)];
+    hashes[3][lane] = p[static_cast<unsigned>(BB)];
+    hashes[4][lane] = p[static_cast<unsigned>(AA + 1)];
+    hashes[5][lane] = p[static_cast<unsigned>(BA + 1)];
+    hashes[6][lane] = p[static_cast<unsigned>(AB + 1)];
+    hashes[7][lane] = p[static_cast<unsigned>(BB + 1)];
+  }
+
+  // Add blended results from 8 corners of cube
+  for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+    const auto x0 = x[lane];
+    const auto y0 = y[lane];
+    const auto z0 = z[lane];
+    const auto g0 = grad(hashes[0][lane], x0, y0, z0);
+    const auto g1 = grad(hashes[1][lane], x0 - 1, y0, z0);
+    const auto g2 = grad(hashes[2][lane], x0, y0 - 1, z0);
+    const auto g3 = grad(hashes[3][lane], x0 - 1, y0 - 1, z0);
+    const auto g4 = grad(hashes[4][lane], x0, y0, z0 - 1);
+    const auto g5 = grad(hashes[5][lane], x0 - 1, y0, z0 - 1);
+    const auto g6 = grad(hashes[6][lane], x0, y0 - 1, z0 - 1);
+    const auto g7 = grad(hashes[7][lane], x0 - 1, y0 - 1, z0 - 1);
+    const auto a  = lerp(v[lane], lerp(u[lane], g0, g1), lerp(u[lane], g2, g3));
+    const auto b  = lerp(v[lane], lerp(u[lane], g4, g5), lerp(u[lane], g6, g7));
+    values[lane]  = lerp(w[lane], a, b);
+  }
+}
+
+// Octave stacking of PerlinNoiseOctave
+detail::NoiseOctaves<double> PerlinOctaves(int octaves)
+{
+  detail::NoiseOctaves<double> noiseOctaves;
+  noiseOctaves.octaves = octaves;
+  return noiseOctaves;
+}
+
+} // end of anonymous namespace
+
 // Initialize with the reference values for the permutation vector
 PerlinNoise::PerlinNoise()
 {
@@ -109,6 +192,33 @@ double PerlinNoise::noise(double x, double y, double z) const
   return lerp(w, a, b);
 }
 
+void PerlinNoise::noiseGrid(Float64Array& result, double x, double y, double z, double stepX,
+                            double stepY, size_t width, size_t height, int octaves,
+                            ThreadPool& threadPool) const
+{
+  result.resize(width * height);
+  const auto point = [&](size_t index, size_t lane, double (&coordinates)[3][NoiseLanes]) {
+    coordinates[0][lane] = x + static_cast<double>(index % width) * stepX;
+    coordinates[1][lane] = y + static_cast<double>(index / width) * stepY;
+    coordinates[2][lane] = z;
+  };
+  detail::FillNoise<double, 3>(result.data(), result.size(), detail::NoiseRowsGrain(width), point,
+                               PerlinNoiseLanes{p}, PerlinOctaves(octaves), threadPool);
+}
+
+void PerlinNoise::noise(const Float64Array& points, Float64Array& result, int octaves,
+                        ThreadPool& threadPool) const
+{
+  result.resize(points.size() / 3);
+  const auto point = [&](size_t index, size_t lane, double (&coordinates)[3][NoiseLanes]) {
+    coordinates[0][lane] = points[3 * index];
+    coordinates[1][lane] = points[3 * index + 1];
+    coordinates[2][lane] = points[3 * index + 2];
+  };
+  detail::FillNoise<double, 3>(result.data(), result.size(), detail::NoisePointsGrain, point,
+                               PerlinNoiseLanes{p}, PerlinOctaves(octaves), threadPool);
+}
+
 PerlinNoiseOctave::PerlinNoiseOctave(int octaves, uint32_t seed)
     : _perlinNoise{seed}, _octaves{octaves}
 {
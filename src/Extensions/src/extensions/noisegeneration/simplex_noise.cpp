@@ -2,6 +2,7 @@
 
 #include <random>
 
+#include <babylon/extensions/noisegeneration/noise_lanes.h>
 #include <babylon/maths/vector2.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/maths/vector4.h>
@@ -9,6 +10,226 @@
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+using detail::NoiseLanes;
+
+using Permutations = std::array<unsigned char, 512>;
+
+int FastFloor(float x)
+{
+  return (x > 0) ? static_cast<int>(x) : static_cast<int>(x) - 1;
+}
+
+float Grad(int hash, float x, float y)
+{
+  int h   = hash & 7;
+  float u = h < 4 ? x : y;
+  float v = h < 4 ? y : x;
+  return ((h & 1) ? -u : u) + ((h & 2) ? -2.0f * v : 2.0f * v);
+}
+
+float Grad(int hash, float x, float y, float z)
+{
+  int h   = hash & 15;
+  float u = h < 8 ? x : y;
+  float v = h < 4 ? y : h == 12 || h == 14 ? x : z;
+  return ((h & 1) ? -u : u) + ((h & 2) ? -v : v);
+}
+
+// Contribution of a simplex corner, t being the falloff at the corner
+float CornerContribution(float t, float grad)
+{
+  if (t < 0.0f) {
+    return 0.0f;
+  }
+  t *= t;
+  return t * t * grad;
+}
+
+/**
+ * SimplexNoise::noise(Vector2) at NoiseLanes points, each step running on all the lanes: the
+ * hashing of the corners is the only scalar step.
+ */
+struct SimplexNoise2DLanes {
+  const Permutations& perm;
+
+  void operator()(const float (&coordinates)[2][NoiseLanes], float (&values)[NoiseLanes]) const
+  {
+    constexpr float F2 = SimplexNoise::F2;
+    constexpr float G2 = SimplexNoise::G2;
+
+    int i[NoiseLanes], j[NoiseLanes];
+    unsigned int i1[NoiseLanes];
+    float x0[NoiseLanes], y0[NoiseLanes];
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      const auto x = coordinates[0][lane];
+      const auto y = coordinates[1][lane];
+      float s      = (x + y) * F2;
+      i[lane]      = FastFloor(x + s);
+      j[lane]      = FastFloor(y + s);
+      float t      = static_cast<float>(i[lane] + j[lane]) * G2;
+      x0[lane]     = x - (i[lane] - t);
+      y0[lane]     = y - (j[lane] - t);
+      i1[lane]     = x0[lane] > y0[lane] ? 1 : 0;
+    }
+
+    int hashes[3][NoiseLanes];
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      const unsigned int ii = i[lane] & 0xff;
+      const unsigned int jj = j[lane] & 0xff;
+      const unsigned int j1 = 1 - i1[lane];
+      hashes[0][lane]       = perm[ii + perm[jj]];
+      hashes[1][lane]       = perm[ii + i1[lane] + perm[jj + j1]];
+      hashes[2][lane]       = perm[ii + 1 + perm[jj + 1]];
+    }
+
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      const unsigned int j1 = 1 - i1[lane];
+      float x1              = x0[lane] - i1[lane] + G2;
+      float y1              = y0[lane] - j1 + G2;
+      float x2              = x0[lane] - 1.0f + 2.0f * G2;
+      float y2              = y0[lane] - 1.0f + 2.0f * G2;
+      float t0              = 0.5f - x0[lane] * x0[lane] - y0[lane] * y0[lane];
+      float t1              = 0.5f - x1 * x1 - y1 * y1;
+      float t2              = 0.5f - x2 * x2 - y2 * y2;
+
+      float n0 = CornerContribution(t0, Grad(hashes[0][lane], x0[lane], y0[lane]));
+      float n1 = CornerContribution(t1, Grad(hashes[1][lane], x1, y1));
+      float n2 = CornerContribution(t2, Grad(hashes[2][lane], x2, y2));
+
+      values[lane] = 40.0f * (n0 + n1 + n2);
+    }
+  }
+}; // end of struct SimplexNoise2DLanes
+
+/**
+ * SimplexNoise::noise(Vector3) at NoiseLanes points, each step running on all the lanes: the
+ * simplex is found without branches and the hashing of the corners is the only scalar step.
+ */
+struct SimplexNoise3DLanes {
+  const Permutations& perm;
+
+  void operator()(const float (&coordinates)[3][NoiseLanes], float (&values)[NoiseLanes]) const
+  {
+    constexpr float F3 = SimplexNoise::F3;
+    constexpr float G3 = SimplexNoise::G3;
+
+    int i[NoiseLanes], j[NoiseLanes], k[NoiseLanes];
+    unsigned int offsets1[3][NoiseLanes], offsets2[3][NoiseLanes];
+    float x0[NoiseLanes], y0[NoiseLanes], z0[NoiseLanes];
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      const auto x = coordinates[0][lane];
+      const auto y = coordinates[1][lane];
+      const auto z = coordinates[2][lane];
+      float s      = (x + y + z) * F3;
+      i[lane]      = FastFloor(x + s);
+      j[lane]      = FastFloor(y + s);
+      k[lane]      = FastFloor(z + s);
+      float t      = static_cast<float>(i[lane] + j[lane] + k[lane]) * G3;
+      x0[lane]     = x - (i[lane] - t);
+      y0[lane]     = y - (j[lane] - t);
+      z0[lane]     = z - (k[lane] - t);
+
+      // Offsets of the second and third corners, from the order of x0, y0 and z0
+      const bool xy     = x0[lane] >= y0[lane];
+      const bool yz     = y0[lane] >= z0[lane];
+      const bool xz     = x0[lane] >= z0[lane];
+      offsets1[0][lane] = xy && xz;
+      offsets1[1][lane] = !xy && yz;
+      offsets1[2][lane] = !yz && !(xy && xz);
+      offsets2[0][lane] = xy || xz;
+      offsets2[1][lane] = !xy || yz;
+      offsets2[2][lane] = !yz || (!xy && !xz);
+    }
+
+    int hashes[4][NoiseLanes];
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      const unsigned int ii = i[lane] & 0xff;
+      const unsigned int jj = j[lane] & 0xff;
+      const unsigned int kk = k[lane] & 0xff;
+      const auto i1 = offsets1[0][lane], j1 = offsets1[1][lane], k1 = offsets1[2][lane];
+      const auto i2 = offsets2[0][lane], j2 = offsets2[1][lane], k2 = offsets2[2][lane];
+
+      hashes[0][lane] = perm[ii + perm[jj + perm[kk]]];
+      hashes[1][lane] = perm[ii + i1 + perm[jj + j1 + perm[kk + k1]]];
+      hashes[2][lane] = perm[ii + i2 + perm[jj + j2 + perm[kk + k2]]];
+      hashes[3][lane] = perm[ii + 1 + perm[jj + 1 + perm[kk + 1]]];
+    }
+
+    for (size_t lane = 0; lane < NoiseLanes; ++lane) {
+      float x1 = x0[lane] - offsets1[0][lane] + G3;
+      float y1 = y0[lane] - offsets1[1][lane] + G3;
+      float z1 = z0[lane] - offsets1[2][lane] + G3;
+      float x2 = x0[lane] - offsets2[0][lane] + 2.0f * G3;
+      float y2 = y0[lane] - offsets2[1][lane] + 2.0f * G3;
+      float z2 = z0[lane] - offsets2[2][lane] + 2.0f * G3;
+      float x3 = x0[lane] - 1.0f + 3.0f * G3;
+      float y3 = y0[lane] - 1.0f + 3.0f * G3;
+      float z3 = z0[lane] - 1.0f + 3.0f * G3;
+      float t0 = 0.6f - x0[lane] * x0[lane] - y0[lane] * y0[lane] - z0[lane] * z0[lane];
+      float t1 = 0.6f - x1 * x1 - y1 * y1 - z1 * z1;
+      float t2 = 0.6f - x2 * x2 - y2 * y2 - z2 * z2;
+      float t3 = 0.6f - x3 * x3 - y3 * y3 - z3 * z3;
+
+      float n0 = CornerContribution(t0, Grad(hashes[0][lane], x0[lane], y0[lane], z0[lane]));
+      float n1 = CornerContribution(t1, Grad(hashes[1][lane], x1, y1, z1));
+      float n2 = CornerContribution(t2, Grad(hashes[2][lane], x2, y2, z2));
+      float n3 = CornerContribution(t3, Grad(hashes[3][lane], x3, y3, z3));
+
+      values[lane] = 32.0f * (n0 + n1 + n2 + n3);
+    }
+  }
+}; // end of struct SimplexNoise3DLanes
+
+detail::NoiseOctaves<float> SimplexOctaves(uint8_t octaves, float lacunarity, float gain)
+{
+  detail::NoiseOctaves<float> noiseOctaves;
+  noiseOctaves.octaves    = octaves;
+  noiseOctaves.amplitude  = 0.5f;
+  noiseOctaves.lacunarity = lacunarity;
+  noiseOctaves.gain       = gain;
+  return noiseOctaves;
+}
+
+detail::NoiseOctaves<float> SimplexRidgedOctaves(float ridgeOffset, uint8_t octaves,
+                                                 float lacunarity, float gain)
+{
+  auto noiseOctaves        = SimplexOctaves(octaves, lacunarity, gain);
+  noiseOctaves.ridged      = true;
+  noiseOctaves.ridgeOffset = ridgeOffset;
+  return noiseOctaves;
+}
+
+void FillGrid(const Permutations& perm, Float32Array& result, const Vector2& origin,
+              const Vector2& step, size_t width, size_t height,
+              const detail::NoiseOctaves<float>& octaves, ThreadPool& threadPool)
+{
+  result.resize(width * height);
+  const auto point = [&](size_t index, size_t lane, float (&coordinates)[2][NoiseLanes]) {
+    coordinates[0][lane] = origin.x + static_cast<float>(index % width) * step.x;
+    coordinates[1][lane] = origin.y + static_cast<float>(index / width) * step.y;
+  };
+  detail::FillNoise<float, 2>(result.data(), result.size(), detail::NoiseRowsGrain(width), point,
+                              SimplexNoise2DLanes{perm}, octaves, threadPool);
+}
+
+void FillPoints(const Permutations& perm, const std::vector<Vector3>& points,
+                Float32Array& result, const detail::NoiseOctaves<float>& octaves,
+                ThreadPool& threadPool)
+{
+  result.resize(points.size());
+  const auto point = [&](size_t index, size_t lane, float (&coordinates)[3][NoiseLanes]) {
+    coordinates[0][lane] = points[index].x;
+    coordinates[1][lane] = points[index].y;
+    coordinates[2][lane] = points[index].z;
+  };
+  detail::FillNoise<float, 3>(result.data(), result.size(), detail::NoisePointsGrain, point,
+                              SimplexNoise3DLanes{perm}, octaves, threadPool);
+}
+
+} // end of anonymous namespace
+
 std::array<std::array<float, 2>, 8> SimplexNoise::grad2lut{{{{-1.0f, -1.0f}},
                                                             {{1.0f, 0.0f}},
                                                             {{-1.0f, 0.0f}},
@@ -2080,6 +2301,50 @@ float SimplexNoise::iqfBm(const Vector3& v, uint8_t octaves, float lacunarity,
 
 // -----------------------------------------------------------------------------
 
+void SimplexNoise::noiseGrid(Float32Array& result, const Vector2& origin, const Vector2& step,
+                             size_t width, size_t height, ThreadPool& threadPool) const
+{
+  FillGrid(perm, result, origin, step, width, height, detail::NoiseOctaves<float>{}, threadPool);
+}
+
+void SimplexNoise::fBmGrid(Float32Array& result, const Vector2& origin, const Vector2& step,
+                           size_t width, size_t height, uint8_t octaves, float lacunarity,
+                           float gain, ThreadPool& threadPool) const
+{
+  FillGrid(perm, result, origin, step, width, height, SimplexOctaves(octaves, lacunarity, gain),
+           threadPool);
+}
+
+void SimplexNoise::ridgedMFGrid(Float32Array& result, const Vector2& origin, const Vector2& step,
+                                size_t width, size_t height, float ridgeOffset, uint8_t octaves,
+                                float lacunarity, float gain, ThreadPool& threadPool) const
+{
+  FillGrid(perm, result, origin, step, width, height,
+           SimplexRidgedOctaves(ridgeOffset, octaves, lacunarity, gain), threadPool);
+}
+
+void SimplexNoise::noise(const std::vector<Vector3>& points, Float32Array& result,
+                         ThreadPool& threadPool) const
+{
+  FillPoints(perm, points, result, detail::NoiseOctaves<float>{}, threadPool);
+}
+
+void SimplexNoise::fBm(const std::vector<Vector3>& points, Float32Array& result, uint8_t octaves,
+                       float lacunarity, float gain, ThreadPool& threadPool) const
+{
+  FillPoints(perm, points, result, SimplexOctaves(octaves, lacunarity, gain), threadPool);
+}
+
+void SimplexNoise::ridgedMF(const std::vector<Vector3>& points, Float32Array& result,
+                            float ridgeOffset, uint8_t octaves, float lacunarity, float gain,
+                            ThreadPool& threadPool) const
+{
+  FillPoints(perm, points, result, SimplexRidgedOctaves(ridgeOffset, octaves, lacunarity, gain),
+             threadPool);
+}
+
+// -----------------------------------------------------------------------------
+
 void SimplexNoise::seed(uint32_t s)
 {
   std::random_device rd;
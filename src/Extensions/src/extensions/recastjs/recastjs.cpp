@@ -1,11 +1,15 @@
 #include <babylon/extensions/recastjs/recastjs.h>
 
+#include "DetourCommon.h"
 #include "DetourNavMesh.h"
 #include "DetourNavMeshBuilder.h"
 #include "DetourNavMeshQuery.h"
+#include "DetourTileCache.h"
+#include "DetourTileCacheBuilder.h"
 #include "Recast.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cstring>
 #include <float.h>
 #include <iostream>
@@ -46,40 +50,252 @@ struct NavMeshintermediates {
     if (m_cset) {
       rcFreeContourSet(m_cset);
     }
+    if (m_lset) {
+      rcFreeHeightfieldLayerSet(m_lset);
+    }
+  }
+
+  rcHeightfield* m_solid        = nullptr;
+  rcCompactHeightfield* m_chf   = nullptr;
+  rcContourSet* m_cset          = nullptr;
+  rcHeightfieldLayerSet* m_lset = nullptr;
+};
+
+namespace {
+
+// Expected number of layers per tile, more for levels with many floors
+constexpr int EXPECTED_LAYERS_PER_TILE = 4;
+// Maximum number of layers per tile kept in the tile cache
+constexpr int MAX_LAYERS = 32;
+
+constexpr int NAVMESHSET_MAGIC   = 'M' << 24 | 'S' << 16 | 'E' << 8 | 'T';
+constexpr int TILECACHESET_MAGIC = 'T' << 24 | 'S' << 16 | 'E' << 8 | 'T';
+constexpr int NAVMESHSET_VERSION = 1;
+
+// Serialized navigation mesh made of the tiles of the Detour navigation mesh
+struct NavMeshSetHeader {
+  int magic;
+  int version;
+  int numTiles;
+  dtNavMeshParams params;
+};
+
+struct NavMeshTileHeader {
+  dtTileRef tileRef;
+  int dataSize;
+};
+
+// Serialized navigation mesh made of the compressed layers of the tile cache
+struct TileCacheSetHeader {
+  int magic;
+  int version;
+  int numTiles;
+  dtNavMeshParams meshParams;
+  dtTileCacheParams cacheParams;
+};
+
+struct TileCacheTileHeader {
+  dtCompressedTileRef tileRef;
+  int dataSize;
+};
+
+// FastLZ is not vendored: the tile cache layers are stored uncompressed
+struct TileCacheCompressor : public dtTileCacheCompressor {
+  int maxCompressedSize(const int bufferSize) override
+  {
+    return bufferSize;
+  }
+
+  dtStatus compress(const unsigned char* buffer, const int bufferSize, unsigned char* compressed,
+                    const int maxCompressedSize, int* compressedSize) override
+  {
+    if (bufferSize > maxCompressedSize) {
+      return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+    }
+    std::memcpy(compressed, buffer, static_cast<size_t>(bufferSize));
+    *compressedSize = bufferSize;
+    return DT_SUCCESS;
   }
 
-  rcHeightfield* m_solid      = nullptr;
-  rcCompactHeightfield* m_chf = nullptr;
-  rcContourSet* m_cset        = nullptr;
+  dtStatus decompress(const unsigned char* compressed, const int compressedSize,
+                      unsigned char* buffer, const int maxBufferSize, int* bufferSize) override
+  {
+    if (compressedSize > maxBufferSize) {
+      return DT_FAILURE | DT_BUFFER_TOO_SMALL;
+    }
+    std::memcpy(buffer, compressed, static_cast<size_t>(compressedSize));
+    *bufferSize = compressedSize;
+    return DT_SUCCESS;
+  }
 };
 
+// Same areas and flags as the polygons of the monolithic navigation mesh
+struct TileCacheMeshProcess : public dtTileCacheMeshProcess {
+  void process(dtNavMeshCreateParams* params, unsigned char* polyAreas,
+               unsigned short* polyFlags) override
+  {
+    for (int i = 0; i < params->polyCount; ++i) {
+      if (polyAreas[i] == DT_TILECACHE_WALKABLE_AREA) {
+        polyAreas[i] = 0;
+      }
+      if (polyAreas[i] == 0) {
+        polyFlags[i] = 1;
+      }
+    }
+  }
+};
+
+// Compressed tile cache layer built by a worker thread
+struct TileCacheData {
+  unsigned char* data = nullptr;
+  int dataSize        = 0;
+};
+
+rcConfig GetBuildConfig(const rcConfig& config)
+{
+  rcConfig cfg               = config;
+  cfg.walkableHeight         = config.walkableHeight;
+  cfg.walkableClimb          = config.walkableClimb;
+  cfg.walkableRadius         = config.walkableRadius;
+  cfg.maxEdgeLen             = config.maxEdgeLen;
+  cfg.maxSimplificationError = config.maxSimplificationError;
+  cfg.minRegionArea    = static_cast<int>(rcSqr(config.minRegionArea));   // Note: area = size*size
+  cfg.mergeRegionArea  = static_cast<int>(rcSqr(config.mergeRegionArea)); // Note: area = size*size
+  cfg.maxVertsPerPoly  = static_cast<int>(config.maxVertsPerPoly);
+  cfg.detailSampleDist = config.detailSampleDist < 0.9f ? 0 : config.cs * config.detailSampleDist;
+  cfg.detailSampleMaxError = config.ch * config.detailSampleMaxError;
+  return cfg;
+}
+
+// Rasterizes the triangles overlapping a tile and builds its compressed tile cache layers
+bool RasterizeTileLayers(const float* positions, const int positionCount, const int* tris,
+                         const std::vector<int>& tileTriangles, const rcConfig& cfg, int tx,
+                         int ty, std::vector<TileCacheData>& layers)
+{
+  rcContext ctx(false);
+  NavMeshintermediates intermediates;
+
+  rcConfig tcfg       = cfg;
+  const float tcs     = static_cast<float>(cfg.tileSize) * cfg.cs;
+  const float padding = static_cast<float>(cfg.borderSize) * cfg.cs;
+  tcfg.bmin[0]        = cfg.bmin[0] + static_cast<float>(tx) * tcs - padding;
+  tcfg.bmin[2]        = cfg.bmin[2] + static_cast<float>(ty) * tcs - padding;
+  tcfg.bmax[0]        = cfg.bmin[0] + static_cast<float>(tx + 1) * tcs + padding;
+  tcfg.bmax[2]        = cfg.bmin[2] + static_cast<float>(ty + 1) * tcs + padding;
+
+  intermediates.m_solid = rcAllocHeightfield();
+  if (!intermediates.m_solid
+      || !rcCreateHeightfield(&ctx, *intermediates.m_solid, tcfg.width, tcfg.height, tcfg.bmin,
+                              tcfg.bmax, tcfg.cs, tcfg.ch)) {
+    Log("buildTiled: Could not create solid heightfield.");
+    return false;
+  }
+
+  const int ntris = static_cast<int>(tileTriangles.size());
+  std::vector<int> tileTris(tileTriangles.size() * 3);
+  for (size_t i = 0; i < tileTriangles.size(); ++i) {
+    std::copy_n(&tris[tileTriangles[i] * 3], 3, &tileTris[i * 3]);
+  }
+  std::vector<unsigned char> triareas(tileTriangles.size(), 0);
+  rcMarkWalkableTriangles(&ctx, tcfg.walkableSlopeAngle, positions, positionCount,
+                          tileTris.data(), ntris, triareas.data());
+  if (!rcRasterizeTriangles(&ctx, positions, positionCount, tileTris.data(), triareas.data(),
+                            ntris, *intermediates.m_solid, tcfg.walkableClimb)) {
+    Log("buildTiled: Could not rasterize triangles.");
+    return false;
+  }
+
+  rcFilterLowHangingWalkableObstacles(&ctx, tcfg.walkableClimb, *intermediates.m_solid);
+  rcFilterLedgeSpans(&ctx, tcfg.walkableHeight, tcfg.walkableClimb, *intermediates.m_solid);
+  rcFilterWalkableLowHeightSpans(&ctx, tcfg.walkableHeight, *intermediates.m_solid);
+
+  intermediates.m_chf = rcAllocCompactHeightfield();
+  if (!intermediates.m_chf
+      || !rcBuildCompactHeightfield(&ctx, tcfg.walkableHeight, tcfg.walkableClimb,
+                                    *intermediates.m_solid, *intermediates.m_chf)) {
+    Log("buildTiled: Could not build compact data.");
+    return false;
+  }
+  if (!rcErodeWalkableArea(&ctx, tcfg.walkableRadius, *intermediates.m_chf)) {
+    Log("buildTiled: Could not erode.");
+    return false;
+  }
+
+  intermediates.m_lset = rcAllocHeightfieldLayerSet();
+  if (!intermediates.m_lset
+      || !rcBuildHeightfieldLayers(&ctx, *intermediates.m_chf, tcfg.borderSize,
+                                   tcfg.walkableHeight, *intermediates.m_lset)) {
+    Log("buildTiled: Could not build heighfield layers.");
+    return false;
+  }
+
+  TileCacheCompressor compressor;
+  const int nlayers = std::min(intermediates.m_lset->nlayers, MAX_LAYERS);
+  for (int i = 0; i < nlayers; ++i) {
+    const rcHeightfieldLayer* layer = &intermediates.m_lset->layers[i];
+
+    dtTileCacheLayerHeader header;
+    header.magic   = DT_TILECACHE_MAGIC;
+    header.version = DT_TILECACHE_VERSION;
+    header.tx      = tx;
+    header.ty      = ty;
+    header.tlayer  = i;
+    dtVcopy(header.bmin, layer->bmin);
+    dtVcopy(header.bmax, layer->bmax);
+    header.width  = static_cast<unsigned char>(layer->width);
+    header.height = static_cast<unsigned char>(layer->height);
+    header.minx   = static_cast<unsigned char>(layer->minx);
+    header.maxx   = static_cast<unsigned char>(layer->maxx);
+    header.miny   = static_cast<unsigned char>(layer->miny);
+    header.maxy   = static_cast<unsigned char>(layer->maxy);
+    header.hmin   = static_cast<unsigned short>(layer->hmin);
+    header.hmax   = static_cast<unsigned short>(layer->hmax);
+
+    TileCacheData tile;
+    if (dtStatusFailed(dtBuildTileCacheLayer(&compressor, &header, layer->heights, layer->areas,
+                                             layer->cons, &tile.data, &tile.dataSize))) {
+      Log("buildTiled: Could not build tile cache layer.");
+      return false;
+    }
+    layers.emplace_back(tile);
+  }
+  return true;
+}
+
+} // end of anonymous namespace
+
 void NavMesh::destroy()
 {
   if (m_pmesh) {
     rcFreePolyMesh(m_pmesh);
+    m_pmesh = nullptr;
   }
   if (m_dmesh) {
     rcFreePolyMeshDetail(m_dmesh);
+    m_dmesh = nullptr;
   }
   if (m_navData) {
     dtFree(m_navData);
+    m_navData = nullptr;
   }
   dtFreeNavMesh(m_navMesh);
+  m_navMesh = nullptr;
   dtFreeNavMeshQuery(m_navQuery);
+  m_navQuery = nullptr;
+  dtFreeTileCache(m_tileCache);
+  m_tileCache = nullptr;
+  delete m_tileCacheAlloc;
+  m_tileCacheAlloc = nullptr;
+  delete m_tileCacheCompressor;
+  m_tileCacheCompressor = nullptr;
+  delete m_tileCacheMeshProcess;
+  m_tileCacheMeshProcess = nullptr;
 }
 
 void NavMesh::build(const float* positions, const int /*positionCount*/, const int* indices,
                     const int indexCount, const rcConfig& config)
 {
-  if (m_pmesh) {
-    rcFreePolyMesh(m_pmesh);
-  }
-  if (m_dmesh) {
-    rcFreePolyMeshDetail(m_dmesh);
-  }
-  if (m_navData) {
-    dtFree(m_navData);
-  }
+  destroy();
 
   NavMeshintermediates intermediates;
   std::vector<Vec3> triangleIndices;
@@ -104,17 +320,7 @@ void NavMesh::build(const float* positions, const int /*positionCount*/, const i
   // area could be specified by an user defined box, etc.
   // float bmin[3] = {-20.f, 0.f, -20.f};
   // float bmax[3] = { 20.f, 1.f,  20.f};
-  rcConfig cfg               = config;
-  cfg.walkableHeight         = config.walkableHeight;
-  cfg.walkableClimb          = config.walkableClimb;
-  cfg.walkableRadius         = config.walkableRadius;
-  cfg.maxEdgeLen             = config.maxEdgeLen;
-  cfg.maxSimplificationError = config.maxSimplificationError;
-  cfg.minRegionArea    = static_cast<int>(rcSqr(config.minRegionArea));   // Note: area = size*size
-  cfg.mergeRegionArea  = static_cast<int>(rcSqr(config.mergeRegionArea)); // Note: area = size*size
-  cfg.maxVertsPerPoly  = static_cast<int>(config.maxVertsPerPoly);
-  cfg.detailSampleDist = config.detailSampleDist < 0.9f ? 0 : config.cs * config.detailSampleDist;
-  cfg.detailSampleMaxError = config.ch * config.detailSampleMaxError;
+  rcConfig cfg = GetBuildConfig(config);
 
   rcVcopy(cfg.bmin, &bbMin.x);
   rcVcopy(cfg.bmax, &bbMax.x);
@@ -347,6 +553,8 @@ void NavMesh::build(const float* positions, const int /*positionCount*/, const i
       Log("Could not init Detour navmesh");
       return;
     }
+    // Owned by the navigation mesh from now on
+    m_navData = nullptr;
 
     m_navQuery = dtAllocNavMeshQuery();
     if (!m_navQuery) {
@@ -366,6 +574,371 @@ void NavMesh::build(const float* positions, const int /*positionCount*/, const i
   Log("Done");
 }
 
+bool NavMesh::buildTiled(const float* positions, const int positionCount, const int* indices,
+                         const int indexCount, const rcConfig& config, ThreadPool& threadPool)
+{
+  destroy();
+
+  if (config.tileSize <= 0) {
+    Log("buildTiled: The tile size must be greater than 0.");
+    return false;
+  }
+
+  Vec3 bbMin(FLT_MAX);
+  Vec3 bbMax(-FLT_MAX);
+  for (int i = 0; i < positionCount; ++i) {
+    const Vec3 v(positions[i * 3], positions[i * 3 + 1], positions[i * 3 + 2]);
+    bbMin.isMinOf(v);
+    bbMax.isMaxOf(v);
+  }
+
+  rcConfig cfg = GetBuildConfig(config);
+  rcVcopy(cfg.bmin, &bbMin.x);
+  rcVcopy(cfg.bmax, &bbMax.x);
+  cfg.tileSize   = config.tileSize;
+  cfg.borderSize = cfg.walkableRadius + 3; // Reserve enough padding.
+  cfg.width      = cfg.tileSize + cfg.borderSize * 2;
+  cfg.height     = cfg.tileSize + cfg.borderSize * 2;
+
+  int gridWidth = 0, gridHeight = 0;
+  rcCalcGridSize(cfg.bmin, cfg.bmax, cfg.cs, &gridWidth, &gridHeight);
+  const int tileCountX = (gridWidth + cfg.tileSize - 1) / cfg.tileSize;
+  const int tileCountY = (gridHeight + cfg.tileSize - 1) / cfg.tileSize;
+  const auto tileCount = static_cast<size_t>(tileCountX * tileCountY);
+
+  // Triangles in the Recast winding order, binned by the tiles their bounds overlap (padding
+  // included)
+  const int ntris = indexCount / 3;
+  std::vector<int> tris(static_cast<size_t>(ntris) * 3);
+  std::vector<std::vector<int>> tileTriangles(tileCount);
+  const float tcs     = static_cast<float>(cfg.tileSize) * cfg.cs;
+  const float padding = static_cast<float>(cfg.borderSize) * cfg.cs;
+  const auto tileX    = [&](float x) { return static_cast<int>((x - cfg.bmin[0]) / tcs); };
+  const auto tileY    = [&](float z) { return static_cast<int>((z - cfg.bmin[2]) / tcs); };
+  for (int i = 0; i < ntris; ++i) {
+    float minX = FLT_MAX, minZ = FLT_MAX, maxX = -FLT_MAX, maxZ = -FLT_MAX;
+    for (int j = 0; j < 3; ++j) {
+      const int index = indices[i * 3 + 2 - j];
+      tris[static_cast<size_t>(i * 3 + j)] = index;
+      minX = std::min(minX, positions[index * 3]);
+      maxX = std::max(maxX, positions[index * 3]);
+      minZ = std::min(minZ, positions[index * 3 + 2]);
+      maxZ = std::max(maxZ, positions[index * 3 + 2]);
+    }
+    const int tx0 = std::max(0, tileX(minX - padding));
+    const int tx1 = std::min(tileCountX - 1, tileX(maxX + padding));
+    const int ty0 = std::max(0, tileY(minZ - padding));
+    const int ty1 = std::min(tileCountY - 1, tileY(maxZ + padding));
+    for (int ty = ty0; ty <= ty1; ++ty) {
+      for (int tx = tx0; tx <= tx1; ++tx) {
+        tileTriangles[static_cast<size_t>(ty * tileCountX + tx)].emplace_back(i);
+      }
+    }
+  }
+
+  // Rasterize the tiles in parallel, each one writing its own layers
+  std::vector<std::vector<TileCacheData>> tileLayers(tileCount);
+  std::atomic<bool> rasterized{true};
+  threadPool.parallelFor(0, tileCount, 1, [&](size_t begin, size_t end) {
+    for (size_t i = begin; i < end; ++i) {
+      const int tx = static_cast<int>(i) % tileCountX;
+      const int ty = static_cast<int>(i) / tileCountX;
+      if (!RasterizeTileLayers(positions, positionCount, tris.data(), tileTriangles[i], cfg, tx,
+                               ty, tileLayers[i])) {
+        rasterized = false;
+      }
+    }
+  });
+
+  dtTileCacheParams cacheParams;
+  std::memset(&cacheParams, 0, sizeof(cacheParams));
+  rcVcopy(cacheParams.orig, cfg.bmin);
+  cacheParams.cs                     = cfg.cs;
+  cacheParams.ch                     = cfg.ch;
+  cacheParams.width                  = cfg.tileSize;
+  cacheParams.height                 = cfg.tileSize;
+  cacheParams.walkableHeight         = static_cast<float>(cfg.walkableHeight) * cfg.ch;
+  cacheParams.walkableRadius         = static_cast<float>(cfg.walkableRadius) * cfg.cs;
+  cacheParams.walkableClimb          = static_cast<float>(cfg.walkableClimb) * cfg.ch;
+  cacheParams.maxSimplificationError = cfg.maxSimplificationError;
+  cacheParams.maxTiles               = static_cast<int>(tileCount) * EXPECTED_LAYERS_PER_TILE;
+  cacheParams.maxObstacles           = MAX_OBSTACLES;
+
+  const auto tileBits = std::min(
+    static_cast<int>(dtIlog2(dtNextPow2(static_cast<unsigned int>(cacheParams.maxTiles)))), 14);
+  dtNavMeshParams meshParams;
+  std::memset(&meshParams, 0, sizeof(meshParams));
+  rcVcopy(meshParams.orig, cfg.bmin);
+  meshParams.tileWidth  = tcs;
+  meshParams.tileHeight = tcs;
+  meshParams.maxTiles   = 1 << tileBits;
+  meshParams.maxPolys   = 1 << (22 - tileBits);
+
+  bool initialized = rasterized && initTileCache(cacheParams, meshParams);
+
+  // The tile cache takes the ownership of the layers
+  for (auto& layers : tileLayers) {
+    for (auto& layer : layers) {
+      if (!initialized
+          || dtStatusFailed(m_tileCache->addTile(layer.data, layer.dataSize,
+                                                 DT_COMPRESSEDTILE_FREE_DATA, nullptr))) {
+        dtFree(layer.data);
+      }
+    }
+  }
+  if (!initialized) {
+    destroy();
+    return false;
+  }
+
+  for (int ty = 0; ty < tileCountY; ++ty) {
+    for (int tx = 0; tx < tileCountX; ++tx) {
+      if (dtStatusFailed(m_tileCache->buildNavMeshTilesAt(tx, ty, m_navMesh))) {
+        Log("buildTiled: Could not build navmesh tile.");
+      }
+    }
+  }
+
+  return initNavMeshQuery();
+}
+
+std::future<bool> NavMesh::buildTiledAsync(std::vector<float> positions, std::vector<int> indices,
+                                           const rcConfig& config, ThreadPool& threadPool)
+{
+  auto result = std::make_shared<std::promise<bool>>();
+  auto future = result->get_future();
+  auto input  = std::make_shared<std::pair<std::vector<float>, std::vector<int>>>(
+    std::move(positions), std::move(indices));
+  threadPool.submit([this, result, input, config, &threadPool]() {
+    const auto& [inputPositions, inputIndices] = *input;
+    result->set_value(buildTiled(inputPositions.data(),
+                                 static_cast<int>(inputPositions.size() / 3), inputIndices.data(),
+                                 static_cast<int>(inputIndices.size()), config, threadPool));
+  });
+  return future;
+}
+
+bool NavMesh::initTileCache(const dtTileCacheParams& cacheParams,
+                            const dtNavMeshParams& meshParams)
+{
+  m_tileCacheAlloc       = new dtTileCacheAlloc();
+  m_tileCacheCompressor  = new TileCacheCompressor();
+  m_tileCacheMeshProcess = new TileCacheMeshProcess();
+
+  m_tileCache = dtAllocTileCache();
+  if (!m_tileCache
+      || dtStatusFailed(m_tileCache->init(&cacheParams, m_tileCacheAlloc, m_tileCacheCompressor,
+                                          m_tileCacheMeshProcess))) {
+    Log("Could not init tile cache");
+    return false;
+  }
+
+  m_navMesh = dtAllocNavMesh();
+  if (!m_navMesh || dtStatusFailed(m_navMesh->init(&meshParams))) {
+    Log("Could not init Detour navmesh");
+    return false;
+  }
+  return true;
+}
+
+bool NavMesh::initNavMeshQuery()
+{
+  m_navQuery = dtAllocNavMeshQuery();
+  if (!m_navQuery || dtStatusFailed(m_navQuery->init(m_navMesh, 2048))) {
+    Log("Could not init Detour navmesh query");
+    destroy();
+    return false;
+  }
+  return true;
+}
+
+dtObstacleRef NavMesh::addCylinderObstacle(const Vec3& position, float radius, float height)
+{
+  dtObstacleRef obstacle = 0;
+  if (!m_tileCache
+      || dtStatusFailed(m_tileCache->addObstacle(&position.x, radius, height, &obstacle))) {
+    return 0;
+  }
+  return obstacle;
+}
+
+dtObstacleRef NavMesh::addBoxObstacle(const Vec3& position, const Vec3& extent, float angle)
+{
+  dtObstacleRef obstacle = 0;
+  if (!m_tileCache
+      || dtStatusFailed(m_tileCache->addBoxObstacle(&position.x, &extent.x, angle, &obstacle))) {
+    return 0;
+  }
+  return obstacle;
+}
+
+void NavMesh::removeObstacle(dtObstacleRef obstacle)
+{
+  if (m_tileCache) {
+    m_tileCache->removeObstacle(obstacle);
+  }
+}
+
+void NavMesh::update()
+{
+  if (!m_tileCache) {
+    return;
+  }
+  // Each update rebuilds a limited number of tiles
+  bool upToDate = false;
+  while (!upToDate) {
+    if (dtStatusFailed(m_tileCache->update(0.f, m_navMesh, &upToDate))) {
+      Log("Could not update tile cache");
+      return;
+    }
+  }
+}
+
+std::vector<uint8_t> NavMesh::getNavmeshData() const
+{
+  std::vector<uint8_t> data;
+  if (!m_navMesh) {
+    return data;
+  }
+
+  const auto append = [&data](const void* value, size_t size) {
+    const auto bytes = static_cast<const uint8_t*>(value);
+    data.insert(data.end(), bytes, bytes + size);
+  };
+
+  if (m_tileCache) {
+    TileCacheSetHeader header;
+    std::memset(&header, 0, sizeof(header));
+    header.magic   = TILECACHESET_MAGIC;
+    header.version = NAVMESHSET_VERSION;
+    std::memcpy(&header.meshParams, m_navMesh->getParams(), sizeof(dtNavMeshParams));
+    std::memcpy(&header.cacheParams, m_tileCache->getParams(), sizeof(dtTileCacheParams));
+    append(&header, sizeof(header));
+    for (int i = 0; i < m_tileCache->getTileCount(); ++i) {
+      const dtCompressedTile* tile = m_tileCache->getTile(i);
+      if (!tile || !tile->header || !tile->dataSize) {
+        continue;
+      }
+      TileCacheTileHeader tileHeader{m_tileCache->getTileRef(tile), tile->dataSize};
+      append(&tileHeader, sizeof(tileHeader));
+      append(tile->data, static_cast<size_t>(tile->dataSize));
+      ++header.numTiles;
+    }
+    std::memcpy(data.data(), &header, sizeof(header));
+    return data;
+  }
+
+  const dtNavMesh& mesh = *m_navMesh;
+  NavMeshSetHeader header;
+  std::memset(&header, 0, sizeof(header));
+  header.magic   = NAVMESHSET_MAGIC;
+  header.version = NAVMESHSET_VERSION;
+  std::memcpy(&header.params, mesh.getParams(), sizeof(dtNavMeshParams));
+  append(&header, sizeof(header));
+  for (int i = 0; i < mesh.getMaxTiles(); ++i) {
+    const dtMeshTile* tile = mesh.getTile(i);
+    if (!tile || !tile->header || !tile->dataSize) {
+      continue;
+    }
+    NavMeshTileHeader tileHeader{mesh.getTileRef(tile), tile->dataSize};
+    append(&tileHeader, sizeof(tileHeader));
+    append(tile->data, static_cast<size_t>(tile->dataSize));
+    ++header.numTiles;
+  }
+  std::memcpy(data.data(), &header, sizeof(header));
+  return data;
+}
+
+bool NavMesh::buildFromNavmeshData(const std::vector<uint8_t>& data)
+{
+  destroy();
+
+  size_t offset   = 0;
+  const auto read = [&data, &offset](void* value, size_t size) {
+    if (offset + size > data.size()) {
+      return false;
+    }
+    std::memcpy(value, data.data() + offset, size);
+    offset += size;
+    return true;
+  };
+  // Copy of the tile data, owned by the navigation mesh or the tile cache
+  const auto readTileData = [&data, &offset](int dataSize) -> unsigned char* {
+    if (dataSize <= 0 || offset + static_cast<size_t>(dataSize) > data.size()) {
+      return nullptr;
+    }
+    auto tileData = static_cast<unsigned char*>(dtAlloc(dataSize, DT_ALLOC_PERM));
+    if (tileData) {
+      std::memcpy(tileData, data.data() + offset, static_cast<size_t>(dataSize));
+      offset += static_cast<size_t>(dataSize);
+    }
+    return tileData;
+  };
+
+  int magic = 0;
+  if (!read(&magic, sizeof(magic))) {
+    Log("buildFromNavmeshData: Invalid navmesh data.");
+    return false;
+  }
+  offset = 0;
+
+  if (magic == TILECACHESET_MAGIC) {
+    TileCacheSetHeader header;
+    if (!read(&header, sizeof(header)) || header.version != NAVMESHSET_VERSION
+        || !initTileCache(header.cacheParams, header.meshParams)) {
+      Log("buildFromNavmeshData: Invalid tile cache data.");
+      destroy();
+      return false;
+    }
+    for (int i = 0; i < header.numTiles; ++i) {
+      TileCacheTileHeader tileHeader;
+      unsigned char* tileData = nullptr;
+      if (!read(&tileHeader, sizeof(tileHeader))
+          || !(tileData = readTileData(tileHeader.dataSize))) {
+        Log("buildFromNavmeshData: Invalid tile cache data.");
+        destroy();
+        return false;
+      }
+      dtCompressedTileRef tile = 0;
+      if (dtStatusFailed(m_tileCache->addTile(tileData, tileHeader.dataSize,
+                                              DT_COMPRESSEDTILE_FREE_DATA, &tile))) {
+        dtFree(tileData);
+        continue;
+      }
+      m_tileCache->buildNavMeshTile(tile, m_navMesh);
+    }
+    return initNavMeshQuery();
+  }
+
+  NavMeshSetHeader header;
+  if (magic != NAVMESHSET_MAGIC || !read(&header, sizeof(header))
+      || header.version != NAVMESHSET_VERSION) {
+    Log("buildFromNavmeshData: Invalid navmesh data.");
+    return false;
+  }
+  m_navMesh = dtAllocNavMesh();
+  if (!m_navMesh || dtStatusFailed(m_navMesh->init(&header.params))) {
+    Log("Could not init Detour navmesh");
+    destroy();
+    return false;
+  }
+  for (int i = 0; i < header.numTiles; ++i) {
+    NavMeshTileHeader tileHeader;
+    unsigned char* tileData = nullptr;
+    if (!read(&tileHeader, sizeof(tileHeader))
+        || !(tileData = readTileData(tileHeader.dataSize))) {
+      Log("buildFromNavmeshData: Invalid navmesh data.");
+      destroy();
+      return false;
+    }
+    if (dtStatusFailed(m_navMesh->addTile(tileData, tileHeader.dataSize, DT_TILE_FREE_DATA,
+                                          tileHeader.tileRef, nullptr))) {
+      dtFree(tileData);
+    }
+  }
+  return initNavMeshQuery();
+}
+
 void NavMesh::navMeshPoly(DebugNavMesh& debugNavMesh, const dtNavMesh& mesh, dtPolyRef ref)
 {
   const dtMeshTile* tile = nullptr;
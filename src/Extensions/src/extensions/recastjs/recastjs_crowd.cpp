@@ -1,5 +1,7 @@
 #include <babylon/extensions/recastjs/recastjs_crowd.h>
 
+#include <algorithm>
+
 #include <babylon/babylon_stl_util.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
@@ -7,14 +9,34 @@
 #include <babylon/extensions/recastjs/recastjs_plugin.h>
 #include <babylon/maths/vector3.h>
 #include <babylon/meshes/transform_node.h>
-#include <babylon/navigation/iagent_parameters.h>
 
 namespace BABYLON {
 namespace Extensions {
 
+namespace {
+
+dtCrowdAgentParams ToAgentParams(const IAgentParameters& parameters)
+{
+  dtCrowdAgentParams agentParams;
+  agentParams.radius                = parameters.radius;
+  agentParams.height                = parameters.height;
+  agentParams.maxAcceleration       = parameters.maxAcceleration;
+  agentParams.maxSpeed              = parameters.maxSpeed;
+  agentParams.collisionQueryRange   = parameters.collisionQueryRange;
+  agentParams.pathOptimizationRange = parameters.pathOptimizationRange;
+  agentParams.separationWeight      = parameters.separationWeight;
+  agentParams.updateFlags           = 7;
+  agentParams.obstacleAvoidanceType = 0;
+  agentParams.queryFilterType       = 0;
+  agentParams.userData              = nullptr;
+  return agentParams;
+}
+
+} // end of anonymous namespace
+
 RecastJSCrowd::RecastJSCrowd(RecastJSPlugin* plugin, size_t maxAgents, float maxAgentRadius,
                              Scene* scene)
-    : ICrowd{}
+    : ICrowd{}, _maxAgents{maxAgents}, _maxAgentRadius{maxAgentRadius}
 {
   bjsRECASTPlugin = plugin;
   recastCrowd     = std::make_unique<Crowd>(static_cast<int>(maxAgents), maxAgentRadius,
@@ -35,22 +57,11 @@ RecastJSCrowd::~RecastJSCrowd()
 int RecastJSCrowd::addAgent(const Vector3& pos, const IAgentParameters& parameters,
                             const TransformNodePtr& transform)
 {
-  dtCrowdAgentParams agentParams;
-  agentParams.radius                = parameters.radius;
-  agentParams.height                = parameters.height;
-  agentParams.maxAcceleration       = parameters.maxAcceleration;
-  agentParams.maxSpeed              = parameters.maxSpeed;
-  agentParams.collisionQueryRange   = parameters.collisionQueryRange;
-  agentParams.pathOptimizationRange = parameters.pathOptimizationRange;
-  agentParams.separationWeight      = parameters.separationWeight;
-  agentParams.updateFlags           = 7;
-  agentParams.obstacleAvoidanceType = 0;
-  agentParams.queryFilterType       = 0;
-  agentParams.userData              = nullptr;
-
-  auto agentIndex = recastCrowd->addAgent(Vec3(pos.x, pos.y, pos.z), &agentParams);
+  const auto agentParams = ToAgentParams(parameters);
+  auto agentIndex        = recastCrowd->addAgent(Vec3(pos.x, pos.y, pos.z), &agentParams);
   transforms.emplace_back(transform);
   agents.emplace_back(agentIndex);
+  _agentParameters.emplace_back(parameters);
   return agentIndex;
 }
 
@@ -79,6 +90,7 @@ void RecastJSCrowd::removeAgent(int index)
   if (item > -1) {
     stl_util::splice(agents, item, 1);
     stl_util::splice(transforms, item, 1);
+    stl_util::splice(_agentParameters, item, 1);
   }
 }
 
@@ -89,6 +101,9 @@ std::vector<int>& RecastJSCrowd::getAgents()
 
 void RecastJSCrowd::update(float deltaTime)
 {
+  // update obstacles
+  bjsRECASTPlugin->navMesh->update();
+
   // update crowd
   recastCrowd->update(deltaTime);
 
@@ -112,10 +127,56 @@ Vector3 RecastJSCrowd::getDefaultQueryExtent() const
 
 void RecastJSCrowd::dispose()
 {
-  recastCrowd->destroy();
+  if (recastCrowd) {
+    recastCrowd->destroy();
+    recastCrowd = nullptr;
+  }
   // _scene->onBeforeAnimationsObservable.remove(_onBeforeAnimationsObserver);
   // _onBeforeAnimationsObserver = nullptr;
 }
 
+void RecastJSCrowd::_rebuild(dtNavMesh* navMesh)
+{
+  if (!recastCrowd) {
+    return;
+  }
+
+  // Read the agent positions before the old crowd is released
+  std::vector<Vec3> positions;
+  positions.reserve(agents.size());
+  for (const auto agent : agents) {
+    positions.emplace_back(agent >= 0 ? recastCrowd->getAgentPosition(agent) : Vec3(0.f));
+  }
+  const auto queryExtent = recastCrowd->getDefaultQueryExtent();
+
+  recastCrowd->destroy();
+  recastCrowd
+    = std::make_unique<Crowd>(static_cast<int>(_maxAgents), _maxAgentRadius, navMesh);
+  recastCrowd->setDefaultQueryExtent(queryExtent);
+
+  // Detour adds an agent in its first free slot: fill the slots in index order, a placeholder
+  // taking the slot of each removed agent, so that the agents keep their index
+  const auto slotCount = agents.empty() ? 0 : *std::max_element(agents.begin(), agents.end()) + 1;
+  std::vector<int> slotAgents(static_cast<size_t>(std::max(slotCount, 0)), -1);
+  for (size_t item = 0; item < agents.size(); ++item) {
+    if (agents[item] >= 0) {
+      slotAgents[static_cast<size_t>(agents[item])] = static_cast<int>(item);
+    }
+  }
+  std::vector<int> placeholders;
+  for (const auto item : slotAgents) {
+    const auto agentParams
+      = ToAgentParams(_agentParameters[item < 0 ? 0 : static_cast<size_t>(item)]);
+    const auto position = item < 0 ? positions.front() : positions[static_cast<size_t>(item)];
+    const auto slot     = recastCrowd->addAgent(position, &agentParams);
+    if (item < 0) {
+      placeholders.emplace_back(slot);
+    }
+  }
+  for (const auto placeholder : placeholders) {
+    recastCrowd->removeAgent(placeholder);
+  }
+}
+
 } // end of namespace Extensions
 } // end of namespace BABYLON
@@ -30,7 +30,7 @@ void RecastJSPlugin::createMavMesh(const std::vector<MeshPtr>& meshes,
   rc.cs                     = parameters.cs;
   rc.ch                     = parameters.ch;
   rc.borderSize             = 0;
-  rc.tileSize               = 0;
+  rc.tileSize               = parameters.tileSize;
   rc.walkableSlopeAngle     = parameters.walkableSlopeAngle;
   rc.walkableHeight         = parameters.walkableHeight;
   rc.walkableClimb          = parameters.walkableClimb;
@@ -43,7 +43,7 @@ void RecastJSPlugin::createMavMesh(const std::vector<MeshPtr>& meshes,
   rc.detailSampleDist       = parameters.detailSampleDist;
   rc.detailSampleMaxError   = parameters.detailSampleMaxError;
 
-  navMesh = std::make_unique<NavMesh>();
+  auto newNavMesh = std::make_unique<NavMesh>();
 
   Int32Array indices;
   Float32Array positions;
@@ -77,7 +77,15 @@ void RecastJSPlugin::createMavMesh(const std::vector<MeshPtr>& meshes,
     }
   }
 
-  navMesh->build(positions.data(), offset, indices.data(), static_cast<int>(indices.size()), rc);
+  if (rc.tileSize > 0) {
+    newNavMesh->buildTiled(positions.data(), offset, indices.data(),
+                           static_cast<int>(indices.size()), rc);
+  }
+  else {
+    newNavMesh->build(positions.data(), offset, indices.data(), static_cast<int>(indices.size()),
+                      rc);
+  }
+  _setNavMesh(std::move(newNavMesh));
 }
 
 MeshPtr RecastJSPlugin::createDebugNavMesh(Scene* scene) const
@@ -146,6 +154,7 @@ std::vector<Vector3> RecastJSPlugin::computePath(const Vector3& start, const Vec
 ICrowdPtr RecastJSPlugin::createCrowd(size_t maxAgents, float maxAgentRadius, Scene* scene)
 {
   auto crowd = std::make_shared<RecastJSCrowd>(this, maxAgents, maxAgentRadius, scene);
+  _crowds.emplace_back(crowd);
   return std::static_pointer_cast<ICrowd>(crowd);
 }
 
@@ -161,6 +170,50 @@ Vector3 RecastJSPlugin::getDefaultQueryExtent() const
   return Vector3(p.x, p.y, p.z);
 }
 
+dtObstacleRef RecastJSPlugin::addCylinderObstacle(const Vector3& position, float radius,
+                                                  float height)
+{
+  const Vec3 p(position.x, position.y, position.z);
+  return navMesh->addCylinderObstacle(p, radius, height);
+}
+
+dtObstacleRef RecastJSPlugin::addBoxObstacle(const Vector3& position, const Vector3& extent,
+                                             float angle)
+{
+  const Vec3 p(position.x, position.y, position.z);
+  const Vec3 e(extent.x, extent.y, extent.z);
+  return navMesh->addBoxObstacle(p, e, angle);
+}
+
+void RecastJSPlugin::removeObstacle(dtObstacleRef obstacle)
+{
+  navMesh->removeObstacle(obstacle);
+}
+
+std::vector<uint8_t> RecastJSPlugin::getNavmeshData() const
+{
+  return navMesh ? navMesh->getNavmeshData() : std::vector<uint8_t>{};
+}
+
+void RecastJSPlugin::buildFromNavmeshData(const std::vector<uint8_t>& data)
+{
+  auto newNavMesh = std::make_unique<NavMesh>();
+  newNavMesh->buildFromNavmeshData(data);
+  _setNavMesh(std::move(newNavMesh));
+}
+
+void RecastJSPlugin::_setNavMesh(std::unique_ptr<NavMesh>&& newNavMesh)
+{
+  // Rebuild the crowds while the previous navigation mesh is still alive
+  stl_util::erase_remove_if(_crowds, [](const auto& crowdRef) { return crowdRef.expired(); });
+  for (const auto& crowdRef : _crowds) {
+    if (auto crowd = crowdRef.lock()) {
+      crowd->_rebuild(newNavMesh->getNavMesh());
+    }
+  }
+  navMesh = std::move(newNavMesh);
+}
+
 void RecastJSPlugin::dispose()
 {
 }
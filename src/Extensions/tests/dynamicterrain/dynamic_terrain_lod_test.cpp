@@ -0,0 +1,48 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_lod.h>
+
+using namespace BABYLON::Extensions;
+
+TEST(TestDynamicTerrainLOD, UniformLOD)
+{
+  DynamicTerrainAxisLOD lod;
+  lod.compute(8, 2, {});
+  EXPECT_THAT(lod.lods, ::testing::Each(2u));
+  EXPECT_THAT(lod.steps, ::testing::ElementsAre(0, 2, 4, 6, 8, 10, 12, 14, 16));
+
+  // Moving by 4 map cells shifts the vertices by 2, the last ones being new
+  std::vector<int64_t> sources;
+  lod.computeSources(4, sources);
+  EXPECT_THAT(sources, ::testing::ElementsAre(2, 3, 4, 5, 6, 7, 8, -1, -1));
+  lod.computeSources(-2, sources);
+  EXPECT_THAT(sources, ::testing::ElementsAre(-1, 0, 1, 2, 3, 4, 5, 6, 7));
+}
+
+TEST(TestDynamicTerrainLOD, LODRings)
+{
+  DynamicTerrainAxisLOD lod;
+  lod.compute(16, 1, {4, 2});
+  EXPECT_THAT(lod.lods,
+              ::testing::ElementsAre(3, 3, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 3, 3, 3));
+  EXPECT_EQ(lod.steps.back(), 28u);
+
+  // Only the vertices landing on the cells of other vertices are copied
+  std::vector<int64_t> sources;
+  lod.computeSources(1, sources);
+  for (size_t i = 0; i < sources.size(); ++i) {
+    if (sources[i] >= 0) {
+      EXPECT_EQ(lod.steps[static_cast<size_t>(sources[i])], lod.steps[i] + 1);
+    }
+  }
+  EXPECT_THAT(std::vector<int64_t>(sources.begin() + 4, sources.begin() + 11),
+              ::testing::ElementsAre(5, 6, 7, 8, 9, 10, 11));
+  EXPECT_EQ(sources.back(), -1);
+
+  DynamicTerrainAxisLOD other;
+  other.compute(16, 1, {4, 2});
+  EXPECT_EQ(lod, other);
+  other.compute(16, 2, {4, 2});
+  EXPECT_NE(lod, other);
+}
@@ -0,0 +1,87 @@
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/cameras/free_camera.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain.h>
+#include <babylon/extensions/dynamicterrain/dynamic_terrain_options.h>
+#include <babylon/meshes/mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+
+namespace {
+
+// Map of mapSub x mapSub points one world unit apart, with hills
+BABYLON::Float32Array CreateMapData(unsigned int mapSub)
+{
+  BABYLON::Float32Array mapData;
+  for (unsigned int z = 0; z < mapSub; ++z) {
+    for (unsigned int x = 0; x < mapSub; ++x) {
+      const auto height = 3.f * std::sin(0.3f * x) * std::cos(0.2f * z);
+      mapData.insert(mapData.end(), {static_cast<float>(x), height, static_cast<float>(z)});
+    }
+  }
+  return mapData;
+}
+
+void ExpectNear(const BABYLON::Float32Array& actual, const BABYLON::Float32Array& expected)
+{
+  ASSERT_EQ(actual.size(), expected.size());
+  for (size_t i = 0; i < actual.size(); ++i) {
+    EXPECT_NEAR(actual[i], expected[i], 1e-4f) << "at " << i;
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestDynamicTerrain, ShiftedUpdateMatchesFullRebuild)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  NullEngineOptions options;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  auto engine                   = NullEngine::New(options);
+  auto scene                    = Scene::New(engine.get());
+  auto camera = FreeCamera::New("camera", Vector3(30.f, 20.f, 30.f), scene.get());
+  scene->activeCamera = camera;
+  camera->getViewMatrix(true);
+
+  const unsigned int mapSub = 60;
+  DynamicTerrainOptions terrainOptions;
+  terrainOptions.terrainSub = 20;
+  terrainOptions.mapData    = CreateMapData(mapSub);
+  terrainOptions.mapSubX    = static_cast<int>(mapSub);
+  terrainOptions.mapSubZ    = static_cast<int>(mapSub);
+  terrainOptions.mapUVs     = DynamicTerrain::CreateUVMap(mapSub, mapSub);
+  terrainOptions.camera     = camera;
+
+  // Uniform LOD, and LOD rings where the vertices are not evenly spaced
+  for (const auto& lodLimits : {Uint32Array{}, Uint32Array{4, 2}}) {
+    camera->position = Vector3(30.f, 20.f, 30.f);
+    camera->getViewMatrix(true);
+    DynamicTerrain terrain("terrain", terrainOptions, scene.get());
+    terrain.LODLimits(lodLimits);
+    terrain.update(true);
+
+    // The vertices still sampling the same map cells are copied
+    camera->position = Vector3(35.2f, 20.f, 27.1f);
+    camera->getViewMatrix(true);
+    terrain.update(false);
+    const auto vertexCount = terrain.mesh()->getTotalVertices();
+    EXPECT_LT(terrain.rebuiltVertexCount(), vertexCount);
+    const auto positions = terrain.mesh()->getVerticesData(VertexBuffer::PositionKind);
+    const auto normals   = terrain.mesh()->getVerticesData(VertexBuffer::NormalKind);
+    const auto uvs       = terrain.mesh()->getVerticesData(VertexBuffer::UVKind);
+    const auto colors    = terrain.mesh()->getVerticesData(VertexBuffer::ColorKind);
+
+    terrain.update(true);
+    EXPECT_EQ(terrain.rebuiltVertexCount(), vertexCount);
+    ExpectNear(positions, terrain.mesh()->getVerticesData(VertexBuffer::PositionKind));
+    ExpectNear(normals, terrain.mesh()->getVerticesData(VertexBuffer::NormalKind));
+    ExpectNear(uvs, terrain.mesh()->getVerticesData(VertexBuffer::UVKind));
+    ExpectNear(colors, terrain.mesh()->getVerticesData(VertexBuffer::ColorKind));
+  }
+}
@@ -0,0 +1,162 @@
+#include <gtest/gtest.h>
+
+#include <memory>
+
+#include <babylon/extensions/entitycomponentsystem/detail/component_pool.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+// Here are the possible test cases we need to test for:
+// 1. Component pool
+//      ✓ Components are packed in storage order
+//      ✓ Removing a component moves the last one in its place
+//      ✓ Components are destroyed with the pool
+// 2. Iterating components through the world
+//      ✓ Only activated entities with all the components are visited
+//      ✓ Ranges of components can be iterated independently
+//      ✓ Killed entities are no longer visited
+
+namespace {
+
+struct CountedComponent : Component {
+  explicit CountedComponent(std::shared_ptr<int> counter) : counter{std::move(counter)}
+  {
+  }
+  std::shared_ptr<int> counter;
+};
+
+} // end of anonymous namespace
+
+TEST(TestComponentStorage, Components_are_packed_in_storage_order)
+{
+  detail::ComponentPool<PositionComponent> pool;
+  const auto componentCount = detail::ComponentPool<PositionComponent>::CHUNK_SIZE + 10;
+  for (std::size_t i = 0; i < componentCount; ++i) {
+    auto& position = pool.emplace(i * 2);
+    position.x     = static_cast<float>(i);
+  }
+
+  EXPECT_EQ(pool.size(), componentCount);
+  EXPECT_TRUE(pool.has(4));
+  EXPECT_FALSE(pool.has(5));
+  EXPECT_EQ(pool.find(5), nullptr);
+  EXPECT_EQ(pool.find(4), &pool.at(2));
+  EXPECT_EQ(&pool.at(1) - &pool.at(0), 1);
+
+  std::size_t visited = 0;
+  pool.forEach(0, pool.size(), [&](std::size_t entityIndex, PositionComponent& position) {
+    EXPECT_EQ(entityIndex, visited * 2);
+    EXPECT_EQ(position.x, static_cast<float>(visited));
+    ++visited;
+  });
+  EXPECT_EQ(visited, componentCount);
+}
+
+TEST(TestComponentStorage, Removing_a_component_moves_the_last_one)
+{
+  detail::ComponentPool<PositionComponent> pool;
+  for (std::size_t i = 0; i < 4; ++i) {
+    pool.emplace(i).x = static_cast<float>(i);
+  }
+
+  pool.remove(1);
+
+  EXPECT_EQ(pool.size(), 3);
+  EXPECT_FALSE(pool.has(1));
+  EXPECT_EQ(pool.getEntityIndices(), (std::vector<std::size_t>{0, 3, 2}));
+  EXPECT_EQ(pool.find(3)->x, 3.f);
+  EXPECT_EQ(pool.find(3), &pool.at(1));
+}
+
+TEST(TestComponentStorage, Components_are_destroyed_with_the_pool)
+{
+  auto counter = std::make_shared<int>(0);
+  {
+    detail::ComponentPool<CountedComponent> pool;
+    for (std::size_t i = 0; i < 10; ++i) {
+      pool.emplace(i, counter);
+    }
+    pool.remove(3);
+    pool.emplace(4, counter);
+    EXPECT_EQ(counter.use_count(), 10);
+  }
+  EXPECT_EQ(counter.use_count(), 1);
+}
+
+TEST(TestComponentStorage, Iterating_activated_entities_with_all_components)
+{
+  World world;
+
+  auto moving = world.createEntity();
+  moving.addComponent<PositionComponent>();
+  moving.addComponent<VelocityComponent>().x = 1.f;
+  moving.activate();
+
+  auto still = world.createEntity();
+  still.addComponent<PositionComponent>();
+  still.activate();
+
+  auto deactivated = world.createEntity();
+  deactivated.addComponent<PositionComponent>();
+  deactivated.addComponent<VelocityComponent>();
+
+  world.refresh();
+
+  std::size_t visited = 0;
+  world.forEach<VelocityComponent, PositionComponent>(
+    [&](Entity& entity, VelocityComponent& velocity, PositionComponent& position) {
+      EXPECT_EQ(entity, moving);
+      position.x += velocity.x;
+      ++visited;
+    });
+
+  EXPECT_EQ(visited, 1);
+  EXPECT_EQ(moving.getComponent<PositionComponent>().x, 1.f);
+  EXPECT_EQ(world.getComponentCount<PositionComponent>(), 3);
+  EXPECT_EQ(world.getComponentCount<PlayerComponent>(), 0);
+}
+
+TEST(TestComponentStorage, Iterating_ranges_of_components)
+{
+  World world;
+  for (int i = 0; i < 100; ++i) {
+    auto e = world.createEntity();
+    e.addComponent<PositionComponent>().x = static_cast<float>(i);
+    e.activate();
+  }
+  world.refresh();
+
+  float sum = 0.f;
+  for (std::size_t begin = 0; begin < 100; begin += 30) {
+    world.forEach<PositionComponent>(
+      begin, begin + 30, [&](Entity& /*entity*/, PositionComponent& p) { sum += p.x; });
+  }
+  EXPECT_EQ(sum, 4950.f);
+}
+
+TEST(TestComponentStorage, Killed_entities_are_not_iterated)
+{
+  World world;
+  auto e1 = world.createEntity();
+  auto e2 = world.createEntity();
+  e1.addComponent<PositionComponent>();
+  e2.addComponent<PositionComponent>().x = 2.f;
+  e1.activate();
+  e2.activate();
+  world.refresh();
+
+  e1.kill();
+  world.refresh();
+
+  std::size_t visited = 0;
+  world.forEach<PositionComponent>([&](Entity& entity, PositionComponent& position) {
+    EXPECT_EQ(entity, e2);
+    EXPECT_EQ(position.x, 2.f);
+    ++visited;
+  });
+  EXPECT_EQ(visited, 1);
+  EXPECT_EQ(world.getComponentCount<PositionComponent>(), 1);
+}
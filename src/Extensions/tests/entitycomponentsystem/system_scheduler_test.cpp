@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+
+#include <atomic>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/entitycomponentsystem/world.h>
+
+#include "components.h"
+
+using namespace BABYLON::Extensions::ECS;
+
+// Here are the possible test cases we need to test for:
+// 1. Scheduling systems
+//      ✓ Systems without declared accesses run alone
+//      ✓ Systems reading the same components share a step
+//      ✓ Writers run after the systems added before them accessing the
+//        written components
+// 2. Updating systems
+//      ✓ Every system is updated once, in its step
+//      ✓ Components are processed in parallel chunks
+
+namespace {
+
+template <int N>
+class CountingSystem : public System<Requires<PositionComponent>> {
+public:
+  void update() override
+  {
+    ++updateCount;
+  }
+  std::atomic<int> updateCount{0};
+};
+
+class IntegrateSystem : public CountingSystem<0> {
+public:
+  IntegrateSystem()
+  {
+    reads<VelocityComponent>();
+    writes<PositionComponent>();
+  }
+  void update() override
+  {
+    CountingSystem<0>::update();
+    getWorld().parallelForEach<VelocityComponent, PositionComponent>(
+      [](Entity& /*e*/, VelocityComponent& velocity, PositionComponent& position) {
+        position.x += velocity.x;
+      },
+      16);
+  }
+};
+
+class PositionReaderSystem : public CountingSystem<1> {
+public:
+  PositionReaderSystem()
+  {
+    reads<PositionComponent>();
+  }
+};
+
+class VelocityReaderSystem : public CountingSystem<2> {
+public:
+  VelocityReaderSystem()
+  {
+    reads<VelocityComponent>();
+  }
+};
+
+class PlayerWriterSystem : public CountingSystem<3> {
+public:
+  PlayerWriterSystem()
+  {
+    writes<PlayerComponent>();
+  }
+};
+
+class LegacySystem : public CountingSystem<4> {
+};
+
+} // end of anonymous namespace
+
+TEST(TestSystemScheduler, Systems_without_declared_accesses_run_alone)
+{
+  World world;
+  PlayerWriterSystem playerWriter;
+  LegacySystem legacy;
+  VelocityReaderSystem velocityReader;
+  world.addSystem(playerWriter);
+  world.addSystem(legacy);
+  world.addSystem(velocityReader);
+
+  const auto& schedule = world.getSystemSchedule();
+  ASSERT_EQ(schedule.size(), 3);
+  EXPECT_EQ(schedule[0].front(), &playerWriter);
+  EXPECT_EQ(schedule[1].front(), &legacy);
+  EXPECT_EQ(schedule[2].front(), &velocityReader);
+}
+
+TEST(TestSystemScheduler, Conflicting_systems_run_in_order)
+{
+  World world;
+  VelocityReaderSystem velocityReader;
+  PositionReaderSystem positionReader;
+  IntegrateSystem integrate;
+  PlayerWriterSystem playerWriter;
+  world.addSystem(velocityReader);
+  world.addSystem(positionReader);
+  world.addSystem(integrate);
+  world.addSystem(playerWriter);
+
+  // integrate writes the positions read by positionReader
+  const auto& schedule = world.getSystemSchedule();
+  ASSERT_EQ(schedule.size(), 2);
+  EXPECT_EQ(schedule[0],
+            (std::vector<detail::BaseSystem*>{&velocityReader, &positionReader, &playerWriter}));
+  EXPECT_EQ(schedule[1], (std::vector<detail::BaseSystem*>{&integrate}));
+
+  world.removeSystem<PositionReaderSystem>();
+  EXPECT_EQ(world.getSystemSchedule().size(), 1);
+}
+
+TEST(TestSystemScheduler, Updating_systems)
+{
+  BABYLON::ThreadPool threadPool(3);
+  World world;
+  VelocityReaderSystem velocityReader;
+  PositionReaderSystem positionReader;
+  IntegrateSystem integrate;
+  world.addSystem(velocityReader);
+  world.addSystem(positionReader);
+  world.addSystem(integrate);
+
+  std::vector<Entity> entities;
+  for (int i = 0; i < 100; ++i) {
+    auto e = world.createEntity();
+    e.addComponent<PositionComponent>();
+    e.addComponent<VelocityComponent>().x = static_cast<float>(i);
+    e.activate();
+    entities.emplace_back(e);
+  }
+  world.refresh();
+
+  world.update(threadPool);
+  world.update(threadPool);
+
+  EXPECT_EQ(velocityReader.updateCount, 2);
+  EXPECT_EQ(positionReader.updateCount, 2);
+  EXPECT_EQ(integrate.updateCount, 2);
+  for (int i = 0; i < 100; ++i) {
+    EXPECT_EQ(entities[i].getComponent<PositionComponent>().x, 2.f * i);
+  }
+}
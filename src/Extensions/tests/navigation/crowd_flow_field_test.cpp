@@ -0,0 +1,55 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/extensions/navigation/crowd_flow_field.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+using namespace BABYLON::Extensions;
+
+TEST(TestCrowdFlowField, Directions_lead_around_obstacles)
+{
+  // Wall between x = 4 and x = 6 blocking the way to the goal
+  RVO2::RVOSimulator simulator;
+  simulator.addObstacle({RVO2::Vector2(6.f, 10.f), RVO2::Vector2(4.f, 10.f),
+                         RVO2::Vector2(4.f, -10.f), RVO2::Vector2(6.f, -10.f)});
+  simulator.processObstacles();
+
+  CrowdFlowField flowField(RVO2::Vector2(-20.f, -20.f), RVO2::Vector2(20.f, 20.f), 1.f);
+  ASSERT_TRUE(flowField.compute(simulator, RVO2::Vector2(15.f, 0.5f), 0.5f));
+  EXPECT_EQ(flowField.width(), 40);
+  EXPECT_EQ(flowField.height(), 40);
+
+  // The path goes around the wall
+  const RVO2::Vector2 start(-5.5f, 0.5f);
+  EXPECT_GT(flowField.getDistanceToGoal(start), 2.f * std::sqrt(10.f * 10.f + 10.f * 10.f));
+
+  // Following the directions from cell to cell reaches the cell of the goal without crossing the
+  // wall
+  auto position = start;
+  RVO2::Vector2 direction;
+  size_t steps  = 0;
+  while (flowField.getDirection(position, direction) && RVO2::absSq(direction) > 0.f
+         && steps < 100) {
+    position += RVO2::Vector2(std::round(direction.x()), std::round(direction.y()));
+    EXPECT_TRUE(position.x() < 4.f || position.x() > 6.f || std::fabs(position.y()) > 10.f);
+    ++steps;
+  }
+  EXPECT_LT(steps, 100);
+  EXPECT_EQ(position, RVO2::Vector2(15.5f, 0.5f));
+  EXPECT_TRUE(flowField.getDirection(position, direction));
+  EXPECT_EQ(direction, RVO2::Vector2());
+}
+
+TEST(TestCrowdFlowField, Goal_outside_of_the_grid)
+{
+  RVO2::RVOSimulator simulator;
+  CrowdFlowField flowField(RVO2::Vector2(0.f, 0.f), RVO2::Vector2(10.f, 10.f), 2.f);
+  EXPECT_FALSE(flowField.compute(simulator, RVO2::Vector2(15.f, 5.f), 0.5f));
+
+  RVO2::Vector2 direction;
+  EXPECT_FALSE(flowField.getDirection(RVO2::Vector2(5.f, 5.f), direction));
+  EXPECT_FALSE(flowField.getDirection(RVO2::Vector2(-1.f, 5.f), direction));
+  EXPECT_TRUE(std::isinf(flowField.getDistanceToGoal(RVO2::Vector2(5.f, 5.f))));
+}
@@ -0,0 +1,86 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <memory>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/navigation/rvo2/rvo_simulator.h>
+
+namespace {
+
+using namespace BABYLON::Extensions::RVO2;
+
+// Agents placed on a circle, large enough for the agent tree to be built in
+// parallel
+std::unique_ptr<RVOSimulator> CreateCircleScenario(size_t agentCount)
+{
+  auto simulator = std::make_unique<RVOSimulator>(0.25f, 15.f, 10, 10.f, 10.f, 1.5f, 2.f);
+  const float radius = 0.5f * static_cast<float>(agentCount);
+  for (size_t i = 0; i < agentCount; ++i) {
+    const float angle = 6.2831853f * static_cast<float>(i) / static_cast<float>(agentCount);
+    simulator->addAgent(Vector2(radius * std::cos(angle), radius * std::sin(angle)));
+  }
+  return simulator;
+}
+
+void SetPreferredVelocities(RVOSimulator& simulator)
+{
+  for (size_t i = 0; i < simulator.getNumAgents(); ++i) {
+    const auto toCenter = -simulator.getAgentPosition(i);
+    simulator.setAgentPrefVelocity(i, absSq(toCenter) > 1.f ? normalize(toCenter) : toCenter);
+  }
+}
+
+} // end of anonymous namespace
+
+TEST(TestRVOSimulator, Steps_do_not_depend_on_the_thread_count)
+{
+  BABYLON::ThreadPool sequentialPool(0);
+  BABYLON::ThreadPool parallelPool(3);
+
+  auto sequential = CreateCircleScenario(9000);
+  auto parallel   = CreateCircleScenario(9000);
+  sequential->setThreadPool(&sequentialPool);
+  parallel->setThreadPool(&parallelPool);
+  EXPECT_EQ(&parallel->getThreadPool(), &parallelPool);
+
+  for (int step = 0; step < 10; ++step) {
+    SetPreferredVelocities(*sequential);
+    SetPreferredVelocities(*parallel);
+    sequential->doStep();
+    parallel->doStep();
+  }
+
+  for (size_t i = 0; i < sequential->getNumAgents(); ++i) {
+    EXPECT_EQ(sequential->getAgentPosition(i), parallel->getAgentPosition(i));
+    EXPECT_EQ(sequential->getAgentVelocity(i), parallel->getAgentVelocity(i));
+  }
+  EXPECT_FLOAT_EQ(parallel->getGlobalTime(), 2.5f);
+}
+
+TEST(TestRVOSimulator, Agent_neighbors_are_sorted_by_distance)
+{
+  RVOSimulator simulator(0.25f, 10.f, 3, 10.f, 10.f, 0.5f, 2.f);
+  for (int i = 0; i < 100; ++i) {
+    simulator.addAgent(Vector2(static_cast<float>(i % 10), static_cast<float>(i / 10)));
+  }
+  simulator.doStep();
+
+  // Agent at (0, 0): its 3 nearest neighbors are (1, 0), (0, 1) and (1, 1)
+  ASSERT_EQ(simulator.getAgentNumAgentNeighbors(0), 3);
+  const auto farthest = simulator.getAgentAgentNeighbor(0, 2);
+  EXPECT_EQ(farthest, 11);
+  for (size_t i = 0; i < simulator.getNumAgents(); ++i) {
+    ASSERT_EQ(simulator.getAgentNumAgentNeighbors(i), 3);
+    float previousDistSq = 0.f;
+    for (size_t n = 0; n < 3; ++n) {
+      const auto neighbor = simulator.getAgentAgentNeighbor(i, n);
+      EXPECT_NE(neighbor, i);
+      const auto distSq
+        = absSq(simulator.getAgentPosition(i) - simulator.getAgentPosition(neighbor));
+      EXPECT_GE(distSq, previousDistSq);
+      previousDistSq = distSq;
+    }
+  }
+}
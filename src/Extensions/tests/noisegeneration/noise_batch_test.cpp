@@ -0,0 +1,126 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/noisegeneration/perlin_noise.h>
+#include <babylon/extensions/noisegeneration/simplex_noise.h>
+#include <babylon/maths/vector2.h>
+#include <babylon/maths/vector3.h>
+
+using namespace BABYLON;
+using namespace BABYLON::Extensions;
+
+namespace {
+
+// Points around the origin, including negative and integer coordinates
+std::vector<Vector3> CreatePoints(std::size_t count)
+{
+  std::vector<Vector3> points;
+  for (std::size_t i = 0; i < count; ++i) {
+    const auto t = static_cast<float>(i);
+    points.emplace_back(-20.f + 0.37f * t, 13.f - 0.21f * t, (i % 7 == 0) ? 2.f : 0.13f * t);
+  }
+  return points;
+}
+
+} // end of anonymous namespace
+
+TEST(TestNoiseGeneration, PerlinNoiseGrid)
+{
+  ThreadPool threadPool(3);
+  PerlinNoise perlinNoise(42);
+  PerlinNoiseOctave perlinNoiseOctave(5, 42);
+
+  // Width which is not a multiple of the number of lanes
+  const std::size_t width = 37, height = 29;
+  Float64Array values, octaveValues;
+  perlinNoise.noiseGrid(values, -3.5, 1.25, 0.75, 0.31, 0.17, width, height, 1, threadPool);
+  perlinNoiseOctave.noiseGrid(octaveValues, -3.5, 1.25, 0.75, 0.31, 0.17, width, height,
+                              threadPool);
+
+  ASSERT_EQ(values.size(), width * height);
+  ASSERT_EQ(octaveValues.size(), width * height);
+  for (std::size_t j = 0; j < height; ++j) {
+    for (std::size_t i = 0; i < width; ++i) {
+      const auto x = -3.5 + static_cast<double>(i) * 0.31;
+      const auto y = 1.25 + static_cast<double>(j) * 0.17;
+      EXPECT_DOUBLE_EQ(values[j * width + i], perlinNoise.noise(x, y, 0.75));
+      EXPECT_DOUBLE_EQ(octaveValues[j * width + i], perlinNoiseOctave.noise(x, y, 0.75));
+    }
+  }
+}
+
+TEST(TestNoiseGeneration, PerlinNoisePoints)
+{
+  ThreadPool threadPool(2);
+  PerlinNoiseOctave perlinNoiseOctave(3, 7);
+
+  Float64Array points;
+  for (const auto& point : CreatePoints(2500)) {
+    points.insert(points.end(), {point.x, point.y, point.z});
+  }
+  Float64Array values;
+  perlinNoiseOctave.noise(points, values, threadPool);
+
+  ASSERT_EQ(values.size(), 2500u);
+  for (std::size_t i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(values[i],
+                     perlinNoiseOctave.noise(points[3 * i], points[3 * i + 1], points[3 * i + 2]));
+  }
+}
+
+TEST(TestNoiseGeneration, SimplexNoiseGrid)
+{
+  ThreadPool threadPool(3);
+  SimplexNoise simplexNoise;
+
+  const std::size_t width = 45, height = 61;
+  const Vector2 origin(-7.3f, -2.1f), step(0.23f, 0.19f);
+  Float32Array noiseValues, fBmValues, ridgedValues;
+  simplexNoise.noiseGrid(noiseValues, origin, step, width, height, threadPool);
+  simplexNoise.fBmGrid(fBmValues, origin, step, width, height, 6, 1.9f, 0.45f, threadPool);
+  simplexNoise.ridgedMFGrid(ridgedValues, origin, step, width, height, 0.9f, 5, 2.1f, 0.5f,
+                            threadPool);
+
+  ASSERT_EQ(noiseValues.size(), width * height);
+  for (std::size_t j = 0; j < height; ++j) {
+    for (std::size_t i = 0; i < width; ++i) {
+      const Vector2 point(origin.x + static_cast<float>(i) * step.x,
+                          origin.y + static_cast<float>(j) * step.y);
+      const auto index = j * width + i;
+      EXPECT_FLOAT_EQ(noiseValues[index], simplexNoise.noise(point));
+      EXPECT_FLOAT_EQ(fBmValues[index], simplexNoise.fBm(point, 6, 1.9f, 0.45f));
+      EXPECT_FLOAT_EQ(ridgedValues[index], simplexNoise.ridgedMF(point, 0.9f, 5, 2.1f, 0.5f));
+    }
+  }
+}
+
+TEST(TestNoiseGeneration, SimplexNoisePoints)
+{
+  ThreadPool threadPool(2);
+  SimplexNoise simplexNoise;
+  simplexNoise.seed(11);
+
+  const auto points = CreatePoints(3001);
+  Float32Array noiseValues, fBmValues, ridgedValues;
+  simplexNoise.noise(points, noiseValues, threadPool);
+  simplexNoise.fBm(points, fBmValues, 4, 2.f, 0.5f, threadPool);
+  simplexNoise.ridgedMF(points, ridgedValues, 1.f, 4, 2.f, 0.5f, threadPool);
+
+  ASSERT_EQ(noiseValues.size(), points.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    EXPECT_FLOAT_EQ(noiseValues[i], simplexNoise.noise(points[i]));
+    EXPECT_FLOAT_EQ(fBmValues[i], simplexNoise.fBm(points[i]));
+    EXPECT_FLOAT_EQ(ridgedValues[i], simplexNoise.ridgedMF(points[i]));
+  }
+}
+
+TEST(TestNoiseGeneration, EmptyBatch)
+{
+  SimplexNoise simplexNoise;
+  Float32Array values{1.f};
+  simplexNoise.noiseGrid(values, Vector2(0.f, 0.f), Vector2(1.f, 1.f), 0, 4);
+  EXPECT_TRUE(values.empty());
+  simplexNoise.noise(std::vector<Vector3>{}, values);
+  EXPECT_TRUE(values.empty());
+}
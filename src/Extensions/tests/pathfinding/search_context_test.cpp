@@ -0,0 +1,123 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/core/random.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/pathfinding/jump_point_search.h>
+#include <babylon/extensions/pathfinding/rectangular_maze.h>
+
+using namespace BABYLON::Extensions;
+
+namespace {
+
+double PathCost(const GridMap& grid, const std::vector<GridMap::NodeId>& path)
+{
+  double cost = 0.0;
+  for (std::size_t i = 1; i < path.size(); ++i) {
+    cost += grid.cost(path[i - 1], grid(path[i]));
+  }
+  return cost;
+}
+
+// Grid with about 30% of blocked cells
+GridMap CreateRandomGrid(std::size_t width, std::size_t height, BABYLON::Math::PCG& pcg)
+{
+  GridMap grid(width, height);
+  for (std::size_t y = 0; y < height; ++y) {
+    for (std::size_t x = 0; x < width; ++x) {
+      grid.setWalkable(x, y, BABYLON::Math::distribution(pcg, std::size_t(0), std::size_t(9)) > 2);
+    }
+  }
+  return grid;
+}
+
+} // end of anonymous namespace
+
+TEST(TestPathFinding, ReusedSearchContext)
+{
+  using L = RectangularMaze::Location;
+
+  RectangularMaze maze(20, 20);
+  maze.generateMaze();
+  const auto expectedPath = maze.findPath();
+  const auto otherPath    = maze.findPath(L{19, 0}, L{0, 19});
+
+  // Searches sharing a context do not see the nodes of the previous searches
+  AStarSearchContext<std::size_t> context;
+  for (int i = 0; i < 3; ++i) {
+    const auto path = AStarSearch(maze, maze.cell(0), maze.cell(maze.size() - 1), context);
+    ASSERT_EQ(path.size(), expectedPath.size());
+    for (std::size_t j = 0; j < path.size(); ++j) {
+      EXPECT_EQ(maze.location(path[j]), expectedPath[j]);
+    }
+    const auto other = AStarSearch(maze, maze.cell(maze.cellId(L{19, 0})),
+                                   maze.cell(maze.cellId(L{0, 19})), context);
+    EXPECT_EQ(other.size(), otherPath.size());
+  }
+}
+
+TEST(TestPathFinding, BatchSearch)
+{
+  using L = RectangularMaze::Location;
+
+  BABYLON::ThreadPool threadPool(3);
+  RectangularMaze maze(30, 30);
+  maze.generateMaze();
+
+  std::vector<std::pair<L, L>> queries;
+  for (std::size_t i = 0; i < 100; ++i) {
+    queries.emplace_back(L{i % 30, (i * 7) % 30}, L{(i * 13) % 30, (i * 3) % 30});
+  }
+  const auto paths = maze.findPaths(queries, threadPool);
+
+  ASSERT_EQ(paths.size(), queries.size());
+  for (std::size_t i = 0; i < queries.size(); ++i) {
+    EXPECT_EQ(paths[i], maze.findPath(queries[i].first, queries[i].second));
+  }
+}
+
+TEST(TestPathFinding, JumpPointSearch)
+{
+  BABYLON::Math::PCG pcg;
+  for (int i = 0; i < 100; ++i) {
+    const auto grid  = CreateRandomGrid(40, 30, pcg);
+    const auto start = BABYLON::Math::distribution(pcg, std::size_t(0), grid.size() - 1);
+    const auto goal  = BABYLON::Math::distribution(pcg, std::size_t(0), grid.size() - 1);
+    if (start == goal || !grid._walkable[start] || !grid._walkable[goal]) {
+      continue;
+    }
+
+    // Same cost as the paths found by A*, cell by cell
+    AStarSearchContext<std::size_t> context;
+    const auto aStarPath = AStarSearch(grid, grid(start), grid(goal), context);
+    const auto jpsPath   = JumpPointSearch(grid, start, goal);
+    ASSERT_EQ(jpsPath.empty(), aStarPath.empty());
+    if (jpsPath.empty()) {
+      continue;
+    }
+    EXPECT_NEAR(PathCost(grid, jpsPath), PathCost(grid, aStarPath), 1e-9);
+    EXPECT_EQ(jpsPath.front(), start);
+    EXPECT_EQ(jpsPath.back(), goal);
+    for (std::size_t j = 1; j < jpsPath.size(); ++j) {
+      const auto neighbors = grid.neighbors(jpsPath[j - 1]);
+      EXPECT_TRUE(std::any_of(neighbors.begin(), neighbors.end(),
+                              [&](const GridNode& node) { return node.id == jpsPath[j]; }));
+    }
+  }
+}
+
+TEST(TestPathFinding, JumpPointSearchWithoutPath)
+{
+  // Wall splitting the grid in two
+  GridMap grid(10, 10);
+  for (std::size_t y = 0; y < 10; ++y) {
+    grid.setWalkable(5, y, false);
+  }
+  EXPECT_TRUE(JumpPointSearch(grid, grid.id(0, 0), grid.id(9, 9)).empty());
+
+  // Opening in the wall, crossed without cutting its corners
+  grid.setWalkable(5, 4, true);
+  EXPECT_EQ(JumpPointSearch(grid, grid.id(0, 0), grid.id(9, 9)).size(), 12);
+}
@@ -0,0 +1,174 @@
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include <cmath>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/extensions/recastjs/recastjs.h>
+
+#include "Recast.h"
+
+using BABYLON::Extensions::NavPath;
+using BABYLON::Extensions::Vec3;
+
+namespace {
+
+// NavMesh alone is ambiguous with the global forward declaration of recastjs.h
+using RecastNavMesh = BABYLON::Extensions::NavMesh;
+
+// Flat ground of size x size world units, in the winding order of the Babylon meshes
+void CreateGround(int size, std::vector<float>& positions, std::vector<int>& indices)
+{
+  for (int z = 0; z <= size; ++z) {
+    for (int x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x), 0.f, static_cast<float>(z)});
+    }
+  }
+  for (int z = 0; z < size; ++z) {
+    for (int x = 0; x < size; ++x) {
+      const int i = z * (size + 1) + x;
+      indices.insert(indices.end(), {i + 1, i + size + 1, i, i + size + 2, i + size + 1, i + 1});
+    }
+  }
+}
+
+rcConfig CreateConfig(int tileSize)
+{
+  rcConfig config{};
+  config.cs                     = 0.2f;
+  config.ch                     = 0.2f;
+  config.tileSize               = tileSize;
+  config.walkableSlopeAngle     = 35.f;
+  config.walkableHeight         = 1;
+  config.walkableClimb          = 1;
+  config.walkableRadius         = 1;
+  config.maxEdgeLen             = 12;
+  config.maxSimplificationError = 1.3f;
+  config.minRegionArea          = 8;
+  config.mergeRegionArea        = 20;
+  config.maxVertsPerPoly        = 6;
+  config.detailSampleDist       = 6.f;
+  config.detailSampleMaxError   = 1.f;
+  return config;
+}
+
+float PathLength(const NavPath& path)
+{
+  float length = 0.f;
+  for (size_t i = 1; i < path.mPoints.size(); ++i) {
+    const auto& a = path.mPoints[i - 1];
+    const auto& b = path.mPoints[i];
+    length += std::sqrt((b.x - a.x) * (b.x - a.x) + (b.z - a.z) * (b.z - a.z));
+  }
+  return length;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRecastJS, BuildTiled)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  CreateGround(40, positions, indices);
+
+  BABYLON::ThreadPool threadPool(3);
+  RecastNavMesh navMesh;
+  ASSERT_TRUE(navMesh.buildTiled(positions.data(), static_cast<int>(positions.size() / 3),
+                                 indices.data(), static_cast<int>(indices.size()),
+                                 CreateConfig(32), threadPool));
+
+  // Straight path across several tiles
+  const auto path = navMesh.computePath(Vec3(2.f, 0.f, 20.f), Vec3(38.f, 0.f, 20.f));
+  ASSERT_GE(path.mPoints.size(), 2u);
+  EXPECT_NEAR(path.mPoints.back().x, 38.f, 0.1f);
+  EXPECT_NEAR(PathLength(path), 36.f, 0.1f);
+  navMesh.destroy();
+}
+
+TEST(TestRecastJS, TemporaryObstacles)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  CreateGround(40, positions, indices);
+
+  RecastNavMesh navMesh;
+  ASSERT_TRUE(navMesh.buildTiled(positions.data(), static_cast<int>(positions.size() / 3),
+                                 indices.data(), static_cast<int>(indices.size()),
+                                 CreateConfig(32)));
+  const Vec3 start(2.f, 0.f, 20.f);
+  const Vec3 end(38.f, 0.f, 20.f);
+
+  // The path goes around the obstacle once the touched tiles are rebuilt
+  const auto obstacle = navMesh.addCylinderObstacle(Vec3(20.f, -1.f, 20.f), 4.f, 3.f);
+  ASSERT_NE(obstacle, 0u);
+  navMesh.update();
+  EXPECT_GT(PathLength(navMesh.computePath(start, end)), 36.5f);
+
+  navMesh.removeObstacle(obstacle);
+  navMesh.update();
+  EXPECT_NEAR(PathLength(navMesh.computePath(start, end)), 36.f, 0.1f);
+
+  // Detour rebuilds at most 8 tiles per obstacle
+  const auto box = navMesh.addBoxObstacle(Vec3(20.f, 0.f, 20.f), Vec3(1.f, 2.f, 5.f), 0.f);
+  ASSERT_NE(box, 0u);
+  navMesh.update();
+  EXPECT_GT(PathLength(navMesh.computePath(start, end)), 36.5f);
+  navMesh.destroy();
+}
+
+TEST(TestRecastJS, Serialization)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  CreateGround(40, positions, indices);
+  const Vec3 start(2.f, 0.f, 5.f);
+  const Vec3 end(38.f, 0.f, 35.f);
+
+  for (const int tileSize : {0, 32}) {
+    RecastNavMesh navMesh;
+    if (tileSize > 0) {
+      ASSERT_TRUE(navMesh.buildTiled(positions.data(), static_cast<int>(positions.size() / 3),
+                                     indices.data(), static_cast<int>(indices.size()),
+                                     CreateConfig(tileSize)));
+    }
+    else {
+      navMesh.build(positions.data(), static_cast<int>(positions.size() / 3), indices.data(),
+                    static_cast<int>(indices.size()), CreateConfig(tileSize));
+    }
+    const auto data = navMesh.getNavmeshData();
+    ASSERT_FALSE(data.empty());
+
+    RecastNavMesh loadedNavMesh;
+    ASSERT_TRUE(loadedNavMesh.buildFromNavmeshData(data));
+    EXPECT_EQ(loadedNavMesh.getNavmeshData(), data);
+    const auto path       = navMesh.computePath(start, end);
+    const auto loadedPath = loadedNavMesh.computePath(start, end);
+    ASSERT_EQ(loadedPath.mPoints.size(), path.mPoints.size());
+    EXPECT_FLOAT_EQ(PathLength(loadedPath), PathLength(path));
+
+    // Obstacles are supported once a tiled navigation mesh is loaded
+    EXPECT_EQ(loadedNavMesh.addCylinderObstacle(Vec3(20.f, 0.f, 20.f), 1.f, 2.f) != 0,
+              tileSize > 0);
+    navMesh.destroy();
+    loadedNavMesh.destroy();
+  }
+
+  RecastNavMesh navMesh;
+  EXPECT_FALSE(navMesh.buildFromNavmeshData({1, 2, 3}));
+}
+
+TEST(TestRecastJS, BuildTiledAsync)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  CreateGround(40, positions, indices);
+
+  BABYLON::ThreadPool threadPool(2);
+  RecastNavMesh navMesh;
+  auto built = navMesh.buildTiledAsync(std::move(positions), std::move(indices), CreateConfig(16),
+                                       threadPool);
+  ASSERT_TRUE(built.get());
+  EXPECT_NEAR(PathLength(navMesh.computePath(Vec3(2.f, 0.f, 20.f), Vec3(38.f, 0.f, 20.f))), 36.f,
+              0.1f);
+  navMesh.destroy();
+}
@@ -0,0 +1,109 @@
+#include <gtest/gtest.h>
+
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/extensions/recastjs/recastjs.h>
+#include <babylon/extensions/recastjs/recastjs_crowd.h>
+#include <babylon/extensions/recastjs/recastjs_plugin.h>
+#include <babylon/maths/vector3.h>
+#include <babylon/meshes/transform_node.h>
+#include <babylon/navigation/iagent_parameters.h>
+
+#include "Recast.h"
+
+namespace {
+
+// Serialized navigation mesh of a flat ground of size x size world units
+std::vector<uint8_t> CreateGroundNavmeshData(int size)
+{
+  std::vector<float> positions;
+  std::vector<int> indices;
+  for (int z = 0; z <= size; ++z) {
+    for (int x = 0; x <= size; ++x) {
+      positions.insert(positions.end(), {static_cast<float>(x), 0.f, static_cast<float>(z)});
+    }
+  }
+  for (int z = 0; z < size; ++z) {
+    for (int x = 0; x < size; ++x) {
+      const int i = z * (size + 1) + x;
+      indices.insert(indices.end(), {i + 1, i + size + 1, i, i + size + 2, i + size + 1, i + 1});
+    }
+  }
+
+  rcConfig config{};
+  config.cs                     = 0.2f;
+  config.ch                     = 0.2f;
+  config.walkableSlopeAngle     = 35.f;
+  config.walkableHeight         = 1;
+  config.walkableClimb          = 1;
+  config.walkableRadius         = 1;
+  config.maxEdgeLen             = 12;
+  config.maxSimplificationError = 1.3f;
+  config.minRegionArea          = 8;
+  config.mergeRegionArea        = 20;
+  config.maxVertsPerPoly        = 6;
+  config.detailSampleDist       = 6.f;
+  config.detailSampleMaxError   = 1.f;
+
+  BABYLON::Extensions::NavMesh navMesh;
+  navMesh.build(positions.data(), static_cast<int>(positions.size() / 3), indices.data(),
+                static_cast<int>(indices.size()), config);
+  auto data = navMesh.getNavmeshData();
+  navMesh.destroy();
+  return data;
+}
+
+} // end of anonymous namespace
+
+TEST(TestRecastJSCrowd, RebuildNavMesh)
+{
+  using namespace BABYLON;
+  using namespace BABYLON::Extensions;
+
+  const auto data = CreateGroundNavmeshData(20);
+  ASSERT_FALSE(data.empty());
+
+  NullEngineOptions options;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  auto engine                   = NullEngine::New(options);
+  auto scene                    = Scene::New(engine.get());
+
+  RecastJSPlugin plugin;
+  plugin.buildFromNavmeshData(data);
+  auto crowd = plugin.createCrowd(4, 0.5f, scene.get());
+
+  IAgentParameters parameters;
+  parameters.radius                = 0.5f;
+  parameters.height                = 1.f;
+  parameters.maxAcceleration       = 4.f;
+  parameters.maxSpeed              = 1.f;
+  parameters.collisionQueryRange   = 0.5f;
+  parameters.pathOptimizationRange = 0.f;
+  parameters.separationWeight      = 1.f;
+  for (const auto& position : {Vector3(5.f, 0.f, 5.f), Vector3(10.f, 0.f, 10.f),
+                               Vector3(15.f, 0.f, 15.f)}) {
+    crowd->addAgent(position, parameters, TransformNode::New("agent", scene.get()));
+  }
+  crowd->removeAgent(1);
+  const auto position0 = crowd->getAgentPosition(0);
+  const auto position2 = crowd->getAgentPosition(2);
+
+  // The crowd moves over to the new navigation mesh, its agents keeping their index and position
+  plugin.buildFromNavmeshData(data);
+  EXPECT_EQ(crowd->getAgents(), (std::vector<int>{0, 2}));
+  EXPECT_TRUE(crowd->getAgentPosition(0).equalsWithEpsilon(position0, 0.01f));
+  EXPECT_TRUE(crowd->getAgentPosition(2).equalsWithEpsilon(position2, 0.01f));
+
+  crowd->agentGoto(2, Vector3(15.f, 0.f, 5.f));
+  for (int step = 0; step < 10; ++step) {
+    crowd->update(0.1f);
+  }
+  EXPECT_LT(crowd->getAgentPosition(2).z, position2.z);
+
+  // The slot of the removed agent is free again
+  EXPECT_EQ(crowd->addAgent(Vector3(5.f, 0.f, 15.f), parameters,
+                            TransformNode::New("agent", scene.get())),
+            1);
+  crowd->dispose();
+}
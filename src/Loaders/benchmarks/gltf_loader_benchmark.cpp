@@ -0,0 +1,205 @@
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <cstring>
+#include <sstream>
+#include <thread>
+
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/glTF/gltf_file_loader.h>
+
+namespace {
+
+std::string EncodeBase64(const std::vector<uint8_t>& data)
+{
+  static const char* characters
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  std::string result;
+  result.reserve((data.size() + 2) / 3 * 4);
+  for (size_t index = 0; index < data.size(); index += 3) {
+    const auto remaining = data.size() - index;
+    const uint32_t bytes = (data[index] << 16u) | (remaining > 1 ? data[index + 1] << 8u : 0u)
+                           | (remaining > 2 ? data[index + 2] : 0u);
+    result += characters[(bytes >> 18u) & 63u];
+    result += characters[(bytes >> 12u) & 63u];
+    result += remaining > 1 ? characters[(bytes >> 6u) & 63u] : '=';
+    result += remaining > 2 ? characters[bytes & 63u] : '=';
+  }
+  return result;
+}
+
+template <typename T>
+void Append(std::vector<uint8_t>& buffer, const std::vector<T>& values)
+{
+  const auto offset = buffer.size();
+  buffer.resize(offset + values.size() * sizeof(T));
+  std::memcpy(buffer.data() + offset, values.data(), values.size() * sizeof(T));
+  // Buffer views are aligned on 4 bytes
+  buffer.resize((buffer.size() + 3) / 4 * 4);
+}
+
+// Uncompressed 32 bit TGA image with its origin at the top left
+std::vector<uint8_t> TGAImage(uint16_t width, uint16_t height)
+{
+  std::vector<uint8_t> image{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  image.insert(image.end(), {static_cast<uint8_t>(width & 0xff), static_cast<uint8_t>(width >> 8),
+                             static_cast<uint8_t>(height & 0xff),
+                             static_cast<uint8_t>(height >> 8), 32, 0x28});
+  image.resize(image.size() + width * height * 4u, 255);
+  return image;
+}
+
+/**
+ * @brief Returns a glTF asset of "meshCount" grids of "size" x "size" vertices, each one with its
+ * own accessors and, when "textureSize" is not 0, its own base color texture, the binary data
+ * being embedded in the json as a base64 buffer.
+ */
+std::string GLTFScene(unsigned int meshCount, unsigned int size, uint16_t textureSize = 0)
+{
+  // Grid geometry
+  std::vector<float> positions;
+  std::vector<float> normals;
+  std::vector<uint32_t> indices;
+  for (unsigned int row = 0; row < size; ++row) {
+    for (unsigned int col = 0; col < size; ++col) {
+      positions.insert(positions.end(), {static_cast<float>(col), 0.f, static_cast<float>(row)});
+      normals.insert(normals.end(), {0.f, 1.f, 0.f});
+    }
+  }
+  for (unsigned int row = 0; row + 1 < size; ++row) {
+    for (unsigned int col = 0; col + 1 < size; ++col) {
+      const auto topLeft    = row * size + col;
+      const auto bottomLeft = topLeft + size;
+      indices.insert(indices.end(), {bottomLeft + 1, bottomLeft, topLeft, //
+                                     topLeft + 1, bottomLeft + 1, topLeft});
+    }
+  }
+
+  std::vector<uint8_t> buffer;
+  std::ostringstream meshes, materials, textures, images, nodes, bufferViews, accessors,
+    sceneNodes;
+  const auto addBufferView = [&buffer, &bufferViews](const auto& values, unsigned int target) {
+    bufferViews << (buffer.empty() ? "" : ",") << "{\"buffer\":0,\"byteOffset\":" << buffer.size()
+                << ",\"byteLength\":" << values.size() * sizeof(values[0]);
+    if (target != 0) {
+      bufferViews << ",\"target\":" << target;
+    }
+    bufferViews << "}";
+    Append(buffer, values);
+  };
+  const auto image = textureSize > 0 ? TGAImage(textureSize, textureSize) : std::vector<uint8_t>();
+  for (unsigned int meshIndex = 0; meshIndex < meshCount; ++meshIndex) {
+    const auto separator = meshIndex > 0 ? "," : "";
+    const auto accessor  = meshIndex * 3;
+    addBufferView(positions, 34962);
+    addBufferView(normals, 34962);
+    addBufferView(indices, 34963);
+    accessors << separator << "{\"bufferView\":" << accessor
+              << ",\"componentType\":5126,\"count\":" << size * size
+              << ",\"type\":\"VEC3\",\"min\":[0,0,0],\"max\":[" << size - 1 << ",0," << size - 1
+              << "]},{\"bufferView\":" << accessor + 1
+              << ",\"componentType\":5126,\"count\":" << size * size
+              << ",\"type\":\"VEC3\"},{\"bufferView\":" << accessor + 2
+              << ",\"componentType\":5125,\"count\":" << indices.size()
+              << ",\"type\":\"SCALAR\"}";
+    meshes << separator << "{\"primitives\":[{\"attributes\":{\"POSITION\":" << accessor
+           << ",\"NORMAL\":" << accessor + 1 << "},\"indices\":" << accessor + 2;
+    if (textureSize > 0) {
+      textures << separator << "{\"source\":" << meshIndex << "}";
+      materials << separator << "{\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":"
+                << meshIndex << "}}}";
+      meshes << ",\"material\":" << meshIndex;
+    }
+    meshes << "}]}";
+    nodes << separator << "{\"mesh\":" << meshIndex << ",\"translation\":[" << meshIndex * size
+          << ",0,0]}";
+    sceneNodes << separator << meshIndex;
+  }
+  // The images follow the geometry of all the meshes in the buffer
+  for (unsigned int meshIndex = 0; textureSize > 0 && meshIndex < meshCount; ++meshIndex) {
+    addBufferView(image, 0);
+    images << (meshIndex > 0 ? "," : "") << "{\"bufferView\":" << meshCount * 3 + meshIndex
+           << "}";
+  }
+
+  std::ostringstream stream;
+  stream << "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":["
+         << sceneNodes.str() << "]}],\"nodes\":[" << nodes.str() << "],\"meshes\":["
+         << meshes.str() << "],";
+  if (textureSize > 0) {
+    stream << "\"materials\":[" << materials.str() << "],\"textures\":[" << textures.str()
+           << "],\"images\":[" << images.str() << "],";
+  }
+  stream << "\"accessors\":[" << accessors.str() << "],\"bufferViews\":["
+         << bufferViews.str() << "],\"buffers\":[{\"byteLength\":" << buffer.size()
+         << ",\"uri\":\"data:application/octet-stream;base64," << EncodeBase64(buffer)
+         << "\"}]}";
+  return stream.str();
+}
+
+void LoadGLTFFile(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto data = GLTFScene(static_cast<unsigned int>(state.range(0)), 64);
+  NullEngineOptions options;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  auto engine                   = NullEngine::New(options);
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto scene = Scene::New(engine.get());
+    GLTF2::GLTFFileLoader loader;
+    state.ResumeTiming();
+
+    // Parsing of the json data, decoding of the buffers and accessors and creation of the meshes
+    loader.loadAsync(scene.get(), data, "");
+
+    state.PauseTiming();
+    loader.dispose();
+    scene->dispose();
+    scene.reset();
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(LoadGLTFFile)->Arg(10)->Arg(50)->Unit(benchmark::kMillisecond);
+
+// Large asset of 200 meshes of 128 x 128 vertices with a 256 x 256 texture each, loaded
+// sequentially (0) or with the accessors and the images decoded on worker threads
+void LoadLargeGLTFFile(benchmark::State& state)
+{
+  using namespace BABYLON;
+
+  const auto data = GLTFScene(200, 128, 256);
+  NullEngineOptions options;
+  options.deterministicLockstep = false;
+  options.lockstepMaxSteps      = 1;
+  auto engine                   = NullEngine::New(options);
+  ThreadPool threadPool(static_cast<size_t>(state.range(0)));
+  for (auto _ : state) {
+    state.PauseTiming();
+    auto scene = Scene::New(engine.get());
+    GLTF2::GLTFFileLoader loader;
+    loader.threadPool = &threadPool;
+    state.ResumeTiming();
+
+    loader.loadAsync(scene.get(), data, "");
+
+    state.PauseTiming();
+    loader.dispose();
+    scene->dispose();
+    scene.reset();
+    state.ResumeTiming();
+  }
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(data.size()));
+}
+BENCHMARK(LoadLargeGLTFFile)
+  ->Arg(0)
+  ->Arg(static_cast<int64_t>(std::max(1u, std::thread::hardware_concurrency())))
+  ->Unit(benchmark::kMillisecond)
+  ->UseRealTime();
+
+} // end of anonymous namespace
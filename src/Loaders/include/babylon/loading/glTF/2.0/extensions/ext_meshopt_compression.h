@@ -0,0 +1,44 @@
+#ifndef BABYLON_LOADING_GLTF_2_0_EXTENSIONS_EXT_MESHOPT_COMPRESSION_H
+#define BABYLON_LOADING_GLTF_2_0_EXTENSIONS_EXT_MESHOPT_COMPRESSION_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/loading/glTF/2.0/gltf_loader_extension.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+class GLTFLoader;
+
+/**
+ * @brief Loader extension decoding the buffer views compressed with the meshoptimizer codecs.
+ * Buffer views are decoded from the threads of the loader, before the scene is built.
+ * @see https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Vendor/EXT_meshopt_compression
+ */
+class BABYLON_SHARED_EXPORT EXT_meshopt_compression : public IGLTFLoaderExtension {
+
+public:
+  static constexpr const char* NAME = "EXT_meshopt_compression";
+
+  EXT_meshopt_compression(GLTFLoader& loader);
+  ~EXT_meshopt_compression() override = default;
+
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+  /**
+   * @brief Decodes the buffer view when it is compressed.
+   * @param context The context when loading the asset
+   * @param bufferView The glTF buffer view property
+   * @returns The decoded data or an empty buffer if the buffer view is not compressed
+   */
+  ArrayBufferView loadBufferViewAsync(const std::string& context,
+                                      const IBufferView& bufferView) override;
+
+private:
+  GLTFLoader& _loader;
+
+}; // end of class EXT_meshopt_compression
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_GLTF_2_0_EXTENSIONS_EXT_MESHOPT_COMPRESSION_H
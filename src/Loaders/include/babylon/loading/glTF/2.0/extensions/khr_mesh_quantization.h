@@ -0,0 +1,33 @@
+#ifndef BABYLON_LOADING_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
+#define BABYLON_LOADING_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
+
+#include <babylon/babylon_api.h>
+#include <babylon/loading/glTF/2.0/gltf_loader_extension.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+class GLTFLoader;
+
+/**
+ * @brief Loader extension allowing vertex attributes stored as normalized or integer components.
+ * The loader binds such attributes with their component type, hence they stay compact in GPU
+ * memory, this extension only marks the support as available.
+ * @see https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Khronos/KHR_mesh_quantization
+ */
+class BABYLON_SHARED_EXPORT KHR_mesh_quantization : public IGLTFLoaderExtension {
+
+public:
+  static constexpr const char* NAME = "KHR_mesh_quantization";
+
+  KHR_mesh_quantization(GLTFLoader& loader);
+  ~KHR_mesh_quantization() override = default;
+
+  void dispose(bool doNotRecurse = false, bool disposeMaterialAndTextures = false) override;
+
+}; // end of class KHR_mesh_quantization
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
+
+#endif // end of BABYLON_LOADING_GLTF_2_0_EXTENSIONS_KHR_MESH_QUANTIZATION_H
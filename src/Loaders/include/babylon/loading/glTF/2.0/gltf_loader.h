@@ -2,6 +2,7 @@
 #define BABYLON_LOADING_GLTF_2_0_GLTF_LOADER_H
 
 #include <functional>
+#include <future>
 #include <memory>
 #include <unordered_map>
 
@@ -268,6 +269,14 @@ public:
                                   const AnimationGroupPtr& babylonAnimationGroup,
                                   const IAnimatablePtr& animationTargetOverride = nullptr);
 
+  /**
+   * @brief Loads a glTF buffer.
+   * @param context The context when loading the asset
+   * @param buffer The glTF buffer property
+   * @returns A promise that resolves with the loaded data when the load is complete
+   */
+  ArrayBufferView& loadBufferAsync(const std::string& context, IBuffer& buffer);
+
   /**
    * @brief Loads a glTF buffer view.
    * @param context The context when loading the asset
@@ -429,6 +438,8 @@ private:
   void _setupData();
   void _loadExtensions();
   void _checkExtensions();
+  void _startDecodingAsync(const std::vector<size_t>& nodes);
+  static void _WaitForDecoding(const std::shared_future<void>& decoding);
   void _setState(const GLTFLoaderState& state);
   INodePtr _createRootNode();
   void _forEachPrimitive(const INode& node,
@@ -463,14 +474,14 @@ private:
   void _loadAnimationsAsync();
   _IAnimationSamplerData _loadAnimationSamplerAsync(const std::string& context,
                                                     IAnimationSampler& sampler);
-  ArrayBufferView& _loadBufferAsync(const std::string& context, IBuffer& buffer);
   template <typename T>
   ArrayBufferView& _loadAccessorAsync(const std::string& context, IAccessor& accessor);
   Float32Array _loadFloatAccessorAsync(const std::string& context, IAccessor& accessor);
-  IndicesArray _getConverted32bitIndices(IAccessor& accessor);
   IndicesArray _castIndicesTo32bit(const IGLTF2::AccessorComponentType& type,
                                    const ArrayBufferView& buffer);
   IndicesArray _loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor);
+  void _decodeIndicesAccessor(const std::string& context, IAccessor& accessor);
+  static Float32Array _ToFloat32Storage(const ArrayBufferView& data);
   BufferPtr _loadVertexBufferViewAsync(IBufferView& bufferView, const std::string& kind);
   VertexBufferPtr& _loadVertexAccessorAsync(const std::string& context, IAccessor& accessor,
                                             const std::string& kind);
@@ -528,6 +539,8 @@ private:
                                                   const IAnimation& animation);
   std::optional<ArrayBufferView> _extensionsLoadUriAsync(const std::string& context,
                                                          const std::string& uri);
+  std::optional<ArrayBufferView> _extensionsLoadBufferViewAsync(const std::string& context,
+                                                                const IBufferView& bufferView);
 
 private:
   bool _disposed;
@@ -542,6 +555,8 @@ private:
   MeshPtr _rootBabylonMesh;
   std::unordered_map<unsigned int, MaterialPtr> _defaultBabylonMaterialData;
   std::function<void(const SceneLoaderProgressEvent& event)> _progressCallback;
+  // Accessor and image decoding tasks started by _startDecodingAsync
+  std::vector<std::shared_future<void>> _decodingTasks;
 
 }; // end of class GLTFLoader
 
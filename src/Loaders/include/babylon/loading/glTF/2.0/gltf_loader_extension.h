@@ -22,6 +22,7 @@ using TransformNodePtr = std::shared_ptr<TransformNode>;
 namespace GLTF2 {
 
 struct IAnimation;
+struct IBufferView;
 struct ICamera;
 struct IMaterial;
 struct IMesh;
@@ -173,6 +174,15 @@ struct BABYLON_SHARED_EXPORT IGLTFLoaderExtension : public IGLTFBaseLoaderExtens
    */
   virtual void _loadSkinAsync(const std::string& context, const INode& node, const ISkin& skin);
 
+  /**
+   * @brief Define this method to modify the default behavior when loading buffer views.
+   * @param context The context when loading the asset
+   * @param bufferView The glTF buffer view property
+   * @returns The loaded data or an empty buffer if not handled
+   */
+  virtual ArrayBufferView loadBufferViewAsync(const std::string& context,
+                                              const IBufferView& bufferView);
+
   /**
    * @brief Define this method to modify the default behavior when loading uris.
    * @param context The context when loading the asset
@@ -1,11 +1,13 @@
 #ifndef BABYLON_LOADING_GLTF_2_0_GLTF_LOADER_INTERFACES_H
 #define BABYLON_LOADING_GLTF_2_0_GLTF_LOADER_INTERFACES_H
 
+#include <future>
 #include <optional>
 
 #include <nlohmann/json.hpp>
 
 #include <babylon/core/array_buffer_view.h>
+#include <babylon/core/structs.h>
 #include <babylon/meshes/vertex_buffer.h>
 
 using json = nlohmann::json;
@@ -1368,9 +1370,18 @@ struct IAccessor : public IGLTF2::IAccessor, IArrayItem {
   /** @hidden */
   std::optional<ArrayBufferView> _data = std::nullopt;
 
+  /** @hidden Data of the accessor used as indices, converted to 32 bit */
+  std::optional<ArrayBufferView> _indicesData = std::nullopt;
+
   /** @hidden */
   VertexBufferPtr _babylonVertexBuffer = nullptr;
 
+  /** @hidden Decoding of _data running on the thread pool of the loader */
+  std::shared_future<void> _decoding;
+
+  /** @hidden Decoding of _indicesData running on the thread pool of the loader */
+  std::shared_future<void> _indicesDecoding;
+
   static IAccessor Parse(const json& parsedAccessor);
 
 }; // end of struct IAccessor
@@ -1452,6 +1463,12 @@ struct IImage : public IGLTF2::IImage, IArrayItem {
   /** @hidden */
   ArrayBufferView _data;
 
+  /** @hidden Pixels of _data, decoded on the thread pool of the loader */
+  std::optional<Image> _decodedImage = std::nullopt;
+
+  /** @hidden Decoding of _decodedImage */
+  std::shared_future<void> _decoding;
+
   static IImage Parse(const json& parsedImage);
 
 }; // end of struct IImage
@@ -1485,7 +1502,8 @@ struct IMaterialPbrMetallicRoughness : public IGLTF2::IMaterialPbrMetallicRoughn
 
 struct IMaterialData {
   MaterialPtr babylonMaterial = nullptr;
-  std::vector<AbstractMeshPtr> babylonMeshes;
+  // Weak references, so that the asset does not keep the disposed meshes alive
+  std::vector<std::weak_ptr<AbstractMesh>> babylonMeshes;
   std::function<void()> promise = nullptr;
 }; // end of struct IMaterialData
 
@@ -19,6 +19,7 @@ class BaseTexture;
 class Camera;
 struct ISceneLoaderPluginAsync;
 class Material;
+class ThreadPool;
 using AbstractMeshPtr            = std::shared_ptr<AbstractMesh>;
 using BaseTexturePtr             = std::shared_ptr<BaseTexture>;
 using CameraPtr                  = std::shared_ptr<Camera>;
@@ -337,6 +338,14 @@ public:
    */
   bool transparencyAsCoverage;
 
+  /**
+   * Thread pool decoding the accessors and the images of the asset while the
+   * scene is built on the calling thread. Defaults to nullptr, which uses
+   * ThreadPool::Default(). A pool without worker threads loads the asset
+   * sequentially.
+   */
+  ThreadPool* threadPool;
+
   /**
    * Function called before loading a url referenced by the asset.
    */
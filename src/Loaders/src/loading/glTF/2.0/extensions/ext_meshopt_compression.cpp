@@ -0,0 +1,62 @@
+#include <babylon/loading/glTF/2.0/extensions/ext_meshopt_compression.h>
+
+#include <babylon/core/json_util.h>
+#include <babylon/loading/glTF/2.0/gltf_loader.h>
+#include <babylon/meshes/compression/meshopt_compression.h>
+#include <babylon/misc/string_tools.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+EXT_meshopt_compression::EXT_meshopt_compression(GLTFLoader& loader) : _loader{loader}
+{
+  name    = EXT_meshopt_compression::NAME;
+  enabled = true;
+}
+
+void EXT_meshopt_compression::dispose(bool /*doNotRecurse*/,
+                                      bool /*disposeMaterialAndTextures*/)
+{
+}
+
+ArrayBufferView EXT_meshopt_compression::loadBufferViewAsync(const std::string& context,
+                                                             const IBufferView& bufferView)
+{
+  const auto it = bufferView.extensions.find(EXT_meshopt_compression::NAME);
+  if (it == bufferView.extensions.end()) {
+    return ArrayBufferView();
+  }
+
+  const auto& extension = it->second;
+  const auto extensionContext
+    = StringTools::printf("%s/extensions/%s", context.c_str(), EXT_meshopt_compression::NAME);
+  auto& buffer = ArrayItem::Get(StringTools::printf("%s/buffer", extensionContext.c_str()),
+                                _loader.gltf()->buffers,
+                                json_util::get_number<size_t>(extension, "buffer"));
+  const auto& data
+    = _loader.loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+
+  // The compressed data is decoded in place of the fallback buffer view data
+  const auto byteOffset = data.byteOffset + json_util::get_number<size_t>(extension, "byteOffset");
+  const auto byteLength = json_util::get_number<size_t>(extension, "byteLength");
+  const auto byteStride = json_util::get_number<size_t>(extension, "byteStride");
+  const auto count      = json_util::get_number<size_t>(extension, "count");
+  const auto mode       = json_util::get_string(extension, "mode");
+  const auto filter     = json_util::get_string(extension, "filter", "NONE");
+  const auto& bytes     = data.uint8Array();
+  if (byteOffset + byteLength > bytes.size()) {
+    throw std::runtime_error(
+      StringTools::printf("%s/byteLength: Value is out of range", extensionContext.c_str()));
+  }
+
+  try {
+    return MeshoptCompression::DecodeGltfBuffer(bytes.data() + byteOffset, byteLength, count,
+                                                byteStride, mode, filter);
+  }
+  catch (const std::exception& e) {
+    throw std::runtime_error(StringTools::printf("%s: %s", extensionContext.c_str(), e.what()));
+  }
+}
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
@@ -0,0 +1,17 @@
+#include <babylon/loading/glTF/2.0/extensions/khr_mesh_quantization.h>
+
+namespace BABYLON {
+namespace GLTF2 {
+
+KHR_mesh_quantization::KHR_mesh_quantization(GLTFLoader& /*loader*/)
+{
+  name    = KHR_mesh_quantization::NAME;
+  enabled = true;
+}
+
+void KHR_mesh_quantization::dispose(bool /*doNotRecurse*/, bool /*disposeMaterialAndTextures*/)
+{
+}
+
+} // end of namespace GLTF2
+} // end of namespace BABYLON
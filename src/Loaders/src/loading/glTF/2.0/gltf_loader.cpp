@@ -1,5 +1,9 @@
 #include <babylon/loading/glTF/2.0/gltf_loader.h>
 
+#include <array>
+#include <cstring>
+#include <mutex>
+
 #include <babylon/animations/animation_group.h>
 #include <babylon/animations/ianimatable.h>
 #include <babylon/animations/ianimation_key.h>
@@ -10,9 +14,12 @@
 #include <babylon/cameras/camera.h>
 #include <babylon/cameras/free_camera.h>
 #include <babylon/core/logging.h>
+#include <babylon/core/thread_pool.h>
 #include <babylon/core/time.h>
 #include <babylon/engines/engine.h>
 #include <babylon/engines/scene.h>
+#include <babylon/loading/glTF/2.0/extensions/ext_meshopt_compression.h>
+#include <babylon/loading/glTF/2.0/extensions/khr_mesh_quantization.h>
 #include <babylon/loading/glTF/2.0/gltf_loader_extension.h>
 #include <babylon/loading/glTF/gltf_file_loader.h>
 #include <babylon/materials/pbr/pbr_material.h>
@@ -71,9 +78,25 @@ GLTFLoader::GLTFLoader(GLTFFileLoader& parent)
     , _rootBabylonMesh{nullptr}
     , _progressCallback{nullptr}
 {
+  // Extensions shipped with the loader, registered once so that they can be unregistered
+  static std::once_flag registerExtensions;
+  std::call_once(registerExtensions, []() {
+    GLTFLoader::RegisterExtension(EXT_meshopt_compression::NAME, [](GLTFLoader& loader) {
+      return std::make_shared<EXT_meshopt_compression>(loader);
+    });
+    GLTFLoader::RegisterExtension(KHR_mesh_quantization::NAME, [](GLTFLoader& loader) {
+      return std::make_shared<KHR_mesh_quantization>(loader);
+    });
+  });
 }
 
-GLTFLoader::~GLTFLoader() = default;
+GLTFLoader::~GLTFLoader()
+{
+  // Decoding tasks still running reference the data of the asset
+  for (const auto& decoding : _decodingTasks) {
+    decoding.wait();
+  }
+}
 
 GLTFLoaderState& GLTFLoader::state()
 {
@@ -177,6 +200,13 @@ void GLTFLoader::_loadAsync(const std::vector<size_t>& nodes,
   _setState(GLTFLoaderState::LOADING);
   _extensionsOnLoading();
 
+  if (!nodes.empty()) {
+    _startDecodingAsync(nodes);
+  }
+  else if (_gltf->scene.has_value() || !_gltf->scenes.empty()) {
+    _startDecodingAsync(ArrayItem::Get("/scene", _gltf->scenes, _gltf->scene.value_or(0)).nodes);
+  }
+
   std::vector<std::function<void()>> promises;
 
   // Block the marking of materials dirty until the scene is loaded.
@@ -243,9 +273,9 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
   _setupData();
 
   if (data.bin.has_value()) {
-    const auto& buffers = _gltf->buffers;
-    if (!buffers.empty() && !buffers[0].uri.empty()) {
-      const auto& binaryBuffer = buffers[0];
+    auto& buffers = _gltf->buffers;
+    if (!buffers.empty() && buffers[0].uri.empty()) {
+      auto& binaryBuffer = buffers[0];
       if (binaryBuffer.byteLength < data.bin->byteLength() - 3
           || binaryBuffer.byteLength > data.bin->byteLength()) {
         BABYLON_LOGF_WARN("GLTFLoader",
@@ -254,7 +284,7 @@ void GLTFLoader::_loadData(const IGLTFLoaderData& data)
                           binaryBuffer.byteLength, data.bin->byteLength())
       }
 
-      // binaryBuffer._data = data.bin;
+      binaryBuffer._data = *data.bin;
     }
     else {
       BABYLON_LOG_WARN("GLTFLoader", "Unexpected BIN chunk")
@@ -325,6 +355,171 @@ void GLTFLoader::_checkExtensions()
   }
 }
 
+void GLTFLoader::_startDecodingAsync(const std::vector<size_t>& nodes)
+{
+  auto& threadPool = _parent.threadPool ? *_parent.threadPool : ThreadPool::Default();
+
+  // Buffers are read from their uris on the calling thread, then sliced into buffer views in
+  // parallel, compressed buffer views being decoded by their extension. Buffer views which cannot
+  // be loaded are left to the calling thread, which reports the error when they are used.
+  for (auto& buffer : _gltf->buffers) {
+    if (!buffer._data && !buffer.uri.empty()) {
+      loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+    }
+  }
+
+  auto& bufferViews = _gltf->bufferViews;
+  threadPool.parallelFor(0, bufferViews.size(), 1, [this, &bufferViews](size_t begin, size_t end) {
+    for (auto i = begin; i < end; ++i) {
+      auto& bufferView = bufferViews[i];
+      if (!bufferView.extensions.empty()
+          || (bufferView.buffer < _gltf->buffers.size()
+              && _gltf->buffers[bufferView.buffer]._data)) {
+        try {
+          loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index),
+                              bufferView);
+        }
+        catch (const std::exception& /*e*/) {
+        }
+      }
+    }
+  });
+
+  const auto hasBufferView = [&bufferViews](const std::optional<size_t>& index) -> bool {
+    return index.has_value() && *index < bufferViews.size() && bufferViews[*index]._data;
+  };
+
+  // Accessors used by the scene, in the order the scene consumes them so that the first meshes
+  // become visible while the next accessors are decoded. Vertex attributes are only decoded when
+  // they cannot be bound to their buffer view directly (see _loadVertexAccessorAsync). An accessor
+  // used both as indices and as floats is decoded once per kind, each kind having its own data.
+  enum class Decoding { Indices, Floats };
+  auto& accessors = _gltf->accessors;
+  std::vector<std::array<bool, 2>> requested(accessors.size(), {{false, false}});
+  std::vector<std::pair<size_t, Decoding>> decodingOrder;
+  const auto requestDecoding = [&](const std::optional<size_t>& index, Decoding decoding) -> void {
+    if (index.has_value() && *index < accessors.size()
+        && !requested[*index][static_cast<size_t>(decoding)]) {
+      requested[*index][static_cast<size_t>(decoding)] = true;
+      decodingOrder.emplace_back(*index, decoding);
+    }
+  };
+  const auto isBoundToBufferView = [&accessors](size_t index) -> bool {
+    if (index >= accessors.size()) {
+      return false;
+    }
+    const auto& accessor = accessors[index];
+    const auto byteLength
+      = VertexBuffer::GetTypeByteLength(static_cast<unsigned int>(accessor.componentType));
+    return !accessor.sparse && (!accessor.byteOffset || *accessor.byteOffset % byteLength == 0);
+  };
+
+  std::vector<bool> visitedNodes(_gltf->nodes.size(), false);
+  std::vector<size_t> pendingNodes(nodes.rbegin(), nodes.rend());
+  while (!pendingNodes.empty()) {
+    const auto nodeIndex = pendingNodes.back();
+    pendingNodes.pop_back();
+    if (nodeIndex >= visitedNodes.size() || visitedNodes[nodeIndex]) {
+      continue;
+    }
+    visitedNodes[nodeIndex] = true;
+
+    const auto& node = *_gltf->nodes[nodeIndex];
+    pendingNodes.insert(pendingNodes.end(), node.children.rbegin(), node.children.rend());
+    if (node.skin.has_value() && *node.skin < _gltf->skins.size()) {
+      requestDecoding(_gltf->skins[*node.skin].inverseBindMatrices, Decoding::Floats);
+    }
+    if (!node.mesh.has_value() || *node.mesh >= _gltf->meshes.size()) {
+      continue;
+    }
+    for (const auto& primitive : _gltf->meshes[*node.mesh].primitives) {
+      requestDecoding(primitive.indices, Decoding::Indices);
+      for (const auto& [attribute, index] : primitive.attributes) {
+        if (attribute == "JOINTS_0" || !isBoundToBufferView(index)) {
+          requestDecoding(index, Decoding::Floats);
+        }
+      }
+      for (const auto& target : primitive.targets) {
+        for (const auto& [attribute, index] : target) {
+          requestDecoding(index, Decoding::Floats);
+        }
+      }
+    }
+  }
+
+  for (const auto& animation : _gltf->animations) {
+    for (const auto& sampler : animation.samplers) {
+      requestDecoding(sampler.input, Decoding::Floats);
+      requestDecoding(sampler.output, Decoding::Floats);
+    }
+  }
+
+  for (const auto& [index, decoding] : decodingOrder) {
+    auto& accessor   = accessors[index];
+    const auto& data = decoding == Decoding::Indices ? accessor._indicesData : accessor._data;
+    if (data.has_value() || !hasBufferView(accessor.bufferView)
+        || (accessor.sparse
+            && (!hasBufferView(accessor.sparse->indices.bufferView)
+                || !hasBufferView(accessor.sparse->values.bufferView)))) {
+      continue;
+    }
+    const auto context = StringTools::printf("/accessors/%ld", accessor.index);
+    if (decoding == Decoding::Indices) {
+      accessor._indicesDecoding
+        = threadPool
+            .submit([this, &accessor, context]() -> void {
+              _decodeIndicesAccessor(context, accessor);
+            })
+            .share();
+      _decodingTasks.emplace_back(accessor._indicesDecoding);
+    }
+    else {
+      accessor._decoding
+        = threadPool
+            .submit([this, &accessor, context]() -> void {
+              _loadAccessorAsync<float>(context, accessor);
+            })
+            .share();
+      _decodingTasks.emplace_back(accessor._decoding);
+    }
+  }
+
+  // Images of the textures are read on the calling thread while the accessors are decoded, then
+  // decoded in parallel. Images which the textures load from their url are skipped.
+  const auto loadsFromUrl = [this](const IImage& image) -> bool {
+    return !image.uri.empty()
+           && (Tools::IsBase64(image.uri)
+               || !_babylonScene->getEngine()->textureFormatInUse().empty());
+  };
+  for (const auto& texture : _gltf->textures) {
+    if (texture.source >= _gltf->images.size()) {
+      continue;
+    }
+    auto& image = _gltf->images[texture.source];
+    if (image._decoding.valid() || loadsFromUrl(image)
+        || (image.uri.empty() && !hasBufferView(image.bufferView))) {
+      continue;
+    }
+    if (!loadImageAsync(StringTools::printf("/images/%ld", image.index), image)) {
+      continue;
+    }
+    image._decoding = threadPool
+                        .submit([&image]() -> void {
+                          image._decodedImage
+                            = FileTools::ArrayBufferToImage(image._data.uint8Array(), false);
+                        })
+                        .share();
+    _decodingTasks.emplace_back(image._decoding);
+  }
+}
+
+void GLTFLoader::_WaitForDecoding(const std::shared_future<void>& decoding)
+{
+  if (decoding.valid()) {
+    decoding.get();
+  }
+}
+
 void GLTFLoader::_setState(const GLTFLoaderState& iState)
 {
   _state = iState;
@@ -1368,7 +1563,7 @@ _IAnimationSamplerData GLTFLoader::_loadAnimationSamplerAsync(const std::string&
   return sampler._data.value();
 }
 
-ArrayBufferView& GLTFLoader::_loadBufferAsync(const std::string& context, IBuffer& buffer)
+ArrayBufferView& GLTFLoader::loadBufferAsync(const std::string& context, IBuffer& buffer)
 {
   if (buffer._data) {
     return buffer._data;
@@ -1390,9 +1585,15 @@ ArrayBufferView& GLTFLoader::loadBufferViewAsync(const std::string& context,
     return bufferView._data;
   }
 
+  auto extensionPromise = _extensionsLoadBufferViewAsync(context, bufferView);
+  if (extensionPromise) {
+    bufferView._data = std::move(*extensionPromise);
+    return bufferView._data;
+  }
+
   auto& buffer = ArrayItem::Get(StringTools::printf("%s/buffer", context.c_str()), _gltf->buffers,
                                 bufferView.buffer);
-  const auto data = _loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
+  const auto& data = loadBufferAsync(StringTools::printf("/buffers/%ld", buffer.index), buffer);
 
   // ASYNC_FIXME: We cannot treat the data right now, it will be otained later!
   try {
@@ -1426,25 +1627,24 @@ ArrayBufferView& GLTFLoader::_loadAccessorAsync(const std::string& context, IAcc
   else {
     auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
                                       _gltf->bufferViews, *accessor.bufferView);
-    auto data
+    const auto& data
       = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-    if (accessor.componentType == IGLTF2::AccessorComponentType::FLOAT && !accessor.normalized) {
-      data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data, accessor.byteOffset,
-                                        length);
+    const auto normalized = accessor.normalized.value_or(false);
+    if (accessor.componentType == IGLTF2::AccessorComponentType::FLOAT && !normalized
+        && (!bufferView.byteStride || *bufferView.byteStride == byteStride)) {
+      accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
+                                                  accessor.byteOffset, length);
     }
     else {
-      auto typedArray             = Float32Array(length);
-      const auto dataFloat32Array = data.float32Array();
+      // Strided, integer and normalized (quantized) data is converted to floats
+      auto typedArray = Float32Array(length);
       VertexBuffer::ForEach(
-        dataFloat32Array, accessor.byteOffset || 0, bufferView.byteStride || byteStride,
-        numComponents, static_cast<unsigned>(accessor.componentType), typedArray.size(),
-        accessor.normalized || false,
+        GLTFLoader::_ToFloat32Storage(data), data.byteOffset + accessor.byteOffset.value_or(0),
+        bufferView.byteStride.value_or(byteStride), numComponents,
+        static_cast<unsigned>(accessor.componentType), typedArray.size(), normalized,
         [&typedArray](float value, size_t index) -> void { typedArray[index] = value; });
-      data = typedArray;
+      accessor._data = std::move(typedArray);
     }
-
-    accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
-                                                accessor.byteOffset, length);
   }
 
   if (accessor.sparse) {
@@ -1489,6 +1689,7 @@ ArrayBufferView& GLTFLoader::_loadAccessorAsync(const std::string& context, IAcc
 
 Float32Array GLTFLoader::_loadFloatAccessorAsync(const std::string& context, IAccessor& accessor)
 {
+  GLTFLoader::_WaitForDecoding(accessor._decoding);
   return _loadAccessorAsync<float>(context, accessor).float32Array();
 }
 
@@ -1505,21 +1706,6 @@ IndicesArray GLTFLoader::_castIndicesTo32bit(const IGLTF2::AccessorComponentType
   }
 }
 
-IndicesArray GLTFLoader::_getConverted32bitIndices(IAccessor& accessor)
-{
-  switch (accessor.componentType) {
-    case IGLTF2::AccessorComponentType::UNSIGNED_BYTE:
-    case IGLTF2::AccessorComponentType::UNSIGNED_SHORT:
-      accessor._data
-        = ArrayBufferView(_castIndicesTo32bit(accessor.componentType, *accessor._data));
-      break;
-    default:
-      break;
-  }
-
-  return accessor._data->uint32Array();
-}
-
 IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, IAccessor& accessor)
 {
   if (accessor.type != IGLTF2::AccessorType::SCALAR) {
@@ -1533,18 +1719,40 @@ IndicesArray GLTFLoader::_loadIndicesAccessorAsync(const std::string& context, I
       StringTools::printf("%s/componentType: Invalid value", context.c_str()));
   }
 
-  if (accessor._data.has_value()) {
-    return _getConverted32bitIndices(accessor);
+  GLTFLoader::_WaitForDecoding(accessor._indicesDecoding);
+  if (!accessor._indicesData.has_value()) {
+    _decodeIndicesAccessor(context, accessor);
+  }
+
+  return accessor._indicesData->uint32Array();
+}
+
+void GLTFLoader::_decodeIndicesAccessor(const std::string& context, IAccessor& accessor)
+{
+  if (!accessor.bufferView.has_value()) {
+    throw std::runtime_error(
+      StringTools::printf("%s/bufferView: Value is missing", context.c_str()));
   }
 
   auto& bufferView = ArrayItem::Get(StringTools::printf("%s/bufferView", context.c_str()),
                                     _gltf->bufferViews, *accessor.bufferView);
-  const auto data
+  const auto& data
     = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-  accessor._data = GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
-                                              accessor.byteOffset, accessor.count);
+  accessor._indicesData = ArrayBufferView(_castIndicesTo32bit(
+    accessor.componentType, GLTFLoader::_GetTypedArray(context, accessor.componentType, data,
+                                                       accessor.byteOffset, accessor.count)));
+}
 
-  return _getConverted32bitIndices(accessor);
+Float32Array GLTFLoader::_ToFloat32Storage(const ArrayBufferView& data)
+{
+  // Raw bytes in float storage, padded to 4 bytes so that the trailing bytes of compact data are
+  // kept
+  const auto& bytes = data.uint8Array();
+  Float32Array storage((bytes.size() + 3) / 4, 0.f);
+  if (!bytes.empty()) {
+    std::memcpy(storage.data(), bytes.data(), bytes.size());
+  }
+  return storage;
 }
 
 BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
@@ -1554,10 +1762,11 @@ BufferPtr GLTFLoader::_loadVertexBufferViewAsync(IBufferView& bufferView,
     return bufferView._babylonBuffer;
   }
 
-  auto data
+  // Quantized attributes (KHR_mesh_quantization) keep their compact byte layout in the buffer
+  const auto& data
     = loadBufferViewAsync(StringTools::printf("/bufferViews/%ld", bufferView.index), bufferView);
-  bufferView._babylonBuffer
-    = std::make_shared<Buffer>(_babylonScene->getEngine(), data.float32Array(), false);
+  bufferView._babylonBuffer = std::make_shared<Buffer>(
+    _babylonScene->getEngine(), GLTFLoader::_ToFloat32Storage(data), false);
 
   return bufferView._babylonBuffer;
 }
@@ -1682,44 +1891,30 @@ MaterialPtr GLTFLoader::_loadMaterialAsync(
     return extensionPromise;
   }
 
-  std::optional<GLTF2::IMaterialData> babylonData = std::nullopt;
-  if (stl_util::contains(material._data, babylonDrawMode)) {
-    babylonData = material._data[babylonDrawMode];
-  }
-
-  if (!babylonData.has_value()) {
+  if (!stl_util::contains(material._data, babylonDrawMode)) {
     logOpen(StringTools::printf("%s %s", context.c_str(), material.name.c_str()));
 
     const auto babylonMaterial = createMaterial(context, material, babylonDrawMode);
     loadMaterialPropertiesAsync(context, material, babylonMaterial);
 
-    babylonData = GLTF2::IMaterialData{
+    material._data[babylonDrawMode] = GLTF2::IMaterialData{
       babylonMaterial, // babylonMaterial
       {},              // babylonMeshes
       nullptr          // promise
     };
 
-    material._data[babylonDrawMode] = *babylonData;
-
     GLTFLoader::AddPointerMetadata(babylonMaterial, context);
     _parent.onMaterialLoadedObservable.notifyObservers(babylonMaterial.get());
 
     logClose();
   }
 
-  babylonData->babylonMeshes.emplace_back(babylonMesh);
-
-  babylonMesh->onDisposeObservable.addOnce([&](Node*, EventState&) -> void {
-    auto it = std::find(babylonData->babylonMeshes.begin(), babylonData->babylonMeshes.end(),
-                        babylonMesh);
-    if (it != babylonData->babylonMeshes.end()) {
-      babylonData->babylonMeshes.erase(it);
-    }
-  });
+  auto& babylonData = material._data[babylonDrawMode];
+  babylonData.babylonMeshes.emplace_back(babylonMesh);
 
-  assign(babylonData->babylonMaterial);
+  assign(babylonData.babylonMaterial);
 
-  return babylonData->babylonMaterial;
+  return babylonData.babylonMaterial;
 }
 
 MaterialPtr GLTFLoader::_createDefaultMaterial(const std::string& name,
@@ -1976,12 +2171,19 @@ BaseTexturePtr GLTFLoader::_loadTextureAsync(
 
   if (url.empty()) {
     promises.emplace_back([this, &image, &babylonTexture]() -> void {
-      const auto data = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
-      const auto name = !image.uri.empty() ?
+      const auto& data = loadImageAsync(StringTools::printf("/images/%ld", image.index), image);
+      const auto name  = !image.uri.empty() ?
                           image.uri :
                           StringTools::printf("%s#image%ld", _fileName.c_str(), image.index);
       const auto dataUrl = StringTools::printf("data:%s%s", _uniqueRootUrl.c_str(), name.c_str());
-      babylonTexture->updateURL(dataUrl, data.uint8Array());
+      // Use the pixels decoded on the thread pool when available
+      GLTFLoader::_WaitForDecoding(image._decoding);
+      if (image._decodedImage && image._decodedImage->valid()) {
+        babylonTexture->updateURL(dataUrl, *image._decodedImage);
+      }
+      else {
+        babylonTexture->updateURL(dataUrl, data.uint8Array());
+      }
     });
   }
 
@@ -2390,6 +2592,25 @@ std::optional<ArrayBufferView> GLTFLoader::_extensionsLoadUriAsync(const std::st
   return std::nullopt;
 }
 
+std::optional<ArrayBufferView>
+GLTFLoader::_extensionsLoadBufferViewAsync(const std::string& context,
+                                           const IBufferView& bufferView)
+{
+  // Buffer views are loaded from the decoding threads, hence the extensions are only looked up
+  for (const auto& name : GLTFLoader::_ExtensionNames) {
+    const auto it = _extensions.find(name);
+    if (it == _extensions.end() || !it->second->enabled) {
+      continue;
+    }
+    auto data = it->second->loadBufferViewAsync(context, bufferView);
+    if (data) {
+      return data;
+    }
+  }
+
+  return std::nullopt;
+}
+
 void GLTFLoader::logOpen(const std::string& message)
 {
   _parent._logOpen(message);
@@ -85,6 +85,12 @@ void IGLTFLoaderExtension::_loadSkinAsync(const std::string& /*context*/, const
 {
 }
 
+ArrayBufferView IGLTFLoaderExtension::loadBufferViewAsync(const std::string& /*context*/,
+                                                          const IBufferView& /*bufferView*/)
+{
+  return ArrayBufferView();
+}
+
 ArrayBufferView IGLTFLoaderExtension::_loadUriAsync(const std::string& /*context*/,
                                                     const IProperty& /*property*/,
                                                     const std::string& /*uri*/)
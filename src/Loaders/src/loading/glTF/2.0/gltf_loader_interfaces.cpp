@@ -5,6 +5,20 @@
 namespace BABYLON {
 namespace GLTF2 {
 
+namespace {
+
+void ParseExtensions(const json& parsedProperty, IGLTF2::IProperty& property)
+{
+  if (json_util::has_valid_key_value(parsedProperty, "extensions")
+      && parsedProperty["extensions"].is_object()) {
+    for (const auto& item : parsedProperty["extensions"].items()) {
+      property.extensions[item.key()] = item.value();
+    }
+  }
+}
+
+} // end of anonymous namespace
+
 IAccessor IAccessor::Parse(const json& parsedAccessor)
 {
   IAccessor accessor;
@@ -227,6 +241,9 @@ IBuffer IBuffer::Parse(const json& parsedBuffer)
   // Byte length
   buffer.byteLength = json_util::get_number<size_t>(parsedBuffer, "byteLength");
 
+  // Extensions
+  ParseExtensions(parsedBuffer, buffer);
+
   return buffer;
 }
 
@@ -253,6 +270,9 @@ IBufferView IBufferView::Parse(const json& parsedBufferView)
       = json_util::get_number<size_t>(parsedBufferView, "byteStride");
   }
 
+  // Extensions
+  ParseExtensions(parsedBufferView, bufferView);
+
   return bufferView;
 }
 
@@ -735,6 +755,14 @@ std::unique_ptr<IGLTF> IGLTF::Parse(const json& parsedGLTFObject)
     glTFObject.cameras.emplace_back(ICamera::Parse(camera));
   }
 
+  // Extensions used
+  glTFObject.extensionsUsed
+    = json_util::get_array<std::string>(parsedGLTFObject, "extensionsUsed");
+
+  // Extensions required
+  glTFObject.extensionsRequired
+    = json_util::get_array<std::string>(parsedGLTFObject, "extensionsRequired");
+
   // Images
   for (const auto& image :
        json_util::get_array<json>(parsedGLTFObject, "images")) {
@@ -40,6 +40,7 @@ GLTFFileLoader::GLTFFileLoader()
     , useClipPlane{false}
     , compileShadowGenerators{false}
     , transparencyAsCoverage{false}
+    , threadPool{nullptr}
     , preprocessUrlAsync{nullptr}
     , onMeshLoaded{this, &GLTFFileLoader::set_onMeshLoaded}
     , onTextureLoaded{this, &GLTFFileLoader::set_onTextureLoaded}
@@ -0,0 +1,251 @@
+#include <gtest/gtest.h>
+
+#include <cstring>
+#include <sstream>
+
+#include <babylon/core/structs.h>
+#include <babylon/core/thread_pool.h>
+#include <babylon/engines/null_engine.h>
+#include <babylon/engines/scene.h>
+#include <babylon/loading/glTF/gltf_file_loader.h>
+#include <babylon/materials/textures/internal_texture.h>
+#include <babylon/meshes/abstract_mesh.h>
+#include <babylon/meshes/vertex_buffer.h>
+#include <babylon/misc/file_tools.h>
+
+namespace {
+
+template <typename T>
+size_t Append(std::vector<uint8_t>& buffer, const std::vector<T>& values)
+{
+  const auto offset = buffer.size();
+  buffer.resize(offset + values.size() * sizeof(T));
+  std::memcpy(buffer.data() + offset, values.data(), values.size() * sizeof(T));
+  // Buffer views are aligned on 4 bytes
+  buffer.resize((buffer.size() + 3) / 4 * 4);
+  return offset;
+}
+
+// Uncompressed 32 bit TGA image with its origin at the top left
+std::vector<uint8_t> TGAImage(uint16_t width, uint16_t height, uint8_t seed)
+{
+  std::vector<uint8_t> image{0, 0, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+  image.insert(image.end(), {static_cast<uint8_t>(width & 0xff), static_cast<uint8_t>(width >> 8),
+                             static_cast<uint8_t>(height & 0xff),
+                             static_cast<uint8_t>(height >> 8), 32, 0x28});
+  for (uint16_t i = 0; i < width * height; ++i) {
+    image.insert(image.end(), {static_cast<uint8_t>(seed + i), static_cast<uint8_t>(i * 3),
+                               static_cast<uint8_t>(255 - i), 255});
+  }
+  return image;
+}
+
+/**
+ * @brief Returns a glTF asset of "meshCount" wavy grids of "size" x "size" vertices, each one with
+ * its own accessors and its own texture, the buffer and the images being embedded in the json.
+ */
+std::string GLTFScene(unsigned int meshCount, unsigned int size)
+{
+  std::vector<uint8_t> buffer;
+  std::ostringstream meshes, materials, textures, images, nodes, bufferViews, accessors,
+    sceneNodes;
+  size_t bufferViewCount = 0;
+  const auto addBufferView = [&](const auto& values) {
+    const auto offset = Append(buffer, values);
+    bufferViews << (bufferViewCount > 0 ? "," : "") << "{\"buffer\":0,\"byteOffset\":" << offset
+                << ",\"byteLength\":" << values.size() * sizeof(values[0]) << "}";
+    return bufferViewCount++;
+  };
+
+  for (unsigned int meshIndex = 0; meshIndex < meshCount; ++meshIndex) {
+    std::vector<float> positions;
+    std::vector<float> normals;
+    std::vector<uint16_t> indices;
+    for (unsigned int row = 0; row < size; ++row) {
+      for (unsigned int col = 0; col < size; ++col) {
+        const auto x = static_cast<float>(col), z = static_cast<float>(row);
+        positions.insert(positions.end(), {x, std::sin(x * 0.3f + meshIndex) * 0.5f, z});
+        normals.insert(normals.end(), {0.f, 1.f, 0.f});
+      }
+    }
+    for (unsigned int row = 0; row + 1 < size; ++row) {
+      for (unsigned int col = 0; col + 1 < size; ++col) {
+        const auto topLeft    = static_cast<uint16_t>(row * size + col);
+        const auto bottomLeft = static_cast<uint16_t>(topLeft + size);
+        indices.insert(indices.end(),
+                       {static_cast<uint16_t>(bottomLeft + 1), bottomLeft, topLeft,
+                        static_cast<uint16_t>(topLeft + 1), static_cast<uint16_t>(bottomLeft + 1),
+                        topLeft});
+      }
+    }
+
+    const auto separator = meshIndex > 0 ? "," : "";
+    const auto accessor  = meshIndex * 3;
+    accessors << separator << "{\"bufferView\":" << addBufferView(positions)
+              << ",\"componentType\":5126,\"count\":" << size * size
+              << ",\"type\":\"VEC3\",\"min\":[0,-0.5,0],\"max\":[" << size - 1 << ",0.5,"
+              << size - 1 << "]},{\"bufferView\":" << addBufferView(normals)
+              << ",\"componentType\":5126,\"count\":" << size * size
+              << ",\"type\":\"VEC3\"},{\"bufferView\":" << addBufferView(indices)
+              << ",\"componentType\":5123,\"count\":" << indices.size()
+              << ",\"type\":\"SCALAR\"}";
+    images << separator << "{\"bufferView\":"
+           << addBufferView(TGAImage(4, 2, static_cast<uint8_t>(meshIndex))) << "}";
+    textures << separator << "{\"source\":" << meshIndex << "}";
+    materials << separator << "{\"pbrMetallicRoughness\":{\"baseColorTexture\":{\"index\":"
+              << meshIndex << "}}}";
+    meshes << separator << "{\"primitives\":[{\"attributes\":{\"POSITION\":" << accessor
+           << ",\"NORMAL\":" << accessor + 1 << "},\"indices\":" << accessor + 2
+           << ",\"material\":" << meshIndex << "}]}";
+    nodes << separator << "{\"name\":\"node" << meshIndex << "\",\"mesh\":" << meshIndex
+          << ",\"translation\":[" << meshIndex * size << ",0,0]}";
+    sceneNodes << separator << meshIndex;
+  }
+
+  std::string base64;
+  static const char* characters
+    = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+  for (size_t index = 0; index < buffer.size(); index += 3) {
+    const auto remaining = buffer.size() - index;
+    const uint32_t bytes = (buffer[index] << 16u)
+                           | (remaining > 1 ? buffer[index + 1] << 8u : 0u)
+                           | (remaining > 2 ? buffer[index + 2] : 0u);
+    base64 += characters[(bytes >> 18u) & 63u];
+    base64 += characters[(bytes >> 12u) & 63u];
+    base64 += remaining > 1 ? characters[(bytes >> 6u) & 63u] : '=';
+    base64 += remaining > 2 ? characters[bytes & 63u] : '=';
+  }
+
+  std::ostringstream stream;
+  stream << "{\"asset\":{\"version\":\"2.0\"},\"scene\":0,\"scenes\":[{\"nodes\":["
+         << sceneNodes.str() << "]}],\"nodes\":[" << nodes.str() << "],\"meshes\":["
+         << meshes.str() << "],\"materials\":[" << materials.str() << "],\"textures\":["
+         << textures.str() << "],\"images\":[" << images.str() << "],\"accessors\":["
+         << accessors.str() << "],\"bufferViews\":[" << bufferViews.str()
+         << "],\"buffers\":[{\"byteLength\":" << buffer.size()
+         << ",\"uri\":\"data:application/octet-stream;base64," << base64 << "\"}]}";
+  return stream.str();
+}
+
+/**
+ * @brief Null engine recording the pixels of the textures created from a buffer, the ones encoded
+ * in a file being decoded as the engine would do.
+ */
+class ImageRecordingEngine : public BABYLON::NullEngine {
+
+public:
+  static std::unique_ptr<ImageRecordingEngine> New()
+  {
+    BABYLON::NullEngineOptions options;
+    options.deterministicLockstep = false;
+    options.lockstepMaxSteps      = 1;
+    return std::unique_ptr<ImageRecordingEngine>(new ImageRecordingEngine(options));
+  }
+
+  BABYLON::InternalTexturePtr createTexture(
+    const std::string& urlArg, bool noMipmap, bool invertY, BABYLON::Scene* scene,
+    unsigned int samplingMode,
+    const std::function<void(BABYLON::InternalTexture*, BABYLON::EventState&)>& onLoad,
+    const std::function<void(const std::string& message, const std::string& exception)>& onError,
+    const std::optional<std::variant<std::string, BABYLON::ArrayBuffer, BABYLON::ArrayBufferView,
+                                     BABYLON::Image>>& buffer,
+    const BABYLON::InternalTexturePtr& fallBack, const std::optional<unsigned int>& format,
+    const std::string& forcedExtension,
+    const std::vector<BABYLON::IInternalTextureLoaderPtr>& excludeLoaders,
+    const std::string& mimeType) override
+  {
+    if (buffer.has_value() && std::holds_alternative<BABYLON::Image>(*buffer)) {
+      images.emplace_back(std::get<BABYLON::Image>(*buffer));
+    }
+    else if (buffer.has_value() && std::holds_alternative<BABYLON::ArrayBuffer>(*buffer)) {
+      images.emplace_back(
+        BABYLON::FileTools::ArrayBufferToImage(std::get<BABYLON::ArrayBuffer>(*buffer)));
+    }
+    return NullEngine::createTexture(urlArg, noMipmap, invertY, scene, samplingMode, onLoad,
+                                     onError, buffer, fallBack, format, forcedExtension,
+                                     excludeLoaders, mimeType);
+  }
+
+  std::vector<BABYLON::Image> images;
+
+protected:
+  explicit ImageRecordingEngine(const BABYLON::NullEngineOptions& options) : NullEngine(options)
+  {
+  }
+
+}; // end of class ImageRecordingEngine
+
+/**
+ * @brief Geometry of the meshes of a loaded scene, in the order of the nodes, and the pixels of its
+ * textures.
+ */
+struct LoadedScene {
+  std::vector<BABYLON::Float32Array> positions;
+  std::vector<BABYLON::Float32Array> normals;
+  std::vector<BABYLON::IndicesArray> indices;
+  std::vector<BABYLON::Image> images;
+};
+
+LoadedScene LoadScene(const std::string& data, BABYLON::ThreadPool& threadPool)
+{
+  using namespace BABYLON;
+
+  auto engine = ImageRecordingEngine::New();
+  auto scene  = Scene::New(engine.get());
+  GLTF2::GLTFFileLoader loader;
+  loader.threadPool = &threadPool;
+  loader.loadAsync(scene.get(), data, "");
+
+  LoadedScene loadedScene;
+  for (size_t nodeIndex = 0;; ++nodeIndex) {
+    const auto mesh = scene->getMeshByName("node" + std::to_string(nodeIndex));
+    if (!mesh) {
+      break;
+    }
+    loadedScene.positions.emplace_back(mesh->getVerticesData(VertexBuffer::PositionKind));
+    loadedScene.normals.emplace_back(mesh->getVerticesData(VertexBuffer::NormalKind));
+    loadedScene.indices.emplace_back(mesh->getIndices());
+  }
+  loadedScene.images = engine->images;
+
+  loader.dispose();
+  return loadedScene;
+}
+
+} // end of anonymous namespace
+
+TEST(TestGLTFLoader, ParallelDecodingMatchesSequentialLoading)
+{
+  using namespace BABYLON;
+
+  constexpr unsigned int meshCount = 8;
+  constexpr unsigned int size      = 16;
+  const auto data                  = GLTFScene(meshCount, size);
+
+  // The accessors and the images are decoded on the workers of the pool while the scene is built
+  ThreadPool sequentialPool(0);
+  ThreadPool parallelPool(3);
+  const auto expected = LoadScene(data, sequentialPool);
+  const auto actual   = LoadScene(data, parallelPool);
+
+  ASSERT_EQ(expected.positions.size(), meshCount);
+  ASSERT_EQ(actual.positions.size(), meshCount);
+  for (size_t meshIndex = 0; meshIndex < meshCount; ++meshIndex) {
+    EXPECT_EQ(expected.positions[meshIndex].size(), size * size * 3);
+    EXPECT_EQ(expected.indices[meshIndex].size(), (size - 1) * (size - 1) * 6);
+    EXPECT_EQ(actual.positions[meshIndex], expected.positions[meshIndex]);
+    EXPECT_EQ(actual.normals[meshIndex], expected.normals[meshIndex]);
+    EXPECT_EQ(actual.indices[meshIndex], expected.indices[meshIndex]);
+  }
+
+  ASSERT_EQ(expected.images.size(), meshCount);
+  ASSERT_EQ(actual.images.size(), meshCount);
+  for (size_t imageIndex = 0; imageIndex < meshCount; ++imageIndex) {
+    EXPECT_EQ(actual.images[imageIndex].width, 4);
+    EXPECT_EQ(actual.images[imageIndex].height, 2);
+    EXPECT_EQ(actual.images[imageIndex].data, expected.images[imageIndex].data);
+    // Blue channel of the first pixel, seeded by the index of the mesh
+    ASSERT_EQ(actual.images[imageIndex].data.size(), 4ull * 2 * 4);
+    EXPECT_EQ(actual.images[imageIndex].data[2], imageIndex);
+  }
+}